@@ -0,0 +1,470 @@
+//
+//  ProcessingBenchmarksMain.c
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+// Command-line driver for the portable benchmarks, the same runs and checks
+// BenchmarkRunner makes on a device. See the Makefile beside it.
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "FrameMailbox.h"
+#include "FrameQueue.h"
+#include "PreRollBuffer.h"
+#include "ProcessingBenchmarks.h"
+#include "Resampler.h"
+
+static int BenchmarkPassed(int passed) {
+    printf("%s ", passed ? "PASS" : "FAIL");
+    return passed ? 0 : 1;
+}
+
+static int RunFaceWarp(void) {
+    enum { kCounts = 3 };
+    const int faceCounts[kCounts] = {1, 3, 6};
+    int failures = 0;
+    for (int i = 0; i < kCounts; i++) {
+        ProcessingFaceWarpResult result = ProcessingBenchmarkFaceWarp(1280, 720, faceCounts[i], 60);
+        failures += BenchmarkPassed(result.maxReferenceError == 0 && result.warpedFraction > 0.0);
+        printf("FaceWarp 720p %d face(s): %.3f ms/frame, %.1f%% of pixels moved, max error vs per-pixel reference %d\n",
+               faceCounts[i], result.ms, result.warpedFraction * 100.0, result.maxReferenceError);
+    }
+    return failures;
+}
+
+static int RunBeautyRegion(void) {
+    enum { kCoverages = 6 };
+    const double coverages[kCoverages] = {0.0, 0.05, 0.15, 0.3, 0.6, 1.0};
+    int failures = 0;
+    for (int i = 0; i < kCoverages; i++) {
+        ProcessingBeautyResult result = ProcessingBenchmarkBeautyRegion(1280, 720, coverages[i], 20);
+        failures += BenchmarkPassed(result.maxRegionError == 0);
+        printf("Beauty 720p coverage %.0f%%: region %.3f ms/frame, full frame %.3f ms/frame, max difference %d\n",
+               result.coverage * 100.0, result.regionMs, result.fullFrameMs, result.maxRegionError);
+    }
+    return failures;
+}
+
+static int RunPyramid(void) {
+    const int frames = 60;
+    ProcessingPyramidResult result = ProcessingBenchmarkPyramid(1920, 1080, frames);
+    int failures = BenchmarkPassed(result.levelsMatch && result.levelsBuiltOnce);
+    printf("Pyramid 1080p, 4 consumers: shared %.3f ms/frame, independent %.3f ms/frame; %llu hits, %llu builds\n",
+           result.sharedMs, result.independentMs, (unsigned long long)result.levelHits, (unsigned long long)result.levelBuilds);
+    return failures;
+}
+
+static int RunMaskCache(void) {
+    // A still face is at most 0.1 px off its cached masks: a level or two on their soft edges.
+    const int staleTolerance = 2;
+    ProcessingMaskCacheResult result = ProcessingBenchmarkMaskCache(1280, 720, 0.5f, 300);
+    int failures = BenchmarkPassed(result.stillHitRate >= 0.9 && result.movingHitRate < result.stillHitRate &&
+                                   result.maxStaleError <= staleTolerance);
+    printf("Makeup mask cache 720p: hit rate still %.1f%%, moving %.1f%%; cached %.3f ms/frame, re-warp %.3f ms/frame; "
+           "stale mask off by %d\n",
+           result.stillHitRate * 100.0, result.movingHitRate * 100.0, result.cachedMs, result.uncachedMs, result.maxStaleError);
+    return failures;
+}
+
+static int RunDisplacementField(void) {
+    enum { kCounts = 3 };
+    const int faceCounts[kCounts] = {1, 3, 6};
+    int failures = 0;
+    for (int i = 0; i < kCounts; i++) {
+        ProcessingDisplacementResult result = ProcessingBenchmarkDisplacementField(1280, 720, faceCounts[i], 8, 30);
+        failures += BenchmarkPassed(result.maxErrorPx <= 0.5);
+        printf("Displacement field 720p %d face(s): max error %.3f px; per-pixel %.3f ms, build %.3f ms, remap %.3f ms\n",
+               faceCounts[i], result.maxErrorPx, result.directMs, result.buildMs, result.remapMs);
+    }
+    return failures;
+}
+
+static int RunNV12Convert(void) {
+    ProcessingNV12Result result = ProcessingBenchmarkNV12Convert(1920, 1080, 60);
+    int failures = BenchmarkPassed(result.maxError <= 2);
+    printf("RGBA -> NV12 1080p: fused %.3f ms, via RGBA intermediate %.3f ms, max error vs BT.709 reference %d\n",
+           result.fusedMs, result.twoPassMs, result.maxError);
+    return failures;
+}
+
+static int RunFrameQueue(void) {
+    // 60 fps producer against a writer that needs 25 ms per frame.
+    enum { kPolicies = 3 };
+    const int policies[kPolicies] = {FrameQueuePolicyBlock, FrameQueuePolicyDropNewest, FrameQueuePolicyDropNonCritical};
+    const char *names[kPolicies] = {"block", "drop newest", "drop non-critical"};
+    const double frameIntervalMs = 1000.0 / 60.0;
+    // A dropping push must not eat into the frame; a blocking one waits out the writer.
+    const double maxPushUs = frameIntervalMs * 1000.0 / 4.0;
+    int failures = 0;
+    for (int i = 0; i < kPolicies; i++) {
+        ProcessingFrameQueueResult result = ProcessingBenchmarkFrameQueue(policies[i], 8, 120, frameIntervalMs, 25.0);
+        int passed;
+        if (policies[i] == FrameQueuePolicyBlock) {
+            passed = result.dropped == 0 && result.written == 120;
+        } else if (policies[i] == FrameQueuePolicyDropNewest) {
+            passed = result.maxPushUs <= maxPushUs;
+        } else {
+            passed = result.maxPushUs <= maxPushUs && result.droppedCritical == 0;
+        }
+        failures += BenchmarkPassed(passed);
+        printf("Recorder queue (%s): push avg %.1f us, max %.1f us; written %llu, dropped %llu (%llu critical)\n",
+               names[i], result.averagePushUs, result.maxPushUs, (unsigned long long)result.written,
+               (unsigned long long)result.dropped, (unsigned long long)result.droppedCritical);
+    }
+    return failures;
+}
+
+static int RunPreRoll(void) {
+    // 3 s of 720p recording frames kept at half resolution.
+    enum { kFormats = 2 };
+    const int formats[kFormats] = {PreRollFormatRGBA, PreRollFormatNV12};
+    const char *names[kFormats] = {"raw", "NV12"};
+    const int tolerances[kFormats] = {0, 6};
+    int failures = 0;
+    for (int i = 0; i < kFormats; i++) {
+        ProcessingPreRollResult result = ProcessingBenchmarkPreRoll(1280, 720, 640, 360, formats[i], 3.0, 150);
+        failures += BenchmarkPassed(result.maxError <= tolerances[i]);
+        printf("Pre-roll %s 720p -> 360p: push %.3f ms, read back %.3f ms, %.1f MB for %u frames, round trip max error %d\n",
+               names[i], result.pushMs, result.readMs, (double)result.memoryBytes / (1024.0 * 1024.0), result.frames,
+               result.maxError);
+    }
+    return failures;
+}
+
+static int RunClockSync(void) {
+    // Two minutes of recording against audio clocks that start off and run fast or slow.
+    enum { kScenarios = 4 };
+    const double scenarios[kScenarios][2] = {{80.0, 500.0}, {-40.0, -300.0}, {0.0, 0.0}, {250.0, 1000.0}};
+    const double settledToleranceMs = 2.0;
+    const double driftTolerancePpm = 50.0;
+    int failures = 0;
+    for (int i = 0; i < kScenarios; i++) {
+        double offsetMs = scenarios[i][0];
+        double driftPpm = scenarios[i][1];
+        ProcessingClockSyncResult result = ProcessingBenchmarkClockSync(offsetMs, driftPpm, 120.0, 8.0, 20.0, 1.0);
+        // The offset is fitted at the end of the run, after two minutes of drift.
+        double expectedOffsetMs = offsetMs + driftPpm * 1.0e-6 * 120.0 * 1000.0;
+        failures += BenchmarkPassed(result.finalErrorMs <= settledToleranceMs &&
+                                    fabs(result.estimatedOffsetMs - expectedOffsetMs) <= settledToleranceMs &&
+                                    fabs(result.estimatedDriftPpm - driftPpm) <= driftTolerancePpm);
+        printf("A/V clock %+.0f ms %+.0f ppm: drift %+.1f ppm, offset %+.1f ms (expected %+.1f ms); error %.2f ms settled, %.2f ms worst\n",
+               offsetMs, driftPpm, result.estimatedDriftPpm, result.estimatedOffsetMs, expectedOffsetMs,
+               result.finalErrorMs, result.maxErrorMs);
+    }
+    return failures;
+}
+
+static int RunResampler(int cores) {
+    // Recording at a videoSize other than the camera's: 1080p down to 720p and 360p up to 720p.
+    enum { kKernels = 4, kSizes = 2 };
+    const int kernels[kKernels] = {ResamplerKernelBox, ResamplerKernelBilinear, ResamplerKernelBicubic, ResamplerKernelLanczos3};
+    const char *names[kKernels] = {"area", "bilinear", "bicubic", "lanczos3"};
+    const int sizes[kSizes][4] = {{1920, 1080, 1280, 720}, {640, 360, 1280, 720}};
+    const int bands = cores * 2;
+    int failures = 0;
+    for (int s = 0; s < kSizes; s++) {
+        for (int i = 0; i < kKernels; i++) {
+            ProcessingResampleResult result = ProcessingBenchmarkResample(kernels[i], sizes[s][0], sizes[s][1],
+                                                                          sizes[s][2], sizes[s][3], bands, 30);
+            failures += BenchmarkPassed(result.maxReferenceError <= 1 && result.parallelMatches && result.tableBuilds == 1);
+            printf("Resample %s %dx%d -> %dx%d: round trip %.2f dB, max error vs reference %d, %llu table build(s)\n",
+                   names[i], sizes[s][0], sizes[s][1], sizes[s][2], sizes[s][3], result.roundTripPsnr,
+                   result.maxReferenceError, (unsigned long long)result.tableBuilds);
+            printf("     RGBA %.3f ms serial, %.3f ms in %d bands; NV12 %.3f ms serial, %.3f ms in bands\n",
+                   result.serialMs, result.parallelMs, bands, result.nv12SerialMs, result.nv12ParallelMs);
+        }
+    }
+    return failures;
+}
+
+static int RunTiledPhoto(void) {
+    // 12 MP still (4032x3024), the size of a full-resolution capture.
+    enum { kTileSizes = 3 };
+    const int tileSizes[kTileSizes] = {256, 512, 1024};
+    int failures = 0;
+    for (int i = 0; i < kTileSizes; i++) {
+        ProcessingTiledPhotoResult result = ProcessingBenchmarkTiledPhoto(4032, 3024, tileSizes[i]);
+        failures += BenchmarkPassed(result.maxError == 0);
+        printf("Tiled photo 12 MP, %d px tiles: %.1f ms with %.2f MB (one pass %.1f ms, %.1f MB), max error vs one pass %d\n",
+               tileSizes[i], result.tiledMs, (double)result.workingBytes / (1024.0 * 1024.0), result.wholeMs,
+               (double)result.wholeBytes / (1024.0 * 1024.0), result.maxError);
+    }
+    return failures;
+}
+
+static int RunEncodedOutput(void) {
+    // 720p through the software reference encoder: a 30 fps camera, then a producer faster than the encoder.
+    enum { kPolicies = 3, kIntervals = 2 };
+    const int policies[kPolicies] = {FrameQueuePolicyBlock, FrameQueuePolicyDropNewest, FrameQueuePolicyDropNonCritical};
+    const char *names[kPolicies] = {"block", "drop newest", "drop non-critical"};
+    const double intervals[kIntervals] = {1000.0 / 30.0, 2.0};
+    int failures = 0;
+    for (int i = 0; i < kPolicies; i++) {
+        for (int j = 0; j < kIntervals; j++) {
+            ProcessingEncodedOutputResult result = ProcessingBenchmarkEncodedOutput(1280, 720, 90, intervals[j], 4, policies[i]);
+            failures += BenchmarkPassed(result.decodedExact);
+            printf("Encoded output (%s, frame every %.1f ms): %llu packets, %llu key frames, %.1fx smaller than NV12\n",
+                   names[i], intervals[j], (unsigned long long)result.packets, (unsigned long long)result.keyFrames,
+                   result.compressionRatio);
+            printf("     latency avg %.1f ms, max %.1f ms; encode %.1f ms; submit %.1f us; max queue depth %u, dropped %llu\n",
+                   result.averageLatencyMs, result.maxLatencyMs, result.averageEncodeMs, result.submitUs,
+                   result.maxQueueDepth, (unsigned long long)result.dropped);
+        }
+    }
+    return failures;
+}
+
+static int RunMultiResolution(void) {
+    // Full-size preview, a 720p stream and a 160p analytics thumbnail from one 1080p frame.
+    enum { kKernels = 4 };
+    const int widths[3] = {1920, 1280, 284};
+    const int heights[3] = {1080, 720, 160};
+    const int kernels[kKernels] = {ResamplerKernelBox, ResamplerKernelBilinear, ResamplerKernelBicubic, ResamplerKernelLanczos3};
+    const char *names[kKernels] = {"box", "bilinear", "bicubic", "lanczos3"};
+    int failures = 0;
+    for (int i = 0; i < kKernels; i++) {
+        ProcessingMultiResolutionResult result = ProcessingBenchmarkMultiResolution(kernels[i], 1920, 1080, widths, heights, 3, 30);
+        failures += BenchmarkPassed(result.minPsnr >= 40.0);
+        printf("Multi-resolution 1080p/720p/160p (%s): %.2f ms shared vs %.2f ms separate, %.1f dB vs separate resizes\n",
+               names[i], result.ladderMs, result.separateMs, result.minPsnr);
+    }
+    return failures;
+}
+
+static int RunFramePipeline(void) {
+    // Upload, face detection, render, readback and delivery: 25 ms end to end, 10 ms in the slowest stage.
+    const double stageMs[5] = {3.0, 6.0, 10.0, 4.0, 2.0};
+    const int frames = 120;
+    int failures = 0;
+    for (int depth = 1; depth <= 3; depth++) {
+        ProcessingFramePipelineResult saturated = ProcessingBenchmarkFramePipeline(depth, stageMs, 5, frames, 0.0);
+        ProcessingFramePipelineResult camera = ProcessingBenchmarkFramePipeline(depth, stageMs, 5, frames, 1000.0 / 60.0);
+        failures += BenchmarkPassed(saturated.ordered && saturated.completed == (uint64_t)frames && saturated.dropped == 0 &&
+                                    saturated.maxInFlight <= depth);
+        printf("Frame pipeline, %d in flight: %.1f fps max, latency avg %.1f ms, p95 %.1f ms, max %d in flight\n",
+               depth, saturated.throughputFps, saturated.averageLatencyMs, saturated.p95LatencyMs, saturated.maxInFlight);
+        failures += BenchmarkPassed(camera.ordered && camera.completed + camera.dropped == (uint64_t)frames &&
+                                    camera.maxInFlight <= depth);
+        printf("Frame pipeline, %d in flight, 60 fps camera: %.1f fps delivered, %llu dropped, latency avg %.1f ms\n",
+               depth, camera.throughputFps, (unsigned long long)camera.dropped, camera.averageLatencyMs);
+    }
+    return failures;
+}
+
+static int RunQualityGovernor(void) {
+    ProcessingQualityGovernorResult result = ProcessingBenchmarkQualityGovernor(30.0);
+    int failures = BenchmarkPassed(result.overBudgetGoverned < result.overBudgetUngoverned && result.finalLevel == 0 &&
+                                   result.boundaryChanges <= 4);
+    printf("Quality governor at 30 fps: %.1f%% of frames over budget (full quality %.1f%%), deepest level %d, "
+           "back to level %d, %llu changes at a step boundary\n",
+           result.overBudgetGoverned * 100.0, result.overBudgetUngoverned * 100.0, result.maxLevel, result.finalLevel,
+           (unsigned long long)result.boundaryChanges);
+    return failures;
+}
+
+static int RunFrameMailbox(void) {
+    // 60 fps camera against processing that needs 25 ms per frame.
+    enum { kCases = 3 };
+    const int policies[kCases] = {FrameMailboxPolicyFIFO, FrameMailboxPolicyFIFO, FrameMailboxPolicyLatest};
+    const size_t depths[kCases] = {120, 3, 1};
+    const char *names[kCases] = {"unbounded FIFO", "FIFO depth 3", "latest frame"};
+    const int frames = 120;
+    int failures = 0;
+    for (int i = 0; i < kCases; i++) {
+        ProcessingFrameMailboxResult result = ProcessingBenchmarkFrameMailbox(policies[i], depths[i], frames, 1000.0 / 60.0, 25.0);
+        failures += BenchmarkPassed(result.processed + result.dropped == (uint64_t)frames && result.maxDepth <= depths[i]);
+        printf("Async submission (%s): processed %llu, dropped %llu, max pending %u; latency avg %.1f ms, last frame %.1f ms\n",
+               names[i], (unsigned long long)result.processed, (unsigned long long)result.dropped, result.maxDepth,
+               result.averageLatencyMs, result.lastLatencyMs);
+    }
+    return failures;
+}
+
+static int RunSessionScaling(int cores) {
+    int maxSessions = cores < 8 ? cores : 8;
+    int failures = 0;
+    for (int sessions = 1; sessions <= maxSessions; sessions++) {
+        ProcessingSessionScalingResult result = ProcessingBenchmarkSessionScaling(sessions, 1280, 720, 30);
+        failures += BenchmarkPassed(result.outputsMatch && result.assetLoads == 1);
+        printf("Sessions 720p x%d: %.1f fps total, %.2f ms/frame per session, shared LUT loaded %llu time(s)\n",
+               sessions, result.framesPerSecond, result.averageFrameMs, (unsigned long long)result.assetLoads);
+    }
+    return failures;
+}
+
+static int RunScheduler(int cores) {
+    int maxWorkers = cores < 8 ? cores : 8;
+    int failures = 0;
+    for (int workers = 1; workers <= maxWorkers; workers++) {
+        ProcessingSchedulerScalingResult result = ProcessingBenchmarkSchedulerScaling(workers, 1920, 1080, 20);
+        failures += BenchmarkPassed(result.outputsMatch);
+        printf("Scheduler 1080p blur, %d worker(s): serial %.2f ms, parallel-for %.2f ms (%.2fx), %llu steals\n",
+               workers, result.serialMs, result.parallelMs,
+               result.parallelMs > 0.0 ? result.serialMs / result.parallelMs : 0.0, (unsigned long long)result.steals);
+    }
+
+    // Realtime tasks under a saturating background load, with and without lanes.
+    const char *names[2] = {"one queue", "priority lanes"};
+    double p99Ms[2];
+    for (int lanes = 0; lanes <= 1; lanes++) {
+        ProcessingSchedulerLatencyResult result = ProcessingBenchmarkSchedulerLatency(maxWorkers > 2 ? maxWorkers : 2, lanes, 300);
+        p99Ms[lanes] = result.p99Ms;
+        if (lanes == 1) {
+            failures += BenchmarkPassed(result.backgroundCompleted > 0 && p99Ms[1] < p99Ms[0]);
+        } else {
+            printf("     ");
+        }
+        printf("Scheduler realtime wait (%s): p50 %.2f ms, p99 %.2f ms, max %.2f ms; %llu background tasks done\n",
+               names[lanes], result.p50Ms, result.p99Ms, result.maxMs, (unsigned long long)result.backgroundCompleted);
+    }
+    return failures;
+}
+
+static int RunVideoFileInput(void) {
+    // 4 ms of simulated render per frame; the file is read in the meantime or not at all.
+    enum { kPrefetches = 2 };
+    const int prefetch[kPrefetches] = {1, 4};
+    const char *formats[2] = {"y4m", "raw I420"};
+    int failures = 0;
+    for (int raw = 0; raw <= 1; raw++) {
+        for (int i = 0; i < kPrefetches; i++) {
+            ProcessingVideoFileResult result = ProcessingBenchmarkVideoFileInput(raw, prefetch[i], 1920, 1080, 120, 4.0);
+            failures += BenchmarkPassed(result.timestampsExact && result.contentMatches);
+            printf("File input %s 1080p, prefetch %d: %llu frames, %.1f fps, %llu processing stalls, %llu reader stalls, max %u read ahead\n",
+                   formats[raw], prefetch[i], (unsigned long long)result.frames, result.framesPerSecond,
+                   (unsigned long long)result.consumerStalls, (unsigned long long)result.readerStalls, result.maxPrefetched);
+        }
+    }
+    return failures;
+}
+
+static int RunImageBatch(int cores) {
+    // 24 photos, a quarter of them 12 MP; 96 MB only fits one 12 MP image at a time.
+    enum { kCaps = 2 };
+    const size_t memoryCaps[kCaps] = {1024 * 1024 * 1024, 96 * 1024 * 1024};
+    int failures = 0;
+    for (int workers = 1; workers <= cores; workers *= 2) {
+        for (int i = 0; i < kCaps; i++) {
+            ProcessingImageBatchResult result = ProcessingBenchmarkImageBatch(workers, 24, memoryCaps[i]);
+            failures += BenchmarkPassed(result.failed == 0 && result.outputsMatch && result.peakLiveBytes <= result.peakBytes);
+            printf("Image batch %d worker(s), cap %zu MB: %.2f images/s, p95 %.0f ms, peak %.0f MB reserved, %.0f MB allocated\n",
+                   workers, memoryCaps[i] / (1024 * 1024), result.imagesPerSecond, result.p95LatencyMs,
+                   (double)result.peakBytes / (1024.0 * 1024.0), (double)result.peakLiveBytes / (1024.0 * 1024.0));
+        }
+    }
+    return failures;
+}
+
+static int RunSourceSwitch(void) {
+    ProcessingSourceSwitchResult result = ProcessingBenchmarkSourceSwitch(40);
+    int failures = BenchmarkPassed(result.strategiesCorrect && result.switches == 40);
+    printf("Source switch to first 720p frame: %.2f ms average, %.2f ms max, %llu switches\n",
+           result.averageSwitchMs, result.maxSwitchMs, (unsigned long long)result.switches);
+    return failures;
+}
+
+static int RunCatalogIndex(void) {
+    enum { kCounts = 2 };
+    const int packageCounts[kCounts] = {10, 1000};
+    int failures = 0;
+    for (int i = 0; i < kCounts; i++) {
+        ProcessingCatalogResult result = ProcessingBenchmarkCatalogIndex(packageCounts[i], 256 * 1024);
+        failures += BenchmarkPassed(result.changesDetected);
+        printf("Filter catalog %d packages: index load %.2f ms, revalidate %.2f ms, after 2 edits %.2f ms; full scan %.1f ms\n",
+               packageCounts[i], result.loadMs, result.revalidateMs, result.incrementalMs, result.fullScanMs);
+    }
+    return failures;
+}
+
+static int Selected(int argc, char **argv, const char *name) {
+    if (argc < 2) {
+        return 1;
+    }
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], name) == 0 || strcmp(argv[i], "all") == 0) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    long online = sysconf(_SC_NPROCESSORS_ONLN);
+    int cores = online > 0 ? (int)online : 1;
+    printf("Processing benchmarks, %d core(s)\n", cores);
+
+    int failures = 0;
+    if (Selected(argc, argv, "facewarp")) {
+        failures += RunFaceWarp();
+    }
+    if (Selected(argc, argv, "beauty")) {
+        failures += RunBeautyRegion();
+    }
+    if (Selected(argc, argv, "pyramid")) {
+        failures += RunPyramid();
+    }
+    if (Selected(argc, argv, "maskcache")) {
+        failures += RunMaskCache();
+    }
+    if (Selected(argc, argv, "displacement")) {
+        failures += RunDisplacementField();
+    }
+    if (Selected(argc, argv, "nv12")) {
+        failures += RunNV12Convert();
+    }
+    if (Selected(argc, argv, "queue")) {
+        failures += RunFrameQueue();
+    }
+    if (Selected(argc, argv, "preroll")) {
+        failures += RunPreRoll();
+    }
+    if (Selected(argc, argv, "clock")) {
+        failures += RunClockSync();
+    }
+    if (Selected(argc, argv, "resample")) {
+        failures += RunResampler(cores);
+    }
+    if (Selected(argc, argv, "tiled")) {
+        failures += RunTiledPhoto();
+    }
+    if (Selected(argc, argv, "encoded")) {
+        failures += RunEncodedOutput();
+    }
+    if (Selected(argc, argv, "ladder")) {
+        failures += RunMultiResolution();
+    }
+    if (Selected(argc, argv, "pipeline")) {
+        failures += RunFramePipeline();
+    }
+    if (Selected(argc, argv, "governor")) {
+        failures += RunQualityGovernor();
+    }
+    if (Selected(argc, argv, "mailbox")) {
+        failures += RunFrameMailbox();
+    }
+    if (Selected(argc, argv, "sessions")) {
+        failures += RunSessionScaling(cores);
+    }
+    if (Selected(argc, argv, "scheduler")) {
+        failures += RunScheduler(cores);
+    }
+    if (Selected(argc, argv, "videofile")) {
+        failures += RunVideoFileInput();
+    }
+    if (Selected(argc, argv, "batch")) {
+        failures += RunImageBatch(cores);
+    }
+    if (Selected(argc, argv, "switch")) {
+        failures += RunSourceSwitch();
+    }
+    if (Selected(argc, argv, "catalog")) {
+        failures += RunCatalogIndex();
+    }
+    printf("%d check(s) failed\n", failures);
+    return failures == 0 ? 0 : 1;
+}
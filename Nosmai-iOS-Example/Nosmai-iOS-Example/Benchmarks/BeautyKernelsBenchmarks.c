@@ -0,0 +1,80 @@
+//
+//  BeautyKernelsBenchmarks.c
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#include "BeautyKernelsBenchmarks.h"
+
+#if DEBUG
+
+#include <math.h>
+#include <stdlib.h>
+
+#include "BeautyKernels.h"
+#include "BenchmarkSupport.h"
+
+ProcessingBeautyResult ProcessingBenchmarkBeautyRegion(int width, int height, double coverage, int iterations) {
+    ProcessingBeautyResult result = {0.0, -1.0, -1.0, -1};
+    size_t frameBytes = (size_t)width * (size_t)height * 4;
+    uint8_t *src = BenchmarkAllocFrame(width, height, 4);
+    uint8_t *dst = malloc(frameBytes);
+    uint8_t *fullFrame = malloc(frameBytes);
+    if (!src || !dst || !fullFrame || iterations <= 0) {
+        free(src);
+        free(dst);
+        free(fullFrame);
+        return result;
+    }
+
+    // Padded region is 1.5x the face box on each axis (25% padding per side).
+    float scale = (float)sqrt(coverage > 0.0 ? coverage : 0.0) / 1.5f;
+    FaceRegionBox face = {
+        .width = (float)width * scale,
+        .height = (float)height * scale,
+    };
+    face.x = ((float)width - face.width) * 0.5f;
+    face.y = ((float)height - face.height) * 0.5f;
+    size_t faceCount = coverage > 0.0 ? 1 : 0;
+
+    BeautyParams params = {
+        .smoothing = 0.7f,
+        .whitening = 0.4f,
+        .lipstick = 0.6f,
+        .blusher = 0.5f,
+        .lipstickColor = {60, 40, 200, 255},
+        .blusherColor = {150, 120, 230, 255},
+    };
+    BeautyContext context;
+    BeautyContextInit(&context);
+    size_t stride = (size_t)width * 4;
+
+    double start = BenchmarkNowMs();
+    for (int i = 0; i < iterations; i++) {
+        BeautyApplyRGBA(&context, &params, &face, NULL, faceCount, src, stride, dst, stride, width, height);
+    }
+    result.regionMs = (BenchmarkNowMs() - start) / (double)iterations;
+    result.coverage = context.stats.processedArea;
+
+    start = BenchmarkNowMs();
+    for (int i = 0; i < iterations; i++) {
+        BeautyApplyFullFrameRGBA(&context, &params, &face, NULL, faceCount, src, stride, fullFrame, stride, width, height);
+    }
+    result.fullFrameMs = (BenchmarkNowMs() - start) / (double)iterations;
+
+    // Outside the regions the kernels have no weight, so both passes must agree everywhere.
+    result.maxRegionError = 0;
+    for (size_t i = 0; i < frameBytes; i++) {
+        int error = abs((int)dst[i] - (int)fullFrame[i]);
+        result.maxRegionError = error > result.maxRegionError ? error : result.maxRegionError;
+    }
+
+    BeautyContextFree(&context);
+    free(src);
+    free(dst);
+    free(fullFrame);
+    return result;
+}
+
+#endif /* DEBUG */
@@ -0,0 +1,39 @@
+//
+//  BeautyKernelsBenchmarks.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#ifndef BEAUTY_KERNELS_BENCHMARKS_H
+#define BEAUTY_KERNELS_BENCHMARKS_H
+
+#if DEBUG
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    double coverage;        // Measured fraction of the frame inside face regions
+    double regionMs;        // Face-region-limited beauty pass
+    double fullFrameMs;     // Same kernels over the whole frame
+    int maxRegionError;     // Largest channel difference between the two outputs
+} ProcessingBeautyResult;
+
+/**
+ * Smoothing + whitening + lipstick + blusher with one face sized so that its
+ * padded region covers roughly `coverage` of the frame (0 = no face).
+ */
+ProcessingBeautyResult ProcessingBenchmarkBeautyRegion(int width, int height, double coverage, int iterations);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DEBUG */
+
+#endif /* BEAUTY_KERNELS_BENCHMARKS_H */
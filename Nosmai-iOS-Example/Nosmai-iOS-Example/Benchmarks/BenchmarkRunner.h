@@ -0,0 +1,32 @@
+//
+//  BenchmarkRunner.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 18/10/2026.
+//
+
+#import <Foundation/Foundation.h>
+
+#if DEBUG
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Launch argument that makes the example app run the processing benchmarks
+extern NSString * const kRunBenchmarksLaunchArgument;
+
+/**
+ * Runs the debug-only processing benchmarks and logs the results.
+ * Enable by adding -NosmaiRunBenchmarks to the scheme's launch arguments.
+ */
+@interface BenchmarkRunner : NSObject
+
++ (BOOL)isRequestedByLaunchArguments;
+
+/// Runs every benchmark on a background queue and logs one line per result
++ (void)runAllInBackground;
+
+@end
+
+NS_ASSUME_NONNULL_END
+
+#endif /* DEBUG */
@@ -0,0 +1,548 @@
+//
+//  BenchmarkRunner.m
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 18/10/2026.
+//
+
+#import "BenchmarkRunner.h"
+
+#if DEBUG
+
+#import "FrameFanout.h"
+#import "SegmentedRecorder.h"
+#include "FrameMailbox.h"
+#include "FrameQueue.h"
+#include "PreRollBuffer.h"
+#include "ProcessingBenchmarks.h"
+#include "Resampler.h"
+
+NSString * const kRunBenchmarksLaunchArgument = @"-NosmaiRunBenchmarks";
+
+@implementation BenchmarkRunner
+
++ (BOOL)isRequestedByLaunchArguments {
+    return [[NSProcessInfo processInfo].arguments containsObject:kRunBenchmarksLaunchArgument];
+}
+
++ (void)runAllInBackground {
+    dispatch_async(dispatch_get_global_queue(QOS_CLASS_UTILITY, 0), ^{
+        NSLog(@"⏱️ Processing benchmarks started");
+        [self runFaceWarpBenchmarks];
+        [self runBeautyRegionBenchmarks];
+        [self runPyramidBenchmarks];
+        [self runMaskCacheBenchmarks];
+        [self runDisplacementFieldBenchmarks];
+        [self runNV12ConvertBenchmarks];
+        [self runFrameQueueStressTest];
+        [self runSegmentedRecordingCheck];
+        [self runPreRollBenchmarks];
+        [self runClockSyncChecks];
+        [self runResamplerBenchmarks];
+        [self runFrameFanoutCheck];
+        [self runTiledPhotoBenchmarks];
+        [self runEncodedOutputBenchmarks];
+        [self runMultiResolutionBenchmarks];
+        [self runFramePipelineBenchmarks];
+        [self runQualityGovernorCheck];
+        [self runFrameMailboxBenchmarks];
+        [self runSessionScalingBenchmarks];
+        [self runTaskSchedulerBenchmarks];
+        [self runVideoFileInputBenchmarks];
+        [self runImageBatchBenchmarks];
+        [self runSourceSwitchBenchmarks];
+        [self runCatalogIndexBenchmarks];
+        NSLog(@"⏱️ Processing benchmarks finished");
+    });
+}
+
++ (void)runFaceWarpBenchmarks {
+    const int faceCounts[] = {1, 3, 6};
+    double oneFaceMs = 0.0;
+    for (size_t i = 0; i < sizeof(faceCounts) / sizeof(faceCounts[0]); i++) {
+        ProcessingFaceWarpResult result = ProcessingBenchmarkFaceWarp(1280, 720, faceCounts[i], 60);
+        oneFaceMs = i == 0 ? result.ms : oneFaceMs;
+        NSLog(@"%@ FaceWarp 720p %d face(s): %.1f%% of pixels moved, max error vs per-pixel reference %d",
+              result.maxReferenceError == 0 && result.warpedFraction > 0.0 ? @"✅" : @"❌", faceCounts[i],
+              result.warpedFraction * 100.0, result.maxReferenceError);
+        NSLog(@"⏱️ FaceWarp 720p %d face(s): %.3f ms/frame (%.2fx of 1 face)",
+              faceCounts[i], result.ms, oneFaceMs > 0.0 ? result.ms / oneFaceMs : 0.0);
+    }
+}
+
++ (void)runBeautyRegionBenchmarks {
+    const double coverages[] = {0.0, 0.05, 0.15, 0.3, 0.6, 1.0};
+    for (size_t i = 0; i < sizeof(coverages) / sizeof(coverages[0]); i++) {
+        ProcessingBeautyResult result = ProcessingBenchmarkBeautyRegion(1280, 720, coverages[i], 20);
+        NSLog(@"%@ Beauty 720p coverage %.0f%%: region output matches full frame (max difference %d)",
+              result.maxRegionError == 0 ? @"✅" : @"❌", result.coverage * 100.0, result.maxRegionError);
+        NSLog(@"⏱️ Beauty 720p coverage %.0f%%: region %.3f ms/frame, full frame %.3f ms/frame",
+              result.coverage * 100.0, result.regionMs, result.fullFrameMs);
+    }
+}
+
++ (void)runPyramidBenchmarks {
+    const int frames = 60;
+    ProcessingPyramidResult result = ProcessingBenchmarkPyramid(1920, 1080, frames);
+    NSLog(@"%@ Pyramid 1080p: shared levels match own downscales, each level built at most once per frame",
+          result.levelsMatch && result.levelsBuiltOnce ? @"✅" : @"❌");
+    NSLog(@"⏱️ Pyramid 1080p, 4 consumers: shared %.3f ms/frame, independent %.3f ms/frame", result.sharedMs, result.independentMs);
+    NSLog(@"⏱️ Pyramid level hits %llu, builds %llu, %.1f MB saved per frame",
+          result.levelHits, result.levelBuilds, (double)result.bytesSaved / frames / (1024.0 * 1024.0));
+}
+
++ (void)runMaskCacheBenchmarks {
+    // A still face is at most 0.1 px off its cached masks: a level or two on their soft edges.
+    const int staleTolerance = 2;
+    ProcessingMaskCacheResult result = ProcessingBenchmarkMaskCache(1280, 720, 0.5f, 300);
+    NSLog(@"%@ Makeup mask cache: still face reuses its masks, moving face re-warps, stale mask off by %d",
+          result.stillHitRate >= 0.9 && result.movingHitRate < result.stillHitRate && result.maxStaleError <= staleTolerance
+              ? @"✅" : @"❌", result.maxStaleError);
+    NSLog(@"⏱️ Makeup mask cache 720p: hit rate still %.1f%%, moving %.1f%%",
+          result.stillHitRate * 100.0, result.movingHitRate * 100.0);
+    NSLog(@"⏱️ Makeup mask lookups: cached %.3f ms/frame, re-warp every frame %.3f ms/frame",
+          result.cachedMs, result.uncachedMs);
+}
+
++ (void)runDisplacementFieldBenchmarks {
+    // Field vs exact displacement must stay under half a pixel at the default cell size.
+    const double maxErrorTolerance = 0.5;
+    const int faceCounts[] = {1, 3, 6};
+    for (size_t i = 0; i < sizeof(faceCounts) / sizeof(faceCounts[0]); i++) {
+        ProcessingDisplacementResult result = ProcessingBenchmarkDisplacementField(1280, 720, faceCounts[i], 8, 30);
+        NSLog(@"%@ Displacement field 720p %d face(s): max error %.3f px, mean %.4f px, mean pixel diff %.3f",
+              result.maxErrorPx <= maxErrorTolerance ? @"✅" : @"❌", faceCounts[i],
+              result.maxErrorPx, result.meanErrorPx, result.meanPixelError);
+        NSLog(@"⏱️ Displacement field 720p %d face(s): per-pixel %.3f ms/frame, build %.3f ms, cached remap %.3f ms/frame (%.0f%% reuse)",
+              faceCounts[i], result.directMs, result.buildMs, result.remapMs, result.reuseRate * 100.0);
+    }
+}
+
++ (void)runNV12ConvertBenchmarks {
+    const int frames = 60;
+    const double frameBudgetMs = 1000.0 / 60.0;
+    ProcessingNV12Result result = ProcessingBenchmarkNV12Convert(1920, 1080, frames);
+    NSLog(@"%@ RGBA -> NV12 1080p max error vs BT.709 reference: %d", result.maxError <= 2 ? @"✅" : @"❌", result.maxError);
+    NSLog(@"⏱️ RGBA -> NV12 1080p fused: %.3f ms/frame (%.1f%% of 60 fps budget), %.1f MB touched",
+          result.fusedMs, result.fusedMs / frameBudgetMs * 100.0, (double)result.fusedBytes / (1024.0 * 1024.0));
+    NSLog(@"⏱️ RGBA -> NV12 1080p via RGBA intermediate: %.3f ms/frame, %.1f MB touched",
+          result.twoPassMs, (double)result.twoPassBytes / (1024.0 * 1024.0));
+}
+
++ (void)runFrameQueueStressTest {
+    // 60 fps producer against a writer that needs 25 ms per frame.
+    const int policies[] = {FrameQueuePolicyBlock, FrameQueuePolicyDropNewest, FrameQueuePolicyDropNonCritical};
+    NSArray<NSString *> *names = @[@"block", @"drop newest", @"drop non-critical"];
+    const double frameIntervalMs = 1000.0 / 60.0;
+    // A dropping push must not eat into the frame; a blocking one waits out the writer.
+    const double maxPushUs = frameIntervalMs * 1000.0 / 4.0;
+    for (size_t i = 0; i < sizeof(policies) / sizeof(policies[0]); i++) {
+        ProcessingFrameQueueResult result = ProcessingBenchmarkFrameQueue(policies[i], 8, 120, frameIntervalMs, 25.0);
+        BOOL passed;
+        if (policies[i] == FrameQueuePolicyBlock) {
+            passed = result.dropped == 0 && result.written == 120;
+        } else if (policies[i] == FrameQueuePolicyDropNewest) {
+            passed = result.maxPushUs <= maxPushUs;
+        } else {
+            passed = result.maxPushUs <= maxPushUs && result.droppedCritical == 0;
+        }
+        NSLog(@"%@ Recorder queue (%@): %@", passed ? @"✅" : @"❌", names[i],
+              policies[i] == FrameQueuePolicyBlock ? @"no frame lost"
+                                                    : [NSString stringWithFormat:@"push never blocked (limit %.0f us)%@", maxPushUs,
+                                                       policies[i] == FrameQueuePolicyDropNonCritical ? @", no critical frame dropped" : @""]);
+        NSLog(@"⏱️ Recorder queue (%@), slow writer: push avg %.1f us, max %.1f us; written %llu, dropped %llu (%llu critical)",
+              names[i], result.averagePushUs, result.maxPushUs, result.written, result.dropped, result.droppedCritical);
+        NSLog(@"⏱️ Recorder queue (%@): max depth %u, max encoder lag %.1f ms", names[i], result.maxDepth, result.maxLagMs);
+    }
+}
+
+// Feeds a solid 32BGRA frame at 30 fps in real time so the encoder sees a
+// live-camera cadence.
++ (void)feedRecorder:(SegmentedRecorder *)recorder
+              buffer:(CVPixelBufferRef)buffer
+              frames:(int)frames
+      startTimestamp:(double)startTimestamp {
+    for (int i = 0; i < frames; i++) {
+        [recorder appendPixelBuffer:buffer timestamp:startTimestamp + i / 30.0];
+        usleep(1000000 / 30);
+    }
+}
+
++ (void)runSegmentedRecordingCheck {
+    const CGSize size = CGSizeMake(1280, 720);
+    NSURL *directory = [[NSURL fileURLWithPath:NSTemporaryDirectory()] URLByAppendingPathComponent:@"SegmentedRecordingCheck"];
+    [[NSFileManager defaultManager] createDirectoryAtURL:directory withIntermediateDirectories:YES attributes:nil error:nil];
+
+    CVPixelBufferRef buffer = NULL;
+    CVPixelBufferCreate(kCFAllocatorDefault, (size_t)size.width, (size_t)size.height, kCVPixelFormatType_32BGRA,
+                        (__bridge CFDictionaryRef)@{(id)kCVPixelBufferIOSurfacePropertiesKey: @{}}, &buffer);
+    if (!buffer) return;
+    CVPixelBufferLockBaseAddress(buffer, 0);
+    memset(CVPixelBufferGetBaseAddress(buffer), 0x80, CVPixelBufferGetDataSize(buffer));
+    CVPixelBufferUnlockBaseAddress(buffer, 0);
+
+    // Cold start: what every start costs without a standby writer.
+    NV12VideoWriter *cold = [[NV12VideoWriter alloc] initWithVideoSize:size];
+    CFAbsoluteTime coldStart = CFAbsoluteTimeGetCurrent();
+    [cold startRecordingToURL:[directory URLByAppendingPathComponent:@"cold.mov"] completion:nil];
+    double coldMs = (CFAbsoluteTimeGetCurrent() - coldStart) * 1000.0;
+    [cold cancelRecording];
+
+    SegmentedRecorder *recorder = [[SegmentedRecorder alloc] initWithVideoSize:size outputDirectory:directory];
+    recorder.segmentDuration = 1.0;
+    recorder.backpressurePolicy = NV12VideoWriterBackpressureBlock;
+    [recorder prewarm];
+    for (int i = 0; i < 200 && !recorder.isStandbyReady; i++) {
+        usleep(10000);
+    }
+
+    // Two takes back to back: the second start must also find a standby.
+    for (int take = 0; take < 2; take++) {
+        if (![recorder startRecording]) {
+            NSLog(@"❌ Segmented recording take %d did not start", take + 1);
+            break;
+        }
+        [self feedRecorder:recorder buffer:buffer frames:105 startTimestamp:take * 10.0];
+
+        dispatch_semaphore_t finished = dispatch_semaphore_create(0);
+        __block NSArray<NSURL *> *segments = nil;
+        [recorder stopRecordingWithCompletion:^(NSArray<NSURL *> *urls, NSError *error) {
+            segments = urls;
+            dispatch_semaphore_signal(finished);
+        }];
+        dispatch_semaphore_wait(finished, dispatch_time(DISPATCH_TIME_NOW, 10 * NSEC_PER_SEC));
+
+        NSDictionary<NSString *, NSNumber *> *stats = recorder.statistics;
+        BOOL gapless = stats[@"boundaryGapFrames"].unsignedLongLongValue == 0 && stats[@"droppedFrames"].unsignedLongLongValue == 0;
+        NSLog(@"%@ Segmented recording take %d: %lu segment file(s), %@ rolls (%@ deferred), boundary gap %.1f ms, %@ frame(s) missing, %@ dropped",
+              gapless && segments.count >= 3 ? @"✅" : @"❌", take + 1, (unsigned long)segments.count,
+              stats[@"rolls"], stats[@"deferredRolls"], stats[@"maxBoundaryGapMs"].doubleValue,
+              stats[@"boundaryGapFrames"], stats[@"droppedFrames"]);
+        NSLog(@"⏱️ Segmented recording take %d start: ready %.3f ms, first frame queued %.3f ms (cold writer start %.1f ms)",
+              take + 1, stats[@"readyLatencyMs"].doubleValue, stats[@"firstFrameLatencyMs"].doubleValue, coldMs);
+
+        for (int i = 0; i < 200 && !recorder.isStandbyReady; i++) {
+            usleep(10000);
+        }
+    }
+
+    CVPixelBufferRelease(buffer);
+    recorder = nil;
+    [[NSFileManager defaultManager] removeItemAtURL:directory error:nil];
+}
+
++ (void)runPreRollBenchmarks {
+    // 3 s of 720p recording frames kept at half resolution.
+    const double frameBudgetMs = 1000.0 / 30.0;
+    const int formats[] = {PreRollFormatRGBA, PreRollFormatNV12};
+    NSArray<NSString *> *names = @[@"raw", @"NV12"];
+    const int tolerances[] = {0, 6};
+    for (size_t i = 0; i < sizeof(formats) / sizeof(formats[0]); i++) {
+        ProcessingPreRollResult result = ProcessingBenchmarkPreRoll(1280, 720, 640, 360, formats[i], 3.0, 150);
+        NSLog(@"%@ Pre-roll %@ round trip max error: %d", result.maxError <= tolerances[i] ? @"✅" : @"❌", names[i], result.maxError);
+        NSLog(@"⏱️ Pre-roll %@ 720p -> 360p: push %.3f ms/frame (%.1f%% of 30 fps budget), read back %.3f ms/frame",
+              names[i], result.pushMs, result.pushMs / frameBudgetMs * 100.0, result.readMs);
+        NSLog(@"⏱️ Pre-roll %@: %.1f MB for %u frames (%.2f s)",
+              names[i], (double)result.memoryBytes / (1024.0 * 1024.0), result.frames, result.bufferedSeconds);
+    }
+}
+
++ (void)runClockSyncChecks {
+    // Two minutes of recording against audio clocks that start off and run fast or slow.
+    const double scenarios[][2] = {{80.0, 500.0}, {-40.0, -300.0}, {0.0, 0.0}, {250.0, 1000.0}};
+    const double settledToleranceMs = 2.0;
+    const double driftTolerancePpm = 50.0;
+    for (size_t i = 0; i < sizeof(scenarios) / sizeof(scenarios[0]); i++) {
+        double offsetMs = scenarios[i][0];
+        double driftPpm = scenarios[i][1];
+        ProcessingClockSyncResult result = ProcessingBenchmarkClockSync(offsetMs, driftPpm, 120.0, 8.0, 20.0, 1.0);
+        // The offset is fitted at the end of the run, after two minutes of drift.
+        double expectedOffsetMs = offsetMs + driftPpm * 1.0e-6 * 120.0 * 1000.0;
+        BOOL passed = result.finalErrorMs <= settledToleranceMs &&
+                      fabs(result.estimatedOffsetMs - expectedOffsetMs) <= settledToleranceMs &&
+                      fabs(result.estimatedDriftPpm - driftPpm) <= driftTolerancePpm;
+        NSLog(@"%@ A/V clock %+.0f ms %+.0f ppm: estimated drift %+.1f ppm, offset %+.1f ms (expected %+.1f ms); error %.2f ms settled, %.2f ms worst (%.1f ms uncorrected)",
+              passed ? @"✅" : @"❌", offsetMs, driftPpm, result.estimatedDriftPpm, result.estimatedOffsetMs, expectedOffsetMs,
+              result.finalErrorMs, result.maxErrorMs, result.uncorrectedErrorMs);
+        NSLog(@"⏱️ A/V clock retime: %.2f us per audio buffer, largest correction step %.3f ms",
+              result.averageCallUs, result.maxStepMs);
+    }
+}
+
++ (void)runResamplerBenchmarks {
+    // Recording at a videoSize other than the camera's: 1080p down to 720p and 360p up to 720p.
+    const int kernels[] = {ResamplerKernelBox, ResamplerKernelBilinear, ResamplerKernelBicubic, ResamplerKernelLanczos3};
+    NSArray<NSString *> *names = @[@"area", @"bilinear", @"bicubic", @"lanczos3"];
+    const int sizes[][4] = {{1920, 1080, 1280, 720}, {640, 360, 1280, 720}};
+    const int bands = (int)[NSProcessInfo processInfo].activeProcessorCount * 2;
+    const double frameBudgetMs = 1000.0 / 30.0;
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        for (size_t i = 0; i < sizeof(kernels) / sizeof(kernels[0]); i++) {
+            ProcessingResampleResult result = ProcessingBenchmarkResample(kernels[i], sizes[s][0], sizes[s][1],
+                                                                          sizes[s][2], sizes[s][3], bands, 30);
+            BOOL passed = result.maxReferenceError <= 1 && result.parallelMatches && result.tableBuilds == 1;
+            NSLog(@"%@ Resample %@ %dx%d -> %dx%d: round trip %.2f dB, max error vs reference %d, parallel %@, %llu table build(s)",
+                  passed ? @"✅" : @"❌", names[i], sizes[s][0], sizes[s][1], sizes[s][2], sizes[s][3],
+                  result.roundTripPsnr, result.maxReferenceError, result.parallelMatches ? @"identical" : @"differs",
+                  result.tableBuilds);
+            NSLog(@"⏱️ Resample %@ RGBA: %.3f ms serial, %.3f ms in %d bands (%.1f%% of 30 fps budget); NV12: %.3f ms serial, %.3f ms in bands",
+                  names[i], result.serialMs, result.parallelMs, bands, result.parallelMs / frameBudgetMs * 100.0,
+                  result.nv12SerialMs, result.nv12ParallelMs);
+        }
+    }
+}
+
++ (void)runFrameFanoutCheck {
+    // Stream, record and analyse the same 720p frames; readback cost must not grow with consumers.
+    const CGSize size = CGSizeMake(1280, 720);
+    const int frames = 60;
+    CVPixelBufferRef buffer = NULL;
+    CVPixelBufferCreate(kCFAllocatorDefault, (size_t)size.width, (size_t)size.height, kCVPixelFormatType_32BGRA,
+                        (__bridge CFDictionaryRef)@{(id)kCVPixelBufferIOSurfacePropertiesKey: @{}}, &buffer);
+    if (!buffer) return;
+    CVPixelBufferLockBaseAddress(buffer, 0);
+    memset(CVPixelBufferGetBaseAddress(buffer), 0x80, CVPixelBufferGetDataSize(buffer));
+    CVPixelBufferUnlockBaseAddress(buffer, 0);
+
+    FrameFanout *fanout = [[FrameFanout alloc] init];
+    const unsigned long long frameBytes = CVPixelBufferGetBytesPerRow(buffer) * CVPixelBufferGetHeight(buffer);
+    __block volatile uint8_t sink = 0;
+    __block unsigned long long foreignBuffers = 0;  // Deliveries of anything but the frame itself, i.e. a copy
+    for (int consumers = 1; consumers <= 3; consumers++) {
+        [fanout addSinkNamed:[NSString stringWithFormat:@"consumer %d", consumers]
+                     handler:^(CVPixelBufferRef pixelBuffer, double timestamp) {
+            if (pixelBuffer != buffer) foreignBuffers++;
+            CVPixelBufferLockBaseAddress(pixelBuffer, kCVPixelBufferLock_ReadOnly);
+            sink ^= ((const uint8_t *)CVPixelBufferGetBaseAddress(pixelBuffer))[0];
+            CVPixelBufferUnlockBaseAddress(pixelBuffer, kCVPixelBufferLock_ReadOnly);
+        }];
+        NSDictionary<NSString *, NSNumber *> *before = fanout.statistics;
+        for (int i = 0; i < frames; i++) {
+            [fanout deliverPixelBuffer:buffer timestamp:i / 30.0];
+        }
+        NSDictionary<NSString *, NSNumber *> *stats = fanout.statistics;
+        unsigned long long readback = stats[@"readbackBytes"].unsignedLongLongValue - before[@"readbackBytes"].unsignedLongLongValue;
+        unsigned long long copied = stats[@"copiedBytes"].unsignedLongLongValue - before[@"copiedBytes"].unsignedLongLongValue;
+        unsigned long long deliveries = stats[@"deliveries"].unsignedLongLongValue - before[@"deliveries"].unsignedLongLongValue;
+        BOOL passed = readback == frameBytes * (unsigned long long)frames && copied == 0 && foreignBuffers == 0 &&
+                      deliveries == (unsigned long long)(frames * consumers);
+        NSLog(@"%@ Frame fan-out, %d consumer(s): %.1f MB read back per frame (separate readbacks: %.1f MB), %llu bytes copied, %llu deliveries",
+              passed ? @"✅" : @"❌", consumers, (double)readback / frames / (1024.0 * 1024.0),
+              (double)frameBytes * consumers / (1024.0 * 1024.0), copied, deliveries);
+        NSLog(@"⏱️ Frame fan-out, %d consumer(s): %.1f us average, %.1f us max per frame",
+              consumers, stats[@"averageFanoutUs"].doubleValue, stats[@"maxFanoutUs"].doubleValue);
+    }
+
+    dispatch_semaphore_t done = dispatch_semaphore_create(0);
+    __block CGSize photoSize = CGSizeZero;
+    unsigned long long copiedBefore = fanout.statistics[@"copiedBytes"].unsignedLongLongValue;
+    [fanout capturePhoto:^(UIImage *image, NSError *error) {
+        photoSize = image.size;
+        dispatch_semaphore_signal(done);
+    }];
+    [fanout deliverPixelBuffer:buffer timestamp:frames / 30.0];
+    dispatch_semaphore_wait(done, dispatch_time(DISPATCH_TIME_NOW, 5 * NSEC_PER_SEC));
+    // The photo is the one copy: the frame into its image.
+    unsigned long long photoCopied = fanout.statistics[@"copiedBytes"].unsignedLongLongValue - copiedBefore;
+    NSLog(@"%@ Frame fan-out photo from the shared frame: %.0fx%.0f, %llu bytes copied",
+          CGSizeEqualToSize(photoSize, size) && photoCopied >= frameBytes ? @"✅" : @"❌",
+          photoSize.width, photoSize.height, photoCopied);
+    CVPixelBufferRelease(buffer);
+}
+
++ (void)runTiledPhotoBenchmarks {
+    // 12 MP still (4032x3024), the size of a full-resolution capture.
+    const int tileSizes[] = {256, 512, 1024};
+    for (size_t i = 0; i < sizeof(tileSizes) / sizeof(tileSizes[0]); i++) {
+        ProcessingTiledPhotoResult result = ProcessingBenchmarkTiledPhoto(4032, 3024, tileSizes[i]);
+        NSLog(@"%@ Tiled photo 12 MP, %d px tiles: max error vs one pass %d, %llu tiles, %.3f px read per px written",
+              result.maxError == 0 ? @"✅" : @"❌", tileSizes[i], result.maxError, result.tiles, result.haloOverhead);
+        NSLog(@"⏱️ Tiled photo 12 MP, %d px tiles: %.1f ms with %.2f MB working memory (one pass: %.1f ms, %.1f MB)",
+              tileSizes[i], result.tiledMs, (double)result.workingBytes / (1024.0 * 1024.0),
+              result.wholeMs, (double)result.wholeBytes / (1024.0 * 1024.0));
+    }
+}
+
++ (void)runEncodedOutputBenchmarks {
+    // 720p through the software reference encoder: a 30 fps camera, then a
+    // producer faster than the encoder.
+    const int policies[] = {FrameQueuePolicyBlock, FrameQueuePolicyDropNewest, FrameQueuePolicyDropNonCritical};
+    NSArray<NSString *> *names = @[@"block", @"drop newest", @"drop non-critical"];
+    const double intervals[] = {1000.0 / 30.0, 2.0};
+    for (size_t i = 0; i < sizeof(policies) / sizeof(policies[0]); i++) {
+        for (size_t j = 0; j < sizeof(intervals) / sizeof(intervals[0]); j++) {
+            ProcessingEncodedOutputResult result = ProcessingBenchmarkEncodedOutput(1280, 720, 90, intervals[j], 4, policies[i]);
+            NSLog(@"%@ Encoded output (%@, frame every %.1f ms): %llu packets decode exactly, %llu key frames, %.1fx smaller than NV12",
+                  result.decodedExact ? @"✅" : @"❌", names[i], intervals[j], result.packets, result.keyFrames,
+                  result.compressionRatio);
+            NSLog(@"⏱️ Encoded output (%@, frame every %.1f ms): latency avg %.1f ms, max %.1f ms; encode %.1f ms; "
+                  @"submit %.1f us; max queue depth %u, dropped %llu",
+                  names[i], intervals[j], result.averageLatencyMs, result.maxLatencyMs, result.averageEncodeMs,
+                  result.submitUs, result.maxQueueDepth, result.dropped);
+        }
+    }
+}
+
++ (void)runMultiResolutionBenchmarks {
+    // Full-size preview, a 720p stream and a 160p analytics thumbnail from one 1080p frame.
+    const int widths[] = {1920, 1280, 284};
+    const int heights[] = {1080, 720, 160};
+    const ResamplerKernel kernels[] = {ResamplerKernelBox, ResamplerKernelBilinear, ResamplerKernelBicubic, ResamplerKernelLanczos3};
+    NSArray<NSString *> *names = @[@"box", @"bilinear", @"bicubic", @"lanczos3"];
+    for (size_t i = 0; i < sizeof(kernels) / sizeof(kernels[0]); i++) {
+        ProcessingMultiResolutionResult result = ProcessingBenchmarkMultiResolution(kernels[i], 1920, 1080, widths, heights, 3, 30);
+        NSLog(@"%@ Multi-resolution 1080p/720p/160p (%@): %.1f dB vs separate resizes, %.2f of the source pixels read, "
+              @"%.1f pyramid levels per frame",
+              result.minPsnr >= 40.0 ? @"✅" : @"❌", names[i], result.minPsnr, result.sourcePixelRatio,
+              result.levelBuildsPerFrame);
+        NSLog(@"⏱️ Multi-resolution 1080p/720p/160p (%@): %.2f ms shared chain vs %.2f ms separate (%.2fx)",
+              names[i], result.ladderMs, result.separateMs, result.separateMs / result.ladderMs);
+    }
+}
+
++ (void)runFramePipelineBenchmarks {
+    // Upload, face detection, render, readback and delivery: 25 ms end to end, 10 ms in the slowest stage.
+    const double stageMs[] = {3.0, 6.0, 10.0, 4.0, 2.0};
+    const int frames = 120;
+    for (int depth = 1; depth <= 3; depth++) {
+        ProcessingFramePipelineResult saturated = ProcessingBenchmarkFramePipeline(depth, stageMs, 5, frames, 0.0);
+        ProcessingFramePipelineResult camera = ProcessingBenchmarkFramePipeline(depth, stageMs, 5, frames, 1000.0 / 60.0);
+        BOOL passed = saturated.ordered && saturated.completed == (uint64_t)frames && saturated.dropped == 0 &&
+                      saturated.maxInFlight <= depth && camera.ordered &&
+                      camera.completed + camera.dropped == (uint64_t)frames && camera.maxInFlight <= depth;
+        NSLog(@"%@ Frame pipeline, %d in flight: frames in order, every frame completed or dropped, at most %d in flight",
+              passed ? @"✅" : @"❌", depth, MAX(saturated.maxInFlight, camera.maxInFlight));
+        NSLog(@"⏱️ Frame pipeline, %d in flight: %.1f fps max, latency avg %.1f ms, p95 %.1f ms",
+              depth, saturated.throughputFps, saturated.averageLatencyMs, saturated.p95LatencyMs);
+        NSLog(@"⏱️ Frame pipeline, %d in flight, 60 fps camera: %.1f fps delivered, %llu dropped, latency avg %.1f ms, p95 %.1f ms",
+              depth, camera.throughputFps, camera.dropped, camera.averageLatencyMs, camera.p95LatencyMs);
+    }
+}
+
++ (void)runQualityGovernorCheck {
+    ProcessingQualityGovernorResult result = ProcessingBenchmarkQualityGovernor(30.0);
+    BOOL passed = result.overBudgetGoverned < result.overBudgetUngoverned && result.finalLevel == 0 && result.boundaryChanges <= 4;
+    NSLog(@"%@ Quality governor, synthetic load at 30 fps: %.1f%% of frames over budget (full quality: %.1f%%), "
+          @"back to level %d after the load drops",
+          passed ? @"✅" : @"❌", result.overBudgetGoverned * 100.0, result.overBudgetUngoverned * 100.0, result.finalLevel);
+    NSLog(@"⏱️ Quality governor: %llu steps down, %llu up, %llu reverted, deepest level %d, %llu changes at a step boundary, "
+          @"recovered in %d frames",
+          result.stepDowns, result.stepUps, result.reverts, result.maxLevel, result.boundaryChanges, result.recoveryFrames);
+}
+
++ (void)runFrameMailboxBenchmarks {
+    // 60 fps camera against processing that needs 25 ms per frame, as in
+    // runFrameQueueStressTest. The deep FIFO stands for submitting every
+    // frame straight to processFrameAsync.
+    const int policies[] = {FrameMailboxPolicyFIFO, FrameMailboxPolicyFIFO, FrameMailboxPolicyLatest};
+    const size_t depths[] = {120, 3, 1};
+    NSArray<NSString *> *names = @[@"unbounded FIFO", @"FIFO depth 3", @"latest frame"];
+    const int frames = 120;
+    for (size_t i = 0; i < sizeof(policies) / sizeof(policies[0]); i++) {
+        ProcessingFrameMailboxResult result = ProcessingBenchmarkFrameMailbox(policies[i], depths[i], frames, 1000.0 / 60.0, 25.0);
+        NSLog(@"%@ Async submission (%@): every frame processed or dropped, never more than %zu pending",
+              result.processed + result.dropped == (uint64_t)frames && result.maxDepth <= depths[i] ? @"✅" : @"❌",
+              names[i], depths[i]);
+        NSLog(@"⏱️ Async submission (%@): processed %llu, dropped %llu, max pending %u",
+              names[i], result.processed, result.dropped, result.maxDepth);
+        NSLog(@"⏱️ Async submission (%@): latency avg %.1f ms, max %.1f ms, last frame %.1f ms",
+              names[i], result.averageLatencyMs, result.maxLatencyMs, result.lastLatencyMs);
+    }
+}
+
++ (void)runSessionScalingBenchmarks {
+    // One independent session per core, all sharing one LUT asset.
+    NSUInteger cores = MIN([NSProcessInfo processInfo].activeProcessorCount, (NSUInteger)8);
+    double singleFps = 0.0;
+    for (NSUInteger sessions = 1; sessions <= cores; sessions++) {
+        ProcessingSessionScalingResult result = ProcessingBenchmarkSessionScaling((int)sessions, 1280, 720, 30);
+        if (sessions == 1) {
+            singleFps = result.framesPerSecond;
+        }
+        NSLog(@"⏱️ Sessions 720p x%lu: %.1f fps total (%.2fx), %.2f ms/frame per session",
+              (unsigned long)sessions, result.framesPerSecond, singleFps > 0.0 ? result.framesPerSecond / singleFps : 0.0,
+              result.averageFrameMs);
+        NSLog(@"%@ Sessions x%lu: outputs identical to a single session, shared LUT loaded %llu time(s)",
+              result.outputsMatch && result.assetLoads == 1 ? @"✅" : @"❌", (unsigned long)sessions, result.assetLoads);
+    }
+}
+
++ (void)runTaskSchedulerBenchmarks {
+    NSUInteger cores = MIN([NSProcessInfo processInfo].activeProcessorCount, (NSUInteger)8);
+    for (NSUInteger workers = 1; workers <= cores; workers++) {
+        ProcessingSchedulerScalingResult result = ProcessingBenchmarkSchedulerScaling((int)workers, 1920, 1080, 20);
+        NSLog(@"⏱️ Scheduler 1080p blur, %lu worker(s): serial %.2f ms, parallel-for %.2f ms (%.2fx), %llu steals",
+              (unsigned long)workers, result.serialMs, result.parallelMs,
+              result.parallelMs > 0.0 ? result.serialMs / result.parallelMs : 0.0, result.steals);
+        NSLog(@"%@ Scheduler parallel-for output identical to serial", result.outputsMatch ? @"✅" : @"❌");
+    }
+
+    // Realtime tasks under a saturating background load, with and without lanes.
+    int workers = (int)MAX(cores, (NSUInteger)2);
+    NSArray<NSString *> *names = @[@"one queue", @"priority lanes"];
+    double p99Ms[2];
+    for (int lanes = 0; lanes <= 1; lanes++) {
+        ProcessingSchedulerLatencyResult result = ProcessingBenchmarkSchedulerLatency(workers, lanes, 300);
+        p99Ms[lanes] = result.p99Ms;
+        NSLog(@"⏱️ Scheduler realtime wait (%@): p50 %.2f ms, p99 %.2f ms, max %.2f ms; %llu background tasks done",
+              names[lanes], result.p50Ms, result.p99Ms, result.maxMs, result.backgroundCompleted);
+        if (lanes == 1) {
+            NSLog(@"%@ Scheduler priority lanes: realtime p99 below one queue's, background still progressing",
+                  result.backgroundCompleted > 0 && p99Ms[1] < p99Ms[0] ? @"✅" : @"❌");
+        }
+    }
+}
+
++ (void)runVideoFileInputBenchmarks {
+    // 4 ms of simulated render per frame; the file is read in the meantime or not at all.
+    const int prefetch[] = {1, 4};
+    NSArray<NSString *> *formats = @[@"y4m", @"raw I420"];
+    for (int raw = 0; raw <= 1; raw++) {
+        for (size_t i = 0; i < sizeof(prefetch) / sizeof(prefetch[0]); i++) {
+            ProcessingVideoFileResult result = ProcessingBenchmarkVideoFileInput(raw, prefetch[i], 1920, 1080, 120, 4.0);
+            NSLog(@"⏱️ File input %@ 1080p, prefetch %d: %.1f fps, %llu processing stalls, %llu reader stalls, max %u read ahead",
+                  formats[raw], prefetch[i], result.framesPerSecond, result.consumerStalls, result.readerStalls, result.maxPrefetched);
+            NSLog(@"%@ File input %@: %llu frames, exact timestamps, content in order",
+                  result.timestampsExact && result.contentMatches ? @"✅" : @"❌", formats[raw], result.frames);
+        }
+    }
+}
+
++ (void)runImageBatchBenchmarks {
+    // 24 photos, a quarter of them 12 MP; 96 MB only fits one 12 MP image at a time.
+    const size_t memoryCaps[] = {1024 * 1024 * 1024, 96 * 1024 * 1024};
+    int cores = (int)[NSProcessInfo processInfo].activeProcessorCount;
+    for (int workers = 1; workers <= cores; workers *= 2) {
+        for (size_t i = 0; i < sizeof(memoryCaps) / sizeof(memoryCaps[0]); i++) {
+            ProcessingImageBatchResult result = ProcessingBenchmarkImageBatch(workers, 24, memoryCaps[i]);
+            NSLog(@"⏱️ Image batch %d worker(s), cap %zu MB: %.2f images/s, p95 latency %.0f ms, %llu waits for memory",
+                  workers, memoryCaps[i] / (1024 * 1024), result.imagesPerSecond, result.p95LatencyMs, result.budgetWaits);
+            NSLog(@"%@ Image batch: peak %.0f MB reserved, %.0f MB allocated, %llu failed, outputs match serial",
+                  result.failed == 0 && result.outputsMatch && result.peakLiveBytes <= result.peakBytes ? @"✅" : @"❌",
+                  (double)result.peakBytes / (1024.0 * 1024.0), (double)result.peakLiveBytes / (1024.0 * 1024.0), result.failed);
+        }
+    }
+}
+
++ (void)runSourceSwitchBenchmarks {
+    ProcessingSourceSwitchResult result = ProcessingBenchmarkSourceSwitch(40);
+    NSLog(@"⏱️ Source switch to first 720p frame: %.2f ms average, %.2f ms max",
+          result.averageSwitchMs, result.maxSwitchMs);
+    NSLog(@"%@ Source arbiter: queue, priority, reject and auto-stop strategies, %llu switches completed",
+          result.strategiesCorrect && result.switches == 40 ? @"✅" : @"❌", result.switches);
+}
+
++ (void)runCatalogIndexBenchmarks {
+    const int packageCounts[] = {10, 1000};
+    for (size_t i = 0; i < sizeof(packageCounts) / sizeof(packageCounts[0]); i++) {
+        ProcessingCatalogResult result = ProcessingBenchmarkCatalogIndex(packageCounts[i], 256 * 1024);
+        NSLog(@"⏱️ Filter catalog %d packages: index load %.2f ms (%zu bytes), revalidate %.2f ms, after 2 edits %.2f ms; reading every package %.1f ms",
+              packageCounts[i], result.loadMs, result.indexBytes, result.revalidateMs, result.incrementalMs, result.fullScanMs);
+        NSLog(@"%@ Filter catalog %d packages: touched package kept, rewritten package stale",
+              result.changesDetected ? @"✅" : @"❌", packageCounts[i]);
+    }
+}
+
+@end
+
+#endif /* DEBUG */
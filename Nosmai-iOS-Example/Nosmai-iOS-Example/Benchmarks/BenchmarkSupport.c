@@ -0,0 +1,114 @@
+//
+//  BenchmarkSupport.c
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#include "BenchmarkSupport.h"
+
+#if DEBUG
+
+#include <math.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "TiledFilter.h"
+
+double BenchmarkNowMs(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1000.0 + (double)ts.tv_nsec / 1.0e6;
+}
+
+uint8_t *BenchmarkAllocFrame(int width, int height, int channels) {
+    size_t size = (size_t)width * (size_t)height * (size_t)channels;
+    uint8_t *frame = malloc(size);
+    if (!frame) {
+        return NULL;
+    }
+    // Deterministic gradient + noise so sampling is not trivially cache friendly.
+    uint32_t seed = 0x9E3779B9u;
+    for (size_t i = 0; i < size; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        frame[i] = (uint8_t)((i / (size_t)channels) % 251 + (seed >> 28));
+    }
+    return frame;
+}
+
+void BenchmarkSyntheticFaces(FaceWarpFace *faces, int faceCount, int width, int height) {
+    int columns = faceCount < 3 ? faceCount : 3;
+    int rows = (faceCount + columns - 1) / columns;
+    float cellW = (float)width / (float)columns;
+    float cellH = (float)height / (float)rows;
+    float size = (cellW < cellH ? cellW : cellH) * 0.7f;
+    for (int i = 0; i < faceCount; i++) {
+        float cx = ((float)(i % columns) + 0.5f) * cellW;
+        float cy = ((float)(i / columns) + 0.5f) * cellH;
+        faces[i] = (FaceWarpFace){
+            .x = cx - size * 0.5f,
+            .y = cy - size * 0.5f,
+            .width = size,
+            .height = size,
+            .slimming = 0.6f,
+            .eyeEnlargement = 0.5f,
+            .noseScale = -0.4f,
+        };
+    }
+}
+
+void BenchmarkSleepMs(double ms) {
+    struct timespec ts = {(time_t)(ms / 1000.0), (long)(fmod(ms, 1000.0) * 1.0e6)};
+    nanosleep(&ts, NULL);
+}
+
+// Smooth gradient: what the round trip is judged on, since 4:2:0 chroma
+// legitimately smears hard colour edges.
+void BenchmarkFillGradient(uint8_t *pixels, int width, int height) {
+    for (int y = 0; y < height; y++) {
+        uint8_t *row = pixels + (size_t)y * (size_t)width * 4;
+        for (int x = 0; x < width; x++) {
+            row[x * 4 + 0] = (uint8_t)(40 + x * 160 / width);
+            row[x * 4 + 1] = (uint8_t)(60 + y * 120 / height);
+            row[x * 4 + 2] = (uint8_t)(200 - (x + y) * 140 / (width + height));
+            row[x * 4 + 3] = 255;
+        }
+    }
+}
+
+// Gradient plus fine texture: enough detail that the kernels' sharpness
+// and aliasing show up in the round trip.
+void BenchmarkFillDetail(uint8_t *pixels, int width, int height) {
+    BenchmarkFillGradient(pixels, width, height);
+    for (int y = 0; y < height; y++) {
+        uint8_t *row = pixels + (size_t)y * (size_t)width * 4;
+        for (int x = 0; x < width; x++) {
+            double texture = 30.0 * sin(x * 0.21) * cos(y * 0.17) + 12.0 * sin((x + y) * 0.6);
+            for (int c = 0; c < 3; c++) {
+                double value = row[x * 4 + c] + texture;
+                row[x * 4 + c] = (uint8_t)(value < 0.0 ? 0.0 : (value > 255.0 ? 255.0 : value));
+            }
+        }
+    }
+}
+
+// Stands in for decoding a filter package's colour grade.
+int BenchmarkLoadLUT(void *context, const char *name, void **data, size_t *size) {
+    (void)context;
+    (void)name;
+    TiledFilterLUTParams *lut = malloc(sizeof(TiledFilterLUTParams));
+    if (!lut) {
+        return -1;
+    }
+    for (int v = 0; v < 256; v++) {
+        lut->table[0][v] = (uint8_t)(sqrt(v / 255.0) * 255.0 + 0.5);
+        lut->table[1][v] = (uint8_t)v;
+        lut->table[2][v] = (uint8_t)(v * 230 / 255);
+        lut->table[3][v] = (uint8_t)v;
+    }
+    *data = lut;
+    *size = sizeof(TiledFilterLUTParams);
+    return 0;
+}
+
+#endif /* DEBUG */
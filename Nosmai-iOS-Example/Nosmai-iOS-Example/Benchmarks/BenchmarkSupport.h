@@ -0,0 +1,46 @@
+//
+//  BenchmarkSupport.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#ifndef BENCHMARK_SUPPORT_H
+#define BENCHMARK_SUPPORT_H
+
+#if DEBUG
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "FaceWarp.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Monotonic clock in milliseconds
+double BenchmarkNowMs(void);
+void BenchmarkSleepMs(double ms);
+
+/// Gradient plus noise, width x height x channels bytes; NULL if allocation failed
+uint8_t *BenchmarkAllocFrame(int width, int height, int channels);
+
+/// Smooth RGBA gradient, tightly packed
+void BenchmarkFillGradient(uint8_t *pixels, int width, int height);
+/// RGBA gradient with fine texture on top, tightly packed
+void BenchmarkFillDetail(uint8_t *pixels, int width, int height);
+
+/// faceCount faces on a grid with every reshape effect enabled
+void BenchmarkSyntheticFaces(FaceWarpFace *faces, int faceCount, int width, int height);
+
+/// RenderAssetLoadFn returning a TiledFilterLUTParams colour grade
+int BenchmarkLoadLUT(void *context, const char *name, void **data, size_t *size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DEBUG */
+
+#endif /* BENCHMARK_SUPPORT_H */
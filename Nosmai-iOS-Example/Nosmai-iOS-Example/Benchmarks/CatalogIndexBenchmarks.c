@@ -0,0 +1,111 @@
+//
+//  CatalogIndexBenchmarks.c
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#include "CatalogIndexBenchmarks.h"
+
+#if DEBUG
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "BenchmarkSupport.h"
+#include "CatalogIndex.h"
+
+static int BenchmarkWritePackage(const char *path, size_t bytes, uint32_t seed) {
+    FILE *file = fopen(path, "wb");
+    if (!file) {
+        return -1;
+    }
+    uint32_t state = seed * 2654435761u + 1u;
+    int ok = 1;
+    for (size_t i = 0; i < bytes && ok; i++) {
+        state = state * 1664525u + 1013904223u;
+        ok = fputc((int)(state >> 24), file) != EOF;
+    }
+    ok = fclose(file) == 0 && ok;
+    return ok ? 0 : -1;
+}
+
+ProcessingCatalogResult ProcessingBenchmarkCatalogIndex(int packages, size_t packageBytes) {
+    ProcessingCatalogResult result = {0.0, 0.0, 0.0, 0.0, 0, 0};
+    char directory[] = "/tmp/catalog-benchmark-XXXXXX";
+    if (packages <= 0 || !mkdtemp(directory)) {
+        return result;
+    }
+    enum { kPathLength = 256 };
+    char path[kPathLength];
+    char name[64];
+    int written = 1;
+    for (int i = 0; i < packages && written; i++) {
+        snprintf(path, sizeof(path), "%s/filter_%04d.nosmai", directory, i);
+        written = BenchmarkWritePackage(path, packageBytes, (uint32_t)i) == 0;
+    }
+
+    // Without an index every listing opens and reads each package for its manifest.
+    double start = BenchmarkNowMs();
+    uint64_t hash;
+    uint64_t size;
+    for (int i = 0; i < packages && written; i++) {
+        snprintf(path, sizeof(path), "%s/filter_%04d.nosmai", directory, i);
+        written = CatalogHashFile(path, &hash, &size) == 0;
+    }
+    result.fullScanMs = BenchmarkNowMs() - start;
+
+    CatalogIndex index;
+    CatalogIndexInit(&index);
+    for (int i = 0; i < packages && written; i++) {
+        snprintf(path, sizeof(path), "%s/filter_%04d.nosmai", directory, i);
+        snprintf(name, sizeof(name), "filter_%04d", i);
+        CatalogEntry entry = {name, name, "local", i % 3 == 0 ? "effect" : "filter", path, "", 0, 0, 0, NULL, 0, 0};
+        written = CatalogIndexPut(&index, &entry) == 0;
+    }
+    char indexPath[kPathLength];
+    snprintf(indexPath, sizeof(indexPath), "%s/catalog.index", directory);
+    written = written && CatalogIndexSave(&index, indexPath) == 0;
+    CatalogIndexFree(&index);
+
+    CatalogIndexInit(&index);
+    start = BenchmarkNowMs();
+    int loaded = written && CatalogIndexLoad(&index, indexPath) == 0 && index.count == (size_t)packages;
+    result.loadMs = BenchmarkNowMs() - start;
+    struct stat st;
+    result.indexBytes = stat(indexPath, &st) == 0 ? (size_t)st.st_size : 0;
+
+    CatalogRevalidateStats stats;
+    size_t stale = loaded ? CatalogIndexRevalidate(&index, &stats) : 1;
+    result.revalidateMs = stats.elapsedMs;
+    int unchangedClean = loaded && stale == 0 && stats.unchanged == (uint64_t)packages;
+
+    // Package 0 is rewritten with the same bytes (a new mtime only); the last one gets new content.
+    snprintf(path, sizeof(path), "%s/filter_%04d.nosmai", directory, 0);
+    BenchmarkSleepMs(5.0);
+    BenchmarkWritePackage(path, packageBytes, 0);
+    snprintf(path, sizeof(path), "%s/filter_%04d.nosmai", directory, packages - 1);
+    BenchmarkWritePackage(path, packageBytes, (uint32_t)packages + 7u);
+    stale = loaded ? CatalogIndexRevalidate(&index, &stats) : 0;
+    result.incrementalMs = stats.elapsedMs;
+    const CatalogEntry *rewritten = CatalogIndexFindPackage(&index, path);
+    snprintf(path, sizeof(path), "%s/filter_%04d.nosmai", directory, 0);
+    const CatalogEntry *touched = CatalogIndexFindPackage(&index, path);
+    int incrementalCorrect = packages == 1 ? stale == 1
+                                           : stale == 1 && rewritten && rewritten->stale && touched && !touched->stale &&
+                                                 stats.touched == 1 && stats.changed == 1;
+    result.changesDetected = unchangedClean && incrementalCorrect;
+    CatalogIndexFree(&index);
+
+    for (int i = 0; i < packages; i++) {
+        snprintf(path, sizeof(path), "%s/filter_%04d.nosmai", directory, i);
+        remove(path);
+    }
+    remove(indexPath);
+    rmdir(directory);
+    return result;
+}
+
+#endif /* DEBUG */
@@ -0,0 +1,42 @@
+//
+//  CatalogIndexBenchmarks.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#ifndef CATALOG_INDEX_BENCHMARKS_H
+#define CATALOG_INDEX_BENCHMARKS_H
+
+#if DEBUG
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    double fullScanMs;         // Reading every package, as listing without an index does
+    double loadMs;             // Reading the index
+    double revalidateMs;       // Checking an unchanged catalog against disk
+    double incrementalMs;      // Revalidating after one package was touched and one rewritten
+    size_t indexBytes;
+    int changesDetected;       // Exactly the rewritten package is stale; the touched one is not
+} ProcessingCatalogResult;
+
+/**
+ * `packages` filter packages of packageBytes each in a temporary
+ * directory, listed by reading and hashing every package, then through a
+ * persisted CatalogIndex.
+ */
+ProcessingCatalogResult ProcessingBenchmarkCatalogIndex(int packages, size_t packageBytes);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DEBUG */
+
+#endif /* CATALOG_INDEX_BENCHMARKS_H */
@@ -0,0 +1,94 @@
+//
+//  ClockSyncBenchmarks.c
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#include "ClockSyncBenchmarks.h"
+
+#if DEBUG
+
+#include <math.h>
+#include <string.h>
+
+#include "BenchmarkSupport.h"
+#include "ClockSync.h"
+
+static double BenchmarkUniform(uint32_t *seed) {
+    *seed = *seed * 1664525u + 1013904223u;
+    return (double)(*seed >> 8) / (double)(1u << 24);
+}
+
+ProcessingClockSyncResult ProcessingBenchmarkClockSync(double offsetMs,
+                                                       double driftPpm,
+                                                       double seconds,
+                                                       double videoJitterMs,
+                                                       double audioJitterMs,
+                                                       double settleSeconds) {
+    ProcessingClockSyncResult result;
+    memset(&result, 0, sizeof(result));
+    ClockSync sync;
+    ClockSyncInit(&sync, 0.5, 0.005);
+
+    // The host clock doubles as the video clock; the audio clock is skewed.
+    const double hostBase = 5000.0;
+    const double videoInterval = 1.0 / 30.0;
+    const double audioInterval = 1024.0 / 48000.0;
+    const double pipelineDelay = 0.004;
+    uint32_t seed = 0x2545F491u;
+    long videoIndex = 0, audioIndex = 0;
+    double callMs = 0.0;
+    long audioCalls = 0;
+    int hasPrevious = 0;
+    double previousApplied = 0.0;
+
+    while (1) {
+        double videoTime = (double)videoIndex * videoInterval;
+        double audioCapture = (double)audioIndex * audioInterval;
+        if (videoTime > seconds && audioCapture > seconds) {
+            break;
+        }
+        if (videoTime <= audioCapture) {
+            double arrival = videoTime + pipelineDelay + BenchmarkUniform(&seed) * videoJitterMs / 1000.0;
+            ClockSyncObserveVideo(&sync, videoTime, hostBase + arrival);
+            videoIndex++;
+            continue;
+        }
+
+        double audioTime = offsetMs / 1000.0 + audioCapture * (1.0 + driftPpm * 1.0e-6);
+        double arrival = audioCapture + pipelineDelay + BenchmarkUniform(&seed) * audioJitterMs / 1000.0;
+        double start = BenchmarkNowMs();
+        ClockSyncObserveAudio(&sync, audioTime, hostBase + arrival);
+        double retimed;
+        ClockSyncAudioToVideo(&sync, audioTime, &retimed);
+        callMs += BenchmarkNowMs() - start;
+        audioCalls++;
+        audioIndex++;
+
+        // The same instant on the video clock is the capture time itself.
+        double errorMs = fabs(retimed - audioCapture) * 1000.0;
+        if (audioCapture >= settleSeconds) {
+            result.maxErrorMs = fmax(result.maxErrorMs, errorMs);
+        }
+        if (audioCapture >= seconds - 1.0) {
+            result.finalErrorMs = fmax(result.finalErrorMs, errorMs);
+        }
+        double applied = retimed - audioTime;
+        if (hasPrevious) {
+            result.maxStepMs = fmax(result.maxStepMs, fabs(applied - previousApplied) * 1000.0);
+        }
+        hasPrevious = 1;
+        previousApplied = applied;
+        result.uncorrectedErrorMs = fabs(audioTime - audioCapture) * 1000.0;
+    }
+
+    ClockSyncEstimate estimate = ClockSyncGetEstimate(&sync);
+    result.estimatedOffsetMs = estimate.offsetSeconds * 1000.0;
+    result.estimatedDriftPpm = estimate.driftPpm;
+    result.averageCallUs = audioCalls > 0 ? callMs * 1000.0 / (double)audioCalls : 0.0;
+    ClockSyncDestroy(&sync);
+    return result;
+}
+
+#endif /* DEBUG */
@@ -0,0 +1,49 @@
+//
+//  ClockSyncBenchmarks.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#ifndef CLOCK_SYNC_BENCHMARKS_H
+#define CLOCK_SYNC_BENCHMARKS_H
+
+#if DEBUG
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    double estimatedOffsetMs;   // Audio minus video at the end of the run
+    double estimatedDriftPpm;
+    double maxErrorMs;          // Worst retimed audio vs video for the same instant, after settling
+    double finalErrorMs;        // Same, over the last second
+    double uncorrectedErrorMs;  // What the raw audio timestamps are off by at the end
+    double maxStepMs;           // Largest change of the applied correction between two audio buffers
+    double averageCallUs;       // Observe + retime, per audio buffer
+} ProcessingClockSyncResult;
+
+/**
+ * Simulated recording: 30 fps video on the host clock and 1024-sample 48 kHz
+ * audio buffers whose clock starts offsetMs ahead and runs driftPpm fast.
+ * Arrival times get uniform jitter on top of a fixed 4 ms delay. Errors
+ * are measured from settleSeconds on.
+ */
+ProcessingClockSyncResult ProcessingBenchmarkClockSync(double offsetMs,
+                                                       double driftPpm,
+                                                       double seconds,
+                                                       double videoJitterMs,
+                                                       double audioJitterMs,
+                                                       double settleSeconds);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DEBUG */
+
+#endif /* CLOCK_SYNC_BENCHMARKS_H */
@@ -0,0 +1,99 @@
+//
+//  ColorConvertBenchmarks.c
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#include "ColorConvertBenchmarks.h"
+
+#if DEBUG
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "BenchmarkSupport.h"
+#include "ColorConvert.h"
+
+// Float BT.709 video-range reference, worst component error over the frame.
+static int BenchmarkNV12MaxError(const uint8_t *rgba,
+                                 int width,
+                                 int height,
+                                 const uint8_t *yPlane,
+                                 const uint8_t *uvPlane,
+                                 size_t uvStride) {
+    int maxError = 0;
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            const uint8_t *p = rgba + ((size_t)y * (size_t)width + (size_t)x) * 4;
+            double luma = 16.0 + 0.1826 * p[0] + 0.6142 * p[1] + 0.0620 * p[2];
+            int error = abs((int)lround(luma) - (int)yPlane[(size_t)y * (size_t)width + (size_t)x]);
+            maxError = error > maxError ? error : maxError;
+        }
+    }
+    for (int y = 0; y + 1 < height; y += 2) {
+        for (int x = 0; x + 1 < width; x += 2) {
+            double rgb[3] = {0.0, 0.0, 0.0};
+            for (int k = 0; k < 4; k++) {
+                const uint8_t *p = rgba + ((size_t)(y + k / 2) * (size_t)width + (size_t)(x + k % 2)) * 4;
+                for (int c = 0; c < 3; c++) rgb[c] += p[c] / 4.0;
+            }
+            double cb = 128.0 - 0.1006 * rgb[0] - 0.3386 * rgb[1] + 0.4392 * rgb[2];
+            double cr = 128.0 + 0.4392 * rgb[0] - 0.3989 * rgb[1] - 0.0403 * rgb[2];
+            const uint8_t *uv = uvPlane + (size_t)(y / 2) * uvStride + (size_t)x;
+            int error = abs((int)lround(cb) - (int)uv[0]);
+            maxError = error > maxError ? error : maxError;
+            error = abs((int)lround(cr) - (int)uv[1]);
+            maxError = error > maxError ? error : maxError;
+        }
+    }
+    return maxError;
+}
+
+ProcessingNV12Result ProcessingBenchmarkNV12Convert(int width, int height, int frames) {
+    ProcessingNV12Result result = {-1.0, -1.0, 0, 0, -1};
+    size_t rgbaBytes = (size_t)width * (size_t)height * 4;
+    uint8_t *src = BenchmarkAllocFrame(width, height, 4);
+    uint8_t *intermediate = malloc(rgbaBytes);
+    uint8_t *yPlane = malloc((size_t)width * (size_t)height);
+    size_t uvStride = (size_t)((width + 1) / 2) * 2;
+    uint8_t *uvPlane = malloc(uvStride * (size_t)((height + 1) / 2));
+    if (!src || !intermediate || !yPlane || !uvPlane || frames <= 0) {
+        free(src);
+        free(intermediate);
+        free(yPlane);
+        free(uvPlane);
+        return result;
+    }
+    size_t stride = (size_t)width * 4;
+
+    double start = BenchmarkNowMs();
+    for (int f = 0; f < frames; f++) {
+        ColorConvertRGBAToNV12(src, stride, width, height, ColorConvertOrderRGBA,
+                               yPlane, (size_t)width, uvPlane, uvStride);
+    }
+    result.fusedMs = (BenchmarkNowMs() - start) / (double)frames;
+    result.maxError = BenchmarkNV12MaxError(src, width, height, yPlane, uvPlane, uvStride);
+
+    // Previous path: the callback frame lands in an RGBA buffer the recorder
+    // owns, which is then read again to produce YUV.
+    start = BenchmarkNowMs();
+    for (int f = 0; f < frames; f++) {
+        memcpy(intermediate, src, rgbaBytes);
+        ColorConvertRGBAToNV12(intermediate, stride, width, height, ColorConvertOrderRGBA,
+                               yPlane, (size_t)width, uvPlane, uvStride);
+    }
+    result.twoPassMs = (BenchmarkNowMs() - start) / (double)frames;
+
+    result.fusedBytes = ColorConvertNV12BytesTouched(width, height);
+    result.twoPassBytes = result.fusedBytes + 2 * rgbaBytes;
+
+    free(src);
+    free(intermediate);
+    free(yPlane);
+    free(uvPlane);
+    return result;
+}
+
+#endif /* DEBUG */
@@ -0,0 +1,40 @@
+//
+//  ColorConvertBenchmarks.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#ifndef COLOR_CONVERT_BENCHMARKS_H
+#define COLOR_CONVERT_BENCHMARKS_H
+
+#if DEBUG
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    double fusedMs;         // Per frame, RGBA -> NV12 in one pass into the encoder buffer
+    double twoPassMs;       // Per frame, copy to an RGBA intermediate, then convert
+    uint64_t fusedBytes;    // Bytes read + written per frame
+    uint64_t twoPassBytes;
+    int maxError;           // Largest Y / Cb / Cr difference from a float BT.709 reference
+} ProcessingNV12Result;
+
+/**
+ * Recording-path colour conversion for a width x height RGBA frame, as
+ * delivered by setRecordingCallback:.
+ */
+ProcessingNV12Result ProcessingBenchmarkNV12Convert(int width, int height, int frames);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DEBUG */
+
+#endif /* COLOR_CONVERT_BENCHMARKS_H */
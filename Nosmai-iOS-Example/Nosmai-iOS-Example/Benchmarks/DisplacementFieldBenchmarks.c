@@ -0,0 +1,106 @@
+//
+//  DisplacementFieldBenchmarks.c
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#include "DisplacementFieldBenchmarks.h"
+
+#if DEBUG
+
+#include <math.h>
+#include <stdlib.h>
+
+#include "BenchmarkSupport.h"
+#include "DisplacementField.h"
+#include "FaceWarp.h"
+
+ProcessingDisplacementResult ProcessingBenchmarkDisplacementField(int width, int height, int faceCount, int cellSize, int iterations) {
+    ProcessingDisplacementResult result = {-1.0, -1.0, -1.0, -1.0, -1.0, -1.0, 0.0};
+    uint8_t *src = BenchmarkAllocFrame(width, height, 4);
+    uint8_t *direct = malloc((size_t)width * (size_t)height * 4);
+    uint8_t *remapped = malloc((size_t)width * (size_t)height * 4);
+    FaceWarpFace *faces = calloc((size_t)(faceCount > 0 ? faceCount : 1), sizeof(FaceWarpFace));
+    if (!src || !direct || !remapped || !faces || iterations <= 0) {
+        free(src);
+        free(direct);
+        free(remapped);
+        free(faces);
+        return result;
+    }
+    BenchmarkSyntheticFaces(faces, faceCount, width, height);
+    size_t stride = (size_t)width * 4;
+
+    FaceWarpBuffer buffer;
+    FaceWarpBufferInit(&buffer);
+    DisplacementField field;
+    DisplacementFieldInit(&field, cellSize, 0.5f);
+
+    // Accuracy: displacement and output against the per-pixel evaluation.
+    FaceWarpBufferPack(&buffer, faces, (size_t)faceCount, width, height);
+    DisplacementFieldUpdate(&field, faces, (size_t)faceCount, width, height);
+    double maxError = 0.0;
+    double errorSum = 0.0;
+    size_t warped = 0;
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            float exactX, exactY, fieldX, fieldY;
+            FaceWarpDisplacementAt(&buffer, (float)x, (float)y, &exactX, &exactY);
+            DisplacementFieldSample(&field, x, y, &fieldX, &fieldY);
+            if (exactX == 0.0f && exactY == 0.0f && fieldX == 0.0f && fieldY == 0.0f) {
+                continue;
+            }
+            double error = hypot((double)(exactX - fieldX), (double)(exactY - fieldY));
+            maxError = error > maxError ? error : maxError;
+            errorSum += error;
+            warped++;
+        }
+    }
+    result.maxErrorPx = maxError;
+    result.meanErrorPx = warped > 0 ? errorSum / (double)warped : 0.0;
+
+    FaceWarpApplyRGBA(&buffer, src, stride, direct, stride, width, height);
+    DisplacementFieldApplyRGBA(&field, src, stride, remapped, stride, width, height);
+    uint64_t diffSum = 0;
+    for (size_t i = 0; i < (size_t)width * (size_t)height * 4; i++) {
+        diffSum += (uint64_t)abs((int)direct[i] - (int)remapped[i]);
+    }
+    result.meanPixelError = (double)diffSum / ((double)width * (double)height * 4.0);
+
+    // Throughput. The direct path packs and evaluates every frame as it did before.
+    double start = BenchmarkNowMs();
+    for (int i = 0; i < iterations; i++) {
+        FaceWarpBufferPack(&buffer, faces, (size_t)faceCount, width, height);
+        FaceWarpApplyRGBA(&buffer, src, stride, direct, stride, width, height);
+    }
+    result.directMs = (BenchmarkNowMs() - start) / (double)iterations;
+
+    start = BenchmarkNowMs();
+    for (int i = 0; i < iterations; i++) {
+        DisplacementFieldInvalidate(&field);
+        DisplacementFieldUpdate(&field, faces, (size_t)faceCount, width, height);
+    }
+    result.buildMs = (BenchmarkNowMs() - start) / (double)iterations;
+
+    // Still subject: boxes jitter by detector noise, well under the threshold.
+    DisplacementFieldStats before = field.stats;
+    start = BenchmarkNowMs();
+    for (int i = 0; i < iterations; i++) {
+        faces[0].x += (i & 1) ? -0.1f : 0.1f;
+        DisplacementFieldUpdate(&field, faces, (size_t)faceCount, width, height);
+        DisplacementFieldApplyRGBA(&field, src, stride, remapped, stride, width, height);
+    }
+    result.remapMs = (BenchmarkNowMs() - start) / (double)iterations;
+    result.reuseRate = (double)(field.stats.reuses - before.reuses) / (double)(field.stats.updates - before.updates);
+
+    DisplacementFieldFree(&field);
+    FaceWarpBufferFree(&buffer);
+    free(src);
+    free(direct);
+    free(remapped);
+    free(faces);
+    return result;
+}
+
+#endif /* DEBUG */
@@ -0,0 +1,43 @@
+//
+//  DisplacementFieldBenchmarks.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#ifndef DISPLACEMENT_FIELD_BENCHMARKS_H
+#define DISPLACEMENT_FIELD_BENCHMARKS_H
+
+#if DEBUG
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    double maxErrorPx;      // Largest field vs per-pixel displacement difference
+    double meanErrorPx;     // Mean over warped pixels
+    double meanPixelError;  // Mean absolute channel difference of the outputs
+    double directMs;        // Per frame, ops evaluated per pixel (FaceWarpApplyRGBA)
+    double buildMs;         // Per field build
+    double remapMs;         // Per frame, cached field remap
+    double reuseRate;       // Fraction of updates that kept the field (0.1 px jitter)
+} ProcessingDisplacementResult;
+
+/**
+ * Accuracy and throughput of the low-resolution displacement field against
+ * the per-pixel face warp, with faceCount synthetic faces and all reshape
+ * effects enabled.
+ */
+ProcessingDisplacementResult ProcessingBenchmarkDisplacementField(int width, int height, int faceCount, int cellSize, int iterations);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DEBUG */
+
+#endif /* DISPLACEMENT_FIELD_BENCHMARKS_H */
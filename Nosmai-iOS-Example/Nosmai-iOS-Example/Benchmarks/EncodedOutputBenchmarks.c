@@ -0,0 +1,138 @@
+//
+//  EncodedOutputBenchmarks.c
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#include "EncodedOutputBenchmarks.h"
+
+#if DEBUG
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "BenchmarkSupport.h"
+#include "EncodedOutput.h"
+#include "FrameQueue.h"
+#include "ReferenceEncoder.h"
+
+// Static gradient with a block that moves a few pixels per frame.
+static void BenchmarkFillStreamFrame(uint8_t *y, uint8_t *uv, int width, int height, uint64_t index) {
+    size_t chromaRow = (size_t)((width + 1) / 2) * 2;
+    for (int row = 0; row < height; row++) {
+        for (int col = 0; col < width; col++) {
+            y[(size_t)row * (size_t)width + (size_t)col] = (uint8_t)(16 + (col + row) * 200 / (width + height));
+        }
+    }
+    for (int row = 0; row < (height + 1) / 2; row++) {
+        for (size_t col = 0; col < chromaRow; col++) {
+            uv[(size_t)row * chromaRow + col] = (uint8_t)(col % 2 == 0 ? 110 : 150);
+        }
+    }
+    int side = height / 6;
+    int x0 = (int)((index * 6) % (uint64_t)(width - side));
+    int y0 = height / 3;
+    for (int row = y0; row < y0 + side; row++) {
+        memset(y + (size_t)row * (size_t)width + (size_t)x0, 235, (size_t)side);
+    }
+}
+
+typedef struct {
+    ReferenceDecoder decoder;
+    uint8_t *expected;
+    int width;
+    int height;
+    int exact;
+} BenchmarkStreamCheck;
+
+static void BenchmarkStreamPacket(void *context, const EncodedPacket *packet) {
+    BenchmarkStreamCheck *check = context;
+    if (ReferenceDecoderDecode(&check->decoder, packet->data, packet->size) != 0) {
+        check->exact = 0;
+        return;
+    }
+    size_t lumaBytes = (size_t)check->width * (size_t)check->height;
+    BenchmarkFillStreamFrame(check->expected, check->expected + lumaBytes, check->width, check->height, packet->frameIndex);
+    if (memcmp(check->expected, check->decoder.frame, check->decoder.frameBytes) != 0) {
+        check->exact = 0;
+    }
+}
+
+static void BenchmarkStreamRelease(void *owner) {
+    free(owner);
+}
+
+ProcessingEncodedOutputResult ProcessingBenchmarkEncodedOutput(int width,
+                                                               int height,
+                                                               int frames,
+                                                               double producerIntervalMs,
+                                                               size_t queueCapacity,
+                                                               int policy) {
+    ProcessingEncodedOutputResult result;
+    memset(&result, 0, sizeof(result));
+    size_t frameBytes = ReferenceFrameBytes(width, height, EncodedFrameFormatNV12);
+    size_t lumaBytes = (size_t)width * (size_t)height;
+    size_t chromaRow = (size_t)((width + 1) / 2) * 2;
+
+    BenchmarkStreamCheck check;
+    ReferenceDecoderInit(&check.decoder);
+    check.expected = malloc(frameBytes);
+    check.width = width;
+    check.height = height;
+    check.exact = 1;
+
+    EncodedOutputConfig config = {
+        ReferenceEncoderCreate(0), BenchmarkStreamPacket, &check, BenchmarkStreamRelease,
+        queueCapacity, (FrameQueuePolicy)policy, 1.0,
+    };
+    EncodedOutput output;
+    if (!check.expected || !config.encoder.encode || EncodedOutputStart(&output, &config) != 0) {
+        free(check.expected);
+        ReferenceDecoderFree(&check.decoder);
+        return result;
+    }
+
+    double submitMs = 0.0;
+    for (int f = 0; f < frames; f++) {
+        double frameStart = BenchmarkNowMs();
+        // Each frame owns its pixels until the encoder is done, like a pool buffer.
+        uint8_t *pixels = malloc(frameBytes);
+        if (!pixels) {
+            break;
+        }
+        BenchmarkFillStreamFrame(pixels, pixels + lumaBytes, width, height, (uint64_t)f);
+        EncodedFrame frame = {
+            {pixels, pixels + lumaBytes}, {(size_t)width, chromaRow}, width, height,
+            EncodedFrameFormatNV12, f * producerIntervalMs / 1000.0, pixels, 0,
+        };
+        double start = BenchmarkNowMs();
+        if (EncodedOutputSubmit(&output, &frame) != 0) {
+            free(pixels);
+        }
+        submitMs += BenchmarkNowMs() - start;
+        double remaining = producerIntervalMs - (BenchmarkNowMs() - frameStart);
+        if (remaining > 0.0) {
+            BenchmarkSleepMs(remaining);
+        }
+    }
+    EncodedOutputStop(&output);
+
+    EncodedOutputStats stats = EncodedOutputGetStats(&output);
+    result.submitUs = frames > 0 ? submitMs * 1000.0 / (double)frames : 0.0;
+    result.averageLatencyMs = stats.averageLatencyMs;
+    result.maxLatencyMs = stats.maxLatencyMs;
+    result.averageEncodeMs = stats.averageEncodeMs;
+    result.maxQueueDepth = stats.maxQueueDepth;
+    result.packets = stats.packets;
+    result.dropped = stats.dropped;
+    result.keyFrames = stats.keyFrames;
+    result.compressionRatio = stats.bytes > 0 ? (double)(stats.packets * frameBytes) / (double)stats.bytes : 0.0;
+    result.decodedExact = check.exact && stats.packets > 0;
+
+    free(check.expected);
+    ReferenceDecoderFree(&check.decoder);
+    return result;
+}
+
+#endif /* DEBUG */
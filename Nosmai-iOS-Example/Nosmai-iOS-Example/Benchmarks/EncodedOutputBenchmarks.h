@@ -0,0 +1,52 @@
+//
+//  EncodedOutputBenchmarks.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#ifndef ENCODED_OUTPUT_BENCHMARKS_H
+#define ENCODED_OUTPUT_BENCHMARKS_H
+
+#if DEBUG
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    double submitUs;          // Producer time per frame inside EncodedOutputSubmit
+    double averageLatencyMs;  // Submit -> encoded packet
+    double maxLatencyMs;
+    double averageEncodeMs;
+    uint32_t maxQueueDepth;
+    uint64_t packets;
+    uint64_t dropped;
+    uint64_t keyFrames;
+    double compressionRatio;  // Raw NV12 bytes per encoded byte
+    int decodedExact;         // Every packet decoded back to the frame that was submitted
+} ProcessingEncodedOutputResult;
+
+/**
+ * Streams `frames` synthetic NV12 frames (static background, moving block)
+ * through EncodedOutput and the software reference encoder, one every
+ * producerIntervalMs, with key frames once a second. Packets are decoded
+ * on arrival and checked against their source frame.
+ */
+ProcessingEncodedOutputResult ProcessingBenchmarkEncodedOutput(int width,
+                                                               int height,
+                                                               int frames,
+                                                               double producerIntervalMs,
+                                                               size_t queueCapacity,
+                                                               int policy);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DEBUG */
+
+#endif /* ENCODED_OUTPUT_BENCHMARKS_H */
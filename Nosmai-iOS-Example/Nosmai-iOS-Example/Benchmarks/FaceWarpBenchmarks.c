@@ -0,0 +1,88 @@
+//
+//  FaceWarpBenchmarks.c
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#include "FaceWarpBenchmarks.h"
+
+#if DEBUG
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "BenchmarkSupport.h"
+#include "FaceWarp.h"
+
+// Per-pixel reference: every op evaluated at every pixel, then the same
+// sampler. @return the largest channel difference from dst
+static int BenchmarkFaceWarpReferenceError(const FaceWarpBuffer *buffer,
+                                           const uint8_t *src,
+                                           const uint8_t *dst,
+                                           int width,
+                                           int height,
+                                           uint64_t *outMoved) {
+    size_t stride = (size_t)width * 4;
+    int maxError = 0;
+    uint64_t moved = 0;
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            float dx;
+            float dy;
+            FaceWarpDisplacementAt(buffer, (float)x, (float)y, &dx, &dy);
+            uint8_t expected[4];
+            size_t offset = (size_t)y * stride + (size_t)x * 4;
+            if (dx == 0.0f && dy == 0.0f) {
+                memcpy(expected, src + offset, 4);
+            } else {
+                FaceWarpSampleRGBA(src, stride, width, height, (float)x + dx, (float)y + dy, expected);
+                moved++;
+            }
+            for (int c = 0; c < 4; c++) {
+                int error = abs((int)expected[c] - (int)dst[offset + (size_t)c]);
+                maxError = error > maxError ? error : maxError;
+            }
+        }
+    }
+    *outMoved = moved;
+    return maxError;
+}
+
+ProcessingFaceWarpResult ProcessingBenchmarkFaceWarp(int width, int height, int faceCount, int iterations) {
+    ProcessingFaceWarpResult result = {-1.0, 0.0, -1};
+    uint8_t *src = BenchmarkAllocFrame(width, height, 4);
+    uint8_t *dst = malloc((size_t)width * (size_t)height * 4);
+    FaceWarpFace *faces = calloc((size_t)(faceCount > 0 ? faceCount : 1), sizeof(FaceWarpFace));
+    if (!src || !dst || !faces || iterations <= 0) {
+        free(src);
+        free(dst);
+        free(faces);
+        return result;
+    }
+    BenchmarkSyntheticFaces(faces, faceCount, width, height);
+
+    FaceWarpBuffer buffer;
+    FaceWarpBufferInit(&buffer);
+    size_t stride = (size_t)width * 4;
+
+    // Pack per frame as the live path does, since faces move every frame.
+    double start = BenchmarkNowMs();
+    for (int i = 0; i < iterations; i++) {
+        FaceWarpBufferPack(&buffer, faces, (size_t)faceCount, width, height);
+        FaceWarpApplyRGBA(&buffer, src, stride, dst, stride, width, height);
+    }
+    result.ms = (BenchmarkNowMs() - start) / (double)iterations;
+
+    uint64_t moved = 0;
+    result.maxReferenceError = BenchmarkFaceWarpReferenceError(&buffer, src, dst, width, height, &moved);
+    result.warpedFraction = (double)moved / ((double)width * (double)height);
+
+    FaceWarpBufferFree(&buffer);
+    free(src);
+    free(dst);
+    free(faces);
+    return result;
+}
+
+#endif /* DEBUG */
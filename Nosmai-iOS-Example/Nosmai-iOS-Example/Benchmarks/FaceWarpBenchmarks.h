@@ -0,0 +1,38 @@
+//
+//  FaceWarpBenchmarks.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#ifndef FACE_WARP_BENCHMARKS_H
+#define FACE_WARP_BENCHMARKS_H
+
+#if DEBUG
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    double ms;              // Per frame, packing included
+    double warpedFraction;  // Pixels the faces moved
+    int maxReferenceError;  // Single pass vs every op evaluated per pixel (FaceWarpDisplacementAt)
+} ProcessingFaceWarpResult;
+
+/**
+ * Single-pass face reshape over a synthetic frame with faceCount faces laid
+ * out on a grid. All three reshape effects are enabled on every face.
+ */
+ProcessingFaceWarpResult ProcessingBenchmarkFaceWarp(int width, int height, int faceCount, int iterations);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DEBUG */
+
+#endif /* FACE_WARP_BENCHMARKS_H */
@@ -0,0 +1,95 @@
+//
+//  FrameMailboxBenchmarks.c
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#include "FrameMailboxBenchmarks.h"
+
+#if DEBUG
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+
+#include "BenchmarkSupport.h"
+#include "FrameMailbox.h"
+
+typedef struct {
+    FrameMailbox *mailbox;
+    double processMs;
+    atomic_int done;
+    uint64_t processed;
+    double totalLatencyMs;
+    double maxLatencyMs;
+    double lastLatencyMs;
+} BenchmarkMailboxConsumer;
+
+static void *BenchmarkMailboxConsumerMain(void *context) {
+    BenchmarkMailboxConsumer *consumer = context;
+    void *item = NULL;
+    while (1) {
+        if (FrameMailboxTake(consumer->mailbox, BenchmarkNowMs(), &item)) {
+            BenchmarkSleepMs(consumer->processMs);
+            double latency = BenchmarkNowMs() - *(const double *)item;
+            consumer->processed++;
+            consumer->totalLatencyMs += latency;
+            consumer->maxLatencyMs = latency > consumer->maxLatencyMs ? latency : consumer->maxLatencyMs;
+            consumer->lastLatencyMs = latency;
+        } else if (atomic_load(&consumer->done)) {
+            break;
+        } else {
+            BenchmarkSleepMs(0.2);
+        }
+    }
+    return NULL;
+}
+
+ProcessingFrameMailboxResult ProcessingBenchmarkFrameMailbox(int policy,
+                                                             size_t depth,
+                                                             int frames,
+                                                             double producerIntervalMs,
+                                                             double processMs) {
+    ProcessingFrameMailboxResult result = {0, 0, 0.0, 0.0, 0.0, 0};
+    FrameMailbox mailbox;
+    double *submitMs = frames > 0 ? malloc(sizeof(double) * (size_t)frames) : NULL;
+    if (!submitMs || FrameMailboxInit(&mailbox, (FrameMailboxPolicy)policy, depth) != 0) {
+        free(submitMs);
+        return result;
+    }
+    BenchmarkMailboxConsumer consumer = {&mailbox, processMs, 0, 0, 0.0, 0.0, 0.0};
+    pthread_t thread;
+    if (pthread_create(&thread, NULL, BenchmarkMailboxConsumerMain, &consumer) != 0) {
+        FrameMailboxFree(&mailbox);
+        free(submitMs);
+        return result;
+    }
+
+    double next = BenchmarkNowMs();
+    for (int i = 0; i < frames; i++) {
+        submitMs[i] = BenchmarkNowMs();
+        void *displaced = NULL;
+        FrameMailboxPush(&mailbox, &submitMs[i], submitMs[i], &displaced);
+        next += producerIntervalMs;
+        double wait = next - BenchmarkNowMs();
+        if (wait > 0.0) {
+            BenchmarkSleepMs(wait);
+        }
+    }
+    atomic_store(&consumer.done, 1);
+    pthread_join(thread, NULL);
+
+    FrameMailboxStats stats = FrameMailboxGetStats(&mailbox);
+    result.processed = consumer.processed;
+    result.dropped = stats.replaced + stats.rejected;
+    result.averageLatencyMs = consumer.processed > 0 ? consumer.totalLatencyMs / (double)consumer.processed : 0.0;
+    result.maxLatencyMs = consumer.maxLatencyMs;
+    result.lastLatencyMs = consumer.lastLatencyMs;
+    result.maxDepth = stats.maxDepth;
+    FrameMailboxFree(&mailbox);
+    free(submitMs);
+    return result;
+}
+
+#endif /* DEBUG */
@@ -0,0 +1,46 @@
+//
+//  FrameMailboxBenchmarks.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#ifndef FRAME_MAILBOX_BENCHMARKS_H
+#define FRAME_MAILBOX_BENCHMARKS_H
+
+#if DEBUG
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    uint64_t processed;
+    uint64_t dropped;          // Replaced or rejected
+    double averageLatencyMs;   // Submit -> processing finished, processed frames
+    double maxLatencyMs;
+    double lastLatencyMs;      // Of the last frame processed: how stale the output is at the end
+    uint32_t maxDepth;
+} ProcessingFrameMailboxResult;
+
+/**
+ * A producer submits `frames` frames every producerIntervalMs to a consumer
+ * that needs processMs per frame, through a FrameMailbox with the given
+ * depth. policy is a FrameMailboxPolicy.
+ */
+ProcessingFrameMailboxResult ProcessingBenchmarkFrameMailbox(int policy,
+                                                             size_t depth,
+                                                             int frames,
+                                                             double producerIntervalMs,
+                                                             double processMs);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DEBUG */
+
+#endif /* FRAME_MAILBOX_BENCHMARKS_H */
@@ -0,0 +1,85 @@
+//
+//  FramePipelineBenchmarks.c
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#include "FramePipelineBenchmarks.h"
+
+#if DEBUG
+
+#include <string.h>
+
+#include "BenchmarkSupport.h"
+#include "FramePipeline.h"
+
+typedef struct {
+    double ms;
+    intptr_t lastFrame;     // Only touched by the stage's own thread
+    int ordered;
+} BenchmarkPipelineStageState;
+
+static int BenchmarkPipelineStage(void *context, void *item) {
+    BenchmarkPipelineStageState *state = context;
+    intptr_t frame = (intptr_t)item;
+    state->ordered &= frame > state->lastFrame;
+    state->lastFrame = frame;
+    BenchmarkSleepMs(state->ms);
+    return 0;
+}
+
+ProcessingFramePipelineResult ProcessingBenchmarkFramePipeline(int framesInFlight,
+                                                               const double *stageMs,
+                                                               int stageCount,
+                                                               int frames,
+                                                               double producerIntervalMs) {
+    ProcessingFramePipelineResult result = {0.0, 0.0, 0.0, 0, 0, 0, 0};
+    if (stageCount <= 0 || stageCount > FRAME_PIPELINE_MAX_STAGES) {
+        return result;
+    }
+    BenchmarkPipelineStageState states[FRAME_PIPELINE_MAX_STAGES];
+    FramePipelineConfig config;
+    memset(&config, 0, sizeof(config));
+    for (int i = 0; i < stageCount; i++) {
+        states[i] = (BenchmarkPipelineStageState){stageMs[i], 0, 1};
+        config.stages[i] = (FramePipelineStage){"stage", BenchmarkPipelineStage, &states[i]};
+    }
+    config.stageCount = stageCount;
+    config.framesInFlight = framesInFlight;
+    config.blockWhenFull = producerIntervalMs <= 0.0;
+    FramePipeline pipeline;
+    if (FramePipelineStart(&pipeline, &config) != 0) {
+        return result;
+    }
+
+    double start = BenchmarkNowMs();
+    for (int f = 0; f < frames; f++) {
+        FramePipelineSubmit(&pipeline, (void *)(intptr_t)(f + 1));
+        if (producerIntervalMs > 0.0) {
+            // Camera cadence: the next frame arrives on schedule whatever happened to this one.
+            double next = start + (double)(f + 1) * producerIntervalMs;
+            double now = BenchmarkNowMs();
+            if (next > now) {
+                BenchmarkSleepMs(next - now);
+            }
+        }
+    }
+    FramePipelineStop(&pipeline);
+    double elapsed = BenchmarkNowMs() - start;
+
+    FramePipelineStats stats = FramePipelineGetStats(&pipeline);
+    result.throughputFps = elapsed > 0.0 ? (double)stats.completed * 1000.0 / elapsed : 0.0;
+    result.averageLatencyMs = stats.averageLatencyMs;
+    result.p95LatencyMs = stats.p95LatencyMs;
+    result.completed = stats.completed;
+    result.dropped = stats.dropped;
+    result.maxInFlight = stats.maxInFlight;
+    result.ordered = 1;
+    for (int i = 0; i < stageCount; i++) {
+        result.ordered &= states[i].ordered;
+    }
+    return result;
+}
+
+#endif /* DEBUG */
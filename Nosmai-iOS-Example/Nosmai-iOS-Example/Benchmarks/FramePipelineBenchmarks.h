@@ -0,0 +1,48 @@
+//
+//  FramePipelineBenchmarks.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#ifndef FRAME_PIPELINE_BENCHMARKS_H
+#define FRAME_PIPELINE_BENCHMARKS_H
+
+#if DEBUG
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    double throughputFps;
+    double averageLatencyMs;  // Submit -> last stage done
+    double p95LatencyMs;
+    uint64_t completed;
+    uint64_t dropped;         // Camera frames refused because every slot was in flight
+    int maxInFlight;
+    int ordered;              // Every stage saw the frames in submit order
+} ProcessingFramePipelineResult;
+
+/**
+ * Runs `frames` frames through a FramePipeline whose stages each take
+ * stageMs[i] (capture / upload, detection, render, readback, delivery...).
+ * producerIntervalMs > 0 submits like a camera and drops frames that find
+ * no free slot; 0 submits as fast as the pipeline accepts them.
+ */
+ProcessingFramePipelineResult ProcessingBenchmarkFramePipeline(int framesInFlight,
+                                                               const double *stageMs,
+                                                               int stageCount,
+                                                               int frames,
+                                                               double producerIntervalMs);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DEBUG */
+
+#endif /* FRAME_PIPELINE_BENCHMARKS_H */
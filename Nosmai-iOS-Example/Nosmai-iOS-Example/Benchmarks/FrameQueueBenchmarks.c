@@ -0,0 +1,93 @@
+//
+//  FrameQueueBenchmarks.c
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#include "FrameQueueBenchmarks.h"
+
+#if DEBUG
+
+#include <pthread.h>
+#include <stdatomic.h>
+
+#include "BenchmarkSupport.h"
+#include "FrameQueue.h"
+
+typedef struct {
+    FrameQueue *queue;
+    double writerMs;
+    atomic_int done;
+    uint64_t written;
+} BenchmarkSlowWriter;
+
+static void *BenchmarkSlowWriterMain(void *context) {
+    BenchmarkSlowWriter *writer = context;
+    FrameQueueEntry entry;
+    while (1) {
+        if (FrameQueuePop(writer->queue, BenchmarkNowMs(), &entry)) {
+            BenchmarkSleepMs(writer->writerMs);
+            writer->written++;
+        } else if (atomic_load(&writer->done)) {
+            break;
+        } else {
+            BenchmarkSleepMs(0.2);
+        }
+    }
+    return NULL;
+}
+
+ProcessingFrameQueueResult ProcessingBenchmarkFrameQueue(int policy,
+                                                         size_t capacity,
+                                                         int frames,
+                                                         double producerIntervalMs,
+                                                         double writerMs) {
+    ProcessingFrameQueueResult result = {-1.0, -1.0, 0, 0, 0, 0, -1.0};
+    FrameQueue queue;
+    if (frames <= 0 || FrameQueueInit(&queue, capacity, (FrameQueuePolicy)policy, capacity / 4 > 0 ? capacity / 4 : 1) != 0) {
+        return result;
+    }
+    BenchmarkSlowWriter writer = {&queue, writerMs, 0, 0};
+    pthread_t thread;
+    if (pthread_create(&thread, NULL, BenchmarkSlowWriterMain, &writer) != 0) {
+        FrameQueueFree(&queue);
+        return result;
+    }
+
+    double maxPushUs = 0.0;
+    double totalPushUs = 0.0;
+    double next = BenchmarkNowMs();
+    for (int i = 0; i < frames; i++) {
+        int critical = i % 30 == 0;
+        double start = BenchmarkNowMs();
+        // The block policy retries until the writer frees a slot.
+        while (FrameQueuePush(&queue, (void *)(intptr_t)(i + 1), (double)i, critical, start) == FrameQueuePushFull) {
+            BenchmarkSleepMs(0.2);
+        }
+        double pushUs = (BenchmarkNowMs() - start) * 1000.0;
+        maxPushUs = pushUs > maxPushUs ? pushUs : maxPushUs;
+        totalPushUs += pushUs;
+
+        next += producerIntervalMs;
+        double wait = next - BenchmarkNowMs();
+        if (wait > 0.0) {
+            BenchmarkSleepMs(wait);
+        }
+    }
+    atomic_store(&writer.done, 1);
+    pthread_join(thread, NULL);
+
+    FrameQueueStats stats = FrameQueueGetStats(&queue);
+    result.maxPushUs = maxPushUs;
+    result.averagePushUs = totalPushUs / (double)frames;
+    result.written = writer.written;
+    result.dropped = stats.dropped;
+    result.droppedCritical = stats.droppedCritical;
+    result.maxDepth = stats.maxDepth;
+    result.maxLagMs = stats.maxLagMs;
+    FrameQueueFree(&queue);
+    return result;
+}
+
+#endif /* DEBUG */
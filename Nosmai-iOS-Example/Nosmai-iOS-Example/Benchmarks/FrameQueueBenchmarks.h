@@ -0,0 +1,47 @@
+//
+//  FrameQueueBenchmarks.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#ifndef FRAME_QUEUE_BENCHMARKS_H
+#define FRAME_QUEUE_BENCHMARKS_H
+
+#if DEBUG
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    double maxPushUs;       // Worst time the producer spent submitting one frame
+    double averagePushUs;
+    uint64_t written;
+    uint64_t dropped;
+    uint64_t droppedCritical;
+    uint32_t maxDepth;
+    double maxLagMs;        // Worst enqueue -> encoder time
+} ProcessingFrameQueueResult;
+
+/**
+ * Stress test of the recorder queue: a producer submits `frames` frames every
+ * producerIntervalMs while a writer thread takes writerMs per frame. policy is
+ * a FrameQueuePolicy; every 30th frame is critical.
+ */
+ProcessingFrameQueueResult ProcessingBenchmarkFrameQueue(int policy,
+                                                         size_t capacity,
+                                                         int frames,
+                                                         double producerIntervalMs,
+                                                         double writerMs);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DEBUG */
+
+#endif /* FRAME_QUEUE_BENCHMARKS_H */
@@ -0,0 +1,128 @@
+//
+//  ImageBatchBenchmarks.c
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#include "ImageBatchBenchmarks.h"
+
+#if DEBUG
+
+#include <stdatomic.h>
+#include <stdlib.h>
+
+#include "BenchmarkSupport.h"
+#include "ImageBatch.h"
+#include "RenderSession.h"
+#include "TaskScheduler.h"
+
+typedef struct {
+    uint64_t *checksums;
+    atomic_size_t liveBytes;
+    atomic_size_t peakLiveBytes;
+} BenchmarkImageBatchJob;
+
+static void BenchmarkImageSize(int index, int *width, int *height) {
+    *width = index % 4 == 0 ? 4032 : 1024;
+    *height = index % 4 == 0 ? 3024 : 768;
+}
+
+static size_t BenchmarkImageMeasure(void *context, size_t index) {
+    (void)context;
+    int width;
+    int height;
+    BenchmarkImageSize((int)index, &width, &height);
+    return (size_t)width * (size_t)height * 4 * 2;
+}
+
+/// Decode, process and encode stand-ins; @return the output's checksum, 0 on failure
+static uint64_t BenchmarkImageRender(int index, ImageBatchTiming *timing, BenchmarkImageBatchJob *job) {
+    int width;
+    int height;
+    BenchmarkImageSize(index, &width, &height);
+    size_t stride = (size_t)width * 4;
+    size_t bytes = stride * (size_t)height;
+
+    double start = BenchmarkNowMs();
+    uint8_t *source = malloc(bytes);
+    uint8_t *output = malloc(bytes);
+    if (!source || !output) {
+        free(source);
+        free(output);
+        return 0;
+    }
+    if (job) {
+        size_t live = atomic_fetch_add(&job->liveBytes, 2 * bytes) + 2 * bytes;
+        size_t peak = atomic_load(&job->peakLiveBytes);
+        while (live > peak && !atomic_compare_exchange_weak(&job->peakLiveBytes, &peak, live)) {
+        }
+    }
+    BenchmarkFillDetail(source, width, height);
+    source[0] = (uint8_t)index;
+    double decoded = BenchmarkNowMs();
+
+    RenderSession session;
+    RenderSessionInit(&session, 256);
+    int rendered = RenderSessionAddBox(&session, 2) == 0 && RenderSessionAddSharpen(&session, 2, 192) == 0 &&
+                   RenderSessionRenderRGBA(&session, source, stride, output, stride, width, height) == 0;
+    RenderSessionFree(&session);
+    double processed = BenchmarkNowMs();
+
+    uint64_t checksum = 1469598103934665603ULL;
+    for (size_t i = 0; rendered && i < bytes; i += 4) {
+        checksum = (checksum ^ output[i]) * 1099511628211ULL;
+    }
+    if (job) {
+        atomic_fetch_sub(&job->liveBytes, 2 * bytes);
+    }
+    free(source);
+    free(output);
+    if (timing) {
+        timing->decodeMs = decoded - start;
+        timing->processMs = processed - decoded;
+        timing->encodeMs = BenchmarkNowMs() - processed;
+    }
+    return rendered ? checksum : 0;
+}
+
+static int BenchmarkImageRun(void *context, size_t index, ImageBatchTiming *timing) {
+    BenchmarkImageBatchJob *job = context;
+    job->checksums[index] = BenchmarkImageRender((int)index, timing, job);
+    return job->checksums[index] != 0 ? 0 : -1;
+}
+
+ProcessingImageBatchResult ProcessingBenchmarkImageBatch(int workers, int count, size_t memoryCap) {
+    ProcessingImageBatchResult result = {0.0, 0.0, 0, 0, 0, 0, 0};
+    BenchmarkImageBatchJob job;
+    job.checksums = count > 0 ? calloc((size_t)count, sizeof(uint64_t)) : NULL;
+    atomic_init(&job.liveBytes, 0);
+    atomic_init(&job.peakLiveBytes, 0);
+    TaskScheduler scheduler;
+    if (!job.checksums || TaskSchedulerStart(&scheduler, workers, workers) != 0) {
+        free(job.checksums);
+        return result;
+    }
+
+    ImageBatchCallbacks callbacks = {&job, BenchmarkImageMeasure, BenchmarkImageRun};
+    ImageBatchStats stats;
+    ImageBatchRun(&scheduler, (size_t)count, memoryCap, &callbacks, NULL, &stats);
+    TaskSchedulerStop(&scheduler);
+
+    // The first two images, one of each size, rendered again on this thread.
+    int matches = 1;
+    for (int i = 0; i < count && i < 2; i++) {
+        matches = matches && BenchmarkImageRender(i, NULL, NULL) == job.checksums[i];
+    }
+    result.imagesPerSecond = stats.imagesPerSecond;
+    result.p95LatencyMs = stats.p95LatencyMs;
+    result.peakBytes = stats.peakBytes;
+    result.peakLiveBytes = atomic_load(&job.peakLiveBytes);
+    result.budgetWaits = stats.budgetWaits;
+    result.failed = stats.failed;
+    result.outputsMatch = matches;
+    free(job.checksums);
+    return result;
+}
+
+#endif /* DEBUG */
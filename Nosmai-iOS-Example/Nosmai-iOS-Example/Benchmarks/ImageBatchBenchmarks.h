@@ -0,0 +1,44 @@
+//
+//  ImageBatchBenchmarks.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#ifndef IMAGE_BATCH_BENCHMARKS_H
+#define IMAGE_BATCH_BENCHMARKS_H
+
+#if DEBUG
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    double imagesPerSecond;
+    double p95LatencyMs;
+    size_t peakBytes;          // Reserved by the memory budget
+    size_t peakLiveBytes;      // Actually allocated at once
+    uint64_t budgetWaits;
+    uint64_t failed;
+    int outputsMatch;          // Every image equals a serial render of the same image
+} ProcessingImageBatchResult;
+
+/**
+ * `count` synthetic photos, every fourth one 12 MP (4032x3024) and the
+ * rest 1024x768, each "decoded" (filled), smoothed and sharpened through
+ * a tiled RenderSession and "encoded" (checksummed) as one ImageBatch on
+ * a scheduler with `workers` workers, under memoryCap bytes.
+ */
+ProcessingImageBatchResult ProcessingBenchmarkImageBatch(int workers, int count, size_t memoryCap);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DEBUG */
+
+#endif /* IMAGE_BATCH_BENCHMARKS_H */
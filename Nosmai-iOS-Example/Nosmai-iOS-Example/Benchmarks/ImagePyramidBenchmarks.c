@@ -0,0 +1,112 @@
+//
+//  ImagePyramidBenchmarks.c
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#include "ImagePyramidBenchmarks.h"
+
+#if DEBUG
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "BenchmarkSupport.h"
+#include "ImagePyramid.h"
+
+ProcessingPyramidResult ProcessingBenchmarkPyramid(int width, int height, int frames) {
+    ProcessingPyramidResult result = {-1.0, -1.0, 0, 0, 0, 0, 0};
+    // Consumer target sizes as fractions of the frame: detection, alignment,
+    // low-res effect, thumbnail.
+    const int divisors[] = {8, 4, 4, 16};
+    const int consumerCount = (int)(sizeof(divisors) / sizeof(divisors[0]));
+
+    uint8_t *src = BenchmarkAllocFrame(width, height, 4);
+    uint8_t *scratch[2] = {malloc((size_t)width * (size_t)height), malloc((size_t)width * (size_t)height)};
+    if (!src || !scratch[0] || !scratch[1] || frames <= 0) {
+        free(src);
+        free(scratch[0]);
+        free(scratch[1]);
+        return result;
+    }
+    size_t stride = (size_t)width * 4;
+
+    double start = BenchmarkNowMs();
+    for (int f = 0; f < frames; f++) {
+        for (int c = 0; c < consumerCount; c++) {
+            // Each consumer halves from full resolution down to its own size.
+            const uint8_t *level = src;
+            size_t levelStride = stride;
+            int w = width;
+            int h = height;
+            int step = 0;
+            for (int d = divisors[c]; d > 1; d /= 2, step ^= 1) {
+                ImagePyramidDownsample2x(level, levelStride, w, h, 4, scratch[step], (size_t)(w / 2) * 4);
+                level = scratch[step];
+                w /= 2;
+                h /= 2;
+                levelStride = (size_t)w * 4;
+            }
+        }
+    }
+    result.independentMs = (BenchmarkNowMs() - start) / (double)frames;
+
+    ImagePyramid pyramid;
+    ImagePyramidInit(&pyramid);
+    start = BenchmarkNowMs();
+    for (int f = 0; f < frames; f++) {
+        ImagePyramidBeginFrame(&pyramid, src, stride, width, height, 4);
+        for (int c = 0; c < consumerCount; c++) {
+            ImagePyramidLevel level;
+            ImagePyramidGetLevelForSize(&pyramid, width / divisors[c], height / divisors[c], &level);
+        }
+    }
+    result.sharedMs = (BenchmarkNowMs() - start) / (double)frames;
+
+    ImagePyramidStats stats = ImagePyramidGetStats(&pyramid);
+    for (int i = 0; i < IMAGE_PYRAMID_MAX_LEVELS; i++) {
+        result.levelHits += stats.levelHits[i];
+        result.levelBuilds += stats.levelBuilds[i];
+    }
+    result.bytesSaved = stats.bytesSaved;
+    result.levelsBuiltOnce = 1;
+    for (int i = 0; i < IMAGE_PYRAMID_MAX_LEVELS; i++) {
+        result.levelsBuiltOnce &= stats.levelBuilds[i] <= stats.frames;
+    }
+
+    // The last frame's shared levels against each consumer's own downscales.
+    result.levelsMatch = 1;
+    for (int c = 0; c < consumerCount; c++) {
+        const uint8_t *own = src;
+        int w = width;
+        int h = height;
+        int step = 0;
+        for (int d = divisors[c]; d > 1; d /= 2, step ^= 1) {
+            ImagePyramidDownsample2x(own, (size_t)w * 4, w, h, 4, scratch[step], (size_t)(w / 2) * 4);
+            own = scratch[step];
+            w /= 2;
+            h /= 2;
+        }
+        ImagePyramidLevel level;
+        if (ImagePyramidGetLevelForSize(&pyramid, width / divisors[c], height / divisors[c], &level) != 0 ||
+            level.width != w || level.height != h) {
+            result.levelsMatch = 0;
+            continue;
+        }
+        for (int y = 0; y < h; y++) {
+            if (memcmp(level.pixels + (size_t)y * level.stride, own + (size_t)y * (size_t)w * 4, (size_t)w * 4) != 0) {
+                result.levelsMatch = 0;
+                break;
+            }
+        }
+    }
+
+    ImagePyramidFree(&pyramid);
+    free(src);
+    free(scratch[0]);
+    free(scratch[1]);
+    return result;
+}
+
+#endif /* DEBUG */
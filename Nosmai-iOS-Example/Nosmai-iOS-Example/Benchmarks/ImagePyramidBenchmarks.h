@@ -0,0 +1,42 @@
+//
+//  ImagePyramidBenchmarks.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#ifndef IMAGE_PYRAMID_BENCHMARKS_H
+#define IMAGE_PYRAMID_BENCHMARKS_H
+
+#if DEBUG
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    double sharedMs;        // Per frame, all consumers served from one pyramid
+    double independentMs;   // Per frame, every consumer downscales on its own
+    uint64_t levelHits;
+    uint64_t levelBuilds;
+    uint64_t bytesSaved;
+    int levelsBuiltOnce;    // No level computed twice in a frame
+    int levelsMatch;        // Shared levels equal each consumer's own downscale
+} ProcessingPyramidResult;
+
+/**
+ * Four consumers per frame (detection, alignment, a low-res effect pass and a
+ * thumbnail) asking for lower resolutions of a 4-channel frame.
+ */
+ProcessingPyramidResult ProcessingBenchmarkPyramid(int width, int height, int frames);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DEBUG */
+
+#endif /* IMAGE_PYRAMID_BENCHMARKS_H */
@@ -0,0 +1,135 @@
+//
+//  MakeupMaskCacheBenchmarks.c
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#include "MakeupMaskCacheBenchmarks.h"
+
+#if DEBUG
+
+#include <stdlib.h>
+
+#include "BeautyKernels.h"
+#include "BenchmarkSupport.h"
+#include "MakeupMaskCache.h"
+
+static uint8_t *BenchmarkEllipseMask(int width, int height) {
+    uint8_t *mask = malloc((size_t)width * (size_t)height);
+    if (!mask) {
+        return NULL;
+    }
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            float nx = ((float)x + 0.5f) / (float)width * 2.0f - 1.0f;
+            float ny = ((float)y + 0.5f) / (float)height * 2.0f - 1.0f;
+            float d = 1.0f - (nx * nx + ny * ny);
+            mask[(size_t)y * (size_t)width + (size_t)x] = (uint8_t)(d > 0.0f ? d * 255.0f : 0.0f);
+        }
+    }
+    return mask;
+}
+
+// Runs `frames` lookups of both masks for one face. The box alternates by
+// `jitter` pixels every frame and sweeps back and forth by `drift` pixels per
+// frame, so a moving face stays inside the frame.
+static double BenchmarkMaskCacheRun(MakeupMaskCache *cache,
+                                    const MakeupMaskSource sources[2],
+                                    FaceRegionBox face,
+                                    float jitter,
+                                    float drift,
+                                    int frames,
+                                    int width,
+                                    int height) {
+    double start = BenchmarkNowMs();
+    for (int f = 0; f < frames; f++) {
+        int sweep = f % 40 < 20 ? f % 20 : 20 - f % 20;
+        float offset = (float)(f & 1) * jitter + (float)sweep * drift;
+        FaceRegionBox moved = face;
+        moved.x += offset;
+        for (int k = 0; k < 2; k++) {
+            MakeupPoint landmarks[3];
+            MakeupMaskLandmarksForFace(&moved, (MakeupMaskKind)k, landmarks);
+            MakeupMaskCacheLookup(cache, 1, (MakeupMaskKind)k, &sources[k], landmarks, width, height);
+        }
+    }
+    return (BenchmarkNowMs() - start) / (double)frames;
+}
+
+// Largest coverage difference between the masks the cache serves for the
+// face at `offset` and masks warped afresh for it.
+static int BenchmarkMaskCacheStaleError(MakeupMaskCache *cache,
+                                        const MakeupMaskSource sources[2],
+                                        FaceRegionBox face,
+                                        float jitter,
+                                        int frame,
+                                        int width,
+                                        int height) {
+    MakeupMaskCache fresh;
+    MakeupMaskCacheInit(&fresh, 2, -1.0f);
+    face.x += (float)(frame & 1) * jitter;
+    int maxError = 0;
+    for (int k = 0; k < 2; k++) {
+        MakeupPoint landmarks[3];
+        MakeupMaskLandmarksForFace(&face, (MakeupMaskKind)k, landmarks);
+        const MakeupWarpedMask *cached = MakeupMaskCacheLookup(cache, 1, (MakeupMaskKind)k, &sources[k], landmarks, width, height);
+        const MakeupWarpedMask *warped = MakeupMaskCacheLookup(&fresh, 1, (MakeupMaskKind)k, &sources[k], landmarks, width, height);
+        if (!cached || !warped) {
+            maxError = 255;
+            continue;
+        }
+        int x0 = cached->x < warped->x ? cached->x : warped->x;
+        int y0 = cached->y < warped->y ? cached->y : warped->y;
+        int x1 = cached->x + cached->width > warped->x + warped->width ? cached->x + cached->width : warped->x + warped->width;
+        int y1 = cached->y + cached->height > warped->y + warped->height ? cached->y + cached->height : warped->y + warped->height;
+        for (int y = y0; y < y1; y++) {
+            for (int x = x0; x < x1; x++) {
+                int error = abs((int)MakeupWarpedMaskCoverage(cached, x, y) - (int)MakeupWarpedMaskCoverage(warped, x, y));
+                maxError = error > maxError ? error : maxError;
+            }
+        }
+    }
+    MakeupMaskCacheFree(&fresh);
+    return maxError;
+}
+
+ProcessingMaskCacheResult ProcessingBenchmarkMaskCache(int width, int height, float threshold, int frames) {
+    ProcessingMaskCacheResult result = {0.0, 0.0, -1.0, -1.0, -1};
+    uint8_t *mouth = BenchmarkEllipseMask(105, 67);
+    uint8_t *blusher = BenchmarkEllipseMask(489, 209);
+    if (!mouth || !blusher || frames <= 0) {
+        free(mouth);
+        free(blusher);
+        return result;
+    }
+    MakeupMaskSource sources[2];
+    MakeupMaskSourceInit(&sources[MakeupMaskKindLipstick], mouth, 105, 105, 67);
+    MakeupMaskSourceInit(&sources[MakeupMaskKindBlusher], blusher, 489, 489, 209);
+
+    float size = (float)(width < height ? width : height) * 0.5f;
+    FaceRegionBox face = {((float)width - size) * 0.5f, ((float)height - size) * 0.5f, size, size};
+    MakeupMaskCache cache;
+
+    MakeupMaskCacheInit(&cache, 4, threshold);
+    result.cachedMs = BenchmarkMaskCacheRun(&cache, sources, face, 0.1f, 0.0f, frames, width, height);
+    result.stillHitRate = (double)cache.stats.hits / (double)cache.stats.lookups;
+    result.maxStaleError = BenchmarkMaskCacheStaleError(&cache, sources, face, 0.1f, frames - 1, width, height);
+    MakeupMaskCacheFree(&cache);
+
+    MakeupMaskCacheInit(&cache, 4, threshold);
+    BenchmarkMaskCacheRun(&cache, sources, face, 0.1f, 2.0f, frames, width, height);
+    result.movingHitRate = (double)cache.stats.hits / (double)cache.stats.lookups;
+    MakeupMaskCacheFree(&cache);
+
+    // A negative threshold never matches, which is the old warp-every-frame cost.
+    MakeupMaskCacheInit(&cache, 4, -1.0f);
+    result.uncachedMs = BenchmarkMaskCacheRun(&cache, sources, face, 0.1f, 0.0f, frames, width, height);
+    MakeupMaskCacheFree(&cache);
+
+    free(mouth);
+    free(blusher);
+    return result;
+}
+
+#endif /* DEBUG */
@@ -0,0 +1,41 @@
+//
+//  MakeupMaskCacheBenchmarks.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#ifndef MAKEUP_MASK_CACHE_BENCHMARKS_H
+#define MAKEUP_MASK_CACHE_BENCHMARKS_H
+
+#if DEBUG
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    double stillHitRate;    // Face jittering by detector noise only (~0.1 px)
+    double movingHitRate;   // Face drifting 2 px per frame
+    double cachedMs;        // Per frame, still face, lipstick + blusher lookups
+    double uncachedMs;      // Per frame, same lookups re-warping every time
+    int maxStaleError;      // Still face: cached vs freshly warped coverage, worst pixel
+} ProcessingMaskCacheResult;
+
+/**
+ * Lipstick and blusher mask lookups for one face through MakeupMaskCache at
+ * the given re-warp threshold, using synthetic masks the size of the bundled
+ * mouth.png and blusher.png.
+ */
+ProcessingMaskCacheResult ProcessingBenchmarkMaskCache(int width, int height, float threshold, int frames);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DEBUG */
+
+#endif /* MAKEUP_MASK_CACHE_BENCHMARKS_H */
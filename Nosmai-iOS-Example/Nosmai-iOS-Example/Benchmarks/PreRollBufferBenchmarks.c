@@ -0,0 +1,80 @@
+//
+//  PreRollBufferBenchmarks.c
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#include "PreRollBufferBenchmarks.h"
+
+#if DEBUG
+
+#include <stdlib.h>
+
+#include "BenchmarkSupport.h"
+#include "ColorConvert.h"
+#include "PreRollBuffer.h"
+
+ProcessingPreRollResult ProcessingBenchmarkPreRoll(int width,
+                                                   int height,
+                                                   int ringWidth,
+                                                   int ringHeight,
+                                                   int format,
+                                                   double seconds,
+                                                   int frames) {
+    ProcessingPreRollResult result = {-1.0, -1.0, 0, 0, 0.0, -1};
+    size_t stride = (size_t)width * 4;
+    uint8_t *src = BenchmarkAllocFrame(width, height, 4);
+    uint8_t *decoded = malloc(stride * (size_t)height);
+    PreRollBuffer ring;
+    if (!src || !decoded || frames <= 0 ||
+        PreRollBufferInit(&ring, ringWidth, ringHeight, (PreRollFormat)format, seconds, 30.0) != 0) {
+        free(src);
+        free(decoded);
+        return result;
+    }
+
+    double start = BenchmarkNowMs();
+    for (int f = 0; f < frames; f++) {
+        PreRollBufferPush(&ring, src, stride, width, height, ColorConvertOrderRGBA, f / 30.0);
+    }
+    result.pushMs = (BenchmarkNowMs() - start) / (double)frames;
+
+    int stored = PreRollBufferCount(&ring);
+    start = BenchmarkNowMs();
+    for (int i = 0; i < stored; i++) {
+        PreRollFrame frame;
+        PreRollBufferGetFrame(&ring, i, &frame);
+        PreRollFrameReadRGBA(&frame, decoded, stride, width, height);
+    }
+    result.readMs = stored > 0 ? (BenchmarkNowMs() - start) / (double)stored : 0.0;
+
+    PreRollBufferStats stats = PreRollBufferGetStats(&ring);
+    result.memoryBytes = stats.memoryBytes;
+    result.frames = stats.frames;
+    result.bufferedSeconds = stats.bufferedSeconds;
+    PreRollBufferFree(&ring);
+
+    // Same-size round trip, so only the storage format contributes error.
+    PreRollBuffer exact;
+    if (PreRollBufferInit(&exact, width, height, (PreRollFormat)format, 1.0, 1.0) == 0) {
+        BenchmarkFillGradient(src, width, height);
+        PreRollBufferPush(&exact, src, stride, width, height, ColorConvertOrderRGBA, 0.0);
+        PreRollFrame frame;
+        PreRollBufferGetFrame(&exact, 0, &frame);
+        PreRollFrameReadRGBA(&frame, decoded, stride, width, height);
+        int maxError = 0;
+        for (size_t i = 0; i < stride * (size_t)height; i++) {
+            int diff = abs((int)src[i] - (int)decoded[i]);
+            maxError = diff > maxError ? diff : maxError;
+        }
+        result.maxError = maxError;
+        PreRollBufferFree(&exact);
+    }
+
+    free(src);
+    free(decoded);
+    return result;
+}
+
+#endif /* DEBUG */
@@ -0,0 +1,47 @@
+//
+//  PreRollBufferBenchmarks.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#ifndef PRE_ROLL_BUFFER_BENCHMARKS_H
+#define PRE_ROLL_BUFFER_BENCHMARKS_H
+
+#if DEBUG
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    double pushMs;          // Per frame: scale (and convert) into the ring
+    double readMs;          // Per frame: decode back to RGBA at the source size
+    uint64_t memoryBytes;   // Ring footprint, allocated once at init
+    uint32_t frames;        // Frames inside the window at the end
+    double bufferedSeconds;
+    int maxError;           // Largest channel difference after a same-size round trip
+} ProcessingPreRollResult;
+
+/**
+ * Pre-roll ring holding `seconds` of 30 fps frames at ringWidth x ringHeight,
+ * fed `frames` RGBA frames of width x height. format is a PreRollFormat.
+ */
+ProcessingPreRollResult ProcessingBenchmarkPreRoll(int width,
+                                                   int height,
+                                                   int ringWidth,
+                                                   int ringHeight,
+                                                   int format,
+                                                   double seconds,
+                                                   int frames);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DEBUG */
+
+#endif /* PRE_ROLL_BUFFER_BENCHMARKS_H */
@@ -0,0 +1,46 @@
+//
+//  ProcessingBenchmarks.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 18/10/2026.
+//
+
+#ifndef PROCESSING_BENCHMARKS_H
+#define PROCESSING_BENCHMARKS_H
+
+#if DEBUG
+
+/**
+ * Debug-only micro benchmarks for the CPU processing modules, one file per
+ * module. They only depend on the C kernels so they run the same on device
+ * and on a Linux host. Every function returns milliseconds per frame unless
+ * stated otherwise; the result structs carry the behavioural checks next to
+ * the timings.
+ */
+
+#include "BeautyKernelsBenchmarks.h"
+#include "CatalogIndexBenchmarks.h"
+#include "ClockSyncBenchmarks.h"
+#include "ColorConvertBenchmarks.h"
+#include "DisplacementFieldBenchmarks.h"
+#include "EncodedOutputBenchmarks.h"
+#include "FaceWarpBenchmarks.h"
+#include "FrameMailboxBenchmarks.h"
+#include "FramePipelineBenchmarks.h"
+#include "FrameQueueBenchmarks.h"
+#include "ImageBatchBenchmarks.h"
+#include "ImagePyramidBenchmarks.h"
+#include "MakeupMaskCacheBenchmarks.h"
+#include "PreRollBufferBenchmarks.h"
+#include "QualityGovernorBenchmarks.h"
+#include "RenderSessionBenchmarks.h"
+#include "ResamplerBenchmarks.h"
+#include "ResolutionLadderBenchmarks.h"
+#include "SourceArbiterBenchmarks.h"
+#include "TaskSchedulerBenchmarks.h"
+#include "TiledFilterBenchmarks.h"
+#include "VideoFileReaderBenchmarks.h"
+
+#endif /* DEBUG */
+
+#endif /* PROCESSING_BENCHMARKS_H */
@@ -0,0 +1,90 @@
+//
+//  QualityGovernorBenchmarks.c
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#include "QualityGovernorBenchmarks.h"
+
+#if DEBUG
+
+#include <string.h>
+
+#include "BenchmarkSupport.h"
+#include "QualityGovernor.h"
+
+// Frame cost in ms for a set of knobs, before the load factor.
+static double BenchmarkQualityCost(const QualitySettings *settings) {
+    double scale = (double)settings->values[QualityKnobRenderScale] / 100.0;
+    double render = 16.0 * scale * scale;
+    double detection = 9.0 / (double)settings->values[QualityKnobDetectionInterval];
+    double smoothing = 2.0 + 3.0 * (double)settings->values[QualityKnobSmoothingQuality];
+    double effects = settings->values[QualityKnobOptionalEffects] ? 5.0 : 0.0;
+    return render + detection + smoothing + effects;
+}
+
+typedef struct {
+    int frames;
+    double load;
+} BenchmarkLoadPhase;
+
+ProcessingQualityGovernorResult ProcessingBenchmarkQualityGovernor(double targetFps) {
+    ProcessingQualityGovernorResult result = {0.0, 0.0, 0, 0, 0, 0, 0, 0, -1};
+    // Full quality costs 38 ms; at 30 fps, 0.7 fits, 1.0 needs two steps, 1.5 most of them,
+    // and 0.9 sits right at the first step's boundary.
+    const BenchmarkLoadPhase phases[] = {{300, 0.7}, {600, 1.0}, {600, 1.5}, {900, 0.7}, {1800, 0.9}, {600, 0.6}};
+    const int phaseCount = (int)(sizeof(phases) / sizeof(phases[0]));
+    QualityGovernorConfig config;
+    memset(&config, 0, sizeof(config));
+    config.targetFps = targetFps;
+    QualityGovernor governor;
+    if (QualityGovernorInit(&governor, &config) != 0) {
+        return result;
+    }
+
+    QualitySettings full = QualityGovernorFullQuality();
+    uint32_t seed = 12345u;
+    uint64_t frames = 0;
+    uint64_t overGoverned = 0;
+    uint64_t overUngoverned = 0;
+    double budget = 1000.0 / targetFps;
+    int recoveryStart = -1;
+    for (int p = 0; p < phaseCount; p++) {
+        uint64_t changesBefore = governor.stats.stepDowns + governor.stats.stepUps;
+        for (int f = 0; f < phases[p].frames; f++) {
+            seed = seed * 1664525u + 1013904223u;
+            double noise = 0.9 + 0.2 * (double)(seed >> 8) / 16777216.0;
+            double spike = (seed >> 4) % 50 == 0 ? 2.0 : 1.0;
+            double factor = phases[p].load * noise * spike;
+
+            double governed = BenchmarkQualityCost(&governor.settings) * factor;
+            double ungoverned = BenchmarkQualityCost(&full) * factor;
+            overGoverned += governed > budget ? 1 : 0;
+            overUngoverned += ungoverned > budget ? 1 : 0;
+            int change = QualityGovernorRecordFrame(&governor, governed);
+            frames++;
+            if (p == 3 && f == 0) {
+                recoveryStart = (int)frames;
+            }
+            if (p == 3 && change == QualityGovernorStepUp) {
+                result.recoveryFrames = (int)frames - recoveryStart;
+            }
+        }
+        if (p == 4) {
+            result.boundaryChanges = governor.stats.stepDowns + governor.stats.stepUps - changesBefore;
+        }
+    }
+
+    QualityGovernorStats stats = QualityGovernorGetStats(&governor);
+    result.overBudgetGoverned = (double)overGoverned / (double)frames;
+    result.overBudgetUngoverned = (double)overUngoverned / (double)frames;
+    result.stepDowns = stats.stepDowns;
+    result.stepUps = stats.stepUps;
+    result.reverts = stats.reverts;
+    result.maxLevel = stats.maxLevel;
+    result.finalLevel = stats.level;
+    return result;
+}
+
+#endif /* DEBUG */
@@ -0,0 +1,46 @@
+//
+//  QualityGovernorBenchmarks.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#ifndef QUALITY_GOVERNOR_BENCHMARKS_H
+#define QUALITY_GOVERNOR_BENCHMARKS_H
+
+#if DEBUG
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    double overBudgetGoverned;    // Fraction of frames over budget with the governor
+    double overBudgetUngoverned;  // Same load at full quality throughout
+    uint64_t stepDowns;
+    uint64_t stepUps;
+    uint64_t reverts;
+    uint64_t boundaryChanges;     // Level changes while the load sits near a step boundary
+    int maxLevel;
+    int finalLevel;               // After the closing light phase; 0 when quality fully recovered
+    int recoveryFrames;           // Frames from the load dropping to the last step up (-1 if never)
+} ProcessingQualityGovernorResult;
+
+/**
+ * Drives a QualityGovernor with a synthetic load generator: a cost model
+ * per knob (render area, detection cadence, smoothing, effects) scaled by
+ * a load profile (light, heavy, very heavy, light, right at a step
+ * boundary, light) with per-frame noise and occasional single-frame spikes.
+ */
+ProcessingQualityGovernorResult ProcessingBenchmarkQualityGovernor(double targetFps);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DEBUG */
+
+#endif /* QUALITY_GOVERNOR_BENCHMARKS_H */
@@ -0,0 +1,133 @@
+//
+//  RenderSessionBenchmarks.c
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#include "RenderSessionBenchmarks.h"
+
+#if DEBUG
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "BenchmarkSupport.h"
+#include "RenderSession.h"
+
+typedef struct {
+    RenderAssetCache *assets;
+    const uint8_t *source;
+    const uint8_t *expected;
+    int width;
+    int height;
+    int frames;
+    atomic_int *go;
+    double elapsedMs;
+    int matches;
+} BenchmarkSessionWorker;
+
+static void *BenchmarkSessionWorkerMain(void *context) {
+    BenchmarkSessionWorker *worker = context;
+    size_t stride = (size_t)worker->width * 4;
+    uint8_t *dst = malloc(stride * (size_t)worker->height);
+    RenderSession session;
+    RenderSessionInit(&session, 256);
+    RenderAsset *lut = RenderAssetCacheLoad(worker->assets, "grade", BenchmarkLoadLUT, NULL);
+    worker->matches = 0;
+    if (!dst || !lut || RenderSessionAddBox(&session, 3) != 0 || RenderSessionAddSharpen(&session, 2, 192) != 0 ||
+        RenderSessionAddLUT(&session, lut) != 0) {
+        RenderAssetRelease(lut);
+        RenderSessionFree(&session);
+        free(dst);
+        return NULL;
+    }
+    RenderAssetRelease(lut);  // The session holds its own reference
+
+    while (!atomic_load(worker->go)) {
+        BenchmarkSleepMs(0.1);
+    }
+    double start = BenchmarkNowMs();
+    int ok = 1;
+    for (int i = 0; i < worker->frames && ok; i++) {
+        ok = RenderSessionRenderRGBA(&session, worker->source, stride, dst, stride, worker->width, worker->height) == 0;
+    }
+    worker->elapsedMs = BenchmarkNowMs() - start;
+    worker->matches = ok && (!worker->expected || memcmp(dst, worker->expected, stride * (size_t)worker->height) == 0);
+    RenderSessionFree(&session);
+    free(dst);
+    return NULL;
+}
+
+ProcessingSessionScalingResult ProcessingBenchmarkSessionScaling(int sessions, int width, int height, int frames) {
+    ProcessingSessionScalingResult result = {0.0, 0.0, 0, 0, 0};
+    if (sessions <= 0 || frames <= 0) {
+        return result;
+    }
+    size_t stride = (size_t)width * 4;
+    uint8_t *source = BenchmarkAllocFrame(width, height, 4);
+    uint8_t *expected = malloc(stride * (size_t)height);
+    BenchmarkSessionWorker *workers = calloc((size_t)sessions, sizeof(BenchmarkSessionWorker));
+    pthread_t *threads = calloc((size_t)sessions, sizeof(pthread_t));
+    if (!source || !expected || !workers || !threads) {
+        free(source);
+        free(expected);
+        free(workers);
+        free(threads);
+        return result;
+    }
+    BenchmarkFillDetail(source, width, height);
+
+    // Reference output from a session of its own, before the others start.
+    RenderAssetCache assets;
+    RenderAssetCacheInit(&assets);
+    RenderSession reference;
+    RenderSessionInit(&reference, 256);
+    RenderAsset *lut = RenderAssetCacheLoad(&assets, "grade", BenchmarkLoadLUT, NULL);
+    int referenceOk = lut && RenderSessionAddBox(&reference, 3) == 0 && RenderSessionAddSharpen(&reference, 2, 192) == 0 &&
+                      RenderSessionAddLUT(&reference, lut) == 0 &&
+                      RenderSessionRenderRGBA(&reference, source, stride, expected, stride, width, height) == 0;
+    RenderAssetRelease(lut);
+    RenderSessionFree(&reference);
+
+    atomic_int go;
+    atomic_init(&go, 0);
+    int started = 0;
+    for (int i = 0; i < sessions; i++) {
+        workers[i] = (BenchmarkSessionWorker){&assets, source, referenceOk ? expected : NULL, width, height, frames, &go, 0.0, 0};
+        if (pthread_create(&threads[i], NULL, BenchmarkSessionWorkerMain, &workers[i]) != 0) {
+            break;
+        }
+        started++;
+    }
+    double start = BenchmarkNowMs();
+    atomic_store(&go, 1);
+    for (int i = 0; i < started; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    double elapsed = BenchmarkNowMs() - start;
+
+    int matches = referenceOk && started == sessions;
+    double sessionMs = 0.0;
+    for (int i = 0; i < started; i++) {
+        matches = matches && workers[i].matches;
+        sessionMs += workers[i].elapsedMs;
+    }
+    RenderAssetCacheStats stats = RenderAssetCacheGetStats(&assets);
+    result.framesPerSecond = elapsed > 0.0 ? (double)started * frames * 1000.0 / elapsed : 0.0;
+    result.averageFrameMs = started > 0 ? sessionMs / ((double)started * frames) : 0.0;
+    result.assetLoads = stats.loads;
+    result.assetHits = stats.hits;
+    result.outputsMatch = matches;
+
+    RenderAssetCacheFree(&assets);
+    free(source);
+    free(expected);
+    free(workers);
+    free(threads);
+    return result;
+}
+
+#endif /* DEBUG */
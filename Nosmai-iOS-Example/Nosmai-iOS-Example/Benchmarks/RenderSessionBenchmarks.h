@@ -0,0 +1,41 @@
+//
+//  RenderSessionBenchmarks.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#ifndef RENDER_SESSION_BENCHMARKS_H
+#define RENDER_SESSION_BENCHMARKS_H
+
+#if DEBUG
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    double framesPerSecond;    // All sessions together
+    double averageFrameMs;     // Per session
+    uint64_t assetLoads;       // Shared LUT decoded this many times (1 expected)
+    uint64_t assetHits;
+    int outputsMatch;          // Every session produced the single-session output
+} ProcessingSessionScalingResult;
+
+/**
+ * `sessions` independent RenderSessions (smoothing, sharpening, a LUT
+ * from one shared asset cache), one thread each, each rendering `frames`
+ * RGBA frames. Run with 1..N sessions for the scaling curve.
+ */
+ProcessingSessionScalingResult ProcessingBenchmarkSessionScaling(int sessions, int width, int height, int frames);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DEBUG */
+
+#endif /* RENDER_SESSION_BENCHMARKS_H */
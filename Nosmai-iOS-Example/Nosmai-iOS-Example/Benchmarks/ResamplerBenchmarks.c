@@ -0,0 +1,150 @@
+//
+//  ResamplerBenchmarks.c
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#include "ResamplerBenchmarks.h"
+
+#if DEBUG
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "BenchmarkSupport.h"
+#include "ColorConvert.h"
+#include "Resampler.h"
+
+// Same separable filter as the plan, without intermediate rounding.
+static int BenchmarkResampleReferenceError(const ResamplerPlan *plan, const uint8_t *src, const uint8_t *dst) {
+    int channels = plan->channels;
+    int dstWidth = plan->dstWidth;
+    size_t srcStride = (size_t)plan->srcWidth * (size_t)channels;
+    double *rows = malloc(sizeof(double) * (size_t)plan->srcHeight * (size_t)dstWidth * (size_t)channels);
+    if (!rows) {
+        return -1;
+    }
+    for (int sy = 0; sy < plan->srcHeight; sy++) {
+        for (int x = 0; x < dstWidth; x++) {
+            const int16_t *w = plan->x.weights + (size_t)x * (size_t)plan->x.taps;
+            for (int c = 0; c < channels; c++) {
+                double acc = 0.0;
+                for (int k = 0; k < plan->x.taps; k++) {
+                    acc += w[k] * (double)src[(size_t)sy * srcStride + (size_t)(plan->x.start[x] + k) * (size_t)channels + (size_t)c];
+                }
+                rows[((size_t)sy * (size_t)dstWidth + (size_t)x) * (size_t)channels + (size_t)c] = acc / 16384.0;
+            }
+        }
+    }
+    int maxError = 0;
+    size_t rowLength = (size_t)dstWidth * (size_t)channels;
+    for (int y = 0; y < plan->dstHeight; y++) {
+        const int16_t *w = plan->y.weights + (size_t)y * (size_t)plan->y.taps;
+        for (size_t i = 0; i < rowLength; i++) {
+            double acc = 0.0;
+            for (int k = 0; k < plan->y.taps; k++) {
+                acc += w[k] * rows[(size_t)(plan->y.start[y] + k) * rowLength + i];
+            }
+            double value = fmin(fmax(acc / 16384.0, 0.0), 255.0);
+            int error = abs((int)lround(value) - (int)dst[(size_t)y * rowLength + i]);
+            maxError = error > maxError ? error : maxError;
+        }
+    }
+    free(rows);
+    return maxError;
+}
+
+ProcessingResampleResult ProcessingBenchmarkResample(int kernel,
+                                                     int width,
+                                                     int height,
+                                                     int dstWidth,
+                                                     int dstHeight,
+                                                     int bands,
+                                                     int frames) {
+    ProcessingResampleResult result = {-1.0, -1.0, -1.0, -1.0, 0.0, -1, 0, 0};
+    size_t srcStride = (size_t)width * 4;
+    size_t dstStride = (size_t)dstWidth * 4;
+    size_t srcUVStride = (size_t)((width + 1) / 2) * 2;
+    size_t dstUVStride = (size_t)((dstWidth + 1) / 2) * 2;
+    uint8_t *src = malloc(srcStride * (size_t)height);
+    uint8_t *back = malloc(srcStride * (size_t)height);
+    uint8_t *dst = malloc(dstStride * (size_t)dstHeight);
+    uint8_t *dstSerial = malloc(dstStride * (size_t)dstHeight);
+    uint8_t *srcY = malloc((size_t)width * (size_t)height);
+    uint8_t *srcUV = malloc(srcUVStride * (size_t)((height + 1) / 2));
+    uint8_t *dstY = malloc((size_t)dstWidth * (size_t)dstHeight);
+    uint8_t *dstUV = malloc(dstUVStride * (size_t)((dstHeight + 1) / 2));
+    ResamplerPlan plan, inverse;
+    ResamplerNV12Plan nv12;
+    ResamplerPlanInit(&plan);
+    ResamplerPlanInit(&inverse);
+    ResamplerNV12PlanInit(&nv12);
+    int ready = src && back && dst && dstSerial && srcY && srcUV && dstY && dstUV && frames > 0 &&
+                ResamplerNV12PlanPrepare(&nv12, (ResamplerKernel)kernel, width, height, dstWidth, dstHeight, bands) >= 0;
+    if (ready) {
+        BenchmarkFillDetail(src, width, height);
+        ColorConvertRGBAToNV12(src, srcStride, width, height, ColorConvertOrderRGBA, srcY, (size_t)width, srcUV, srcUVStride);
+
+        // Prepare runs every frame, as it would for a live feed; only the first builds.
+        double start = BenchmarkNowMs();
+        for (int f = 0; f < frames; f++) {
+            ResamplerPlanPrepare(&plan, (ResamplerKernel)kernel, width, height, dstWidth, dstHeight, 4, bands);
+            ResamplerRun(&plan, src, srcStride, dstSerial, dstStride, 0);
+        }
+        result.serialMs = (BenchmarkNowMs() - start) / (double)frames;
+
+        start = BenchmarkNowMs();
+        for (int f = 0; f < frames; f++) {
+            ResamplerPlanPrepare(&plan, (ResamplerKernel)kernel, width, height, dstWidth, dstHeight, 4, bands);
+            ResamplerRun(&plan, src, srcStride, dst, dstStride, 1);
+        }
+        result.parallelMs = (BenchmarkNowMs() - start) / (double)frames;
+        result.tableBuilds = plan.stats.builds;
+        result.parallelMatches = memcmp(dst, dstSerial, dstStride * (size_t)dstHeight) == 0;
+        result.maxReferenceError = BenchmarkResampleReferenceError(&plan, src, dst);
+
+        start = BenchmarkNowMs();
+        for (int f = 0; f < frames; f++) {
+            ResamplerRunNV12(&nv12, srcY, (size_t)width, srcUV, srcUVStride, dstY, (size_t)dstWidth, dstUV, dstUVStride, 0);
+        }
+        result.nv12SerialMs = (BenchmarkNowMs() - start) / (double)frames;
+        start = BenchmarkNowMs();
+        for (int f = 0; f < frames; f++) {
+            ResamplerRunNV12(&nv12, srcY, (size_t)width, srcUV, srcUVStride, dstY, (size_t)dstWidth, dstUV, dstUVStride, 1);
+        }
+        result.nv12ParallelMs = (BenchmarkNowMs() - start) / (double)frames;
+
+        if (ResamplerPlanPrepare(&inverse, (ResamplerKernel)kernel, dstWidth, dstHeight, width, height, 4, bands) >= 0) {
+            ResamplerRun(&inverse, dst, dstStride, back, srcStride, 1);
+            double squared = 0.0;
+            size_t samples = 0;
+            for (size_t i = 0; i < srcStride * (size_t)height; i++) {
+                if (i % 4 == 3) {
+                    continue;
+                }
+                double diff = (double)src[i] - (double)back[i];
+                squared += diff * diff;
+                samples++;
+            }
+            double mse = squared / (double)samples;
+            result.roundTripPsnr = mse > 0.0 ? 10.0 * log10(255.0 * 255.0 / mse) : 99.0;
+        }
+    }
+
+    ResamplerPlanFree(&plan);
+    ResamplerPlanFree(&inverse);
+    ResamplerNV12PlanFree(&nv12);
+    free(src);
+    free(back);
+    free(dst);
+    free(dstSerial);
+    free(srcY);
+    free(srcUV);
+    free(dstY);
+    free(dstUV);
+    return result;
+}
+
+#endif /* DEBUG */
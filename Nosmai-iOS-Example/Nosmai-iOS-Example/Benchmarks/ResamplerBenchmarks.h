@@ -0,0 +1,49 @@
+//
+//  ResamplerBenchmarks.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#ifndef RESAMPLER_BENCHMARKS_H
+#define RESAMPLER_BENCHMARKS_H
+
+#if DEBUG
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    double serialMs;        // RGBA frame, every band on one thread
+    double parallelMs;      // RGBA frame, bands in parallel
+    double nv12SerialMs;
+    double nv12ParallelMs;
+    double roundTripPsnr;   // dB, source -> destination size -> source size
+    int maxReferenceError;  // Fixed point vs double precision with the same weights
+    int parallelMatches;    // Parallel output is bit-identical to serial
+    uint64_t tableBuilds;   // Coefficient table builds over all the frames
+} ProcessingResampleResult;
+
+/**
+ * Resamples a detailed RGBA frame (and its NV12 conversion) from width x
+ * height to dstWidth x dstHeight `frames` times with a ResamplerKernel.
+ */
+ProcessingResampleResult ProcessingBenchmarkResample(int kernel,
+                                                     int width,
+                                                     int height,
+                                                     int dstWidth,
+                                                     int dstHeight,
+                                                     int bands,
+                                                     int frames);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DEBUG */
+
+#endif /* RESAMPLER_BENCHMARKS_H */
@@ -0,0 +1,122 @@
+//
+//  ResolutionLadderBenchmarks.c
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#include "ResolutionLadderBenchmarks.h"
+
+#if DEBUG
+
+#include <math.h>
+#include <stdlib.h>
+
+#include "BenchmarkSupport.h"
+#include "ColorConvert.h"
+#include "Resampler.h"
+#include "ResolutionLadder.h"
+
+static double BenchmarkPsnr(const uint8_t *a, const uint8_t *b, size_t bytes) {
+    double squared = 0.0;
+    for (size_t i = 0; i < bytes; i++) {
+        double diff = (double)a[i] - (double)b[i];
+        squared += diff * diff;
+    }
+    double mse = squared / (double)bytes;
+    return mse > 0.0 ? 10.0 * log10(255.0 * 255.0 / mse) : 99.0;
+}
+
+ProcessingMultiResolutionResult ProcessingBenchmarkMultiResolution(int kernel,
+                                                                   int width,
+                                                                   int height,
+                                                                   const int *widths,
+                                                                   const int *heights,
+                                                                   int count,
+                                                                   int frames) {
+    ProcessingMultiResolutionResult result = {-1.0, -1.0, 0.0, 0.0, 0.0, 0};
+    if (count <= 0 || count > RESOLUTION_LADDER_MAX_OUTPUTS || frames <= 0) {
+        return result;
+    }
+    size_t rgbaStride = (size_t)width * 4;
+    size_t uvStride = (size_t)((width + 1) / 2) * 2;
+    uint8_t *rgba = malloc(rgbaStride * (size_t)height);
+    uint8_t *srcY = malloc((size_t)width * (size_t)height);
+    uint8_t *srcUV = malloc(uvStride * (size_t)((height + 1) / 2));
+    uint8_t *ladderPlanes[RESOLUTION_LADDER_MAX_OUTPUTS] = {NULL};
+    uint8_t *separatePlanes[RESOLUTION_LADDER_MAX_OUTPUTS] = {NULL};
+    size_t outputBytes[RESOLUTION_LADDER_MAX_OUTPUTS] = {0};
+    ResamplerNV12Plan separate[RESOLUTION_LADDER_MAX_OUTPUTS];
+    ResolutionLadder ladder;
+    ResolutionLadderInit(&ladder);
+    int ready = rgba && srcY && srcUV &&
+                ResolutionLadderConfigure(&ladder, ResolutionLadderFormatNV12, (ResamplerKernel)kernel, widths, heights,
+                                          count, 8) == 0;
+    for (int i = 0; i < count; i++) {
+        ResamplerNV12PlanInit(&separate[i]);
+        // Y plane followed by the CbCr plane, both tightly packed.
+        outputBytes[i] = (size_t)widths[i] * (size_t)heights[i] +
+                         (size_t)((widths[i] + 1) / 2) * 2 * (size_t)((heights[i] + 1) / 2);
+        ladderPlanes[i] = malloc(outputBytes[i]);
+        separatePlanes[i] = malloc(outputBytes[i]);
+        ready = ready && ladderPlanes[i] && separatePlanes[i];
+    }
+    if (ready) {
+        BenchmarkFillDetail(rgba, width, height);
+        ColorConvertRGBAToNV12(rgba, rgbaStride, width, height, ColorConvertOrderRGBA, srcY, (size_t)width, srcUV, uvStride);
+        ResolutionLadderImage frame = {{srcY, srcUV}, {(size_t)width, uvStride}};
+        ResolutionLadderImage outputs[RESOLUTION_LADDER_MAX_OUTPUTS];
+
+        double start = BenchmarkNowMs();
+        for (int f = 0; f < frames; f++) {
+            for (int i = 0; i < count; i++) {
+                uint8_t *y = ladderPlanes[i];
+                outputs[i] = (ResolutionLadderImage){{y, y + (size_t)widths[i] * (size_t)heights[i]},
+                                                     {(size_t)widths[i], (size_t)((widths[i] + 1) / 2) * 2}};
+            }
+            ResolutionLadderRun(&ladder, &frame, width, height, outputs, 1);
+        }
+        result.ladderMs = (BenchmarkNowMs() - start) / (double)frames;
+
+        start = BenchmarkNowMs();
+        for (int f = 0; f < frames; f++) {
+            for (int i = 0; i < count; i++) {
+                if (widths[i] == width && heights[i] == height) {
+                    continue;
+                }
+                uint8_t *y = separatePlanes[i];
+                size_t dstUVStride = (size_t)((widths[i] + 1) / 2) * 2;
+                ResamplerNV12PlanPrepare(&separate[i], (ResamplerKernel)kernel, width, height, widths[i], heights[i], 8);
+                ResamplerRunNV12(&separate[i], srcY, (size_t)width, srcUV, uvStride, y, (size_t)widths[i],
+                                 y + (size_t)widths[i] * (size_t)heights[i], dstUVStride, 1);
+            }
+        }
+        result.separateMs = (BenchmarkNowMs() - start) / (double)frames;
+
+        result.minPsnr = 99.0;
+        for (int i = 0; i < count; i++) {
+            if (widths[i] != width || heights[i] != height) {
+                result.minPsnr = fmin(result.minPsnr, BenchmarkPsnr(ladderPlanes[i], separatePlanes[i], outputBytes[i]));
+            }
+        }
+        ResolutionLadderStats stats = ResolutionLadderGetStats(&ladder);
+        result.sourcePixelRatio = stats.directSourcePixels > 0
+                                      ? (double)stats.resizeSourcePixels / (double)stats.directSourcePixels
+                                      : 0.0;
+        result.levelBuildsPerFrame = (double)stats.levelBuilds / (double)stats.frames;
+        result.passthroughs = stats.passthroughs;
+    }
+
+    for (int i = 0; i < count; i++) {
+        ResamplerNV12PlanFree(&separate[i]);
+        free(ladderPlanes[i]);
+        free(separatePlanes[i]);
+    }
+    ResolutionLadderFree(&ladder);
+    free(rgba);
+    free(srcY);
+    free(srcUV);
+    return result;
+}
+
+#endif /* DEBUG */
@@ -0,0 +1,48 @@
+//
+//  ResolutionLadderBenchmarks.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#ifndef RESOLUTION_LADDER_BENCHMARKS_H
+#define RESOLUTION_LADDER_BENCHMARKS_H
+
+#if DEBUG
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    double ladderMs;          // Every output through one ResolutionLadder
+    double separateMs;        // Every output resized from the full frame on its own
+    double minPsnr;           // Ladder vs separate output, worst output (99 when identical)
+    double sourcePixelRatio;  // Pixels the ladder's resizes read / pixels the separate resizes read
+    double levelBuildsPerFrame;
+    uint64_t passthroughs;
+} ProcessingMultiResolutionResult;
+
+/**
+ * Produces `count` NV12 outputs (widths[i] x heights[i], the frame size for
+ * a passthrough) from a detailed width x height NV12 frame, `frames` times,
+ * once through a ResolutionLadder and once as separate resizes.
+ */
+ProcessingMultiResolutionResult ProcessingBenchmarkMultiResolution(int kernel,
+                                                                   int width,
+                                                                   int height,
+                                                                   const int *widths,
+                                                                   const int *heights,
+                                                                   int count,
+                                                                   int frames);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DEBUG */
+
+#endif /* RESOLUTION_LADDER_BENCHMARKS_H */
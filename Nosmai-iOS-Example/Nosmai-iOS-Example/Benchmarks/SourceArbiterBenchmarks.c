@@ -0,0 +1,145 @@
+//
+//  SourceArbiterBenchmarks.c
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#include "SourceArbiterBenchmarks.h"
+
+#if DEBUG
+
+#include <stdlib.h>
+
+#include "BenchmarkSupport.h"
+#include "RenderSession.h"
+#include "SourceArbiter.h"
+
+static int BenchmarkArbiterStrategiesCorrect(void) {
+    SourceTransition t;
+    SourceArbiter arbiter;
+    int ok = 1;
+
+    SourceArbiterInit(&arbiter, SourceArbiterQueueRequest);
+    ok = ok && SourceArbiterRequest(&arbiter, 1, 0, 0.0, &t) == SourceRequestActive && t.activate == 1;
+    ok = ok && SourceArbiterRequest(&arbiter, 2, 9, 0.0, &t) == SourceRequestQueued && t.activate < 0 && t.deactivate < 0;
+    ok = ok && SourceArbiterRequest(&arbiter, 3, 0, 0.0, &t) == SourceRequestQueued;
+    SourceArbiterRelease(&arbiter, 1, 0.0, &t);
+    ok = ok && t.deactivate == 1 && t.activate == 2;
+    SourceArbiterRelease(&arbiter, 2, 0.0, &t);
+    ok = ok && t.activate == 3;
+    SourceArbiterFree(&arbiter);
+
+    // Waiting sources go by priority, not arrival; a preempted one resumes when the preemptor leaves.
+    SourceArbiterInit(&arbiter, SourceArbiterPriorityBased);
+    SourceArbiterRequest(&arbiter, 1, 5, 0.0, &t);
+    ok = ok && SourceArbiterRequest(&arbiter, 3, 0, 0.0, &t) == SourceRequestQueued;
+    ok = ok && SourceArbiterRequest(&arbiter, 2, 3, 0.0, &t) == SourceRequestQueued;
+    SourceArbiterRelease(&arbiter, 1, 0.0, &t);
+    ok = ok && t.deactivate == 1 && t.activate == 2;
+    ok = ok && SourceArbiterRequest(&arbiter, 4, 9, 0.0, &t) == SourceRequestActive && t.deactivate == 2 && t.activate == 4;
+    SourceArbiterRelease(&arbiter, 4, 0.0, &t);
+    ok = ok && t.activate == 2;
+    SourceArbiterRelease(&arbiter, 2, 0.0, &t);
+    ok = ok && t.activate == 3;
+    SourceArbiterFree(&arbiter);
+
+    SourceArbiterInit(&arbiter, SourceArbiterErrorOnConflict);
+    SourceArbiterRequest(&arbiter, 1, 0, 0.0, &t);
+    ok = ok && SourceArbiterRequest(&arbiter, 2, 5, 0.0, &t) == SourceRequestRejected && t.deactivate < 0;
+    SourceArbiterFree(&arbiter);
+
+    SourceArbiterInit(&arbiter, SourceArbiterAutoStopPrevious);
+    SourceArbiterRequest(&arbiter, 1, 0, 0.0, &t);
+    ok = ok && SourceArbiterRequest(&arbiter, 2, 0, 0.0, &t) == SourceRequestActive && t.deactivate == 1;
+    SourceArbiterRelease(&arbiter, 2, 0.0, &t);
+    ok = ok && t.activate < 0 && SourceArbiterActiveSource(&arbiter) < 0;
+    SourceArbiterFree(&arbiter);
+
+    // Frames only observed (processed before they could be held back) complete a switch but are not counted.
+    double switchMs;
+    int previous;
+    SourceArbiterInit(&arbiter, SourceArbiterPriorityBased);
+    SourceArbiterRequest(&arbiter, 1, 0, 0.0, &t);
+    SourceArbiterObserveFrame(&arbiter, 2, 1.0, &switchMs, &previous);
+    ok = ok && switchMs < 0.0;
+    SourceArbiterObserveFrame(&arbiter, 1, 2.0, &switchMs, &previous);
+    ok = ok && switchMs == 2.0;
+    ok = ok && SourceArbiterAdmitFrame(&arbiter, 2, 3.0, &switchMs, &previous) == 0;
+    SourceArbiterStats stats = SourceArbiterGetStats(&arbiter);
+    ok = ok && stats.switches == 1 && stats.framesAdmitted == 0 && stats.framesDropped == 1;
+    SourceArbiterFree(&arbiter);
+    return ok;
+}
+
+typedef struct {
+    RenderAssetCache assets;
+    RenderSession session;
+} BenchmarkSwitchPipeline;
+
+static int BenchmarkSwitchPipelineBuild(BenchmarkSwitchPipeline *pipeline) {
+    RenderAssetCacheInit(&pipeline->assets);
+    RenderSessionInit(&pipeline->session, 256);
+    RenderAsset *lut = RenderAssetCacheLoad(&pipeline->assets, "grade", BenchmarkLoadLUT, NULL);
+    int built = lut && RenderSessionAddBox(&pipeline->session, 3) == 0 &&
+                RenderSessionAddSharpen(&pipeline->session, 2, 192) == 0 && RenderSessionAddLUT(&pipeline->session, lut) == 0;
+    RenderAssetRelease(lut);
+    return built;
+}
+
+static void BenchmarkSwitchPipelineTearDown(BenchmarkSwitchPipeline *pipeline) {
+    RenderSessionFree(&pipeline->session);
+    RenderAssetCacheFree(&pipeline->assets);
+}
+
+ProcessingSourceSwitchResult ProcessingBenchmarkSourceSwitch(int switches) {
+    ProcessingSourceSwitchResult result = {0.0, 0.0, 0, BenchmarkArbiterStrategiesCorrect()};
+    const int width = 1280;
+    const int height = 720;
+    size_t stride = (size_t)width * 4;
+    uint8_t *source = BenchmarkAllocFrame(width, height, 4);
+    uint8_t *output = malloc(stride * (size_t)height);
+    BenchmarkSwitchPipeline pipeline;
+    if (!source || !output || !BenchmarkSwitchPipelineBuild(&pipeline)) {
+        free(source);
+        free(output);
+        return result;
+    }
+    BenchmarkFillDetail(source, width, height);
+    // One frame before the first switch, so no switch pays for first use.
+    RenderSessionRenderRGBA(&pipeline.session, source, stride, output, stride, width, height);
+
+    enum { kCamera = 1, kFile = 3 };
+    SourceArbiter arbiter;
+    SourceArbiterInit(&arbiter, SourceArbiterPriorityBased);
+    SourceTransition transition;
+    SourceArbiterRequest(&arbiter, kCamera, 0, BenchmarkNowMs(), &transition);
+    double switchMs;
+    int previous;
+    SourceArbiterAdmitFrame(&arbiter, kCamera, BenchmarkNowMs(), &switchMs, &previous);
+
+    double totalMs = 0.0;
+    for (int i = 0; i < switches; i++) {
+        // Alternately preempt the camera with the file and hand back.
+        if (i % 2 == 0) {
+            SourceArbiterRequest(&arbiter, kFile, 1, BenchmarkNowMs(), &transition);
+        } else {
+            SourceArbiterRelease(&arbiter, kFile, BenchmarkNowMs(), &transition);
+        }
+        RenderSessionRenderRGBA(&pipeline.session, source, stride, output, stride, width, height);
+        if (SourceArbiterAdmitFrame(&arbiter, transition.activate, BenchmarkNowMs(), &switchMs, &previous) && switchMs >= 0.0) {
+            totalMs += switchMs;
+            result.maxSwitchMs = switchMs > result.maxSwitchMs ? switchMs : result.maxSwitchMs;
+            result.switches++;
+        }
+    }
+    result.averageSwitchMs = result.switches > 0 ? totalMs / (double)result.switches : 0.0;
+
+    SourceArbiterFree(&arbiter);
+    BenchmarkSwitchPipelineTearDown(&pipeline);
+    free(source);
+    free(output);
+    return result;
+}
+
+#endif /* DEBUG */
@@ -0,0 +1,40 @@
+//
+//  SourceArbiterBenchmarks.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#ifndef SOURCE_ARBITER_BENCHMARKS_H
+#define SOURCE_ARBITER_BENCHMARKS_H
+
+#if DEBUG
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    double averageSwitchMs;    // Request -> first processed frame of the new source
+    double maxSwitchMs;
+    uint64_t switches;
+    int strategiesCorrect;     // Queue, priority, reject and auto-stop scenarios behave as specified
+} ProcessingSourceSwitchResult;
+
+/**
+ * A camera-like source preempted and resumed `switches` times by a
+ * higher-priority one under PriorityBased arbitration, each switch timed
+ * to the first processed 720p frame through one render session.
+ */
+ProcessingSourceSwitchResult ProcessingBenchmarkSourceSwitch(int switches);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DEBUG */
+
+#endif /* SOURCE_ARBITER_BENCHMARKS_H */
@@ -0,0 +1,160 @@
+//
+//  TaskSchedulerBenchmarks.c
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#include "TaskSchedulerBenchmarks.h"
+
+#if DEBUG
+
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "BenchmarkSupport.h"
+#include "TaskScheduler.h"
+
+typedef struct {
+    const uint8_t *src;
+    uint8_t *dst;
+    int width;
+    int height;
+} BenchmarkBlurJob;
+
+static void BenchmarkBlurRows(void *context, size_t begin, size_t end) {
+    const BenchmarkBlurJob *job = context;
+    size_t stride = (size_t)job->width * 4;
+    for (size_t y = begin; y < end; y++) {
+        const uint8_t *rows[3] = {
+            job->src + (y > 0 ? y - 1 : y) * stride,
+            job->src + y * stride,
+            job->src + (y + 1 < (size_t)job->height ? y + 1 : y) * stride,
+        };
+        uint8_t *out = job->dst + y * stride;
+        for (int x = 0; x < job->width; x++) {
+            int left = x > 0 ? x - 1 : x;
+            int right = x + 1 < job->width ? x + 1 : x;
+            for (int c = 0; c < 4; c++) {
+                int sum = 0;
+                for (int r = 0; r < 3; r++) {
+                    sum += rows[r][left * 4 + c] + rows[r][x * 4 + c] + rows[r][right * 4 + c];
+                }
+                out[x * 4 + c] = (uint8_t)((sum + 4) / 9);
+            }
+        }
+    }
+}
+
+ProcessingSchedulerScalingResult ProcessingBenchmarkSchedulerScaling(int workers, int width, int height, int frames) {
+    ProcessingSchedulerScalingResult result = {0.0, 0.0, 0, 0};
+    size_t bytes = (size_t)width * (size_t)height * 4;
+    uint8_t *src = malloc(bytes);
+    uint8_t *serial = malloc(bytes);
+    uint8_t *parallel = malloc(bytes);
+    TaskScheduler scheduler;
+    if (!src || !serial || !parallel || frames <= 0 || TaskSchedulerStart(&scheduler, workers, 0) != 0) {
+        free(src);
+        free(serial);
+        free(parallel);
+        return result;
+    }
+    BenchmarkFillDetail(src, width, height);
+
+    BenchmarkBlurJob serialJob = {src, serial, width, height};
+    double start = BenchmarkNowMs();
+    for (int i = 0; i < frames; i++) {
+        BenchmarkBlurRows(&serialJob, 0, (size_t)height);
+    }
+    result.serialMs = (BenchmarkNowMs() - start) / frames;
+
+    BenchmarkBlurJob parallelJob = {src, parallel, width, height};
+    start = BenchmarkNowMs();
+    for (int i = 0; i < frames; i++) {
+        TaskSchedulerParallelFor(&scheduler, TaskPriorityRealtime, (size_t)height, 16, BenchmarkBlurRows, &parallelJob);
+    }
+    result.parallelMs = (BenchmarkNowMs() - start) / frames;
+    result.outputsMatch = memcmp(serial, parallel, bytes) == 0;
+    result.steals = TaskSchedulerGetStats(&scheduler).steals;
+
+    TaskSchedulerStop(&scheduler);
+    free(src);
+    free(serial);
+    free(parallel);
+    return result;
+}
+
+static void BenchmarkSpinMs(double ms) {
+    double start = BenchmarkNowMs();
+    while (BenchmarkNowMs() - start < ms) {
+    }
+}
+
+static void BenchmarkBackgroundTask(void *context) {
+    (void)context;
+    BenchmarkSpinMs(2.0);
+}
+
+typedef struct {
+    double submitMs;
+    double startMs;
+    atomic_int done;
+} BenchmarkProbe;
+
+static void BenchmarkProbeTask(void *context) {
+    BenchmarkProbe *probe = context;
+    probe->startMs = BenchmarkNowMs();
+    BenchmarkSpinMs(0.5);
+    atomic_store(&probe->done, 1);
+}
+
+static int BenchmarkCompareDoubles(const void *a, const void *b) {
+    double x = *(const double *)a;
+    double y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+ProcessingSchedulerLatencyResult ProcessingBenchmarkSchedulerLatency(int workers, int useLanes, int frames) {
+    ProcessingSchedulerLatencyResult result = {0.0, 0.0, 0.0, 0};
+    BenchmarkProbe *probes = frames > 0 ? calloc((size_t)frames, sizeof(BenchmarkProbe)) : NULL;
+    double *waits = frames > 0 ? malloc(sizeof(double) * (size_t)frames) : NULL;
+    TaskScheduler scheduler;
+    if (!probes || !waits || TaskSchedulerStart(&scheduler, workers, useLanes ? 0 : workers) != 0) {
+        free(probes);
+        free(waits);
+        return result;
+    }
+    TaskPriority probeLane = useLanes ? TaskPriorityRealtime : TaskPriorityBackground;
+    int backlog = 4 * scheduler.workerCount;
+
+    double next = BenchmarkNowMs();
+    for (int i = 0; i < frames; i++) {
+        while (atomic_load(&scheduler.pending[TaskPriorityBackground]) < backlog) {
+            TaskSchedulerSubmit(&scheduler, TaskPriorityBackground, BenchmarkBackgroundTask, NULL);
+        }
+        atomic_init(&probes[i].done, 0);
+        probes[i].submitMs = BenchmarkNowMs();
+        TaskSchedulerSubmit(&scheduler, probeLane, BenchmarkProbeTask, &probes[i]);
+        next += 1000.0 / 60.0;
+        double wait = next - BenchmarkNowMs();
+        if (wait > 0.0) {
+            BenchmarkSleepMs(wait);
+        }
+    }
+    TaskSchedulerStop(&scheduler);
+
+    for (int i = 0; i < frames; i++) {
+        waits[i] = atomic_load(&probes[i].done) ? probes[i].startMs - probes[i].submitMs : 0.0;
+    }
+    qsort(waits, (size_t)frames, sizeof(double), BenchmarkCompareDoubles);
+    result.p50Ms = waits[frames / 2];
+    result.p99Ms = waits[(frames * 99) / 100];
+    result.maxMs = waits[frames - 1];
+    result.backgroundCompleted = TaskSchedulerGetStats(&scheduler).lanes[TaskPriorityBackground].completed;
+    free(probes);
+    free(waits);
+    return result;
+}
+
+#endif /* DEBUG */
@@ -0,0 +1,50 @@
+//
+//  TaskSchedulerBenchmarks.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#ifndef TASK_SCHEDULER_BENCHMARKS_H
+#define TASK_SCHEDULER_BENCHMARKS_H
+
+#if DEBUG
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    double serialMs;           // Per frame, calling thread only
+    double parallelMs;         // Per frame, parallel-for on the scheduler
+    int outputsMatch;
+    uint64_t steals;
+} ProcessingSchedulerScalingResult;
+
+/// A 3x3 RGBA blur as a parallel-for over rows, on a scheduler with `workers` workers
+ProcessingSchedulerScalingResult ProcessingBenchmarkSchedulerScaling(int workers, int width, int height, int frames);
+
+typedef struct {
+    double p50Ms;              // Realtime task: submit -> start
+    double p99Ms;
+    double maxMs;
+    uint64_t backgroundCompleted;
+} ProcessingSchedulerLatencyResult;
+
+/**
+ * A short realtime task every 16.7 ms while 2 ms background tasks keep
+ * every worker busy. With useLanes = 0 the realtime tasks share the
+ * background lane and no worker is reserved, like one global queue.
+ */
+ProcessingSchedulerLatencyResult ProcessingBenchmarkSchedulerLatency(int workers, int useLanes, int frames);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DEBUG */
+
+#endif /* TASK_SCHEDULER_BENCHMARKS_H */
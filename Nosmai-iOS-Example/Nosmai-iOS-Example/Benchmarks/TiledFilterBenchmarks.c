@@ -0,0 +1,116 @@
+//
+//  TiledFilterBenchmarks.c
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#include "TiledFilterBenchmarks.h"
+
+#if DEBUG
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "BenchmarkSupport.h"
+#include "TiledFilter.h"
+
+static inline uint8_t BenchmarkStillPixel(int x, int y, int c) {
+    uint32_t hash = (uint32_t)x * 73856093u ^ (uint32_t)y * 19349663u ^ (uint32_t)c * 83492791u;
+    hash ^= hash >> 13;
+    hash *= 0x5bd1e995u;
+    int base = c == 3 ? 255 : 64 + ((x / 7 + y / 5 + c * 40) & 127);
+    return (uint8_t)(c == 3 ? 255 : base + (int)((hash >> 24) & 31) - 16);
+}
+
+typedef struct {
+    const uint8_t *src;
+    size_t stride;
+    const uint8_t *reference;
+    int maxError;
+} BenchmarkTiledIO;
+
+static void BenchmarkTiledRead(void *io, int x, int y, int width, int height, uint8_t *dst, size_t dstStride) {
+    const BenchmarkTiledIO *source = io;
+    for (int row = 0; row < height; row++) {
+        memcpy(dst + (size_t)row * dstStride, source->src + (size_t)(y + row) * source->stride + (size_t)x * 4, (size_t)width * 4);
+    }
+}
+
+// Stands in for writing the output: touches every pixel once.
+static void BenchmarkTiledWrite(void *io, int x, int y, int width, int height, const uint8_t *src, size_t srcStride) {
+    BenchmarkTiledIO *check = io;
+    for (int row = 0; row < height; row++) {
+        const uint8_t *expected = check->reference + (size_t)(y + row) * check->stride + (size_t)x * 4;
+        const uint8_t *actual = src + (size_t)row * srcStride;
+        for (size_t i = 0; i < (size_t)width * 4; i++) {
+            int diff = abs((int)expected[i] - (int)actual[i]);
+            check->maxError = diff > check->maxError ? diff : check->maxError;
+        }
+    }
+}
+
+ProcessingTiledPhotoResult ProcessingBenchmarkTiledPhoto(int width, int height, int tileSize) {
+    ProcessingTiledPhotoResult result = {-1.0, -1.0, 0, 0, 0.0, 0, -1};
+    static TiledFilterLUTParams lut;
+    for (int v = 0; v < 256; v++) {
+        lut.table[0][v] = (uint8_t)(sqrt(v / 255.0) * 255.0 + 0.5);
+        lut.table[1][v] = (uint8_t)v;
+        lut.table[2][v] = (uint8_t)(v * 230 / 255);
+        lut.table[3][v] = (uint8_t)v;
+    }
+    const TiledFilterBoxParams smoothing = {3};
+    const TiledFilterSharpenParams sharpening = {2, 192};
+    const TiledFilterStage stages[] = {
+        {TiledFilterBox, &smoothing, 3},
+        {TiledFilterSharpen, &sharpening, 2},
+        {TiledFilterLUT, &lut, 0},
+    };
+    const int stageCount = (int)(sizeof(stages) / sizeof(stages[0]));
+
+    size_t stride = (size_t)width * 4;
+    size_t imageBytes = stride * (size_t)height;
+    uint8_t *src = malloc(imageBytes);
+    uint8_t *reference = malloc(imageBytes);
+    uint8_t *temp = malloc(imageBytes);
+    uint32_t *scratch = malloc(sizeof(uint32_t) * (size_t)width * 8);
+    TiledFilter filter;
+    if (!src || !reference || !temp || !scratch || TiledFilterInit(&filter, stages, stageCount, tileSize) != 0) {
+        free(src);
+        free(reference);
+        free(temp);
+        free(scratch);
+        return result;
+    }
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            for (int c = 0; c < 4; c++) {
+                src[(size_t)y * stride + (size_t)x * 4 + (size_t)c] = BenchmarkStillPixel(x, y, c);
+            }
+        }
+    }
+
+    double start = BenchmarkNowMs();
+    TiledFilterApplyChain(stages, stageCount, src, stride, reference, stride, width, height, temp, scratch);
+    result.wholeMs = BenchmarkNowMs() - start;
+    result.wholeBytes = imageBytes + sizeof(uint32_t) * (size_t)width * 8;
+
+    BenchmarkTiledIO check = {src, stride, reference, 0};
+    start = BenchmarkNowMs();
+    TiledFilterRun(&filter, width, height, BenchmarkTiledRead, BenchmarkTiledWrite, &check);
+    result.tiledMs = BenchmarkNowMs() - start;
+    result.maxError = check.maxError;
+    result.workingBytes = filter.stats.workingBytes;
+    result.haloOverhead = (double)filter.stats.pixelsRead / (double)filter.stats.pixelsWritten;
+    result.tiles = filter.stats.tiles;
+
+    TiledFilterFree(&filter);
+    free(src);
+    free(reference);
+    free(temp);
+    free(scratch);
+    return result;
+}
+
+#endif /* DEBUG */
@@ -0,0 +1,43 @@
+//
+//  TiledFilterBenchmarks.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#ifndef TILED_FILTER_BENCHMARKS_H
+#define TILED_FILTER_BENCHMARKS_H
+
+#if DEBUG
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    double tiledMs;          // Whole image through tiles
+    double wholeMs;          // Same chain in one pass over the whole image
+    uint64_t workingBytes;   // Tiled: tile buffers and scratch
+    uint64_t wholeBytes;     // One pass: intermediate image and scratch
+    double haloOverhead;     // Pixels read per pixel written
+    uint64_t tiles;
+    int maxError;            // Tiled vs one-pass output
+} ProcessingTiledPhotoResult;
+
+/**
+ * Smoothing, sharpening and a colour LUT over a synthetic width x height
+ * still, tiled and in one pass. The tiled pass only reads tiles out of the
+ * source, the way it would from a camera pixel buffer.
+ */
+ProcessingTiledPhotoResult ProcessingBenchmarkTiledPhoto(int width, int height, int tileSize);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DEBUG */
+
+#endif /* TILED_FILTER_BENCHMARKS_H */
@@ -0,0 +1,91 @@
+//
+//  VideoFileReaderBenchmarks.c
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#include "VideoFileReaderBenchmarks.h"
+
+#if DEBUG
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "BenchmarkSupport.h"
+#include "VideoFileReader.h"
+
+// Each plane starts with a byte derived from the frame index.
+static void BenchmarkFillFileFrame(uint8_t *frame, size_t lumaBytes, size_t chromaBytes, uint64_t index) {
+    memset(frame, (int)(16 + index % 200), lumaBytes);
+    memset(frame + lumaBytes, (int)(index * 3 % 256), chromaBytes);
+    memset(frame + lumaBytes + chromaBytes, (int)(index * 7 % 256), chromaBytes);
+}
+
+ProcessingVideoFileResult ProcessingBenchmarkVideoFileInput(int raw,
+                                                            int prefetchFrames,
+                                                            int width,
+                                                            int height,
+                                                            int frames,
+                                                            double processMs) {
+    ProcessingVideoFileResult result = {0.0, 0, 0, 0, 0, 0, 0};
+    const char *directory = getenv("TMPDIR") ? getenv("TMPDIR") : "/tmp";
+    char path[1024];
+    snprintf(path, sizeof(path), "%s/benchmark-input.%s", directory, raw ? "yuv" : "y4m");
+
+    size_t lumaBytes = (size_t)width * (size_t)height;
+    size_t chromaBytes = (size_t)((width + 1) / 2) * (size_t)((height + 1) / 2);
+    uint8_t *frame = malloc(lumaBytes + 2 * chromaBytes);
+    FILE *file = frame ? fopen(path, "wb") : NULL;
+    if (!file) {
+        free(frame);
+        return result;
+    }
+    if (!raw) {
+        fprintf(file, "YUV4MPEG2 W%d H%d F30000:1001 Ip A1:1 C420jpeg\n", width, height);
+    }
+    for (int i = 0; i < frames; i++) {
+        BenchmarkFillFileFrame(frame, lumaBytes, chromaBytes, (uint64_t)i);
+        if (!raw) {
+            fputs("FRAME\n", file);
+        }
+        fwrite(frame, 1, lumaBytes + 2 * chromaBytes, file);
+    }
+    fclose(file);
+    free(frame);
+
+    VideoFileConfig config = {raw ? VideoFileFormatRawI420 : VideoFileFormatY4M, width, height, 30000, 1001, prefetchFrames};
+    VideoFileReader reader;
+    if (VideoFileReaderOpen(&reader, path, &config) != 0) {
+        remove(path);
+        return result;
+    }
+    int exact = 1;
+    int matches = 1;
+    double start = BenchmarkNowMs();
+    VideoFileFrame input;
+    while (VideoFileReaderNext(&reader, &input) == 1) {
+        exact = exact && input.timeValue == (int64_t)input.index * 1001 && input.timeScale == 30000;
+        matches = matches && input.planes[0][0] == (uint8_t)(16 + input.index % 200) &&
+                  input.planes[1][0] == (uint8_t)(input.index * 3 % 256) &&
+                  input.planes[2][chromaBytes - 1] == (uint8_t)(input.index * 7 % 256);
+        BenchmarkSleepMs(processMs);
+        VideoFileReaderRelease(&reader, &input);
+        result.frames++;
+    }
+    double elapsed = BenchmarkNowMs() - start;
+    VideoFileReaderStats stats = VideoFileReaderGetStats(&reader);
+    VideoFileReaderClose(&reader);
+    remove(path);
+
+    result.framesPerSecond = elapsed > 0.0 ? (double)result.frames * 1000.0 / elapsed : 0.0;
+    result.consumerStalls = stats.consumerStalls;
+    result.readerStalls = stats.readerStalls;
+    result.maxPrefetched = stats.maxPrefetched;
+    result.timestampsExact = exact && result.frames == (uint64_t)frames;
+    result.contentMatches = matches && result.frames == (uint64_t)frames;
+    return result;
+}
+
+#endif /* DEBUG */
@@ -0,0 +1,49 @@
+//
+//  VideoFileReaderBenchmarks.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#ifndef VIDEO_FILE_READER_BENCHMARKS_H
+#define VIDEO_FILE_READER_BENCHMARKS_H
+
+#if DEBUG
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    double framesPerSecond;
+    uint64_t frames;
+    uint64_t consumerStalls;   // Processing waited for the file
+    uint64_t readerStalls;     // The prefetch window was full
+    uint32_t maxPrefetched;
+    int timestampsExact;       // Every timestamp is index * 1001 / 30000 exactly
+    int contentMatches;        // Every frame is the one written at its index
+} ProcessingVideoFileResult;
+
+/**
+ * Writes `frames` frames of width x height 4:2:0 at 30000/1001 fps to a
+ * temporary y4m (or raw I420) file, then reads them back through a
+ * VideoFileReader with the given prefetch window while a consumer spends
+ * processMs per frame (a sleep, standing in for GPU time).
+ */
+ProcessingVideoFileResult ProcessingBenchmarkVideoFileInput(int raw,
+                                                            int prefetchFrames,
+                                                            int width,
+                                                            int height,
+                                                            int frames,
+                                                            double processMs);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DEBUG */
+
+#endif /* VIDEO_FILE_READER_BENCHMARKS_H */
@@ -0,0 +1,73 @@
+//
+//  AdaptiveQualityGovernor.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#import <Foundation/Foundation.h>
+#import <CoreGraphics/CoreGraphics.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Posted on the main queue for every level change; userInfo is the event dictionary
+extern NSNotificationName const AdaptiveQualityGovernorDidChangeNotification;
+
+/**
+ * Opt-in quality governor fed by -[NosmaiDelegate
+ * nosmaiDidProcessFrame:processingTime:error:].
+ *
+ * When frame times run over the target frame rate's budget it steps down,
+ * in order: internal render resolution, face-detection cadence, smoothing
+ * quality, then optional effects. With headroom it steps back up, with
+ * hysteresis (see QualityGovernor). The current settings are readable at
+ * any time; each change is reported to changeHandler and as an
+ * AdaptiveQualityGovernorDidChangeNotification.
+ *
+ * Event dictionaries carry direction (@"down" / @"up"), level, knob,
+ * value, frameMs, budgetMs, frame and revert.
+ */
+@interface AdaptiveQualityGovernor : NSObject
+
+@property (nonatomic, readonly) double targetFrameRate;
+
+/// Off by default; while off, frame times are ignored and settings stay at full quality
+@property (nonatomic, assign, getter=isEnabled) BOOL enabled;
+
+@property (nonatomic, readonly) NSInteger level;
+/// 1.0 at full quality
+@property (nonatomic, readonly) CGFloat renderScale;
+/// Run face detection every N frames
+@property (nonatomic, readonly) NSInteger faceDetectionInterval;
+/// 2 full, 1 reduced, 0 cheapest
+@property (nonatomic, readonly) NSInteger smoothingQuality;
+@property (nonatomic, readonly) BOOL optionalEffectsEnabled;
+
+/// Called on the main queue after every level change
+@property (nonatomic, copy, nullable) void (^changeHandler)(AdaptiveQualityGovernor *governor, NSDictionary<NSString *, id> *event);
+
+/**
+ * frames, overBudgetFrames, stepDowns, stepUps, reverts, level, maxLevel,
+ * averageFrameMs, budgetMs, upDwellFrames and framesAtLevel (array)
+ */
+@property (nonatomic, readonly) NSDictionary<NSString *, id> *statistics;
+
+/**
+ * Only the default steps on these knobs (renderScale, faceDetectionInterval,
+ * smoothingQuality, optionalEffects), so the governor never steps through a
+ * knob the caller does not apply; the others stay at full quality.
+ */
+- (instancetype)initWithTargetFrameRate:(double)targetFrameRate knobs:(NSArray<NSString *> *)knobs NS_DESIGNATED_INITIALIZER;
+/// Every knob
+- (instancetype)initWithTargetFrameRate:(double)targetFrameRate;
+- (instancetype)init NS_UNAVAILABLE;
+
+/// One processed frame's time in milliseconds; callable from any thread
+- (void)recordProcessingTime:(double)processingTimeMs;
+
+/// Back to full quality with fresh statistics
+- (void)reset;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,193 @@
+//
+//  AdaptiveQualityGovernor.m
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#import "AdaptiveQualityGovernor.h"
+#import <os/lock.h>
+#include "QualityGovernor.h"
+
+NSNotificationName const AdaptiveQualityGovernorDidChangeNotification = @"AdaptiveQualityGovernorDidChange";
+
+static NSString *AdaptiveQualityKnobName(QualityKnob knob) {
+    switch (knob) {
+        case QualityKnobRenderScale: return @"renderScale";
+        case QualityKnobDetectionInterval: return @"faceDetectionInterval";
+        case QualityKnobSmoothingQuality: return @"smoothingQuality";
+        case QualityKnobOptionalEffects: return @"optionalEffects";
+        default: return @"unknown";
+    }
+}
+
+@implementation AdaptiveQualityGovernor {
+    os_unfair_lock _lock;
+    // Guarded by _lock.
+    QualityGovernor _governor;
+    BOOL _enabled;
+    NSMutableArray<NSDictionary *> *_pendingEvents;
+    QualityStep _steps[QUALITY_GOVERNOR_MAX_STEPS];
+    int _stepCount;
+}
+
+// Runs inside -recordProcessingTime:, with _lock held.
+static void AdaptiveQualityGovernorEvent(void *context, const QualityGovernorEvent *event, const QualitySettings *settings) {
+    AdaptiveQualityGovernor *governor = (__bridge AdaptiveQualityGovernor *)context;
+    NSDictionary *info = @{
+        @"direction": event->direction == QualityGovernorStepDown ? @"down" : @"up",
+        @"level": @(event->level),
+        @"knob": AdaptiveQualityKnobName(event->knob),
+        @"value": @(event->value),
+        @"frameMs": @(event->frameMs),
+        @"budgetMs": @(event->budgetMs),
+        @"frame": @(event->frame),
+        @"revert": @(event->revert != 0),
+    };
+    [governor->_pendingEvents addObject:info];
+}
+
+- (instancetype)initWithTargetFrameRate:(double)targetFrameRate knobs:(NSArray<NSString *> *)knobs {
+    self = [super init];
+    if (self) {
+        _lock = OS_UNFAIR_LOCK_INIT;
+        _targetFrameRate = targetFrameRate > 0.0 ? targetFrameRate : 30.0;
+        _pendingEvents = [NSMutableArray array];
+        int defaultCount = 0;
+        const QualityStep *defaults = QualityGovernorDefaultSteps(&defaultCount);
+        for (int i = 0; i < defaultCount; i++) {
+            if ([knobs containsObject:AdaptiveQualityKnobName(defaults[i].knob)]) {
+                _steps[_stepCount++] = defaults[i];
+            }
+        }
+        [self reset];
+    }
+    return self;
+}
+
+- (instancetype)initWithTargetFrameRate:(double)targetFrameRate {
+    return [self initWithTargetFrameRate:targetFrameRate
+                                   knobs:@[@"renderScale", @"faceDetectionInterval", @"smoothingQuality", @"optionalEffects"]];
+}
+
+- (void)reset {
+    QualityGovernorConfig config;
+    memset(&config, 0, sizeof(config));
+    config.targetFps = self.targetFrameRate;
+    config.steps = _steps;
+    config.stepCount = _stepCount;
+    config.onEvent = AdaptiveQualityGovernorEvent;
+    config.eventContext = (__bridge void *)self;
+    os_unfair_lock_lock(&_lock);
+    if (QualityGovernorInit(&_governor, &config) != 0) {
+        // No knob to step through: it never changes level and reports full quality.
+        _governor.settings = QualityGovernorFullQuality();
+    }
+    [_pendingEvents removeAllObjects];
+    os_unfair_lock_unlock(&_lock);
+}
+
+- (BOOL)isEnabled {
+    os_unfair_lock_lock(&_lock);
+    BOOL enabled = _enabled;
+    os_unfair_lock_unlock(&_lock);
+    return enabled;
+}
+
+- (void)setEnabled:(BOOL)enabled {
+    os_unfair_lock_lock(&_lock);
+    _enabled = enabled;
+    os_unfair_lock_unlock(&_lock);
+    if (!enabled) {
+        [self reset];
+    }
+}
+
+- (QualitySettings)currentSettings {
+    os_unfair_lock_lock(&_lock);
+    QualitySettings settings = _governor.settings;
+    os_unfair_lock_unlock(&_lock);
+    return settings;
+}
+
+- (NSInteger)level {
+    os_unfair_lock_lock(&_lock);
+    NSInteger level = _governor.stats.level;
+    os_unfair_lock_unlock(&_lock);
+    return level;
+}
+
+- (CGFloat)renderScale {
+    return (CGFloat)[self currentSettings].values[QualityKnobRenderScale] / 100.0;
+}
+
+- (NSInteger)faceDetectionInterval {
+    return [self currentSettings].values[QualityKnobDetectionInterval];
+}
+
+- (NSInteger)smoothingQuality {
+    return [self currentSettings].values[QualityKnobSmoothingQuality];
+}
+
+- (BOOL)optionalEffectsEnabled {
+    return [self currentSettings].values[QualityKnobOptionalEffects] != 0;
+}
+
+- (NSDictionary<NSString *, id> *)statistics {
+    os_unfair_lock_lock(&_lock);
+    QualityGovernorStats stats = QualityGovernorGetStats(&_governor);
+    int stepCount = _governor.config.stepCount;
+    os_unfair_lock_unlock(&_lock);
+
+    NSMutableArray<NSNumber *> *framesAtLevel = [NSMutableArray array];
+    for (int i = 0; i <= stepCount; i++) {
+        [framesAtLevel addObject:@(stats.framesAtLevel[i])];
+    }
+    return @{
+        @"frames": @(stats.frames),
+        @"overBudgetFrames": @(stats.overBudget),
+        @"stepDowns": @(stats.stepDowns),
+        @"stepUps": @(stats.stepUps),
+        @"reverts": @(stats.reverts),
+        @"level": @(stats.level),
+        @"maxLevel": @(stats.maxLevel),
+        @"averageFrameMs": @(stats.averageFrameMs),
+        @"budgetMs": @(stats.budgetMs),
+        @"upDwellFrames": @(stats.upFrames),
+        @"framesAtLevel": framesAtLevel,
+    };
+}
+
+- (void)recordProcessingTime:(double)processingTimeMs {
+    os_unfair_lock_lock(&_lock);
+    if (!_enabled || processingTimeMs < 0.0) {
+        os_unfair_lock_unlock(&_lock);
+        return;
+    }
+    QualityGovernorRecordFrame(&_governor, processingTimeMs);
+    NSArray<NSDictionary *> *events = nil;
+    if (_pendingEvents.count > 0) {
+        events = [_pendingEvents copy];
+        [_pendingEvents removeAllObjects];
+    }
+    os_unfair_lock_unlock(&_lock);
+
+    if (!events) {
+        return;
+    }
+    dispatch_async(dispatch_get_main_queue(), ^{
+        for (NSDictionary *event in events) {
+            NSLog(@"⏱️ Quality governor: %@ to level %@ (%@ = %@, frame %.1f ms of %.1f ms)",
+                  event[@"direction"], event[@"level"], event[@"knob"], event[@"value"],
+                  [event[@"frameMs"] doubleValue], [event[@"budgetMs"] doubleValue]);
+            if (self.changeHandler) {
+                self.changeHandler(self, event);
+            }
+            [[NSNotificationCenter defaultCenter] postNotificationName:AdaptiveQualityGovernorDidChangeNotification
+                                                                object:self
+                                                              userInfo:event];
+        }
+    });
+}
+
+@end
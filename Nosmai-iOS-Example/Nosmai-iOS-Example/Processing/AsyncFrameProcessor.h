@@ -0,0 +1,69 @@
+//
+//  AsyncFrameProcessor.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#import <Foundation/Foundation.h>
+#import <CoreVideo/CoreVideo.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+typedef NS_ENUM(NSInteger, AsyncFrameSubmissionPolicy) {
+    /// Frames are processed in order, at most queueDepth waiting; a frame arriving when full is dropped
+    AsyncFrameSubmissionPolicyFIFO = 0,
+    /// One waiting slot; a new frame replaces the one waiting, so the output is never more than one frame stale
+    AsyncFrameSubmissionPolicyLatestFrame = 1,
+};
+
+/// Error code passed to the completion of a frame that was never processed
+typedef NS_ENUM(NSInteger, AsyncFrameProcessorErrorCode) {
+    AsyncFrameProcessorErrorDropped = 1,    // Replaced by a newer frame or refused by a full queue
+    AsyncFrameProcessorErrorCancelled = 2,  // Still waiting when the processor went away
+};
+
+extern NSString * const AsyncFrameProcessorErrorDomain;
+
+typedef void (^AsyncFrameCompletion)(BOOL success, NSError * _Nullable error);
+
+/**
+ * Submission front end for -[NosmaiSDK processFrameAsync:mirror:completion:].
+ *
+ * Calling processFrameAsync directly for every camera frame lets requests
+ * pile up whenever processing is slower than the camera, and every frame
+ * then waits behind all of the earlier ones: latency grows without bound
+ * while the preview shows ever older frames. Here only one frame is handed
+ * to the SDK at a time and the rest wait under the chosen policy, so the
+ * wait is bounded by the depth.
+ *
+ * Every submitted frame gets exactly one completion: the SDK's for frames
+ * that were processed, AsyncFrameProcessorErrorDropped (on the submitting
+ * thread) for frames that were replaced or refused.
+ *
+ * The example app never calls processFrameAsync, so it has none.
+ */
+@interface AsyncFrameProcessor : NSObject
+
+@property (nonatomic, readonly) AsyncFrameSubmissionPolicy policy;
+/// Frames allowed to wait for the SDK; always 1 for the latest-frame policy
+@property (nonatomic, readonly) NSUInteger queueDepth;
+@property (nonatomic, assign) BOOL mirror;
+
+/**
+ * submitted, processed, failed, dropped, pending, maxPending,
+ * averageWaitMs (submit -> handed to the SDK), averageProcessMs (inside
+ * processFrameAsync), averageLatencyMs and maxLatencyMs (submit -> completion)
+ */
+@property (nonatomic, readonly) NSDictionary<NSString *, NSNumber *> *statistics;
+
+/// Latest-frame policy
+- (instancetype)init;
+- (nullable instancetype)initWithPolicy:(AsyncFrameSubmissionPolicy)policy queueDepth:(NSUInteger)queueDepth NS_DESIGNATED_INITIALIZER;
+
+/// @return NO if the frame was dropped at once (its completion has already run)
+- (BOOL)submitPixelBuffer:(CVPixelBufferRef)pixelBuffer completion:(nullable AsyncFrameCompletion)completion;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,174 @@
+//
+//  AsyncFrameProcessor.m
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#import "AsyncFrameProcessor.h"
+#import <nosmai/Nosmai.h>
+#import <os/lock.h>
+#include <time.h>
+#include "FrameMailbox.h"
+
+NSString * const AsyncFrameProcessorErrorDomain = @"AsyncFrameProcessor";
+
+static double AsyncFrameProcessorNowMs(void) {
+    return (double)clock_gettime_nsec_np(CLOCK_UPTIME_RAW) / 1.0e6;
+}
+
+typedef struct {
+    CVPixelBufferRef pixelBuffer;
+    void *completion;  // AsyncFrameCompletion, retained
+    double submitMs;
+} AsyncFrameItem;
+
+static AsyncFrameItem *AsyncFrameItemCreate(CVPixelBufferRef pixelBuffer, AsyncFrameCompletion completion) {
+    AsyncFrameItem *item = malloc(sizeof(AsyncFrameItem));
+    if (item) {
+        item->pixelBuffer = CVPixelBufferRetain(pixelBuffer);
+        item->completion = completion ? (void *)CFBridgingRetain([completion copy]) : NULL;
+        item->submitMs = AsyncFrameProcessorNowMs();
+    }
+    return item;
+}
+
+/// Runs the completion and frees the item
+static void AsyncFrameItemFinish(AsyncFrameItem *item, BOOL success, NSError *error) {
+    AsyncFrameCompletion completion = item->completion ? CFBridgingRelease(item->completion) : nil;
+    CVPixelBufferRelease(item->pixelBuffer);
+    free(item);
+    if (completion) {
+        completion(success, error);
+    }
+}
+
+static NSError *AsyncFrameProcessorError(AsyncFrameProcessorErrorCode code, NSString *description) {
+    return [NSError errorWithDomain:AsyncFrameProcessorErrorDomain
+                               code:code
+                           userInfo:@{NSLocalizedDescriptionKey: description}];
+}
+
+@implementation AsyncFrameProcessor {
+    os_unfair_lock _lock;
+    FrameMailbox _mailbox;
+
+    // Guarded by _lock.
+    BOOL _inFlight;
+    uint64_t _processed;
+    uint64_t _failed;
+    double _processMs;
+    double _latencyMs;
+    double _maxLatencyMs;
+}
+
+- (instancetype)init {
+    return [self initWithPolicy:AsyncFrameSubmissionPolicyLatestFrame queueDepth:1];
+}
+
+- (nullable instancetype)initWithPolicy:(AsyncFrameSubmissionPolicy)policy queueDepth:(NSUInteger)queueDepth {
+    self = [super init];
+    if (self) {
+        FrameMailboxPolicy mailboxPolicy = policy == AsyncFrameSubmissionPolicyFIFO ? FrameMailboxPolicyFIFO : FrameMailboxPolicyLatest;
+        if (FrameMailboxInit(&_mailbox, mailboxPolicy, queueDepth) != 0) {
+            return nil;
+        }
+        _lock = OS_UNFAIR_LOCK_INIT;
+        _policy = policy;
+        _queueDepth = _mailbox.capacity;
+    }
+    return self;
+}
+
+- (void)dealloc {
+    // A frame in flight keeps the processor alive, so only waiting frames are left.
+    void *item = NULL;
+    while (FrameMailboxTake(&_mailbox, AsyncFrameProcessorNowMs(), &item)) {
+        AsyncFrameItemFinish(item, NO, AsyncFrameProcessorError(AsyncFrameProcessorErrorCancelled, @"The frame processor went away"));
+    }
+    FrameMailboxFree(&_mailbox);
+}
+
+#pragma mark - Submission
+
+- (BOOL)submitPixelBuffer:(CVPixelBufferRef)pixelBuffer completion:(AsyncFrameCompletion)completion {
+    AsyncFrameItem *item = AsyncFrameItemCreate(pixelBuffer, completion);
+    if (!item) {
+        if (completion) {
+            completion(NO, AsyncFrameProcessorError(AsyncFrameProcessorErrorDropped, @"Out of memory"));
+        }
+        return NO;
+    }
+    void *displaced = NULL;
+    FrameMailboxPushResult result = FrameMailboxPush(&_mailbox, item, item->submitMs, &displaced);
+    if (result == FrameMailboxPushRejected) {
+        AsyncFrameItemFinish(item, NO, AsyncFrameProcessorError(AsyncFrameProcessorErrorDropped, @"The frame queue is full"));
+        return NO;
+    }
+    if (result == FrameMailboxPushReplaced) {
+        AsyncFrameItemFinish(displaced, NO, AsyncFrameProcessorError(AsyncFrameProcessorErrorDropped, @"Replaced by a newer frame"));
+    }
+    [self processNextFrame];
+    return YES;
+}
+
+// Hands the oldest waiting frame to the SDK unless one is already there.
+// Called after every submit and every completion, so a frame pushed while
+// the previous one completes is picked up by one of the two.
+- (void)processNextFrame {
+    void *next = NULL;
+    os_unfair_lock_lock(&_lock);
+    BOOL start = !_inFlight && FrameMailboxTake(&_mailbox, AsyncFrameProcessorNowMs(), &next);
+    if (start) {
+        _inFlight = YES;
+    }
+    os_unfair_lock_unlock(&_lock);
+    if (!start) {
+        return;
+    }
+
+    AsyncFrameItem *item = next;
+    double startMs = AsyncFrameProcessorNowMs();
+    [[NosmaiSDK sharedInstance] processFrameAsync:item->pixelBuffer mirror:self.mirror completion:^(BOOL success, NSError *error) {
+        double now = AsyncFrameProcessorNowMs();
+        double latency = now - item->submitMs;
+        os_unfair_lock_lock(&self->_lock);
+        self->_inFlight = NO;
+        if (success) {
+            self->_processed++;
+        } else {
+            self->_failed++;
+        }
+        self->_processMs += now - startMs;
+        self->_latencyMs += latency;
+        self->_maxLatencyMs = MAX(self->_maxLatencyMs, latency);
+        os_unfair_lock_unlock(&self->_lock);
+
+        AsyncFrameItemFinish(item, success, error);
+        [self processNextFrame];
+    }];
+}
+
+#pragma mark - Metrics
+
+- (NSDictionary<NSString *, NSNumber *> *)statistics {
+    FrameMailboxStats mailbox = FrameMailboxGetStats(&_mailbox);
+    os_unfair_lock_lock(&_lock);
+    uint64_t finished = _processed + _failed;
+    NSDictionary *stats = @{
+        @"submitted": @(mailbox.submitted),
+        @"processed": @(_processed),
+        @"failed": @(_failed),
+        @"dropped": @(mailbox.replaced + mailbox.rejected),
+        @"pending": @(mailbox.depth),
+        @"maxPending": @(mailbox.maxDepth),
+        @"averageWaitMs": @(mailbox.averageWaitMs),
+        @"averageProcessMs": @(finished > 0 ? _processMs / (double)finished : 0.0),
+        @"averageLatencyMs": @(finished > 0 ? _latencyMs / (double)finished : 0.0),
+        @"maxLatencyMs": @(_maxLatencyMs),
+    };
+    os_unfair_lock_unlock(&_lock);
+    return stats;
+}
+
+@end
@@ -0,0 +1,356 @@
+//
+//  BeautyKernels.c
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 18/10/2026.
+//
+
+#include "BeautyKernels.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Padding around the face box that still receives skin effects (forehead, jaw).
+static const float kBeautyPadding = 0.25f;
+// Colour difference above which smoothing backs off to keep edges sharp.
+static const float kSmoothingEdgeThreshold = 40.0f;
+static const int kMaxSmoothingRadius = 7;
+
+typedef struct {
+    float cx, cy;
+    float invRadiusX, invRadiusY;
+} BeautyEllipse;
+
+typedef struct {
+    const FaceRegionBox *face;
+    const MakeupWarpedMask *lipstickMask;
+    const MakeupWarpedMask *blusherMask;
+    BeautyEllipse mouth;
+    BeautyEllipse cheeks[2];
+} BeautyFaceGeometry;
+
+void BeautyContextInit(BeautyContext *context) {
+    memset(context, 0, sizeof(*context));
+    context->whitenLevel = -1.0f;
+}
+
+void BeautyContextFree(BeautyContext *context) {
+    free(context->rowSums);
+    free(context->columnSums);
+    free(context->blurred);
+    memset(context, 0, sizeof(*context));
+}
+
+int BeautyParamsActive(const BeautyParams *params) {
+    return params->smoothing > 0.0f || params->whitening > 0.0f || params->lipstick > 0.0f || params->blusher > 0.0f;
+}
+
+static int BeautyReserve(void **buffer, size_t *capacity, size_t bytes) {
+    if (bytes <= *capacity) {
+        return 1;
+    }
+    void *resized = realloc(*buffer, bytes);
+    if (!resized) {
+        return 0;
+    }
+    *buffer = resized;
+    *capacity = bytes;
+    return 1;
+}
+
+static void BeautyUpdateWhitenLUT(BeautyContext *context, float level) {
+    if (context->whitenLevel == level) {
+        return;
+    }
+    // Log curve: lifts mid-tones while keeping black and white fixed.
+    float beta = 1.0f + level * 4.0f;
+    float invLogBeta = 1.0f / logf(beta);
+    for (int v = 0; v < 256; v++) {
+        float x = (float)v / 255.0f;
+        float y = level > 0.0f ? logf(x * (beta - 1.0f) + 1.0f) * invLogBeta : x;
+        context->whitenLUT[v] = (uint8_t)fminf(255.0f, y * 255.0f + 0.5f);
+    }
+    context->whitenLevel = level;
+}
+
+static BeautyEllipse BeautyMakeEllipse(float cx, float cy, float radiusX, float radiusY) {
+    BeautyEllipse ellipse = {cx, cy, 1.0f / radiusX, 1.0f / radiusY};
+    return ellipse;
+}
+
+static inline float BeautyEllipseWeight(const BeautyEllipse *ellipse, float x, float y) {
+    float nx = (x - ellipse->cx) * ellipse->invRadiusX;
+    float ny = (y - ellipse->cy) * ellipse->invRadiusY;
+    float distSq = nx * nx + ny * ny;
+    if (distSq >= 1.0f) {
+        return 0.0f;
+    }
+    float t = 1.0f - distSq;
+    return t * t;
+}
+
+static BeautyFaceGeometry BeautyMakeGeometry(const FaceRegionBox *face, const BeautyFaceMasks *masks) {
+    float w = face->width;
+    float h = face->height;
+    BeautyFaceGeometry geometry;
+    geometry.face = face;
+    geometry.lipstickMask = masks ? masks->lipstick : NULL;
+    geometry.blusherMask = masks ? masks->blusher : NULL;
+    geometry.mouth = BeautyMakeEllipse(face->x + 0.5f * w, face->y + 0.80f * h, 0.17f * w, 0.07f * h);
+    geometry.cheeks[0] = BeautyMakeEllipse(face->x + 0.25f * w, face->y + 0.62f * h, 0.13f * w, 0.09f * h);
+    geometry.cheeks[1] = BeautyMakeEllipse(face->x + 0.75f * w, face->y + 0.62f * h, 0.13f * w, 0.09f * h);
+    return geometry;
+}
+
+static int BeautyFaceTouchesRect(const FaceRegionBox *face, const FaceRegionRect *rect) {
+    float padX = face->width * kBeautyPadding;
+    float padY = face->height * kBeautyPadding;
+    return face->x - padX < (float)rect->x1 && face->x + face->width + padX > (float)rect->x0 &&
+           face->y - padY < (float)rect->y1 && face->y + face->height + padY > (float)rect->y0;
+}
+
+static inline int BeautyClamp(int value, int low, int high) {
+    return value < low ? low : (value > high ? high : value);
+}
+
+// Separable box blur of the rect into context->blurred (tightly packed RGBA).
+// Reads up to `radius` pixels outside the rect from src with edge replication.
+static int BeautyBoxBlurRect(BeautyContext *context,
+                             const FaceRegionRect *rect,
+                             int radius,
+                             const uint8_t *src,
+                             size_t srcStride,
+                             int width,
+                             int height) {
+    int rectW = rect->x1 - rect->x0;
+    int rectH = rect->y1 - rect->y0;
+    int rows = rectH + 2 * radius;
+    size_t rowSumCount = (size_t)rows * (size_t)rectW * 4;
+    if (!BeautyReserve((void **)&context->rowSums, &context->rowSumsCapacity, rowSumCount * sizeof(uint16_t)) ||
+        !BeautyReserve((void **)&context->columnSums, &context->columnSumsCapacity, (size_t)rectW * 4 * sizeof(uint32_t)) ||
+        !BeautyReserve((void **)&context->blurred, &context->blurredCapacity, (size_t)rectW * (size_t)rectH * 4)) {
+        return 0;
+    }
+
+    // Horizontal running sums.
+    for (int i = 0; i < rows; i++) {
+        int sy = BeautyClamp(rect->y0 - radius + i, 0, height - 1);
+        const uint8_t *row = src + (size_t)sy * srcStride;
+        uint16_t *out = context->rowSums + (size_t)i * (size_t)rectW * 4;
+        uint32_t sum[4] = {0, 0, 0, 0};
+        for (int k = -radius; k <= radius; k++) {
+            const uint8_t *p = row + (size_t)BeautyClamp(rect->x0 + k, 0, width - 1) * 4;
+            for (int c = 0; c < 4; c++) sum[c] += p[c];
+        }
+        for (int x = 0; x < rectW; x++) {
+            for (int c = 0; c < 4; c++) out[x * 4 + c] = (uint16_t)sum[c];
+            const uint8_t *add = row + (size_t)BeautyClamp(rect->x0 + x + radius + 1, 0, width - 1) * 4;
+            const uint8_t *sub = row + (size_t)BeautyClamp(rect->x0 + x - radius, 0, width - 1) * 4;
+            for (int c = 0; c < 4; c++) sum[c] = sum[c] + add[c] - sub[c];
+        }
+    }
+
+    // Vertical running sums over the horizontal sums.
+    size_t rowLength = (size_t)rectW * 4;
+    uint32_t *columns = context->columnSums;
+    memset(columns, 0, rowLength * sizeof(uint32_t));
+    for (int i = 0; i <= 2 * radius; i++) {
+        const uint16_t *row = context->rowSums + (size_t)i * rowLength;
+        for (size_t k = 0; k < rowLength; k++) columns[k] += row[k];
+    }
+    uint32_t area = (uint32_t)((2 * radius + 1) * (2 * radius + 1));
+    uint32_t half = area / 2;
+    for (int y = 0; y < rectH; y++) {
+        uint8_t *out = context->blurred + (size_t)y * rowLength;
+        for (size_t k = 0; k < rowLength; k++) out[k] = (uint8_t)((columns[k] + half) / area);
+        if (y + 1 < rectH) {
+            const uint16_t *add = context->rowSums + (size_t)(y + 2 * radius + 1) * rowLength;
+            const uint16_t *sub = context->rowSums + (size_t)y * rowLength;
+            for (size_t k = 0; k < rowLength; k++) columns[k] = columns[k] + add[k] - sub[k];
+        }
+    }
+    return 1;
+}
+
+static void BeautyProcessRect(BeautyContext *context,
+                              const BeautyParams *params,
+                              const BeautyFaceGeometry *geometry,
+                              size_t faceCount,
+                              const FaceRegionRect *rect,
+                              const uint8_t *src,
+                              size_t srcStride,
+                              uint8_t *dst,
+                              size_t dstStride,
+                              int width,
+                              int height) {
+    const BeautyFaceGeometry *candidates[BEAUTY_MAX_FACES];
+    size_t candidateCount = 0;
+    for (size_t i = 0; i < faceCount && candidateCount < BEAUTY_MAX_FACES; i++) {
+        if (BeautyFaceTouchesRect(geometry[i].face, rect)) {
+            candidates[candidateCount++] = &geometry[i];
+        }
+    }
+    if (candidateCount == 0) {
+        return;
+    }
+
+    int smoothing = params->smoothing > 0.0f;
+    int radius = 1 + (int)(fminf(params->smoothing, 1.0f) * (float)(kMaxSmoothingRadius - 1));
+    if (smoothing && !BeautyBoxBlurRect(context, rect, radius, src, srcStride, width, height)) {
+        smoothing = 0;
+    }
+    int whitening = params->whitening > 0.0f;
+    int rectW = rect->x1 - rect->x0;
+
+    for (int y = rect->y0; y < rect->y1; y++) {
+        const uint8_t *srcRow = src + (size_t)y * srcStride;
+        uint8_t *dstRow = dst + (size_t)y * dstStride;
+        const uint8_t *blurRow = smoothing ? context->blurred + (size_t)(y - rect->y0) * (size_t)rectW * 4 : NULL;
+        float fy = (float)y + 0.5f;
+
+        for (int x = rect->x0; x < rect->x1; x++) {
+            float fx = (float)x + 0.5f;
+            float skin = 0.0f;
+            float lips = 0.0f;
+            float blush = 0.0f;
+            for (size_t f = 0; f < candidateCount; f++) {
+                const BeautyFaceGeometry *g = candidates[f];
+                skin = fmaxf(skin, FaceRegionFaceWeight(g->face, kBeautyPadding, fx, fy));
+                if (params->lipstick > 0.0f) {
+                    float weight = g->lipstickMask ? (float)MakeupWarpedMaskCoverage(g->lipstickMask, x, y) / 255.0f
+                                                   : BeautyEllipseWeight(&g->mouth, fx, fy);
+                    lips = fmaxf(lips, weight);
+                }
+                if (params->blusher > 0.0f) {
+                    float weight = g->blusherMask ? (float)MakeupWarpedMaskCoverage(g->blusherMask, x, y) / 255.0f
+                                                  : fmaxf(BeautyEllipseWeight(&g->cheeks[0], fx, fy),
+                                                          BeautyEllipseWeight(&g->cheeks[1], fx, fy));
+                    blush = fmaxf(blush, weight);
+                }
+            }
+            if (skin <= 0.0f && lips <= 0.0f && blush <= 0.0f) {
+                continue;
+            }
+
+            const uint8_t *s = srcRow + (size_t)x * 4;
+            float p[3] = {s[0], s[1], s[2]};
+
+            if (smoothing && skin > 0.0f) {
+                const uint8_t *b = blurRow + (size_t)(x - rect->x0) * 4;
+                float diff = (fabsf((float)b[0] - p[0]) + fabsf((float)b[1] - p[1]) + fabsf((float)b[2] - p[2])) / 3.0f;
+                float edge = diff >= kSmoothingEdgeThreshold ? 0.0f : 1.0f - diff / kSmoothingEdgeThreshold;
+                float amount = params->smoothing * skin * edge;
+                for (int c = 0; c < 3; c++) p[c] += ((float)b[c] - p[c]) * amount;
+            }
+            if (whitening && skin > 0.0f) {
+                for (int c = 0; c < 3; c++) {
+                    uint8_t v = (uint8_t)fminf(255.0f, p[c] + 0.5f);
+                    p[c] += ((float)context->whitenLUT[v] - p[c]) * skin;
+                }
+            }
+            if (lips > 0.0f) {
+                // Multiply blend keeps lip texture under the colour.
+                float amount = params->lipstick * lips * 0.65f;
+                for (int c = 0; c < 3; c++) {
+                    float tinted = p[c] * (float)params->lipstickColor[c] / 255.0f;
+                    p[c] += (tinted - p[c]) * amount;
+                }
+            }
+            if (blush > 0.0f) {
+                float amount = params->blusher * blush * 0.35f;
+                for (int c = 0; c < 3; c++) p[c] += ((float)params->blusherColor[c] - p[c]) * amount;
+            }
+
+            uint8_t *d = dstRow + (size_t)x * 4;
+            for (int c = 0; c < 3; c++) d[c] = (uint8_t)fminf(255.0f, fmaxf(0.0f, p[c] + 0.5f));
+            d[3] = s[3];
+        }
+    }
+}
+
+static void BeautyCopyFrame(const uint8_t *src, size_t srcStride, uint8_t *dst, size_t dstStride, int width, int height) {
+    if (src == dst) {
+        return;
+    }
+    size_t rowBytes = (size_t)width * 4;
+    if (srcStride == dstStride && srcStride == rowBytes) {
+        memcpy(dst, src, rowBytes * (size_t)height);
+        return;
+    }
+    for (int y = 0; y < height; y++) {
+        memcpy(dst + (size_t)y * dstStride, src + (size_t)y * srcStride, rowBytes);
+    }
+}
+
+static void BeautyApply(BeautyContext *context,
+                        const BeautyParams *params,
+                        const FaceRegionBox *faces,
+                        const BeautyFaceMasks *masks,
+                        size_t faceCount,
+                        int fullFrame,
+                        const uint8_t *src,
+                        size_t srcStride,
+                        uint8_t *dst,
+                        size_t dstStride,
+                        int width,
+                        int height) {
+    context->stats.processedArea = 0.0f;
+    context->stats.regionCount = 0;
+    BeautyCopyFrame(src, srcStride, dst, dstStride, width, height);
+    if (!BeautyParamsActive(params) || faceCount == 0 || width <= 0 || height <= 0) {
+        return;
+    }
+    if (faceCount > BEAUTY_MAX_FACES) {
+        faceCount = BEAUTY_MAX_FACES;
+    }
+    BeautyUpdateWhitenLUT(context, fminf(fmaxf(params->whitening, 0.0f), 1.0f));
+
+    BeautyFaceGeometry geometry[BEAUTY_MAX_FACES];
+    for (size_t i = 0; i < faceCount; i++) {
+        geometry[i] = BeautyMakeGeometry(&faces[i], masks ? &masks[i] : NULL);
+    }
+
+    FaceRegionRect rects[BEAUTY_MAX_FACES];
+    size_t rectCount;
+    if (fullFrame) {
+        rects[0] = (FaceRegionRect){0, 0, width, height};
+        rectCount = 1;
+    } else {
+        rectCount = FaceRegionBuild(faces, faceCount, kBeautyPadding, 0, width, height, rects, BEAUTY_MAX_FACES);
+    }
+    for (size_t i = 0; i < rectCount; i++) {
+        BeautyProcessRect(context, params, geometry, faceCount, &rects[i], src, srcStride, dst, dstStride, width, height);
+    }
+
+    context->stats.regionCount = (uint32_t)rectCount;
+    context->stats.processedArea = (float)((double)FaceRegionArea(rects, rectCount) / ((double)width * (double)height));
+}
+
+void BeautyApplyRGBA(BeautyContext *context,
+                     const BeautyParams *params,
+                     const FaceRegionBox *faces,
+                     const BeautyFaceMasks *masks,
+                     size_t faceCount,
+                     const uint8_t *src,
+                     size_t srcStride,
+                     uint8_t *dst,
+                     size_t dstStride,
+                     int width,
+                     int height) {
+    BeautyApply(context, params, faces, masks, faceCount, 0, src, srcStride, dst, dstStride, width, height);
+}
+
+void BeautyApplyFullFrameRGBA(BeautyContext *context,
+                              const BeautyParams *params,
+                              const FaceRegionBox *faces,
+                              const BeautyFaceMasks *masks,
+                              size_t faceCount,
+                              const uint8_t *src,
+                              size_t srcStride,
+                              uint8_t *dst,
+                              size_t dstStride,
+                              int width,
+                              int height) {
+    BeautyApply(context, params, faces, masks, faceCount, 1, src, srcStride, dst, dstStride, width, height);
+}
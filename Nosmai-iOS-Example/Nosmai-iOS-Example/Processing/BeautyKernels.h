@@ -0,0 +1,108 @@
+//
+//  BeautyKernels.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 18/10/2026.
+//
+
+#ifndef BEAUTY_KERNELS_H
+#define BEAUTY_KERNELS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "FaceRegion.h"
+#include "MakeupMaskCache.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define BEAUTY_MAX_FACES 8
+
+/**
+ * Face-local beauty and makeup parameters. Levels are 0.0 (off) .. 1.0 (max),
+ * matching applySkinSmoothing:, applySkinWhitening: and
+ * applyMakeupBlendLevel:level: in the SDK. Colors are given in the channel
+ * order of the frame (BGRA for camera buffers).
+ */
+typedef struct {
+    float smoothing;
+    float whitening;
+    float lipstick;
+    float blusher;
+    uint8_t lipstickColor[4];
+    uint8_t blusherColor[4];
+} BeautyParams;
+
+/**
+ * Warped makeup masks for one face (see MakeupMaskCache). A NULL mask falls
+ * back to the analytic mouth / cheek ellipses.
+ */
+typedef struct {
+    const MakeupWarpedMask *lipstick;
+    const MakeupWarpedMask *blusher;
+} BeautyFaceMasks;
+
+typedef struct {
+    float processedArea;   // Fraction of the frame computed by the last call
+    uint32_t regionCount;  // Number of merged face regions in the last call
+} BeautyStats;
+
+typedef struct {
+    uint16_t *rowSums;
+    size_t rowSumsCapacity;
+    uint32_t *columnSums;
+    size_t columnSumsCapacity;
+    uint8_t *blurred;
+    size_t blurredCapacity;
+    uint8_t whitenLUT[256];
+    float whitenLevel;
+    BeautyStats stats;
+} BeautyContext;
+
+void BeautyContextInit(BeautyContext *context);
+void BeautyContextFree(BeautyContext *context);
+
+/// YES when any level would change the image
+int BeautyParamsActive(const BeautyParams *params);
+
+/**
+ * Applies smoothing, whitening, lipstick and blusher inside padded regions
+ * around the faces only. Pixels outside those regions are copied through (or
+ * left untouched when src == dst, which is supported). With no faces the call
+ * costs a copy at most. masks is either NULL or holds faceCount entries.
+ */
+void BeautyApplyRGBA(BeautyContext *context,
+                     const BeautyParams *params,
+                     const FaceRegionBox *faces,
+                     const BeautyFaceMasks *masks,
+                     size_t faceCount,
+                     const uint8_t *src,
+                     size_t srcStride,
+                     uint8_t *dst,
+                     size_t dstStride,
+                     int width,
+                     int height);
+
+/**
+ * Same kernels evaluated over every pixel of the frame, the way a full-frame
+ * filter pass would. Kept as the reference for benchmarks and output checks.
+ */
+void BeautyApplyFullFrameRGBA(BeautyContext *context,
+                              const BeautyParams *params,
+                              const FaceRegionBox *faces,
+                              const BeautyFaceMasks *masks,
+                              size_t faceCount,
+                              const uint8_t *src,
+                              size_t srcStride,
+                              uint8_t *dst,
+                              size_t dstStride,
+                              int width,
+                              int height);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BEAUTY_KERNELS_H */
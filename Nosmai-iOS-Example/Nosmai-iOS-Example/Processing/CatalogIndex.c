@@ -0,0 +1,400 @@
+//
+//  CatalogIndex.c
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#include "CatalogIndex.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+
+enum {
+    kCatalogMagic = 0x4E434958,  // "NCIX"
+    kCatalogVersion = 1,
+    kCatalogStringCount = 6,
+    kCatalogHashChunk = 64 * 1024,
+};
+
+static const uint64_t kCatalogFnvOffset = 1469598103934665603ULL;
+static const uint64_t kCatalogFnvPrime = 1099511628211ULL;
+
+static double CatalogNowMs(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1000.0 + (double)ts.tv_nsec / 1.0e6;
+}
+
+static int64_t CatalogStatMtimeNs(const struct stat *st) {
+#if defined(__APPLE__)
+    return (int64_t)st->st_mtimespec.tv_sec * 1000000000LL + (int64_t)st->st_mtimespec.tv_nsec;
+#else
+    return (int64_t)st->st_mtim.tv_sec * 1000000000LL + (int64_t)st->st_mtim.tv_nsec;
+#endif
+}
+
+static uint64_t CatalogFnv(uint64_t hash, const uint8_t *bytes, size_t length) {
+    for (size_t i = 0; i < length; i++) {
+        hash = (hash ^ bytes[i]) * kCatalogFnvPrime;
+    }
+    return hash;
+}
+
+int CatalogHashFile(const char *path, uint64_t *hash, uint64_t *size) {
+    FILE *file = fopen(path, "rb");
+    if (!file) {
+        return -1;
+    }
+    uint8_t *chunk = malloc(kCatalogHashChunk);
+    if (!chunk) {
+        fclose(file);
+        return -1;
+    }
+    uint64_t value = kCatalogFnvOffset;
+    uint64_t total = 0;
+    size_t read;
+    while ((read = fread(chunk, 1, kCatalogHashChunk, file)) > 0) {
+        value = CatalogFnv(value, chunk, read);
+        total += read;
+    }
+    int failed = ferror(file);
+    free(chunk);
+    fclose(file);
+    if (failed) {
+        return -1;
+    }
+    *hash = value;
+    *size = total;
+    return 0;
+}
+
+static void CatalogEntryStrings(CatalogEntry *entry, char **strings[kCatalogStringCount]) {
+    strings[0] = &entry->name;
+    strings[1] = &entry->displayName;
+    strings[2] = &entry->type;
+    strings[3] = &entry->group;
+    strings[4] = &entry->packagePath;
+    strings[5] = &entry->previewPath;
+}
+
+static void CatalogEntryFree(CatalogEntry *entry) {
+    char **strings[kCatalogStringCount];
+    CatalogEntryStrings(entry, strings);
+    for (int i = 0; i < kCatalogStringCount; i++) {
+        free(*strings[i]);
+    }
+    free(entry->attributes);
+    memset(entry, 0, sizeof(*entry));
+}
+
+static char *CatalogCopyString(const char *string) {
+    const char *source = string ? string : "";
+    size_t length = strlen(source);
+    char *copy = malloc(length + 1);
+    if (copy) {
+        memcpy(copy, source, length + 1);
+    }
+    return copy;
+}
+
+void CatalogIndexInit(CatalogIndex *index) {
+    memset(index, 0, sizeof(*index));
+}
+
+void CatalogIndexClear(CatalogIndex *index) {
+    for (size_t i = 0; i < index->count; i++) {
+        CatalogEntryFree(&index->entries[i]);
+    }
+    index->count = 0;
+}
+
+void CatalogIndexFree(CatalogIndex *index) {
+    CatalogIndexClear(index);
+    free(index->entries);
+    memset(index, 0, sizeof(*index));
+}
+
+/// @return A zeroed slot at the end, or NULL
+static CatalogEntry *CatalogIndexAppend(CatalogIndex *index) {
+    if (index->count == index->capacity) {
+        size_t capacity = index->capacity > 0 ? index->capacity * 2 : 64;
+        CatalogEntry *entries = realloc(index->entries, capacity * sizeof(CatalogEntry));
+        if (!entries) {
+            return NULL;
+        }
+        index->entries = entries;
+        index->capacity = capacity;
+    }
+    CatalogEntry *entry = &index->entries[index->count++];
+    memset(entry, 0, sizeof(*entry));
+    return entry;
+}
+
+int CatalogIndexPut(CatalogIndex *index, const CatalogEntry *entry) {
+    CatalogEntry copy;
+    memset(&copy, 0, sizeof(copy));
+    char **copyStrings[kCatalogStringCount];
+    char **sourceStrings[kCatalogStringCount];
+    CatalogEntryStrings(&copy, copyStrings);
+    CatalogEntryStrings((CatalogEntry *)entry, sourceStrings);
+    int failed = 0;
+    for (int i = 0; i < kCatalogStringCount; i++) {
+        *copyStrings[i] = CatalogCopyString(*sourceStrings[i]);
+        failed = failed || !*copyStrings[i];
+    }
+    if (entry->attributesSize > 0) {
+        copy.attributes = malloc(entry->attributesSize);
+        failed = failed || !copy.attributes;
+        if (copy.attributes) {
+            memcpy(copy.attributes, entry->attributes, entry->attributesSize);
+            copy.attributesSize = entry->attributesSize;
+        }
+    }
+    if (!failed && copy.packagePath[0] != '\0') {
+        struct stat st;
+        failed = stat(copy.packagePath, &st) != 0 || CatalogHashFile(copy.packagePath, &copy.contentHash, &copy.size) != 0;
+        copy.mtimeNs = failed ? 0 : CatalogStatMtimeNs(&st);
+    }
+    if (failed) {
+        CatalogEntryFree(&copy);
+        return -1;
+    }
+
+    for (size_t i = 0; i < index->count; i++) {
+        CatalogEntry *existing = &index->entries[i];
+        if (strcmp(existing->name, copy.name) == 0 && strcmp(existing->group, copy.group) == 0) {
+            CatalogEntryFree(existing);
+            *existing = copy;
+            return 0;
+        }
+    }
+    CatalogEntry *slot = CatalogIndexAppend(index);
+    if (!slot) {
+        CatalogEntryFree(&copy);
+        return -1;
+    }
+    *slot = copy;
+    return 0;
+}
+
+const CatalogEntry *CatalogIndexFindPackage(const CatalogIndex *index, const char *packagePath) {
+    for (size_t i = 0; i < index->count; i++) {
+        if (strcmp(index->entries[i].packagePath, packagePath) == 0) {
+            return &index->entries[i];
+        }
+    }
+    return NULL;
+}
+
+typedef struct {
+    uint8_t *bytes;
+    size_t length;
+    size_t capacity;
+    int failed;
+} CatalogWriter;
+
+static void CatalogWrite(CatalogWriter *writer, const void *bytes, size_t length) {
+    if (writer->failed || length == 0) {
+        return;
+    }
+    if (writer->length + length > writer->capacity) {
+        size_t capacity = writer->capacity > 0 ? writer->capacity : 4096;
+        while (capacity < writer->length + length) {
+            capacity *= 2;
+        }
+        uint8_t *grown = realloc(writer->bytes, capacity);
+        if (!grown) {
+            writer->failed = 1;
+            return;
+        }
+        writer->bytes = grown;
+        writer->capacity = capacity;
+    }
+    memcpy(writer->bytes + writer->length, bytes, length);
+    writer->length += length;
+}
+
+static void CatalogWriteBlob(CatalogWriter *writer, const void *bytes, size_t length) {
+    uint32_t length32 = (uint32_t)length;
+    CatalogWrite(writer, &length32, sizeof(length32));
+    CatalogWrite(writer, bytes, length);
+}
+
+typedef struct {
+    const uint8_t *bytes;
+    size_t length;
+    size_t offset;
+    int failed;
+} CatalogReader;
+
+static void CatalogRead(CatalogReader *reader, void *out, size_t length) {
+    if (reader->failed || reader->length - reader->offset < length) {
+        reader->failed = 1;
+        memset(out, 0, length);
+        return;
+    }
+    memcpy(out, reader->bytes + reader->offset, length);
+    reader->offset += length;
+}
+
+/// @return A malloc'd copy of the next blob, NUL-terminated, or NULL
+static uint8_t *CatalogReadBlob(CatalogReader *reader, size_t *length) {
+    uint32_t length32 = 0;
+    CatalogRead(reader, &length32, sizeof(length32));
+    if (reader->failed || reader->length - reader->offset < length32) {
+        reader->failed = 1;
+        return NULL;
+    }
+    uint8_t *blob = malloc((size_t)length32 + 1);
+    if (!blob) {
+        reader->failed = 1;
+        return NULL;
+    }
+    memcpy(blob, reader->bytes + reader->offset, length32);
+    blob[length32] = 0;
+    reader->offset += length32;
+    *length = length32;
+    return blob;
+}
+
+int CatalogIndexSave(const CatalogIndex *index, const char *path) {
+    CatalogWriter writer = {NULL, 0, 0, 0};
+    uint32_t header[3] = {kCatalogMagic, kCatalogVersion, (uint32_t)index->count};
+    CatalogWrite(&writer, header, sizeof(header));
+    for (size_t i = 0; i < index->count; i++) {
+        CatalogEntry *entry = &index->entries[i];
+        char **strings[kCatalogStringCount];
+        CatalogEntryStrings(entry, strings);
+        for (int s = 0; s < kCatalogStringCount; s++) {
+            CatalogWriteBlob(&writer, *strings[s], strlen(*strings[s]));
+        }
+        CatalogWrite(&writer, &entry->size, sizeof(entry->size));
+        CatalogWrite(&writer, &entry->mtimeNs, sizeof(entry->mtimeNs));
+        CatalogWrite(&writer, &entry->contentHash, sizeof(entry->contentHash));
+        CatalogWriteBlob(&writer, entry->attributes, entry->attributesSize);
+    }
+    // A torn or corrupt file fails this check on load and is rebuilt.
+    uint64_t checksum = writer.failed ? 0 : CatalogFnv(kCatalogFnvOffset, writer.bytes, writer.length);
+    CatalogWrite(&writer, &checksum, sizeof(checksum));
+    if (writer.failed) {
+        free(writer.bytes);
+        return -1;
+    }
+
+    size_t pathLength = strlen(path);
+    char *temporary = malloc(pathLength + 5);
+    if (!temporary) {
+        free(writer.bytes);
+        return -1;
+    }
+    memcpy(temporary, path, pathLength);
+    memcpy(temporary + pathLength, ".tmp", 5);
+    FILE *file = fopen(temporary, "wb");
+    int result = -1;
+    if (file) {
+        int written = fwrite(writer.bytes, 1, writer.length, file) == writer.length;
+        written = fclose(file) == 0 && written;
+        result = written && rename(temporary, path) == 0 ? 0 : -1;
+        if (result != 0) {
+            remove(temporary);
+        }
+    }
+    free(temporary);
+    free(writer.bytes);
+    return result;
+}
+
+int CatalogIndexLoad(CatalogIndex *index, const char *path) {
+    CatalogIndexClear(index);
+    FILE *file = fopen(path, "rb");
+    if (!file) {
+        return -1;
+    }
+    struct stat st;
+    uint8_t *bytes = NULL;
+    size_t length = 0;
+    if (fstat(fileno(file), &st) == 0 && st.st_size >= (off_t)(3 * sizeof(uint32_t) + sizeof(uint64_t))) {
+        length = (size_t)st.st_size;
+        bytes = malloc(length);
+    }
+    int read = bytes && fread(bytes, 1, length, file) == length;
+    fclose(file);
+    if (!read) {
+        free(bytes);
+        return -1;
+    }
+
+    size_t bodyLength = length - sizeof(uint64_t);
+    uint64_t checksum;
+    memcpy(&checksum, bytes + bodyLength, sizeof(checksum));
+    CatalogReader reader = {bytes, bodyLength, 0, CatalogFnv(kCatalogFnvOffset, bytes, bodyLength) != checksum};
+    uint32_t header[3] = {0, 0, 0};
+    CatalogRead(&reader, header, sizeof(header));
+    reader.failed = reader.failed || header[0] != kCatalogMagic || header[1] != kCatalogVersion;
+    for (uint32_t i = 0; i < header[2] && !reader.failed; i++) {
+        CatalogEntry *entry = CatalogIndexAppend(index);
+        if (!entry) {
+            reader.failed = 1;
+            break;
+        }
+        char **strings[kCatalogStringCount];
+        CatalogEntryStrings(entry, strings);
+        size_t ignored;
+        for (int s = 0; s < kCatalogStringCount; s++) {
+            *strings[s] = (char *)CatalogReadBlob(&reader, &ignored);
+        }
+        CatalogRead(&reader, &entry->size, sizeof(entry->size));
+        CatalogRead(&reader, &entry->mtimeNs, sizeof(entry->mtimeNs));
+        CatalogRead(&reader, &entry->contentHash, sizeof(entry->contentHash));
+        entry->attributes = CatalogReadBlob(&reader, &entry->attributesSize);
+        if (entry->attributesSize == 0) {
+            free(entry->attributes);
+            entry->attributes = NULL;
+        }
+    }
+    free(bytes);
+    if (reader.failed) {
+        CatalogIndexClear(index);
+        return -1;
+    }
+    return 0;
+}
+
+size_t CatalogIndexRevalidate(CatalogIndex *index, CatalogRevalidateStats *stats) {
+    memset(stats, 0, sizeof(*stats));
+    double start = CatalogNowMs();
+    size_t stale = 0;
+    for (size_t i = 0; i < index->count; i++) {
+        CatalogEntry *entry = &index->entries[i];
+        entry->stale = 0;
+        if (entry->packagePath[0] == '\0') {
+            continue;
+        }
+        struct stat st;
+        if (stat(entry->packagePath, &st) != 0) {
+            entry->stale = 1;
+            stats->missing++;
+        } else if ((uint64_t)st.st_size == entry->size && CatalogStatMtimeNs(&st) == entry->mtimeNs) {
+            stats->unchanged++;
+        } else {
+            uint64_t hash = 0;
+            uint64_t size = 0;
+            int hashed = CatalogHashFile(entry->packagePath, &hash, &size) == 0;
+            stats->bytesHashed += size;
+            if (hashed && hash == entry->contentHash && size == entry->size) {
+                entry->mtimeNs = CatalogStatMtimeNs(&st);
+                stats->touched++;
+            } else {
+                entry->stale = 1;
+                stats->changed++;
+            }
+        }
+        stale += (size_t)entry->stale;
+    }
+    stats->elapsedMs = CatalogNowMs() - start;
+    return stale;
+}
@@ -0,0 +1,93 @@
+//
+//  CatalogIndex.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#ifndef CATALOG_INDEX_H
+#define CATALOG_INDEX_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    char *name;
+    char *displayName;
+    char *type;           // local, cloud, ...
+    char *group;          // filter or effect
+    char *packagePath;    // Empty for a cloud filter that is not downloaded
+    char *previewPath;
+    uint64_t size;        // Package size, mtime and hash; zero without a package
+    int64_t mtimeNs;
+    uint64_t contentHash;
+    uint8_t *attributes;  // Opaque, stored as is (the rest of the filter's description)
+    size_t attributesSize;
+    int stale;            // Set by CatalogIndexRevalidate: the package changed or is gone
+} CatalogEntry;
+
+typedef struct {
+    CatalogEntry *entries;
+    size_t count;
+    size_t capacity;
+} CatalogIndex;
+
+typedef struct {
+    uint64_t unchanged;   // Size and mtime match; the package was not read
+    uint64_t touched;     // mtime moved but the content hash matches
+    uint64_t changed;     // Content differs
+    uint64_t missing;     // The package is gone
+    uint64_t bytesHashed;
+    double elapsedMs;
+} CatalogRevalidateStats;
+
+/**
+ * Persisted description of every filter package: what listing the
+ * catalog needs, without opening or decrypting a single package.
+ *
+ * The index is one file read in one go. Revalidation stats each package
+ * and only hashes the ones whose size or mtime moved, so an unchanged
+ * catalog of 1,000 packages costs 1,000 stats. Not thread-safe.
+ */
+void CatalogIndexInit(CatalogIndex *index);
+void CatalogIndexFree(CatalogIndex *index);
+void CatalogIndexClear(CatalogIndex *index);
+
+/**
+ * Adds a copy of entry, replacing any entry with the same name and group.
+ * Size, mtime and hash are taken from the package file when it has one.
+ *
+ * @return 0, or -1 if memory cannot be allocated or the package cannot be read
+ */
+int CatalogIndexPut(CatalogIndex *index, const CatalogEntry *entry);
+
+/// @return The entry for that package, or NULL
+const CatalogEntry *CatalogIndexFindPackage(const CatalogIndex *index, const char *packagePath);
+
+/// @return 0, or -1 if the file is missing, from another version or corrupt; the index is then empty
+int CatalogIndexLoad(CatalogIndex *index, const char *path);
+
+/// Written to a temporary file and renamed over path, so readers never see half an index. @return 0 or -1
+int CatalogIndexSave(const CatalogIndex *index, const char *path);
+
+/**
+ * Checks every package against disk and marks entries whose content
+ * changed or whose package is gone as stale. Entries only touched get the
+ * new mtime.
+ *
+ * @return The number of stale entries
+ */
+size_t CatalogIndexRevalidate(CatalogIndex *index, CatalogRevalidateStats *stats);
+
+/// FNV-1a over the file's bytes. @return 0 on success, -1 if it cannot be read
+int CatalogHashFile(const char *path, uint64_t *hash, uint64_t *size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CATALOG_INDEX_H */
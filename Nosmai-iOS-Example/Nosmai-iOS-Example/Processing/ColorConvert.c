@@ -0,0 +1,136 @@
+//
+//  ColorConvert.c
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 18/10/2026.
+//
+
+#include "ColorConvert.h"
+
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+// BT.709 video range coefficients in 8-bit fixed point.
+enum {
+    kYR = 47, kYG = 157, kYB = 16,
+    kUR = -26, kUG = -87, kUB = 112,
+    kVR = 112, kVG = -102, kVB = -10,
+};
+
+static inline uint8_t ColorConvertLuma(int r, int g, int b) {
+    return (uint8_t)(((kYR * r + kYG * g + kYB * b + 128) >> 8) + 16);
+}
+
+static inline uint8_t ColorConvertClamp(int value) {
+    return (uint8_t)(value < 0 ? 0 : (value > 255 ? 255 : value));
+}
+
+// Finishes a row pair from fromX onwards, two pixels at a time.
+static void ColorConvertRowPairScalar(const uint8_t *row0,
+                                      const uint8_t *row1,
+                                      int fromX,
+                                      int width,
+                                      int rIndex,
+                                      int bIndex,
+                                      uint8_t *y0,
+                                      uint8_t *y1,
+                                      uint8_t *uv) {
+    for (int x = fromX; x < width; x += 2) {
+        int x1 = x + 1 < width ? x + 1 : x;
+        const uint8_t *p[4] = {row0 + (size_t)x * 4, row0 + (size_t)x1 * 4, row1 + (size_t)x * 4, row1 + (size_t)x1 * 4};
+        y0[x] = ColorConvertLuma(p[0][rIndex], p[0][1], p[0][bIndex]);
+        y1[x] = ColorConvertLuma(p[2][rIndex], p[2][1], p[2][bIndex]);
+        if (x + 1 < width) {
+            y0[x + 1] = ColorConvertLuma(p[1][rIndex], p[1][1], p[1][bIndex]);
+            y1[x + 1] = ColorConvertLuma(p[3][rIndex], p[3][1], p[3][bIndex]);
+        }
+        int r = (p[0][rIndex] + p[1][rIndex] + p[2][rIndex] + p[3][rIndex] + 2) >> 2;
+        int g = (p[0][1] + p[1][1] + p[2][1] + p[3][1] + 2) >> 2;
+        int b = (p[0][bIndex] + p[1][bIndex] + p[2][bIndex] + p[3][bIndex] + 2) >> 2;
+        uv[x] = ColorConvertClamp(((kUR * r + kUG * g + kUB * b + 128) >> 8) + 128);
+        uv[x + 1] = ColorConvertClamp(((kVR * r + kVG * g + kVB * b + 128) >> 8) + 128);
+    }
+}
+
+#if defined(__ARM_NEON)
+static inline uint8x8_t ColorConvertLumaNEON(uint8x8_t r, uint8x8_t g, uint8x8_t b) {
+    uint16x8_t sum = vmull_u8(r, vdup_n_u8(kYR));
+    sum = vmlal_u8(sum, g, vdup_n_u8(kYG));
+    sum = vmlal_u8(sum, b, vdup_n_u8(kYB));
+    return vadd_u8(vrshrn_n_u16(sum, 8), vdup_n_u8(16));
+}
+
+static inline uint8x8_t ColorConvertChromaNEON(int16x8_t r, int16x8_t g, int16x8_t b, int16_t cr, int16_t cg, int16_t cb) {
+    int16x8_t sum = vmulq_n_s16(r, cr);
+    sum = vmlaq_n_s16(sum, g, cg);
+    sum = vmlaq_n_s16(sum, b, cb);
+    return vqmovun_s16(vaddq_s16(vrshrq_n_s16(sum, 8), vdupq_n_s16(128)));
+}
+
+// 16 pixels from each of two rows per step.
+static int ColorConvertRowPairNEON(const uint8_t *row0,
+                                   const uint8_t *row1,
+                                   int width,
+                                   int rIndex,
+                                   uint8_t *y0,
+                                   uint8_t *y1,
+                                   uint8_t *uv) {
+    int bIndex = 2 - rIndex;
+    int x = 0;
+    for (; x + 16 <= width; x += 16) {
+        uint8x16x4_t a = vld4q_u8(row0 + (size_t)x * 4);
+        uint8x16x4_t b = vld4q_u8(row1 + (size_t)x * 4);
+        uint8x16_t ra = a.val[rIndex], ga = a.val[1], ba = a.val[bIndex];
+        uint8x16_t rb = b.val[rIndex], gb = b.val[1], bb = b.val[bIndex];
+
+        vst1q_u8(y0 + x, vcombine_u8(ColorConvertLumaNEON(vget_low_u8(ra), vget_low_u8(ga), vget_low_u8(ba)),
+                                     ColorConvertLumaNEON(vget_high_u8(ra), vget_high_u8(ga), vget_high_u8(ba))));
+        vst1q_u8(y1 + x, vcombine_u8(ColorConvertLumaNEON(vget_low_u8(rb), vget_low_u8(gb), vget_low_u8(bb)),
+                                     ColorConvertLumaNEON(vget_high_u8(rb), vget_high_u8(gb), vget_high_u8(bb))));
+
+        // 2x2 averages: horizontal pairs of both rows, rounded down to 8 bits.
+        int16x8_t r = vreinterpretq_s16_u16(vrshrq_n_u16(vpadalq_u8(vpaddlq_u8(ra), rb), 2));
+        int16x8_t g = vreinterpretq_s16_u16(vrshrq_n_u16(vpadalq_u8(vpaddlq_u8(ga), gb), 2));
+        int16x8_t bl = vreinterpretq_s16_u16(vrshrq_n_u16(vpadalq_u8(vpaddlq_u8(ba), bb), 2));
+        uint8x8x2_t chroma;
+        chroma.val[0] = ColorConvertChromaNEON(r, g, bl, kUR, kUG, kUB);
+        chroma.val[1] = ColorConvertChromaNEON(r, g, bl, kVR, kVG, kVB);
+        vst2_u8(uv + x, chroma);
+    }
+    return x;
+}
+#endif
+
+void ColorConvertRGBAToNV12(const uint8_t *src,
+                            size_t srcStride,
+                            int width,
+                            int height,
+                            ColorConvertChannelOrder order,
+                            uint8_t *yPlane,
+                            size_t yStride,
+                            uint8_t *uvPlane,
+                            size_t uvStride) {
+    int rIndex = order == ColorConvertOrderBGRA ? 2 : 0;
+    int bIndex = 2 - rIndex;
+    for (int y = 0; y < height; y += 2) {
+        int nextY = y + 1 < height ? y + 1 : y;
+        const uint8_t *row0 = src + (size_t)y * srcStride;
+        const uint8_t *row1 = src + (size_t)nextY * srcStride;
+        uint8_t *y0 = yPlane + (size_t)y * yStride;
+        // The duplicated last row of an odd-height frame is written to itself.
+        uint8_t *y1 = yPlane + (size_t)nextY * yStride;
+        uint8_t *uv = uvPlane + (size_t)(y / 2) * uvStride;
+        int done = 0;
+#if defined(__ARM_NEON)
+        done = ColorConvertRowPairNEON(row0, row1, width, rIndex, y0, y1, uv);
+#endif
+        ColorConvertRowPairScalar(row0, row1, done, width, rIndex, bIndex, y0, y1, uv);
+    }
+}
+
+size_t ColorConvertNV12BytesTouched(int width, int height) {
+    size_t pixels = (size_t)width * (size_t)height;
+    size_t chroma = (size_t)((width + 1) / 2) * (size_t)((height + 1) / 2) * 2;
+    return pixels * 4 + pixels + chroma;
+}
@@ -0,0 +1,49 @@
+//
+//  ColorConvert.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 18/10/2026.
+//
+
+#ifndef COLOR_CONVERT_H
+#define COLOR_CONVERT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    ColorConvertOrderRGBA = 0,  // setRecordingCallback: frames
+    ColorConvertOrderBGRA = 1   // kCVPixelFormatType_32BGRA buffers
+} ColorConvertChannelOrder;
+
+/**
+ * Fused 4-channel -> NV12 (BT.709, video range) conversion.
+ *
+ * Two source rows are read once and produce two luma rows plus one
+ * interleaved CbCr row (2x2 box-averaged chroma), so the frame is touched
+ * exactly once. Output matches kCVPixelFormatType_420YpCbCr8BiPlanarVideoRange
+ * and can be written straight into an encoder pool buffer. Odd sizes replicate
+ * the last column / row for chroma.
+ */
+void ColorConvertRGBAToNV12(const uint8_t *src,
+                            size_t srcStride,
+                            int width,
+                            int height,
+                            ColorConvertChannelOrder order,
+                            uint8_t *yPlane,
+                            size_t yStride,
+                            uint8_t *uvPlane,
+                            size_t uvStride);
+
+/// Bytes read and written by one ColorConvertRGBAToNV12 call
+size_t ColorConvertNV12BytesTouched(int width, int height);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* COLOR_CONVERT_H */
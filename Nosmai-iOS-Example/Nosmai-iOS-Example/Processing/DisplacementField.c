@@ -0,0 +1,225 @@
+//
+//  DisplacementField.c
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 18/10/2026.
+//
+
+#include "DisplacementField.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Displacements smaller than this round to the same source pixel anyway.
+static const float kMinDisplacement = 1.0f / 512.0f;
+
+void DisplacementFieldInit(DisplacementField *field, int cellSize, float threshold) {
+    memset(field, 0, sizeof(*field));
+    FaceWarpBufferInit(&field->ops);
+    field->cellSize = cellSize > 0 ? cellSize : DISPLACEMENT_FIELD_DEFAULT_CELL;
+    field->threshold = threshold;
+}
+
+void DisplacementFieldFree(DisplacementField *field) {
+    FaceWarpBufferFree(&field->ops);
+    free(field->faces);
+    free(field->nodes);
+    free(field->rowScratch);
+    memset(field, 0, sizeof(*field));
+}
+
+void DisplacementFieldInvalidate(DisplacementField *field) {
+    field->valid = 0;
+}
+
+static int DisplacementFieldReserve(void **buffer, size_t *capacity, size_t bytes) {
+    if (bytes <= *capacity) {
+        return 1;
+    }
+    void *resized = realloc(*buffer, bytes);
+    if (!resized) {
+        return 0;
+    }
+    *buffer = resized;
+    *capacity = bytes;
+    return 1;
+}
+
+static int DisplacementFieldFacesMatch(const DisplacementField *field, const FaceWarpFace *faces, size_t faceCount) {
+    if (faceCount != field->faceCount) {
+        return 0;
+    }
+    float t = field->threshold;
+    for (size_t i = 0; i < faceCount; i++) {
+        const FaceWarpFace *a = &field->faces[i];
+        const FaceWarpFace *b = &faces[i];
+        if (a->slimming != b->slimming || a->eyeEnlargement != b->eyeEnlargement || a->noseScale != b->noseScale) {
+            return 0;
+        }
+        if (fabsf(a->x - b->x) > t || fabsf(a->y - b->y) > t ||
+            fabsf(a->x + a->width - b->x - b->width) > t || fabsf(a->y + a->height - b->y - b->height) > t) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static int DisplacementFieldBuild(DisplacementField *field, int width, int height) {
+    const FaceWarpBuffer *ops = &field->ops;
+    field->x0 = width;
+    field->y0 = height;
+    field->x1 = 0;
+    field->y1 = 0;
+    for (size_t i = 0; i < ops->count; i++) {
+        const FaceWarpOp *op = &ops->ops[i];
+        if (op->x0 < field->x0) field->x0 = op->x0;
+        if (op->y0 < field->y0) field->y0 = op->y0;
+        if (op->x1 > field->x1) field->x1 = op->x1;
+        if (op->y1 > field->y1) field->y1 = op->y1;
+    }
+    if (field->x0 >= field->x1 || field->y0 >= field->y1) {
+        field->x0 = field->y0 = field->x1 = field->y1 = 0;
+        field->gridWidth = field->gridHeight = 0;
+        field->stats.nodes = 0;
+        return 1;
+    }
+
+    int cell = field->cellSize;
+    field->originX = (field->x0 / cell) * cell;
+    field->originY = (field->y0 / cell) * cell;
+    // One extra node past the last pixel so every pixel has a right/bottom neighbour.
+    field->gridWidth = (field->x1 - 1 - field->originX) / cell + 2;
+    field->gridHeight = (field->y1 - 1 - field->originY) / cell + 2;
+    size_t nodeCount = (size_t)field->gridWidth * (size_t)field->gridHeight;
+    if (!DisplacementFieldReserve((void **)&field->nodes, &field->nodesCapacity, nodeCount * 2 * sizeof(float)) ||
+        !DisplacementFieldReserve((void **)&field->rowScratch, &field->rowScratchCapacity,
+                                  (size_t)field->gridWidth * 2 * sizeof(float))) {
+        return 0;
+    }
+
+    for (int j = 0; j < field->gridHeight; j++) {
+        float py = (float)(field->originY + j * cell);
+        float *row = field->nodes + (size_t)j * (size_t)field->gridWidth * 2;
+        for (int i = 0; i < field->gridWidth; i++) {
+            float px = (float)(field->originX + i * cell);
+            FaceWarpDisplacementAt(ops, px, py, &row[i * 2], &row[i * 2 + 1]);
+        }
+    }
+    field->stats.nodes = (uint32_t)nodeCount;
+    return 1;
+}
+
+int DisplacementFieldUpdate(DisplacementField *field,
+                            const FaceWarpFace *faces,
+                            size_t faceCount,
+                            int width,
+                            int height) {
+    field->stats.updates++;
+    if (field->valid && field->frameWidth == width && field->frameHeight == height &&
+        DisplacementFieldFacesMatch(field, faces, faceCount)) {
+        field->stats.reuses++;
+        return 0;
+    }
+
+    field->valid = 0;
+    if (!DisplacementFieldReserve((void **)&field->faces, &field->faceCapacity, faceCount * sizeof(FaceWarpFace))) {
+        return -1;
+    }
+    if (faceCount > 0) {
+        memcpy(field->faces, faces, faceCount * sizeof(FaceWarpFace));
+    }
+    field->faceCount = faceCount;
+    field->frameWidth = width;
+    field->frameHeight = height;
+
+    FaceWarpBufferPack(&field->ops, faces, faceCount, width, height);
+    if (!DisplacementFieldBuild(field, width, height)) {
+        return -1;
+    }
+    field->valid = 1;
+    field->stats.builds++;
+    return 1;
+}
+
+void DisplacementFieldSample(const DisplacementField *field, int x, int y, float *outDx, float *outDy) {
+    *outDx = 0.0f;
+    *outDy = 0.0f;
+    if (!field->valid || x < field->x0 || x >= field->x1 || y < field->y0 || y >= field->y1) {
+        return;
+    }
+    int cell = field->cellSize;
+    int lx = x - field->originX;
+    int ly = y - field->originY;
+    int i = lx / cell;
+    int j = ly / cell;
+    float s = (float)(lx - i * cell) / (float)cell;
+    float t = (float)(ly - j * cell) / (float)cell;
+    size_t stride = (size_t)field->gridWidth * 2;
+    const float *n0 = field->nodes + (size_t)j * stride + (size_t)i * 2;
+    const float *n1 = n0 + stride;
+    float top = n0[0] + (n0[2] - n0[0]) * s;
+    float bottom = n1[0] + (n1[2] - n1[0]) * s;
+    *outDx = top + (bottom - top) * t;
+    top = n0[1] + (n0[3] - n0[1]) * s;
+    bottom = n1[1] + (n1[3] - n1[1]) * s;
+    *outDy = top + (bottom - top) * t;
+}
+
+void DisplacementFieldApplyRGBA(DisplacementField *field,
+                                const uint8_t *src,
+                                size_t srcStride,
+                                uint8_t *dst,
+                                size_t dstStride,
+                                int width,
+                                int height) {
+    size_t rowBytes = (size_t)width * 4;
+    int hasField = field->valid && field->frameWidth == width && field->frameHeight == height &&
+                   field->x0 < field->x1;
+    int cell = field->cellSize;
+    float invCell = 1.0f / (float)cell;
+    size_t gridStride = (size_t)field->gridWidth * 2;
+
+    for (int y = 0; y < height; y++) {
+        const uint8_t *srcRow = src + (size_t)y * srcStride;
+        uint8_t *dstRow = dst + (size_t)y * dstStride;
+        if (!hasField || y < field->y0 || y >= field->y1) {
+            memcpy(dstRow, srcRow, rowBytes);
+            continue;
+        }
+        memcpy(dstRow, srcRow, (size_t)field->x0 * 4);
+        memcpy(dstRow + (size_t)field->x1 * 4, srcRow + (size_t)field->x1 * 4, (size_t)(width - field->x1) * 4);
+
+        // Vertical interpolation once per row, then a linear ramp per cell.
+        int ly = y - field->originY;
+        int j = ly / cell;
+        float t = (float)(ly - j * cell) * invCell;
+        const float *n0 = field->nodes + (size_t)j * gridStride;
+        const float *n1 = n0 + gridStride;
+        float *row = field->rowScratch;
+        for (size_t k = 0; k < gridStride; k++) {
+            row[k] = n0[k] + (n1[k] - n0[k]) * t;
+        }
+
+        float fy = (float)y;
+        int x = field->x0;
+        while (x < field->x1) {
+            int i = (x - field->originX) / cell;
+            int cellStart = field->originX + i * cell;
+            int cellEnd = cellStart + cell < field->x1 ? cellStart + cell : field->x1;
+            const float *r = row + (size_t)i * 2;
+            float stepX = (r[2] - r[0]) * invCell;
+            float stepY = (r[3] - r[1]) * invCell;
+            float dx = r[0] + stepX * (float)(x - cellStart);
+            float dy = r[1] + stepY * (float)(x - cellStart);
+            for (; x < cellEnd; x++, dx += stepX, dy += stepY) {
+                uint8_t *out = dstRow + (size_t)x * 4;
+                if (fabsf(dx) < kMinDisplacement && fabsf(dy) < kMinDisplacement) {
+                    memcpy(out, srcRow + (size_t)x * 4, 4);
+                } else {
+                    FaceWarpSampleRGBA(src, srcStride, width, height, (float)x + dx, fy + dy, out);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,94 @@
+//
+//  DisplacementField.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 18/10/2026.
+//
+
+#ifndef DISPLACEMENT_FIELD_H
+#define DISPLACEMENT_FIELD_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "FaceWarp.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DISPLACEMENT_FIELD_DEFAULT_CELL 8
+
+typedef struct {
+    uint64_t updates;
+    uint64_t builds;   // Field re-evaluated from the deformation ops
+    uint64_t reuses;   // Faces within threshold, previous field kept
+    uint32_t nodes;    // Grid nodes in the current field
+} DisplacementFieldStats;
+
+/**
+ * Face reshape deformation sampled on a coarse grid (one node every `cellSize`
+ * pixels) over the area the ops touch.
+ *
+ * The field is rebuilt only when a face moves more than `threshold` pixels or
+ * a level changes, and is applied with bilinear upsampling in a single remap
+ * pass. Per-pixel cost no longer depends on the number of control points.
+ */
+typedef struct {
+    FaceWarpBuffer ops;
+    FaceWarpFace *faces;     // Faces the field was built for
+    size_t faceCount;
+    size_t faceCapacity;
+    float *nodes;            // Interleaved (dx, dy), gridWidth x gridHeight
+    size_t nodesCapacity;
+    float *rowScratch;       // One interpolated grid row, used by the remap
+    size_t rowScratchCapacity;
+    int cellSize;
+    float threshold;
+    int originX, originY;    // Frame position of node (0, 0)
+    int gridWidth, gridHeight;
+    int x0, y0, x1, y1;      // Affected rect, x1/y1 exclusive; empty when nothing warps
+    int frameWidth, frameHeight;
+    int valid;
+    DisplacementFieldStats stats;
+} DisplacementField;
+
+/// cellSize <= 0 uses DISPLACEMENT_FIELD_DEFAULT_CELL; threshold is in pixels
+void DisplacementFieldInit(DisplacementField *field, int cellSize, float threshold);
+void DisplacementFieldFree(DisplacementField *field);
+
+/// Forces the next update to rebuild
+void DisplacementFieldInvalidate(DisplacementField *field);
+
+/**
+ * Updates the field for the current faces, reusing the previous one when every
+ * face box stayed within the threshold and no level changed.
+ *
+ * @return 1 if the field was rebuilt, 0 if reused, -1 on allocation failure
+ */
+int DisplacementFieldUpdate(DisplacementField *field,
+                            const FaceWarpFace *faces,
+                            size_t faceCount,
+                            int width,
+                            int height);
+
+/// Bilinearly upsampled inverse displacement at pixel (x, y)
+void DisplacementFieldSample(const DisplacementField *field, int x, int y, float *outDx, float *outDy);
+
+/**
+ * Remaps a 4-channel 8-bit frame through the field in one pass. Pixels
+ * outside the affected rect are copied through. src and dst must not alias.
+ */
+void DisplacementFieldApplyRGBA(DisplacementField *field,
+                                const uint8_t *src,
+                                size_t srcStride,
+                                uint8_t *dst,
+                                size_t dstStride,
+                                int width,
+                                int height);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DISPLACEMENT_FIELD_H */
@@ -0,0 +1,70 @@
+//
+//  FaceBeautyRenderer.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 18/10/2026.
+//
+
+#import <Foundation/Foundation.h>
+#import <CoreVideo/CoreVideo.h>
+#import <nosmai/Nosmai.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * CPU skin smoothing, whitening, lipstick and blusher for app-side frame paths.
+ *
+ * Work is limited to padded regions around the current faces; everything else
+ * is copied through (or untouched when rendering in place), so a frame with no
+ * faces costs close to nothing.
+ *
+ * Not used by the example app, whose beauty sliders drive the SDK's GPU
+ * BeautyFaceFilter, LipstickFilter and BlusherFilter.
+ */
+@interface FaceBeautyRenderer : NSObject
+
+/// 0.0 - 1.0, same range as -[NosmaiEffectsEngine applySkinSmoothing:]
+@property (nonatomic, assign) float smoothingLevel;
+
+/// 0.0 - 1.0, same range as -[NosmaiEffectsEngine applySkinWhitening:]
+@property (nonatomic, assign) float whiteningLevel;
+
+/// 0.0 - 1.0 blend, same as applyMakeupBlendLevel:@"LipstickFilter" level:
+@property (nonatomic, assign) float lipstickLevel;
+
+/// 0.0 - 1.0 blend, same as applyMakeupBlendLevel:@"BlusherFilter" level:
+@property (nonatomic, assign) float blusherLevel;
+
+@property (nonatomic, strong) UIColor *lipstickColor;
+@property (nonatomic, strong) UIColor *blusherColor;
+
+/// Use mouth_blue_optimized.png instead of mouth.png as the lipstick mask
+@property (nonatomic, assign) BOOL usesOptimizedLipstickMask;
+
+/**
+ * Landmark movement, in pixels, below which the previous frame's warped
+ * makeup mask is reused for a face. Default 0.5.
+ */
+@property (nonatomic, assign) float maskRewarpThreshold;
+
+/// Warped mask cache counters: lookups, hits, rewarps, evictions and hitRate
+@property (nonatomic, readonly) NSDictionary<NSString *, NSNumber *> *maskCacheStatistics;
+
+/// Fraction of the last frame that was actually computed (0 when no faces)
+@property (nonatomic, readonly) float lastProcessedArea;
+
+@property (nonatomic, readonly) BOOL hasActiveEffect;
+
+/// Safe to call from the delegate thread while another thread renders
+- (void)updateFaces:(NSArray<NosmaiFaceInfo *> *)faces;
+
+/**
+ * Render a 32BGRA buffer. Pass the same buffer twice to render in place.
+ *
+ * @return NO if the buffers are incompatible
+ */
+- (BOOL)renderPixelBuffer:(CVPixelBufferRef)source toPixelBuffer:(CVPixelBufferRef)destination;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,260 @@
+//
+//  FaceBeautyRenderer.m
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 18/10/2026.
+//
+
+#import "FaceBeautyRenderer.h"
+#import "NosmaiFaceInfo+PixelBounds.h"
+#import <os/lock.h>
+#include "BeautyKernels.h"
+#include "MakeupMaskCache.h"
+
+// Two makeup masks per face, with room for faces that briefly drop out.
+static const size_t kMaskCacheCapacity = BEAUTY_MAX_FACES * MakeupMaskKindCount * 2;
+
+/// 8-bit coverage decoded from one of the SDK's makeup mask PNGs
+@interface FaceBeautyMask : NSObject
+@property (nonatomic, strong) NSData *coverage;
+@property (nonatomic, assign) int width;
+@property (nonatomic, assign) int height;
+@end
+
+@implementation FaceBeautyMask
+@end
+
+// Masks ship in nosmai.framework/res. Masks with alpha use it as coverage;
+// opaque ones are drawn on black, so the brightest channel is used instead.
+static FaceBeautyMask *FaceBeautyLoadMask(NSString *name) {
+    NSBundle *bundle = [NSBundle bundleForClass:[NosmaiSDK class]];
+    NSString *path = [bundle pathForResource:name ofType:@"png" inDirectory:@"res"];
+    if (!path) {
+        NSString *frameworkPath = [[NSBundle mainBundle].privateFrameworksPath stringByAppendingPathComponent:@"nosmai.framework"];
+        path = [[NSBundle bundleWithPath:frameworkPath] pathForResource:name ofType:@"png" inDirectory:@"res"];
+    }
+    CGImageRef image = [UIImage imageWithContentsOfFile:path].CGImage;
+    if (!image) {
+        NSLog(@"⚠️ Makeup mask %@ not found", name);
+        return nil;
+    }
+
+    size_t width = CGImageGetWidth(image);
+    size_t height = CGImageGetHeight(image);
+    NSMutableData *rgba = [NSMutableData dataWithLength:width * height * 4];
+    CGColorSpaceRef colorSpace = CGColorSpaceCreateDeviceRGB();
+    CGContextRef context = CGBitmapContextCreate(rgba.mutableBytes, width, height, 8, width * 4, colorSpace,
+                                                 kCGImageAlphaPremultipliedLast | kCGBitmapByteOrder32Big);
+    CGColorSpaceRelease(colorSpace);
+    if (!context) {
+        return nil;
+    }
+    CGContextDrawImage(context, CGRectMake(0, 0, width, height), image);
+    CGContextRelease(context);
+
+    CGImageAlphaInfo alphaInfo = CGImageGetAlphaInfo(image);
+    BOOL hasAlpha = alphaInfo != kCGImageAlphaNone && alphaInfo != kCGImageAlphaNoneSkipLast &&
+                    alphaInfo != kCGImageAlphaNoneSkipFirst;
+    NSMutableData *coverage = [NSMutableData dataWithLength:width * height];
+    const uint8_t *src = rgba.bytes;
+    uint8_t *dst = coverage.mutableBytes;
+    for (size_t i = 0; i < width * height; i++, src += 4) {
+        dst[i] = hasAlpha ? src[3] : MAX(src[0], MAX(src[1], src[2]));
+    }
+
+    FaceBeautyMask *mask = [[FaceBeautyMask alloc] init];
+    mask.coverage = coverage;
+    mask.width = (int)width;
+    mask.height = (int)height;
+    return mask;
+}
+
+// Decoded once per process and shared by every renderer.
+static FaceBeautyMask *FaceBeautyMaskNamed(NSString *name) {
+    static NSMutableDictionary<NSString *, id> *masks;
+    static os_unfair_lock lock = OS_UNFAIR_LOCK_INIT;
+    os_unfair_lock_lock(&lock);
+    if (!masks) masks = [NSMutableDictionary dictionary];
+    id mask = masks[name];
+    if (!mask) {
+        mask = FaceBeautyLoadMask(name) ?: [NSNull null];
+        masks[name] = mask;
+    }
+    os_unfair_lock_unlock(&lock);
+    return mask == [NSNull null] ? nil : mask;
+}
+
+static BOOL FaceBeautyMaskSource(NSString *name, MakeupMaskSource *outSource) {
+    FaceBeautyMask *mask = FaceBeautyMaskNamed(name);
+    if (!mask) return NO;
+    MakeupMaskSourceInit(outSource, mask.coverage.bytes, (size_t)mask.width, mask.width, mask.height);
+    return YES;
+}
+
+static void FaceBeautyColorToBGRA(UIColor *color, uint8_t out[4]) {
+    CGFloat r = 0, g = 0, b = 0, a = 1;
+    [color getRed:&r green:&g blue:&b alpha:&a];
+    out[0] = (uint8_t)lround(b * 255.0);
+    out[1] = (uint8_t)lround(g * 255.0);
+    out[2] = (uint8_t)lround(r * 255.0);
+    out[3] = (uint8_t)lround(a * 255.0);
+}
+
+@implementation FaceBeautyRenderer {
+    os_unfair_lock _lock;
+    NSArray<NosmaiFaceInfo *> *_faces;
+    BeautyContext _context;
+    MakeupMaskCache _maskCache;
+}
+
+- (instancetype)init {
+    self = [super init];
+    if (self) {
+        _lock = OS_UNFAIR_LOCK_INIT;
+        _faces = @[];
+        _lipstickColor = [UIColor colorWithRed:0.78 green:0.16 blue:0.24 alpha:1.0];
+        _blusherColor = [UIColor colorWithRed:0.93 green:0.47 blue:0.55 alpha:1.0];
+        _maskRewarpThreshold = 0.5f;
+        BeautyContextInit(&_context);
+        MakeupMaskCacheInit(&_maskCache, kMaskCacheCapacity, _maskRewarpThreshold);
+    }
+    return self;
+}
+
+- (void)dealloc {
+    BeautyContextFree(&_context);
+    MakeupMaskCacheFree(&_maskCache);
+}
+
+- (BOOL)hasActiveEffect {
+    return self.smoothingLevel > 0.0f || self.whiteningLevel > 0.0f || self.lipstickLevel > 0.0f || self.blusherLevel > 0.0f;
+}
+
+- (float)lastProcessedArea {
+    return _context.stats.processedArea;
+}
+
+- (NSDictionary<NSString *, NSNumber *> *)maskCacheStatistics {
+    os_unfair_lock_lock(&_lock);
+    MakeupMaskCacheStats stats = _maskCache.stats;
+    os_unfair_lock_unlock(&_lock);
+    return @{
+        @"lookups": @(stats.lookups),
+        @"hits": @(stats.hits),
+        @"rewarps": @(stats.rewarps),
+        @"evictions": @(stats.evictions),
+        @"hitRate": @(stats.lookups > 0 ? (double)stats.hits / (double)stats.lookups : 0.0),
+    };
+}
+
+- (void)updateFaces:(NSArray<NosmaiFaceInfo *> *)faces {
+    NSArray *copy = [faces copy] ?: @[];
+    os_unfair_lock_lock(&_lock);
+    _faces = copy;
+    os_unfair_lock_unlock(&_lock);
+}
+
+- (BOOL)renderPixelBuffer:(CVPixelBufferRef)source toPixelBuffer:(CVPixelBufferRef)destination {
+    if (!source || !destination) return NO;
+    if (CVPixelBufferGetPixelFormatType(source) != kCVPixelFormatType_32BGRA ||
+        CVPixelBufferGetPixelFormatType(destination) != kCVPixelFormatType_32BGRA) {
+        return NO;
+    }
+    size_t width = CVPixelBufferGetWidth(source);
+    size_t height = CVPixelBufferGetHeight(source);
+    if (CVPixelBufferGetWidth(destination) != width || CVPixelBufferGetHeight(destination) != height) {
+        return NO;
+    }
+
+    os_unfair_lock_lock(&_lock);
+    NSArray<NosmaiFaceInfo *> *faces = _faces;
+    os_unfair_lock_unlock(&_lock);
+
+    FaceRegionBox boxes[BEAUTY_MAX_FACES];
+    NSInteger faceIDs[BEAUTY_MAX_FACES];
+    size_t faceCount = 0;
+    CGSize frameSize = CGSizeMake(width, height);
+    for (NosmaiFaceInfo *face in faces) {
+        if (faceCount == BEAUTY_MAX_FACES) break;
+        CGRect box = [face pixelBoundingBoxForFrameSize:frameSize];
+        faceIDs[faceCount] = face.faceID;
+        boxes[faceCount++] = (FaceRegionBox){(float)box.origin.x, (float)box.origin.y,
+                                             (float)box.size.width, (float)box.size.height};
+    }
+
+    BeautyParams params = {
+        .smoothing = fminf(fmaxf(self.smoothingLevel, 0.0f), 1.0f),
+        .whitening = fminf(fmaxf(self.whiteningLevel, 0.0f), 1.0f),
+        .lipstick = fminf(fmaxf(self.lipstickLevel, 0.0f), 1.0f),
+        .blusher = fminf(fmaxf(self.blusherLevel, 0.0f), 1.0f),
+    };
+    FaceBeautyColorToBGRA(self.lipstickColor, params.lipstickColor);
+    FaceBeautyColorToBGRA(self.blusherColor, params.blusherColor);
+
+    BeautyFaceMasks masks[BEAUTY_MAX_FACES] = {{NULL, NULL}};
+    [self lookUpMasks:masks forFaces:boxes faceIDs:faceIDs count:faceCount params:&params width:(int)width height:(int)height];
+
+    BOOL inPlace = source == destination;
+    CVPixelBufferLockBaseAddress(source, inPlace ? 0 : kCVPixelBufferLock_ReadOnly);
+    if (!inPlace) CVPixelBufferLockBaseAddress(destination, 0);
+    BeautyApplyRGBA(&_context,
+                    &params,
+                    boxes,
+                    masks,
+                    faceCount,
+                    CVPixelBufferGetBaseAddress(source),
+                    CVPixelBufferGetBytesPerRow(source),
+                    CVPixelBufferGetBaseAddress(destination),
+                    CVPixelBufferGetBytesPerRow(destination),
+                    (int)width,
+                    (int)height);
+    if (!inPlace) CVPixelBufferUnlockBaseAddress(destination, 0);
+    CVPixelBufferUnlockBaseAddress(source, inPlace ? 0 : kCVPixelBufferLock_ReadOnly);
+    return YES;
+}
+
+#pragma mark - Makeup Masks
+
+- (void)lookUpMasks:(BeautyFaceMasks *)masks
+           forFaces:(const FaceRegionBox *)faces
+            faceIDs:(const NSInteger *)faceIDs
+              count:(size_t)faceCount
+             params:(const BeautyParams *)params
+              width:(int)width
+             height:(int)height {
+    MakeupMaskSource lipstick;
+    MakeupMaskSource blusher;
+    NSString *lipstickName = self.usesOptimizedLipstickMask ? @"mouth_blue_optimized" : @"mouth";
+    BOOL hasLipstick = params->lipstick > 0.0f && FaceBeautyMaskSource(lipstickName, &lipstick);
+    BOOL hasBlusher = params->blusher > 0.0f && FaceBeautyMaskSource(@"blusher", &blusher);
+    if (!hasLipstick && !hasBlusher) return;
+
+    // The lock only guards the counters read by maskCacheStatistics; frames
+    // are rendered from one thread.
+    os_unfair_lock_lock(&_lock);
+    _maskCache.threshold = self.maskRewarpThreshold;
+    for (size_t i = 0; i < faceCount; i++) {
+        // Entries are keyed by faceID; a repeated ID would overwrite the mask
+        // handed out for the earlier face, so it keeps the analytic shapes.
+        BOOL duplicate = NO;
+        for (size_t j = 0; j < i && !duplicate; j++) {
+            duplicate = faceIDs[j] == faceIDs[i];
+        }
+        if (duplicate) continue;
+
+        MakeupPoint landmarks[3];
+        if (hasLipstick) {
+            MakeupMaskLandmarksForFace(&faces[i], MakeupMaskKindLipstick, landmarks);
+            masks[i].lipstick = MakeupMaskCacheLookup(&_maskCache, faceIDs[i], MakeupMaskKindLipstick, &lipstick,
+                                                      landmarks, width, height);
+        }
+        if (hasBlusher) {
+            MakeupMaskLandmarksForFace(&faces[i], MakeupMaskKindBlusher, landmarks);
+            masks[i].blusher = MakeupMaskCacheLookup(&_maskCache, faceIDs[i], MakeupMaskKindBlusher, &blusher,
+                                                     landmarks, width, height);
+        }
+    }
+    os_unfair_lock_unlock(&_lock);
+}
+
+@end
@@ -0,0 +1,96 @@
+//
+//  FaceRegion.c
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 18/10/2026.
+//
+
+#include "FaceRegion.h"
+
+#include <math.h>
+
+// Fraction of the padded ellipse that receives the full effect.
+static const float kFaceCoreRadius = 0.7f;
+
+static int FaceRegionOverlaps(const FaceRegionRect *a, const FaceRegionRect *b) {
+    return a->x0 < b->x1 && b->x0 < a->x1 && a->y0 < b->y1 && b->y0 < a->y1;
+}
+
+size_t FaceRegionBuild(const FaceRegionBox *faces,
+                       size_t faceCount,
+                       float padding,
+                       int32_t halo,
+                       int width,
+                       int height,
+                       FaceRegionRect *outRects,
+                       size_t maxRects) {
+    size_t count = 0;
+    for (size_t i = 0; i < faceCount && count < maxRects; i++) {
+        const FaceRegionBox *face = &faces[i];
+        if (face->width <= 0.0f || face->height <= 0.0f) {
+            continue;
+        }
+        float padX = face->width * padding + (float)halo;
+        float padY = face->height * padding + (float)halo;
+        FaceRegionRect rect = {
+            .x0 = (int32_t)fmaxf(0.0f, floorf(face->x - padX)),
+            .y0 = (int32_t)fmaxf(0.0f, floorf(face->y - padY)),
+            .x1 = (int32_t)fminf((float)width, ceilf(face->x + face->width + padX)),
+            .y1 = (int32_t)fminf((float)height, ceilf(face->y + face->height + padY)),
+        };
+        if (rect.x0 < rect.x1 && rect.y0 < rect.y1) {
+            outRects[count++] = rect;
+        }
+    }
+
+    // Merge until stable; face counts are tiny so the quadratic loop is fine.
+    int merged = 1;
+    while (merged) {
+        merged = 0;
+        for (size_t i = 0; i < count && !merged; i++) {
+            for (size_t j = i + 1; j < count; j++) {
+                if (!FaceRegionOverlaps(&outRects[i], &outRects[j])) {
+                    continue;
+                }
+                FaceRegionRect *a = &outRects[i];
+                const FaceRegionRect *b = &outRects[j];
+                if (b->x0 < a->x0) a->x0 = b->x0;
+                if (b->y0 < a->y0) a->y0 = b->y0;
+                if (b->x1 > a->x1) a->x1 = b->x1;
+                if (b->y1 > a->y1) a->y1 = b->y1;
+                outRects[j] = outRects[count - 1];
+                count--;
+                merged = 1;
+                break;
+            }
+        }
+    }
+    return count;
+}
+
+uint64_t FaceRegionArea(const FaceRegionRect *rects, size_t count) {
+    uint64_t area = 0;
+    for (size_t i = 0; i < count; i++) {
+        area += (uint64_t)(rects[i].x1 - rects[i].x0) * (uint64_t)(rects[i].y1 - rects[i].y0);
+    }
+    return area;
+}
+
+float FaceRegionFaceWeight(const FaceRegionBox *face, float padding, float x, float y) {
+    float radiusX = face->width * (0.5f + padding);
+    float radiusY = face->height * (0.5f + padding);
+    if (radiusX <= 0.0f || radiusY <= 0.0f) {
+        return 0.0f;
+    }
+    float nx = (x - (face->x + face->width * 0.5f)) / radiusX;
+    float ny = (y - (face->y + face->height * 0.5f)) / radiusY;
+    float distSq = nx * nx + ny * ny;
+    if (distSq >= 1.0f) {
+        return 0.0f;
+    }
+    if (distSq <= kFaceCoreRadius * kFaceCoreRadius) {
+        return 1.0f;
+    }
+    float t = (1.0f - sqrtf(distSq)) / (1.0f - kFaceCoreRadius);
+    return t * t * (3.0f - 2.0f * t);
+}
@@ -0,0 +1,59 @@
+//
+//  FaceRegion.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 18/10/2026.
+//
+
+#ifndef FACE_REGION_H
+#define FACE_REGION_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// Face bounds in pixels of the frame being processed
+typedef struct {
+    float x, y, width, height;
+} FaceRegionBox;
+
+/// Pixel rect, x1/y1 exclusive
+typedef struct {
+    int32_t x0, y0, x1, y1;
+} FaceRegionRect;
+
+/**
+ * Builds the rects a face-local filter needs to touch: every box is grown by
+ * `padding` (fraction of its size) plus `halo` pixels for neighbourhood reads,
+ * clamped to the frame, and overlapping rects are merged so no pixel is
+ * processed twice.
+ *
+ * @return Number of rects written to outRects (at most maxRects)
+ */
+size_t FaceRegionBuild(const FaceRegionBox *faces,
+                       size_t faceCount,
+                       float padding,
+                       int32_t halo,
+                       int width,
+                       int height,
+                       FaceRegionRect *outRects,
+                       size_t maxRects);
+
+/// Total pixel area covered by the rects
+uint64_t FaceRegionArea(const FaceRegionRect *rects, size_t count);
+
+/**
+ * Soft elliptical weight of a face at (x, y): 1.0 inside the core of the face,
+ * falling smoothly to 0.0 at the padded edge. Used to feather face-local
+ * filters so region borders never show.
+ */
+float FaceRegionFaceWeight(const FaceRegionBox *face, float padding, float x, float y);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FACE_REGION_H */
@@ -0,0 +1,72 @@
+//
+//  FaceReshapeRenderer.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 18/10/2026.
+//
+
+#import <Foundation/Foundation.h>
+#import <CoreVideo/CoreVideo.h>
+#import <nosmai/Nosmai.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * CPU face reshape for app-side frame paths (offscreen / streamed frames).
+ *
+ * Slimming, eye enlargement and nose size for every detected face are packed
+ * into one deformation buffer and applied in a single pass over the frame.
+ * Each extra face still adds the pixels it covers: at 720p, 6 faces cost
+ * about 1.7x what 1 face does (ProcessingBenchmarkFaceWarp), not 6x.
+ *
+ * The example app does not use it: its camera reshape is the SDK's own
+ * (applyFaceSlimming: and the other beauty levels), rendered on the GPU
+ * before the app sees the frame.
+ */
+@interface FaceReshapeRenderer : NSObject
+
+/// Same range as -[NosmaiEffectsEngine applyFaceSlimming:] (0.0 - 1.0)
+@property (nonatomic, assign) float slimmingLevel;
+
+/// Same range as -[NosmaiEffectsEngine applyEyeEnlargement:] (0.0 - 1.0)
+@property (nonatomic, assign) float eyeEnlargementLevel;
+
+/// Same range as -[NosmaiEffectsEngine applyNoseSize:] (0.0 - 100.0, 50.0 is normal)
+@property (nonatomic, assign) float noseSizeLevel;
+
+/**
+ * Apply the deformation through a low-resolution displacement field that is
+ * rebuilt only when faces move more than landmarkThreshold. Default YES;
+ * NO evaluates every op per pixel.
+ */
+@property (nonatomic, assign) BOOL usesDisplacementField;
+
+/// Face box movement, in pixels, below which the field is reused. Default 0.5
+@property (nonatomic, assign) float landmarkThreshold;
+
+/// Field counters: updates, builds, reuses and nodes
+@property (nonatomic, readonly) NSDictionary<NSString *, NSNumber *> *displacementFieldStatistics;
+
+/// Number of deformation ops packed for the last rendered frame
+@property (nonatomic, readonly) NSUInteger packedOperationCount;
+
+/// YES when at least one level would change the image
+@property (nonatomic, readonly) BOOL hasActiveEffect;
+
+/**
+ * Update the faces to reshape. Safe to call from the delegate thread while
+ * another thread renders. Bounding boxes may be normalized (0-1) or in pixels.
+ */
+- (void)updateFaces:(NSArray<NosmaiFaceInfo *> *)faces;
+
+/**
+ * Warp a 32BGRA pixel buffer into a destination of the same size and format.
+ * Rows without faces are copied through.
+ *
+ * @return NO if the buffers are incompatible
+ */
+- (BOOL)renderPixelBuffer:(CVPixelBufferRef)source toPixelBuffer:(CVPixelBufferRef)destination;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,141 @@
+//
+//  FaceReshapeRenderer.m
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 18/10/2026.
+//
+
+#import "FaceReshapeRenderer.h"
+#import "NosmaiFaceInfo+PixelBounds.h"
+#import <os/lock.h>
+#include "DisplacementField.h"
+#include "FaceWarp.h"
+
+@implementation FaceReshapeRenderer {
+    os_unfair_lock _lock;
+    NSArray<NosmaiFaceInfo *> *_faces;
+    FaceWarpBuffer _buffer;
+    DisplacementField _field;
+    FaceWarpFace *_packedFaces;
+    size_t _packedFacesCapacity;
+}
+
+- (instancetype)init {
+    self = [super init];
+    if (self) {
+        _lock = OS_UNFAIR_LOCK_INIT;
+        _faces = @[];
+        _noseSizeLevel = 50.0f;
+        _usesDisplacementField = YES;
+        _landmarkThreshold = 0.5f;
+        FaceWarpBufferInit(&_buffer);
+        DisplacementFieldInit(&_field, DISPLACEMENT_FIELD_DEFAULT_CELL, _landmarkThreshold);
+    }
+    return self;
+}
+
+- (void)dealloc {
+    FaceWarpBufferFree(&_buffer);
+    DisplacementFieldFree(&_field);
+    free(_packedFaces);
+}
+
+- (BOOL)hasActiveEffect {
+    return self.slimmingLevel > 0.0f || self.eyeEnlargementLevel > 0.0f || self.noseSizeLevel != 50.0f;
+}
+
+- (void)updateFaces:(NSArray<NosmaiFaceInfo *> *)faces {
+    NSArray *copy = [faces copy] ?: @[];
+    os_unfair_lock_lock(&_lock);
+    _faces = copy;
+    os_unfair_lock_unlock(&_lock);
+}
+
+- (NSUInteger)packedOperationCount {
+    return self.usesDisplacementField ? _field.ops.count : _buffer.count;
+}
+
+- (NSDictionary<NSString *, NSNumber *> *)displacementFieldStatistics {
+    DisplacementFieldStats stats = _field.stats;
+    return @{
+        @"updates": @(stats.updates),
+        @"builds": @(stats.builds),
+        @"reuses": @(stats.reuses),
+        @"nodes": @(stats.nodes),
+    };
+}
+
+- (size_t)collectFacesForWidth:(size_t)width height:(size_t)height {
+    os_unfair_lock_lock(&_lock);
+    NSArray<NosmaiFaceInfo *> *faces = _faces;
+    os_unfair_lock_unlock(&_lock);
+
+    if (faces.count > _packedFacesCapacity) {
+        FaceWarpFace *resized = realloc(_packedFaces, faces.count * sizeof(FaceWarpFace));
+        if (!resized) return 0;
+        _packedFaces = resized;
+        _packedFacesCapacity = faces.count;
+    }
+
+    float slimming = fminf(fmaxf(self.slimmingLevel, 0.0f), 1.0f);
+    float eyes = fminf(fmaxf(self.eyeEnlargementLevel, 0.0f), 1.0f);
+    float nose = (fminf(fmaxf(self.noseSizeLevel, 0.0f), 100.0f) - 50.0f) / 50.0f;
+
+    size_t count = 0;
+    for (NosmaiFaceInfo *face in faces) {
+        CGRect box = [face pixelBoundingBoxForFrameSize:CGSizeMake(width, height)];
+        _packedFaces[count++] = (FaceWarpFace){
+            .x = (float)box.origin.x,
+            .y = (float)box.origin.y,
+            .width = (float)box.size.width,
+            .height = (float)box.size.height,
+            .slimming = slimming,
+            .eyeEnlargement = eyes,
+            .noseScale = nose,
+        };
+    }
+    return count;
+}
+
+- (BOOL)renderPixelBuffer:(CVPixelBufferRef)source toPixelBuffer:(CVPixelBufferRef)destination {
+    if (!source || !destination || source == destination) return NO;
+    if (CVPixelBufferGetPixelFormatType(source) != kCVPixelFormatType_32BGRA ||
+        CVPixelBufferGetPixelFormatType(destination) != kCVPixelFormatType_32BGRA) {
+        return NO;
+    }
+    size_t width = CVPixelBufferGetWidth(source);
+    size_t height = CVPixelBufferGetHeight(source);
+    if (CVPixelBufferGetWidth(destination) != width || CVPixelBufferGetHeight(destination) != height) {
+        return NO;
+    }
+
+    size_t faceCount = self.hasActiveEffect ? [self collectFacesForWidth:width height:height] : 0;
+    BOOL usesField = self.usesDisplacementField;
+    if (usesField) {
+        _field.threshold = self.landmarkThreshold;
+        if (DisplacementFieldUpdate(&_field, _packedFaces, faceCount, (int)width, (int)height) < 0) {
+            // Out of memory for the grid; fall back to per-pixel evaluation.
+            usesField = NO;
+        }
+    }
+    if (!usesField) {
+        FaceWarpBufferPack(&_buffer, _packedFaces, faceCount, (int)width, (int)height);
+    }
+
+    CVPixelBufferLockBaseAddress(source, kCVPixelBufferLock_ReadOnly);
+    CVPixelBufferLockBaseAddress(destination, 0);
+    const uint8_t *src = CVPixelBufferGetBaseAddress(source);
+    uint8_t *dst = CVPixelBufferGetBaseAddress(destination);
+    size_t srcStride = CVPixelBufferGetBytesPerRow(source);
+    size_t dstStride = CVPixelBufferGetBytesPerRow(destination);
+    if (usesField) {
+        DisplacementFieldApplyRGBA(&_field, src, srcStride, dst, dstStride, (int)width, (int)height);
+    } else {
+        FaceWarpApplyRGBA(&_buffer, src, srcStride, dst, dstStride, (int)width, (int)height);
+    }
+    CVPixelBufferUnlockBaseAddress(destination, 0);
+    CVPixelBufferUnlockBaseAddress(source, kCVPixelBufferLock_ReadOnly);
+    return YES;
+}
+
+@end
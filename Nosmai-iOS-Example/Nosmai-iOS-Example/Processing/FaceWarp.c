@@ -0,0 +1,271 @@
+//
+//  FaceWarp.c
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 18/10/2026.
+//
+
+#include "FaceWarp.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Landmark proportions relative to the face box. NosmaiFaceInfo only exposes the
+// bounding box, so control points are placed where the SDK's reshape filters
+// put them for a frontal face.
+static const float kCheekX = 0.18f;
+static const float kCheekY = 0.72f;
+static const float kCheekRadius = 0.32f;
+static const float kCheekPull = 0.07f;
+static const float kEyeX = 0.31f;
+static const float kEyeY = 0.40f;
+static const float kEyeRadius = 0.16f;
+static const float kEyeStrength = 0.25f;
+static const float kNoseY = 0.60f;
+static const float kNoseRadius = 0.14f;
+static const float kNoseStrength = 0.20f;
+static const float kMinEffect = 1e-4f;
+
+void FaceWarpBufferInit(FaceWarpBuffer *buffer) {
+    memset(buffer, 0, sizeof(*buffer));
+}
+
+void FaceWarpBufferFree(FaceWarpBuffer *buffer) {
+    free(buffer->ops);
+    free(buffer->activeScratch);
+    memset(buffer, 0, sizeof(*buffer));
+}
+
+static int FaceWarpReserve(FaceWarpBuffer *buffer, size_t capacity) {
+    if (capacity <= buffer->capacity) {
+        return 1;
+    }
+    FaceWarpOp *ops = realloc(buffer->ops, capacity * sizeof(FaceWarpOp));
+    if (!ops) {
+        return 0;
+    }
+    buffer->ops = ops;
+    int32_t *scratch = realloc(buffer->activeScratch, capacity * sizeof(int32_t));
+    if (!scratch) {
+        return 0;
+    }
+    buffer->activeScratch = scratch;
+    buffer->capacity = capacity;
+    return 1;
+}
+
+static void FaceWarpPushOp(FaceWarpBuffer *buffer,
+                           FaceWarpOpKind kind,
+                           float cx,
+                           float cy,
+                           float radius,
+                           float dx,
+                           float dy,
+                           float strength,
+                           int width,
+                           int height) {
+    if (radius < 1.0f) {
+        return;
+    }
+    FaceWarpOp *op = &buffer->ops[buffer->count];
+    op->kind = kind;
+    op->cx = cx;
+    op->cy = cy;
+    op->radiusSq = radius * radius;
+    op->invRadiusSq = 1.0f / op->radiusSq;
+    op->dx = dx;
+    op->dy = dy;
+    op->strength = strength;
+
+    float left = floorf(cx - radius);
+    float top = floorf(cy - radius);
+    float right = ceilf(cx + radius) + 1.0f;
+    float bottom = ceilf(cy + radius) + 1.0f;
+    op->x0 = (int32_t)fmaxf(0.0f, left);
+    op->y0 = (int32_t)fmaxf(0.0f, top);
+    op->x1 = (int32_t)fminf((float)width, right);
+    op->y1 = (int32_t)fminf((float)height, bottom);
+    if (op->x0 >= op->x1 || op->y0 >= op->y1) {
+        return;
+    }
+    buffer->count++;
+}
+
+static int FaceWarpCompareOps(const void *a, const void *b) {
+    const FaceWarpOp *lhs = a;
+    const FaceWarpOp *rhs = b;
+    return (lhs->y0 > rhs->y0) - (lhs->y0 < rhs->y0);
+}
+
+size_t FaceWarpBufferPack(FaceWarpBuffer *buffer,
+                          const FaceWarpFace *faces,
+                          size_t faceCount,
+                          int width,
+                          int height) {
+    buffer->count = 0;
+    if (!faces || faceCount == 0 || width <= 0 || height <= 0) {
+        return 0;
+    }
+    // At most 2 cheeks + 2 eyes + 1 nose per face.
+    if (!FaceWarpReserve(buffer, faceCount * 5)) {
+        return 0;
+    }
+
+    for (size_t i = 0; i < faceCount; i++) {
+        const FaceWarpFace *face = &faces[i];
+        if (face->width <= 0.0f || face->height <= 0.0f) {
+            continue;
+        }
+        float w = face->width;
+        float h = face->height;
+
+        if (face->slimming > kMinEffect) {
+            // Cheeks move toward the face centre; the op stores the inverse displacement.
+            float pull = face->slimming * kCheekPull * w;
+            float cy = face->y + kCheekY * h;
+            FaceWarpPushOp(buffer, FaceWarpOpTranslate, face->x + kCheekX * w, cy, kCheekRadius * w,
+                           -pull, 0.0f, 0.0f, width, height);
+            FaceWarpPushOp(buffer, FaceWarpOpTranslate, face->x + (1.0f - kCheekX) * w, cy, kCheekRadius * w,
+                           pull, 0.0f, 0.0f, width, height);
+        }
+
+        if (face->eyeEnlargement > kMinEffect) {
+            float strength = face->eyeEnlargement * kEyeStrength;
+            float cy = face->y + kEyeY * h;
+            FaceWarpPushOp(buffer, FaceWarpOpScale, face->x + kEyeX * w, cy, kEyeRadius * w,
+                           0.0f, 0.0f, strength, width, height);
+            FaceWarpPushOp(buffer, FaceWarpOpScale, face->x + (1.0f - kEyeX) * w, cy, kEyeRadius * w,
+                           0.0f, 0.0f, strength, width, height);
+        }
+
+        if (fabsf(face->noseScale) > kMinEffect) {
+            FaceWarpPushOp(buffer, FaceWarpOpScale, face->x + 0.5f * w, face->y + kNoseY * h, kNoseRadius * w,
+                           0.0f, 0.0f, face->noseScale * kNoseStrength, width, height);
+        }
+    }
+
+    qsort(buffer->ops, buffer->count, sizeof(FaceWarpOp), FaceWarpCompareOps);
+    return buffer->count;
+}
+
+static inline void FaceWarpAccumulate(const FaceWarpOp *op, float x, float y, float *dx, float *dy) {
+    float ox = x - op->cx;
+    float oy = y - op->cy;
+    float distSq = ox * ox + oy * oy;
+    if (distSq >= op->radiusSq) {
+        return;
+    }
+    float falloff = 1.0f - distSq * op->invRadiusSq;
+    if (op->kind == FaceWarpOpTranslate) {
+        float weight = falloff * falloff;
+        *dx += op->dx * weight;
+        *dy += op->dy * weight;
+    } else {
+        float weight = -op->strength * falloff;
+        *dx += ox * weight;
+        *dy += oy * weight;
+    }
+}
+
+void FaceWarpDisplacementAt(const FaceWarpBuffer *buffer, float x, float y, float *outDx, float *outDy) {
+    float dx = 0.0f;
+    float dy = 0.0f;
+    for (size_t i = 0; i < buffer->count; i++) {
+        const FaceWarpOp *op = &buffer->ops[i];
+        if (y < (float)op->y0 || y >= (float)op->y1 || x < (float)op->x0 || x >= (float)op->x1) {
+            continue;
+        }
+        FaceWarpAccumulate(op, x, y, &dx, &dy);
+    }
+    *outDx = dx;
+    *outDy = dy;
+}
+
+void FaceWarpSampleRGBA(const uint8_t *src, size_t srcStride, int width, int height, float sx, float sy, uint8_t *out) {
+    float maxX = (float)(width - 1);
+    float maxY = (float)(height - 1);
+    sx = sx < 0.0f ? 0.0f : (sx > maxX ? maxX : sx);
+    sy = sy < 0.0f ? 0.0f : (sy > maxY ? maxY : sy);
+
+    int x0 = (int)sx;
+    int y0 = (int)sy;
+    int x1 = x0 + 1 < width ? x0 + 1 : x0;
+    int y1 = y0 + 1 < height ? y0 + 1 : y0;
+    // 8-bit fixed point weights keep the inner loop in integer arithmetic.
+    uint32_t fx = (uint32_t)((sx - (float)x0) * 256.0f);
+    uint32_t fy = (uint32_t)((sy - (float)y0) * 256.0f);
+    uint32_t w00 = (256 - fx) * (256 - fy);
+    uint32_t w10 = fx * (256 - fy);
+    uint32_t w01 = (256 - fx) * fy;
+    uint32_t w11 = fx * fy;
+
+    const uint8_t *r0 = src + (size_t)y0 * srcStride;
+    const uint8_t *r1 = src + (size_t)y1 * srcStride;
+    const uint8_t *p00 = r0 + (size_t)x0 * 4;
+    const uint8_t *p10 = r0 + (size_t)x1 * 4;
+    const uint8_t *p01 = r1 + (size_t)x0 * 4;
+    const uint8_t *p11 = r1 + (size_t)x1 * 4;
+    for (int c = 0; c < 4; c++) {
+        uint32_t v = p00[c] * w00 + p10[c] * w10 + p01[c] * w01 + p11[c] * w11;
+        out[c] = (uint8_t)((v + 32768u) >> 16);
+    }
+}
+
+void FaceWarpApplyRGBA(FaceWarpBuffer *buffer,
+                       const uint8_t *src,
+                       size_t srcStride,
+                       uint8_t *dst,
+                       size_t dstStride,
+                       int width,
+                       int height) {
+    size_t rowBytes = (size_t)width * 4;
+    int32_t *active = buffer->activeScratch;
+
+    for (int y = 0; y < height; y++) {
+        const uint8_t *srcRow = src + (size_t)y * srcStride;
+        uint8_t *dstRow = dst + (size_t)y * dstStride;
+
+        // Ops are sorted by top edge, so the scan stops at the first op below this row.
+        size_t activeCount = 0;
+        int32_t spanStart = width;
+        int32_t spanEnd = 0;
+        for (size_t i = 0; i < buffer->count && buffer->ops[i].y0 <= y; i++) {
+            const FaceWarpOp *op = &buffer->ops[i];
+            if (y >= op->y1) {
+                continue;
+            }
+            active[activeCount++] = (int32_t)i;
+            if (op->x0 < spanStart) spanStart = op->x0;
+            if (op->x1 > spanEnd) spanEnd = op->x1;
+        }
+
+        if (activeCount == 0) {
+            memcpy(dstRow, srcRow, rowBytes);
+            continue;
+        }
+
+        memcpy(dstRow, srcRow, (size_t)spanStart * 4);
+        memcpy(dstRow + (size_t)spanEnd * 4, srcRow + (size_t)spanEnd * 4, (size_t)(width - spanEnd) * 4);
+
+        float fy = (float)y;
+        for (int32_t x = spanStart; x < spanEnd; x++) {
+            float fx = (float)x;
+            float dx = 0.0f;
+            float dy = 0.0f;
+            for (size_t k = 0; k < activeCount; k++) {
+                const FaceWarpOp *op = &buffer->ops[active[k]];
+                if (x < op->x0 || x >= op->x1) {
+                    continue;
+                }
+                FaceWarpAccumulate(op, fx, fy, &dx, &dy);
+            }
+            uint8_t *out = dstRow + (size_t)x * 4;
+            if (dx == 0.0f && dy == 0.0f) {
+                memcpy(out, srcRow + (size_t)x * 4, 4);
+            } else {
+                FaceWarpSampleRGBA(src, srcStride, width, height, fx + dx, fy + dy, out);
+            }
+        }
+    }
+}
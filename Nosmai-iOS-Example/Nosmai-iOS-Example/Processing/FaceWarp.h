@@ -0,0 +1,101 @@
+//
+//  FaceWarp.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 18/10/2026.
+//
+
+#ifndef FACE_WARP_H
+#define FACE_WARP_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Per-face reshape request, in pixel coordinates of the frame being warped.
+ * Levels use the same ranges as the SDK built-ins:
+ *   slimming / eyeEnlargement : 0.0 (off) .. 1.0 (max)   -> applyFaceSlimming: / applyEyeEnlargement:
+ *   noseScale                 : -1.0 (smaller) .. 1.0 (larger), 0 = unchanged -> applyNoseSize: (50 = 0)
+ */
+typedef struct {
+    float x, y, width, height;
+    float slimming;
+    float eyeEnlargement;
+    float noseScale;
+} FaceWarpFace;
+
+typedef enum {
+    FaceWarpOpTranslate = 0,  // Pull pixels inside the radius by (dx, dy), with smooth falloff
+    FaceWarpOpScale = 1       // Magnify (strength > 0) or shrink (strength < 0) around the centre
+} FaceWarpOpKind;
+
+/**
+ * One deformation primitive. Every face expands into a handful of these and all
+ * faces share a single packed buffer, so the whole frame is warped in one pass.
+ */
+typedef struct {
+    FaceWarpOpKind kind;
+    float cx, cy;
+    float radiusSq;
+    float invRadiusSq;
+    float dx, dy;
+    float strength;
+    int32_t x0, y0, x1, y1;  // Clamped affected rect, x1/y1 exclusive
+} FaceWarpOp;
+
+typedef struct {
+    FaceWarpOp *ops;
+    size_t count;
+    size_t capacity;
+    int32_t *activeScratch;  // Row-active op indices used by the single-pass renderer
+} FaceWarpBuffer;
+
+void FaceWarpBufferInit(FaceWarpBuffer *buffer);
+void FaceWarpBufferFree(FaceWarpBuffer *buffer);
+
+/**
+ * Expands every face into deformation ops and packs them into one buffer sorted
+ * by their top edge. Ops that would not move any pixel are skipped.
+ *
+ * @return Number of packed ops, or 0 if there is nothing to warp.
+ */
+size_t FaceWarpBufferPack(FaceWarpBuffer *buffer,
+                          const FaceWarpFace *faces,
+                          size_t faceCount,
+                          int width,
+                          int height);
+
+/**
+ * Inverse displacement at (x, y): the warped output pixel samples the source at
+ * (x + dx, y + dy). Evaluates every packed op that covers the point.
+ */
+void FaceWarpDisplacementAt(const FaceWarpBuffer *buffer, float x, float y, float *outDx, float *outDy);
+
+/**
+ * Warps a 4-channel 8-bit frame (RGBA or BGRA, channel order does not matter)
+ * for all faces in one pass. Rows and spans not covered by any op are copied
+ * through. src and dst must not alias.
+ */
+void FaceWarpApplyRGBA(FaceWarpBuffer *buffer,
+                       const uint8_t *src,
+                       size_t srcStride,
+                       uint8_t *dst,
+                       size_t dstStride,
+                       int width,
+                       int height);
+
+/**
+ * Bilinear sample of a 4-channel 8-bit image with edge clamping. Shared with
+ * the displacement-field renderer.
+ */
+void FaceWarpSampleRGBA(const uint8_t *src, size_t srcStride, int width, int height, float sx, float sy, uint8_t *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FACE_WARP_H */
@@ -0,0 +1,61 @@
+//
+//  FilterCatalog.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Lists the catalog from its packages, e.g. with -[NosmaiSDK getInitialFilters]; called off the main thread
+typedef NSDictionary<NSString *, NSArray<NSDictionary *> *> * _Nullable (^FilterCatalogLister)(void);
+
+/**
+ * The filter catalog as the SDK last listed it, persisted as a CatalogIndex
+ * so the next launch lists every filter with one small file read instead
+ * of -getInitialFilters opening and decrypting each package on the main
+ * thread.
+ *
+ * Each filter keeps its name, display name, type, preview and package
+ * location, package size and content hash; its other keys are stored as
+ * is. -revalidateWithLister:completion: checks the packages against disk in
+ * the background, hashing only those whose size or mtime moved, and lists
+ * the catalog again, on the same background queue, only when one did.
+ * Thread-safe.
+ */
+@interface FilterCatalog : NSObject
+
+/// Where the index lives; Caches/filter-catalog.index by default
+@property (nonatomic, readonly) NSURL *indexURL;
+
+/**
+ * loadMs, entries, indexBytes, revalidateMs, unchanged, touched, changed,
+ * missing, added, bytesHashed, relistMs
+ */
+@property (nonatomic, readonly) NSDictionary<NSString *, NSNumber *> *statistics;
+
+- (instancetype)initWithIndexURL:(NSURL *)indexURL packageDirectories:(NSArray<NSURL *> *)packageDirectories NS_DESIGNATED_INITIALIZER;
+/// The default index, watching the bundled Filters directory
+- (instancetype)init;
+
+/// The catalog organised by filter type, like -getInitialFilters; nil without a usable index
+- (nullable NSDictionary<NSString *, NSArray<NSDictionary *> *> *)cachedFilters;
+
+/// Replaces the index with this listing; hashed and written in the background
+- (void)recordFilters:(NSDictionary<NSString *, NSArray<NSDictionary *> *> *)organizedFilters;
+
+/**
+ * Checks every indexed package, and the package directories for packages
+ * the index does not know, off the calling thread. When a package changed,
+ * disappeared or appeared, lister runs on the catalog's queue and its
+ * listing replaces the index. completion runs on the main queue with that
+ * listing, or nil when the index was still valid.
+ */
+- (void)revalidateWithLister:(FilterCatalogLister)lister
+                  completion:(void (^)(NSDictionary<NSString *, NSArray<NSDictionary *> *> * _Nullable refreshedFilters))completion;
+
+@end
+
+NS_ASSUME_NONNULL_END
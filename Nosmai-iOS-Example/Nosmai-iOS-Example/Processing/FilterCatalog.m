@@ -0,0 +1,226 @@
+//
+//  FilterCatalog.m
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#import "FilterCatalog.h"
+#import <os/lock.h>
+#include "CatalogIndex.h"
+#include <time.h>
+
+static NSString * const kFilterPackageExtension = @"nosmai";
+
+static double FilterCatalogNowMs(void) {
+    return (double)clock_gettime_nsec_np(CLOCK_UPTIME_RAW) / 1.0e6;
+}
+
+static NSString *FilterCatalogString(const char *value) {
+    return value && value[0] ? [NSString stringWithUTF8String:value] : nil;
+}
+
+@implementation FilterCatalog {
+    NSArray<NSURL *> *_packageDirectories;
+    dispatch_queue_t _queue;  // Serialises index writes and revalidation
+    os_unfair_lock _lock;
+    // Guarded by _lock.
+    NSMutableDictionary<NSString *, NSNumber *> *_statistics;
+}
+
+- (instancetype)initWithIndexURL:(NSURL *)indexURL packageDirectories:(NSArray<NSURL *> *)packageDirectories {
+    self = [super init];
+    if (self) {
+        _indexURL = [indexURL copy];
+        _packageDirectories = [packageDirectories copy];
+        _queue = dispatch_queue_create("com.nosmai.filter-catalog", dispatch_queue_attr_make_with_qos_class(DISPATCH_QUEUE_SERIAL, QOS_CLASS_UTILITY, 0));
+        _lock = OS_UNFAIR_LOCK_INIT;
+        _statistics = [NSMutableDictionary dictionary];
+    }
+    return self;
+}
+
+- (instancetype)init {
+    NSURL *caches = [[NSFileManager defaultManager] URLsForDirectory:NSCachesDirectory inDomains:NSUserDomainMask].firstObject;
+    NSURL *bundled = [NSBundle mainBundle].resourceURL;
+    return [self initWithIndexURL:[caches URLByAppendingPathComponent:@"filter-catalog.index"]
+               packageDirectories:bundled ? @[bundled] : @[]];
+}
+
+- (NSDictionary<NSString *, NSNumber *> *)statistics {
+    os_unfair_lock_lock(&_lock);
+    NSDictionary<NSString *, NSNumber *> *statistics = [_statistics copy];
+    os_unfair_lock_unlock(&_lock);
+    return statistics;
+}
+
+- (void)updateStatistics:(NSDictionary<NSString *, NSNumber *> *)values {
+    os_unfair_lock_lock(&_lock);
+    [_statistics addEntriesFromDictionary:values];
+    os_unfair_lock_unlock(&_lock);
+}
+
+#pragma mark - Listing
+
+- (nullable NSDictionary<NSString *, NSArray<NSDictionary *> *> *)cachedFilters {
+    double start = FilterCatalogNowMs();
+    CatalogIndex index;
+    CatalogIndexInit(&index);
+    if (CatalogIndexLoad(&index, self.indexURL.fileSystemRepresentation) != 0 || index.count == 0) {
+        CatalogIndexFree(&index);
+        return nil;
+    }
+
+    NSMutableDictionary<NSString *, NSMutableArray<NSDictionary *> *> *organized = [NSMutableDictionary dictionary];
+    for (size_t i = 0; i < index.count; i++) {
+        const CatalogEntry *entry = &index.entries[i];
+        NSMutableDictionary *filter = [NSMutableDictionary dictionary];
+        if (entry->attributesSize > 0) {
+            NSData *data = [NSData dataWithBytesNoCopy:entry->attributes length:entry->attributesSize freeWhenDone:NO];
+            NSDictionary *attributes = [NSPropertyListSerialization propertyListWithData:data options:NSPropertyListImmutable format:NULL error:NULL];
+            if ([attributes isKindOfClass:[NSDictionary class]]) [filter addEntriesFromDictionary:attributes];
+        }
+        filter[@"name"] = FilterCatalogString(entry->name);
+        filter[@"displayName"] = FilterCatalogString(entry->displayName);
+        filter[@"type"] = FilterCatalogString(entry->type);
+        filter[@"path"] = FilterCatalogString(entry->packagePath);
+        filter[@"previewPath"] = FilterCatalogString(entry->previewPath);
+        if (entry->size > 0) filter[@"fileSize"] = @(entry->size);
+
+        NSString *group = FilterCatalogString(entry->group) ?: @"filter";
+        if (!organized[group]) organized[group] = [NSMutableArray array];
+        [organized[group] addObject:filter];
+    }
+    NSUInteger count = index.count;
+    CatalogIndexFree(&index);
+
+    [self updateStatistics:@{@"loadMs": @(FilterCatalogNowMs() - start), @"entries": @(count)}];
+    return organized;
+}
+
+#pragma mark - Recording
+
+/// The keys a filter is listed by travel in the index's own fields; the rest, if it is a property list, as attributes
+- (nullable NSData *)attributesForFilter:(NSDictionary *)filter {
+    NSMutableDictionary *attributes = [NSMutableDictionary dictionary];
+    [filter enumerateKeysAndObjectsUsingBlock:^(id key, id value, BOOL *stop) {
+        if (![key isKindOfClass:[NSString class]]) return;
+        if ([@[@"name", @"displayName", @"type", @"path", @"previewPath", @"fileSize"] containsObject:key]) return;
+        if ([value isKindOfClass:[NSString class]] || [value isKindOfClass:[NSNumber class]] || [value isKindOfClass:[NSDate class]] ||
+            [value isKindOfClass:[NSData class]] || [value isKindOfClass:[NSArray class]] || [value isKindOfClass:[NSDictionary class]]) {
+            attributes[key] = value;
+        }
+    }];
+    if (attributes.count == 0) return nil;
+    return [NSPropertyListSerialization dataWithPropertyList:attributes format:NSPropertyListBinaryFormat_v1_0 options:0 error:NULL];
+}
+
+- (void)recordFilters:(NSDictionary<NSString *, NSArray<NSDictionary *> *> *)organizedFilters {
+    NSDictionary<NSString *, NSArray<NSDictionary *> *> *snapshot = [organizedFilters copy];
+    dispatch_async(_queue, ^{
+        [self writeIndexForFilters:snapshot];
+    });
+}
+
+// Catalog queue only.
+- (void)writeIndexForFilters:(NSDictionary<NSString *, NSArray<NSDictionary *> *> *)organizedFilters {
+    CatalogIndex index;
+    CatalogIndexInit(&index);
+    for (NSString *group in organizedFilters) {
+        for (NSDictionary *filter in organizedFilters[group]) {
+            NSString *name = filter[@"name"] ?: filter[@"displayName"];
+            if (![name isKindOfClass:[NSString class]]) continue;
+            NSString *package = filter[@"path"] ?: filter[@"localPath"];
+            if (![package isKindOfClass:[NSString class]] ||
+                ![[NSFileManager defaultManager] fileExistsAtPath:package]) {
+                package = @"";
+            }
+            NSData *attributes = [self attributesForFilter:filter];
+            CatalogEntry entry = {
+                .name = (char *)name.UTF8String,
+                .displayName = (char *)([filter[@"displayName"] description] ?: name).UTF8String,
+                .type = (char *)([filter[@"type"] description] ?: @"").UTF8String,
+                .group = (char *)group.UTF8String,
+                .packagePath = (char *)package.fileSystemRepresentation,
+                .previewPath = (char *)([filter[@"previewPath"] description] ?: @"").UTF8String,
+                .attributes = (uint8_t *)attributes.bytes,
+                .attributesSize = attributes.length,
+            };
+            if (CatalogIndexPut(&index, &entry) != 0) {
+                NSLog(@"❌ Filter catalog: %@ not indexed", name);
+            }
+        }
+    }
+    if (CatalogIndexSave(&index, self.indexURL.fileSystemRepresentation) != 0) {
+        NSLog(@"❌ Filter catalog index not written to %@", self.indexURL.path);
+    }
+    CatalogIndexFree(&index);
+}
+
+#pragma mark - Revalidation
+
+/// Packages in the watched directories and beside indexed packages that the index does not know
+- (NSUInteger)countUnindexedPackagesIn:(const CatalogIndex *)index {
+    NSMutableSet<NSString *> *directories = [NSMutableSet set];
+    for (NSURL *directory in _packageDirectories) [directories addObject:directory.path];
+    for (size_t i = 0; i < index->count; i++) {
+        NSString *package = FilterCatalogString(index->entries[i].packagePath);
+        if (package) [directories addObject:package.stringByDeletingLastPathComponent];
+    }
+
+    NSUInteger added = 0;
+    for (NSString *directory in directories) {
+        NSArray<NSString *> *contents = [[NSFileManager defaultManager] contentsOfDirectoryAtPath:directory error:NULL];
+        for (NSString *file in contents) {
+            if (![file.pathExtension isEqualToString:kFilterPackageExtension]) continue;
+            NSString *package = [directory stringByAppendingPathComponent:file];
+            if (!CatalogIndexFindPackage(index, package.fileSystemRepresentation)) added++;
+        }
+    }
+    return added;
+}
+
+- (void)revalidateWithLister:(FilterCatalogLister)lister
+                  completion:(void (^)(NSDictionary<NSString *, NSArray<NSDictionary *> *> * _Nullable))completion {
+    dispatch_async(_queue, ^{
+        CatalogIndex index;
+        CatalogIndexInit(&index);
+        BOOL stale = YES;
+        if (CatalogIndexLoad(&index, self.indexURL.fileSystemRepresentation) == 0) {
+            CatalogRevalidateStats stats;
+            size_t changed = CatalogIndexRevalidate(&index, &stats);
+            NSUInteger added = [self countUnindexedPackagesIn:&index];
+            stale = changed > 0 || added > 0;
+            if (!stale && stats.touched > 0) {
+                // Only mtimes moved; keep them so the next launch does not hash those packages again.
+                CatalogIndexSave(&index, self.indexURL.fileSystemRepresentation);
+            }
+            NSDictionary *attributes = [[NSFileManager defaultManager] attributesOfItemAtPath:self.indexURL.path error:NULL];
+            [self updateStatistics:@{
+                @"revalidateMs": @(stats.elapsedMs),
+                @"unchanged": @(stats.unchanged),
+                @"touched": @(stats.touched),
+                @"changed": @(stats.changed),
+                @"missing": @(stats.missing),
+                @"added": @(added),
+                @"bytesHashed": @(stats.bytesHashed),
+                @"indexBytes": @(attributes.fileSize),
+            }];
+        }
+        CatalogIndexFree(&index);
+
+        // Listing opens every package; it stays on this queue, off the main thread.
+        NSDictionary<NSString *, NSArray<NSDictionary *> *> *refreshed = nil;
+        if (stale) {
+            double start = FilterCatalogNowMs();
+            refreshed = lister();
+            if (refreshed) [self writeIndexForFilters:refreshed];
+            [self updateStatistics:@{@"relistMs": @(FilterCatalogNowMs() - start)}];
+        }
+        dispatch_async(dispatch_get_main_queue(), ^{
+            completion(refreshed);
+        });
+    });
+}
+
+@end
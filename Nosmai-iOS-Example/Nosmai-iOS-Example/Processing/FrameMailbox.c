@@ -0,0 +1,94 @@
+//
+//  FrameMailbox.c
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#include "FrameMailbox.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+int FrameMailboxInit(FrameMailbox *mailbox, FrameMailboxPolicy policy, size_t depth) {
+    memset(mailbox, 0, sizeof(*mailbox));
+    size_t capacity = policy == FrameMailboxPolicyLatest ? 1 : depth;
+    if (capacity == 0) {
+        return -1;
+    }
+    mailbox->items = calloc(capacity, sizeof(void *));
+    mailbox->pushMs = calloc(capacity, sizeof(double));
+    if (!mailbox->items || !mailbox->pushMs) {
+        free(mailbox->items);
+        free(mailbox->pushMs);
+        memset(mailbox, 0, sizeof(*mailbox));
+        return -1;
+    }
+    mailbox->policy = policy;
+    mailbox->capacity = capacity;
+    pthread_mutex_init(&mailbox->mutex, NULL);
+    return 0;
+}
+
+void FrameMailboxFree(FrameMailbox *mailbox) {
+    if (!mailbox->items) {
+        return;
+    }
+    pthread_mutex_destroy(&mailbox->mutex);
+    free(mailbox->items);
+    free(mailbox->pushMs);
+    memset(mailbox, 0, sizeof(*mailbox));
+}
+
+FrameMailboxPushResult FrameMailboxPush(FrameMailbox *mailbox, void *item, double nowMs, void **displaced) {
+    FrameMailboxPushResult result = FrameMailboxPushQueued;
+    pthread_mutex_lock(&mailbox->mutex);
+    mailbox->stats.submitted++;
+    if (mailbox->count == mailbox->capacity) {
+        if (mailbox->policy == FrameMailboxPolicyFIFO) {
+            mailbox->stats.rejected++;
+            pthread_mutex_unlock(&mailbox->mutex);
+            return FrameMailboxPushRejected;
+        }
+        // Latest policy: the single slot changes hands.
+        *displaced = mailbox->items[mailbox->head];
+        mailbox->head = (mailbox->head + 1) % mailbox->capacity;
+        mailbox->count--;
+        mailbox->stats.replaced++;
+        result = FrameMailboxPushReplaced;
+    }
+    size_t slot = (mailbox->head + mailbox->count) % mailbox->capacity;
+    mailbox->items[slot] = item;
+    mailbox->pushMs[slot] = nowMs;
+    mailbox->count++;
+    mailbox->stats.depth = (uint32_t)mailbox->count;
+    mailbox->stats.maxDepth = mailbox->stats.depth > mailbox->stats.maxDepth ? mailbox->stats.depth : mailbox->stats.maxDepth;
+    pthread_mutex_unlock(&mailbox->mutex);
+    return result;
+}
+
+int FrameMailboxTake(FrameMailbox *mailbox, double nowMs, void **item) {
+    pthread_mutex_lock(&mailbox->mutex);
+    if (mailbox->count == 0) {
+        pthread_mutex_unlock(&mailbox->mutex);
+        return 0;
+    }
+    *item = mailbox->items[mailbox->head];
+    double wait = nowMs - mailbox->pushMs[mailbox->head];
+    mailbox->head = (mailbox->head + 1) % mailbox->capacity;
+    mailbox->count--;
+    mailbox->stats.depth = (uint32_t)mailbox->count;
+    mailbox->stats.taken++;
+    mailbox->totalWaitMs += wait;
+    mailbox->stats.maxWaitMs = wait > mailbox->stats.maxWaitMs ? wait : mailbox->stats.maxWaitMs;
+    pthread_mutex_unlock(&mailbox->mutex);
+    return 1;
+}
+
+FrameMailboxStats FrameMailboxGetStats(FrameMailbox *mailbox) {
+    pthread_mutex_lock(&mailbox->mutex);
+    FrameMailboxStats stats = mailbox->stats;
+    stats.averageWaitMs = stats.taken > 0 ? mailbox->totalWaitMs / (double)stats.taken : 0.0;
+    pthread_mutex_unlock(&mailbox->mutex);
+    return stats;
+}
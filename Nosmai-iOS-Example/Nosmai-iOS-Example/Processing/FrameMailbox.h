@@ -0,0 +1,83 @@
+//
+//  FrameMailbox.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#ifndef FRAME_MAILBOX_H
+#define FRAME_MAILBOX_H
+
+#include <pthread.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    FrameMailboxPolicyFIFO = 0,    // Up to depth frames in order; a frame arriving when full is rejected
+    FrameMailboxPolicyLatest = 1   // One slot; a new frame replaces the pending one
+} FrameMailboxPolicy;
+
+typedef enum {
+    FrameMailboxPushQueued = 0,
+    FrameMailboxPushReplaced = 1,  // Queued; *displaced is the frame it replaced
+    FrameMailboxPushRejected = 2   // Not queued; the caller still owns the frame
+} FrameMailboxPushResult;
+
+typedef struct {
+    uint64_t submitted;
+    uint64_t taken;        // Handed to the consumer
+    uint64_t replaced;     // Displaced by a newer frame (latest policy)
+    uint64_t rejected;     // Refused because the FIFO was full
+    uint32_t depth;
+    uint32_t maxDepth;
+    double averageWaitMs;  // Push -> take
+    double maxWaitMs;
+} FrameMailboxStats;
+
+/**
+ * Pending frames between a producer that may outrun its consumer and the
+ * consumer.
+ *
+ * Unlike FrameQueue, the producer may take frames back out (a replaced
+ * frame belongs to the producer again, so it can report the drop), so this
+ * is a small mutex-protected ring rather than a lock-free one. The depth
+ * is what bounds latency: nothing waits behind more than `depth` frames.
+ */
+typedef struct {
+    pthread_mutex_t mutex;
+    FrameMailboxPolicy policy;
+    size_t capacity;
+    void **items;
+    double *pushMs;
+    size_t head;
+    size_t count;
+    FrameMailboxStats stats;
+    double totalWaitMs;
+} FrameMailbox;
+
+/**
+ * depth is forced to 1 for FrameMailboxPolicyLatest.
+ *
+ * @return 0 on success, -1 on invalid arguments or allocation failure
+ */
+int FrameMailboxInit(FrameMailbox *mailbox, FrameMailboxPolicy policy, size_t depth);
+
+/// Pending frames are not released; drain them first
+void FrameMailboxFree(FrameMailbox *mailbox);
+
+FrameMailboxPushResult FrameMailboxPush(FrameMailbox *mailbox, void *item, double nowMs, void **displaced);
+
+/// @return 1 if a frame was taken, 0 if none is pending
+int FrameMailboxTake(FrameMailbox *mailbox, double nowMs, void **item);
+
+FrameMailboxStats FrameMailboxGetStats(FrameMailbox *mailbox);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FRAME_MAILBOX_H */
@@ -0,0 +1,268 @@
+//
+//  FramePipeline.c
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 18/10/2026.
+//
+
+#include "FramePipeline.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// Wake-up interval while waiting for a frame or a free slot.
+static const long kFramePipelineWaitNs = 10 * 1000 * 1000;
+
+static double FramePipelineNowMs(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1000.0 + (double)ts.tv_nsec / 1.0e6;
+}
+
+// Caller holds the mutex.
+static void FramePipelineWait(FramePipeline *pipeline, pthread_cond_t *condition) {
+    struct timespec deadline;
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_nsec += kFramePipelineWaitNs;
+    if (deadline.tv_nsec >= 1000000000L) {
+        deadline.tv_sec += 1;
+        deadline.tv_nsec -= 1000000000L;
+    }
+    pthread_cond_timedwait(condition, &pipeline->mutex, &deadline);
+}
+
+static int FramePipelineClampDepth(int framesInFlight) {
+    return framesInFlight < 1 ? 1 : (framesInFlight > FRAME_PIPELINE_MAX_IN_FLIGHT ? FRAME_PIPELINE_MAX_IN_FLIGHT : framesInFlight);
+}
+
+// Caller holds the mutex.
+static void FramePipelineEnqueue(FramePipeline *pipeline, int stage, void *item, double submitMs, int abandoned) {
+    int slot = (pipeline->heads[stage] + pipeline->counts[stage]) % FRAME_PIPELINE_MAX_IN_FLIGHT;
+    pipeline->queues[stage][slot] = item;
+    pipeline->submitMs[stage][slot] = submitMs;
+    pipeline->abandoned[stage][slot] = abandoned;
+    pipeline->counts[stage]++;
+    pthread_cond_signal(&pipeline->stageConditions[stage]);
+}
+
+// Caller holds the mutex. Closes the active period of the current setting.
+static void FramePipelineAccountSetting(FramePipeline *pipeline, double now) {
+    FramePipelineDepthStats *depth = &pipeline->stats.depths[pipeline->stats.framesInFlight];
+    depth->activeMs += now - pipeline->settingSinceMs;
+    pipeline->settingSinceMs = now;
+}
+
+// Caller holds the mutex.
+static void FramePipelineFinish(FramePipeline *pipeline, double submitMs, int abandoned, double now) {
+    pipeline->inFlight--;
+    pthread_cond_broadcast(&pipeline->spaceCondition);
+    if (abandoned) {
+        pipeline->stats.abandoned++;
+        return;
+    }
+    double latency = now - submitMs;
+    FramePipelineStats *stats = &pipeline->stats;
+    pipeline->latencies[stats->completed % FRAME_PIPELINE_LATENCY_SAMPLES] = latency;
+    stats->completed++;
+    pipeline->totalLatencyMs += latency;
+    stats->maxLatencyMs = latency > stats->maxLatencyMs ? latency : stats->maxLatencyMs;
+    stats->depths[stats->framesInFlight].completed++;
+    pipeline->depthLatencyMs[stats->framesInFlight] += latency;
+}
+
+static void *FramePipelineStageMain(void *context) {
+    FramePipelineWorker *worker = context;
+    FramePipeline *pipeline = worker->pipeline;
+    int stage = worker->stage;
+    const FramePipelineStage *definition = &pipeline->config.stages[stage];
+    int last = stage == pipeline->config.stageCount - 1;
+
+    pthread_mutex_lock(&pipeline->mutex);
+    while (1) {
+        if (pipeline->counts[stage] == 0) {
+            if (pipeline->stopping) {
+                break;
+            }
+            FramePipelineWait(pipeline, &pipeline->stageConditions[stage]);
+            continue;
+        }
+        int slot = pipeline->heads[stage];
+        void *item = pipeline->queues[stage][slot];
+        double submitMs = pipeline->submitMs[stage][slot];
+        int abandoned = pipeline->abandoned[stage][slot];
+        pipeline->heads[stage] = (slot + 1) % FRAME_PIPELINE_MAX_IN_FLIGHT;
+        pipeline->counts[stage]--;
+        pthread_mutex_unlock(&pipeline->mutex);
+
+        double start = FramePipelineNowMs();
+        if (!abandoned) {
+            abandoned = definition->run(definition->context, item) != 0;
+        }
+        double now = FramePipelineNowMs();
+        double elapsed = now - start;
+
+        pthread_mutex_lock(&pipeline->mutex);
+        FramePipelineStageStats *stageStats = &pipeline->stats.stages[stage];
+        stageStats->frames++;
+        stageStats->maxMs = elapsed > stageStats->maxMs ? elapsed : stageStats->maxMs;
+        pipeline->stageTotalMs[stage] += elapsed;
+        if (!last) {
+            FramePipelineEnqueue(pipeline, stage + 1, item, submitMs, abandoned);
+            continue;
+        }
+        FramePipelineFinish(pipeline, submitMs, abandoned, now);
+        pthread_mutex_unlock(&pipeline->mutex);
+        if (pipeline->config.onComplete) {
+            pipeline->config.onComplete(pipeline->config.completeContext, item, !abandoned);
+        }
+        pthread_mutex_lock(&pipeline->mutex);
+    }
+    pthread_mutex_unlock(&pipeline->mutex);
+    return NULL;
+}
+
+static void FramePipelineDestroySync(FramePipeline *pipeline) {
+    for (int i = 0; i < pipeline->config.stageCount; i++) {
+        pthread_cond_destroy(&pipeline->stageConditions[i]);
+    }
+    pthread_cond_destroy(&pipeline->spaceCondition);
+    pthread_mutex_destroy(&pipeline->mutex);
+}
+
+int FramePipelineStart(FramePipeline *pipeline, const FramePipelineConfig *config) {
+    memset(pipeline, 0, sizeof(*pipeline));
+    if (config->stageCount <= 0 || config->stageCount > FRAME_PIPELINE_MAX_STAGES) {
+        return -1;
+    }
+    for (int i = 0; i < config->stageCount; i++) {
+        if (!config->stages[i].run) {
+            return -1;
+        }
+    }
+    pipeline->config = *config;
+    pipeline->stats.framesInFlight = FramePipelineClampDepth(config->framesInFlight);
+    pipeline->settingSinceMs = FramePipelineNowMs();
+    pthread_mutex_init(&pipeline->mutex, NULL);
+    pthread_cond_init(&pipeline->spaceCondition, NULL);
+    for (int i = 0; i < config->stageCount; i++) {
+        pthread_cond_init(&pipeline->stageConditions[i], NULL);
+    }
+
+    int started = 0;
+    for (; started < config->stageCount; started++) {
+        pipeline->workers[started] = (FramePipelineWorker){pipeline, started};
+        if (pthread_create(&pipeline->threads[started], NULL, FramePipelineStageMain, &pipeline->workers[started]) != 0) {
+            break;
+        }
+    }
+    if (started < config->stageCount) {
+        pthread_mutex_lock(&pipeline->mutex);
+        pipeline->stopping = 1;
+        pthread_mutex_unlock(&pipeline->mutex);
+        for (int i = 0; i < started; i++) {
+            pthread_join(pipeline->threads[i], NULL);
+        }
+        FramePipelineDestroySync(pipeline);
+        return -1;
+    }
+    pipeline->running = 1;
+    return 0;
+}
+
+int FramePipelineSubmit(FramePipeline *pipeline, void *item) {
+    if (!pipeline->running) {
+        return -1;
+    }
+    pthread_mutex_lock(&pipeline->mutex);
+    pipeline->stats.submitted++;
+    while (!pipeline->stopping && pipeline->inFlight >= pipeline->stats.framesInFlight && pipeline->config.blockWhenFull) {
+        FramePipelineWait(pipeline, &pipeline->spaceCondition);
+    }
+    if (pipeline->stopping || pipeline->inFlight >= pipeline->stats.framesInFlight) {
+        pipeline->stats.dropped++;
+        pthread_mutex_unlock(&pipeline->mutex);
+        return -1;
+    }
+    pipeline->inFlight++;
+    pipeline->stats.maxInFlight = pipeline->inFlight > pipeline->stats.maxInFlight ? pipeline->inFlight
+                                                                                   : pipeline->stats.maxInFlight;
+    FramePipelineEnqueue(pipeline, 0, item, FramePipelineNowMs(), 0);
+    pthread_mutex_unlock(&pipeline->mutex);
+    return 0;
+}
+
+void FramePipelineSetFramesInFlight(FramePipeline *pipeline, int framesInFlight) {
+    if (!pipeline->running) {
+        return;
+    }
+    pthread_mutex_lock(&pipeline->mutex);
+    int depth = FramePipelineClampDepth(framesInFlight);
+    if (depth != pipeline->stats.framesInFlight) {
+        FramePipelineAccountSetting(pipeline, FramePipelineNowMs());
+        pipeline->stats.framesInFlight = depth;
+        pthread_cond_broadcast(&pipeline->spaceCondition);
+    }
+    pthread_mutex_unlock(&pipeline->mutex);
+}
+
+void FramePipelineStop(FramePipeline *pipeline) {
+    if (!pipeline->running) {
+        return;
+    }
+    pthread_mutex_lock(&pipeline->mutex);
+    while (pipeline->inFlight > 0) {
+        FramePipelineWait(pipeline, &pipeline->spaceCondition);
+    }
+    pipeline->stopping = 1;
+    for (int i = 0; i < pipeline->config.stageCount; i++) {
+        pthread_cond_broadcast(&pipeline->stageConditions[i]);
+    }
+    pthread_cond_broadcast(&pipeline->spaceCondition);
+    pthread_mutex_unlock(&pipeline->mutex);
+    for (int i = 0; i < pipeline->config.stageCount; i++) {
+        pthread_join(pipeline->threads[i], NULL);
+    }
+
+    // Keep the final numbers readable after the threads are gone.
+    pipeline->stats = FramePipelineGetStats(pipeline);
+    pipeline->running = 0;
+    FramePipelineDestroySync(pipeline);
+}
+
+static int FramePipelineCompareDoubles(const void *a, const void *b) {
+    double x = *(const double *)a;
+    double y = *(const double *)b;
+    return x < y ? -1 : (x > y ? 1 : 0);
+}
+
+FramePipelineStats FramePipelineGetStats(FramePipeline *pipeline) {
+    if (!pipeline->running) {
+        return pipeline->stats;
+    }
+    double samples[FRAME_PIPELINE_LATENCY_SAMPLES];
+    pthread_mutex_lock(&pipeline->mutex);
+    FramePipelineAccountSetting(pipeline, FramePipelineNowMs());
+    FramePipelineStats stats = pipeline->stats;
+    stats.inFlight = pipeline->inFlight;
+    size_t count = stats.completed < FRAME_PIPELINE_LATENCY_SAMPLES ? (size_t)stats.completed : FRAME_PIPELINE_LATENCY_SAMPLES;
+    memcpy(samples, pipeline->latencies, sizeof(double) * count);
+    stats.averageLatencyMs = stats.completed > 0 ? pipeline->totalLatencyMs / (double)stats.completed : 0.0;
+    for (int i = 0; i < pipeline->config.stageCount; i++) {
+        FramePipelineStageStats *stage = &stats.stages[i];
+        stage->averageMs = stage->frames > 0 ? pipeline->stageTotalMs[i] / (double)stage->frames : 0.0;
+    }
+    for (int d = 1; d <= FRAME_PIPELINE_MAX_IN_FLIGHT; d++) {
+        FramePipelineDepthStats *depth = &stats.depths[d];
+        depth->throughputFps = depth->activeMs > 0.0 ? (double)depth->completed * 1000.0 / depth->activeMs : 0.0;
+        depth->averageLatencyMs = depth->completed > 0 ? pipeline->depthLatencyMs[d] / (double)depth->completed : 0.0;
+    }
+    pthread_mutex_unlock(&pipeline->mutex);
+
+    if (count > 0) {
+        qsort(samples, count, sizeof(double), FramePipelineCompareDoubles);
+        stats.p50LatencyMs = samples[count / 2];
+        stats.p95LatencyMs = samples[(count * 95) / 100 < count ? (count * 95) / 100 : count - 1];
+    }
+    return stats;
+}
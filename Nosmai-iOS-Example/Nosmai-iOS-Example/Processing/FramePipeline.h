@@ -0,0 +1,140 @@
+//
+//  FramePipeline.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 18/10/2026.
+//
+
+#ifndef FRAME_PIPELINE_H
+#define FRAME_PIPELINE_H
+
+#include <pthread.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define FRAME_PIPELINE_MAX_STAGES 8
+#define FRAME_PIPELINE_MAX_IN_FLIGHT 4
+#define FRAME_PIPELINE_LATENCY_SAMPLES 256
+
+/// @return 0 to pass the frame on, -1 to abandon it (later stages are skipped)
+typedef int (*FramePipelineStageFn)(void *context, void *item);
+/// Called once per submitted frame after its last stage; completed is 0 if a stage abandoned it
+typedef void (*FramePipelineCompleteFn)(void *context, void *item, int completed);
+
+typedef struct {
+    const char *name;
+    FramePipelineStageFn run;
+    void *context;
+} FramePipelineStage;
+
+typedef struct {
+    FramePipelineStage stages[FRAME_PIPELINE_MAX_STAGES];
+    int stageCount;
+    int framesInFlight;     // 1 .. FRAME_PIPELINE_MAX_IN_FLIGHT
+    int blockWhenFull;      // Submit waits for a slot instead of dropping the frame
+    FramePipelineCompleteFn onComplete;
+    void *completeContext;
+} FramePipelineConfig;
+
+typedef struct {
+    uint64_t frames;
+    double averageMs;
+    double maxMs;
+} FramePipelineStageStats;
+
+/// Frames completed while one frames-in-flight setting was active
+typedef struct {
+    uint64_t completed;
+    double activeMs;        // Time the setting was in effect
+    double throughputFps;   // completed / activeMs
+    double averageLatencyMs;
+} FramePipelineDepthStats;
+
+typedef struct {
+    uint64_t submitted;
+    uint64_t completed;
+    uint64_t dropped;       // Refused at submit: every slot was in flight
+    uint64_t abandoned;     // A stage returned -1
+    int framesInFlight;     // Current setting
+    int inFlight;
+    int maxInFlight;
+    double averageLatencyMs;  // Submit -> last stage done, all frames
+    double p50LatencyMs;      // Over the last FRAME_PIPELINE_LATENCY_SAMPLES frames
+    double p95LatencyMs;
+    double maxLatencyMs;
+    FramePipelineStageStats stages[FRAME_PIPELINE_MAX_STAGES];
+    FramePipelineDepthStats depths[FRAME_PIPELINE_MAX_IN_FLIGHT + 1];  // Indexed by setting
+} FramePipelineStats;
+
+/**
+ * Per-frame work split into explicit stages that overlap across frames.
+ *
+ * Every stage has its own thread and handles frames in submit order, so
+ * while frame n is in stage 2, frame n + 1 can already be in stage 1. How
+ * many frames may be inside the pipeline at once is the frames-in-flight
+ * setting: 1 runs the stages back to back for the lowest latency, 2 or 3
+ * let them overlap for throughput, bounded by the slowest stage.
+ *
+ * The setting can change while frames are flowing; frames already inside
+ * finish normally. Stats keep throughput and latency per setting.
+ */
+typedef struct FramePipeline FramePipeline;
+
+typedef struct {
+    FramePipeline *pipeline;
+    int stage;
+} FramePipelineWorker;
+
+struct FramePipeline {
+    FramePipelineConfig config;
+    pthread_t threads[FRAME_PIPELINE_MAX_STAGES];
+    FramePipelineWorker workers[FRAME_PIPELINE_MAX_STAGES];
+    pthread_mutex_t mutex;
+    pthread_cond_t stageConditions[FRAME_PIPELINE_MAX_STAGES];
+    pthread_cond_t spaceCondition;
+    int running;
+    int stopping;
+
+    // Guarded by mutex. Each stage's queue holds at most every in-flight frame.
+    void *queues[FRAME_PIPELINE_MAX_STAGES][FRAME_PIPELINE_MAX_IN_FLIGHT];
+    double submitMs[FRAME_PIPELINE_MAX_STAGES][FRAME_PIPELINE_MAX_IN_FLIGHT];
+    int abandoned[FRAME_PIPELINE_MAX_STAGES][FRAME_PIPELINE_MAX_IN_FLIGHT];
+    int heads[FRAME_PIPELINE_MAX_STAGES];
+    int counts[FRAME_PIPELINE_MAX_STAGES];
+    int inFlight;
+    double settingSinceMs;
+    double latencies[FRAME_PIPELINE_LATENCY_SAMPLES];
+    double totalLatencyMs;
+    double stageTotalMs[FRAME_PIPELINE_MAX_STAGES];
+    double depthLatencyMs[FRAME_PIPELINE_MAX_IN_FLIGHT + 1];
+    FramePipelineStats stats;
+};
+
+/// @return 0 on success, -1 on invalid configuration or if a thread could not be started
+int FramePipelineStart(FramePipeline *pipeline, const FramePipelineConfig *config);
+
+/**
+ * Hands a frame to the first stage.
+ *
+ * @return 0 if accepted (onComplete will see it), -1 if every slot is in
+ *         flight and blockWhenFull is off, or the pipeline is stopping
+ */
+int FramePipelineSubmit(FramePipeline *pipeline, void *item);
+
+/// Takes effect for the next submit; clamped to 1 .. FRAME_PIPELINE_MAX_IN_FLIGHT
+void FramePipelineSetFramesInFlight(FramePipeline *pipeline, int framesInFlight);
+
+/// Lets every accepted frame finish, then joins the stage threads
+void FramePipelineStop(FramePipeline *pipeline);
+
+FramePipelineStats FramePipelineGetStats(FramePipeline *pipeline);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FRAME_PIPELINE_H */
@@ -0,0 +1,50 @@
+//
+//  FramePyramid.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 18/10/2026.
+//
+
+#import <Foundation/Foundation.h>
+#import <CoreGraphics/CoreGraphics.h>
+#import <CoreVideo/CoreVideo.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * Per-frame image pyramid shared by every app-side consumer that needs a lower
+ * resolution copy of the current camera frame (face boxes, low-res passes,
+ * thumbnails). Each level is computed at most once per frame.
+ *
+ * 32BGRA buffers are pyramided as 4-channel images; biplanar YUV buffers use
+ * their luma plane, which is what detection and alignment consume.
+ *
+ * The example app creates none: face detection runs inside the SDK and the
+ * app takes no reduced copies of the camera frame.
+ */
+@interface FramePyramid : NSObject
+
+/// Retains and locks the buffer until -endFrame or the next -beginFrameWithPixelBuffer:
+- (BOOL)beginFrameWithPixelBuffer:(CVPixelBufferRef)pixelBuffer;
+
+- (void)endFrame;
+
+/**
+ * Calls block with the smallest level that is at least `size`. The pixels are
+ * only valid inside the block.
+ */
+- (BOOL)accessLevelForMinimumSize:(CGSize)size
+                       usingBlock:(void (NS_NOESCAPE ^)(const uint8_t *pixels, size_t bytesPerRow, int width, int height, int channels))block;
+
+/// Thumbnail from the smallest level at least `size` (32BGRA frames only)
+- (nullable CGImageRef)copyImageForMinimumSize:(CGSize)size CF_RETURNS_RETAINED;
+
+/**
+ * Counters: frames, levelHits / levelBuilds / levelRequests (arrays indexed by
+ * level) and bytesSaved.
+ */
+@property (nonatomic, readonly) NSDictionary<NSString *, id> *statistics;
+
+@end
+
+NS_ASSUME_NONNULL_END
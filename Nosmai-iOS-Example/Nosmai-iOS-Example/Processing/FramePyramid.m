@@ -0,0 +1,115 @@
+//
+//  FramePyramid.m
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 18/10/2026.
+//
+
+#import "FramePyramid.h"
+#include "ImagePyramid.h"
+
+@implementation FramePyramid {
+    ImagePyramid _pyramid;
+    CVPixelBufferRef _pixelBuffer;
+}
+
+- (instancetype)init {
+    self = [super init];
+    if (self) {
+        ImagePyramidInit(&_pyramid);
+    }
+    return self;
+}
+
+- (void)dealloc {
+    [self endFrame];
+    ImagePyramidFree(&_pyramid);
+}
+
+- (BOOL)beginFrameWithPixelBuffer:(CVPixelBufferRef)pixelBuffer {
+    [self endFrame];
+    if (!pixelBuffer) return NO;
+
+    OSType format = CVPixelBufferGetPixelFormatType(pixelBuffer);
+    BOOL isBGRA = format == kCVPixelFormatType_32BGRA;
+    BOOL isBiplanar = format == kCVPixelFormatType_420YpCbCr8BiPlanarFullRange ||
+                      format == kCVPixelFormatType_420YpCbCr8BiPlanarVideoRange;
+    if (!isBGRA && !isBiplanar) return NO;
+
+    CVPixelBufferRetain(pixelBuffer);
+    CVPixelBufferLockBaseAddress(pixelBuffer, kCVPixelBufferLock_ReadOnly);
+    _pixelBuffer = pixelBuffer;
+
+    if (isBGRA) {
+        ImagePyramidBeginFrame(&_pyramid,
+                               CVPixelBufferGetBaseAddress(pixelBuffer),
+                               CVPixelBufferGetBytesPerRow(pixelBuffer),
+                               (int)CVPixelBufferGetWidth(pixelBuffer),
+                               (int)CVPixelBufferGetHeight(pixelBuffer),
+                               4);
+    } else {
+        ImagePyramidBeginFrame(&_pyramid,
+                               CVPixelBufferGetBaseAddressOfPlane(pixelBuffer, 0),
+                               CVPixelBufferGetBytesPerRowOfPlane(pixelBuffer, 0),
+                               (int)CVPixelBufferGetWidthOfPlane(pixelBuffer, 0),
+                               (int)CVPixelBufferGetHeightOfPlane(pixelBuffer, 0),
+                               1);
+    }
+    return YES;
+}
+
+- (void)endFrame {
+    if (!_pixelBuffer) return;
+    CVPixelBufferUnlockBaseAddress(_pixelBuffer, kCVPixelBufferLock_ReadOnly);
+    CVPixelBufferRelease(_pixelBuffer);
+    _pixelBuffer = NULL;
+}
+
+- (BOOL)accessLevelForMinimumSize:(CGSize)size
+                       usingBlock:(void (NS_NOESCAPE ^)(const uint8_t *, size_t, int, int, int))block {
+    if (!_pixelBuffer) return NO;
+    ImagePyramidLevel level;
+    if (ImagePyramidGetLevelForSize(&_pyramid, (int)ceil(size.width), (int)ceil(size.height), &level) != 0) {
+        return NO;
+    }
+    block(level.pixels, level.stride, level.width, level.height, level.channels);
+    return YES;
+}
+
+- (CGImageRef)copyImageForMinimumSize:(CGSize)size {
+    __block CGImageRef image = NULL;
+    [self accessLevelForMinimumSize:size usingBlock:^(const uint8_t *pixels, size_t bytesPerRow, int width, int height, int channels) {
+        if (channels != 4) return;
+        CGColorSpaceRef colorSpace = CGColorSpaceCreateDeviceRGB();
+        // The level is reused next frame, so CGBitmapContextCreateImage's copy is what we want.
+        CGContextRef context = CGBitmapContextCreate((void *)pixels, width, height, 8, bytesPerRow, colorSpace,
+                                                     kCGImageAlphaNoneSkipFirst | kCGBitmapByteOrder32Little);
+        if (context) {
+            image = CGBitmapContextCreateImage(context);
+            CGContextRelease(context);
+        }
+        CGColorSpaceRelease(colorSpace);
+    }];
+    return image;
+}
+
+- (NSDictionary<NSString *, id> *)statistics {
+    ImagePyramidStats stats = ImagePyramidGetStats(&_pyramid);
+    NSMutableArray *hits = [NSMutableArray array];
+    NSMutableArray *builds = [NSMutableArray array];
+    NSMutableArray *requests = [NSMutableArray array];
+    for (int i = 0; i < IMAGE_PYRAMID_MAX_LEVELS; i++) {
+        [hits addObject:@(stats.levelHits[i])];
+        [builds addObject:@(stats.levelBuilds[i])];
+        [requests addObject:@(stats.levelRequests[i])];
+    }
+    return @{
+        @"frames": @(stats.frames),
+        @"levelHits": hits,
+        @"levelBuilds": builds,
+        @"levelRequests": requests,
+        @"bytesSaved": @(stats.bytesSaved),
+    };
+}
+
+@end
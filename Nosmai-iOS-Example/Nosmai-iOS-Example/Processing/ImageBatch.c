@@ -0,0 +1,165 @@
+//
+//  ImageBatch.c
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#include "ImageBatch.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static double ImageBatchNowMs(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1000.0 + (double)ts.tv_nsec / 1.0e6;
+}
+
+void MemoryBudgetInit(MemoryBudget *budget, size_t capBytes) {
+    memset(budget, 0, sizeof(*budget));
+    budget->capBytes = capBytes;
+    pthread_mutex_init(&budget->mutex, NULL);
+    pthread_cond_init(&budget->released, NULL);
+}
+
+void MemoryBudgetFree(MemoryBudget *budget) {
+    pthread_cond_destroy(&budget->released);
+    pthread_mutex_destroy(&budget->mutex);
+}
+
+void MemoryBudgetAcquire(MemoryBudget *budget, size_t bytes) {
+    pthread_mutex_lock(&budget->mutex);
+    if (budget->usedBytes > 0 && budget->usedBytes + bytes > budget->capBytes) {
+        budget->waits++;
+        while (budget->usedBytes > 0 && budget->usedBytes + bytes > budget->capBytes) {
+            pthread_cond_wait(&budget->released, &budget->mutex);
+        }
+    }
+    budget->usedBytes += bytes;
+    budget->peakBytes = budget->usedBytes > budget->peakBytes ? budget->usedBytes : budget->peakBytes;
+    pthread_mutex_unlock(&budget->mutex);
+}
+
+void MemoryBudgetRelease(MemoryBudget *budget, size_t bytes) {
+    pthread_mutex_lock(&budget->mutex);
+    budget->usedBytes -= bytes < budget->usedBytes ? bytes : budget->usedBytes;
+    pthread_cond_broadcast(&budget->released);
+    pthread_mutex_unlock(&budget->mutex);
+}
+
+typedef struct ImageBatchJob ImageBatchJob;
+
+typedef struct {
+    ImageBatchJob *job;
+    size_t index;
+    size_t bytes;
+    double admitMs;
+} ImageBatchItem;
+
+struct ImageBatchJob {
+    const ImageBatchCallbacks *callbacks;
+    MemoryBudget budget;
+    double *latencyMs;
+    ImageBatchItem *items;
+    pthread_mutex_t mutex;
+    // Guarded by mutex.
+    uint64_t succeeded;
+    uint64_t failed;
+    double decodeMs;
+    double processMs;
+    double encodeMs;
+};
+
+static void ImageBatchRunItem(void *context) {
+    ImageBatchItem *item = context;
+    ImageBatchJob *job = item->job;
+    ImageBatchTiming timing = {0.0, 0.0, 0.0};
+    int result = job->callbacks->run(job->callbacks->context, item->index, &timing);
+    double latency = ImageBatchNowMs() - item->admitMs;
+    MemoryBudgetRelease(&job->budget, item->bytes);
+
+    pthread_mutex_lock(&job->mutex);
+    if (result == 0) {
+        job->succeeded++;
+    } else {
+        job->failed++;
+    }
+    job->decodeMs += timing.decodeMs;
+    job->processMs += timing.processMs;
+    job->encodeMs += timing.encodeMs;
+    job->latencyMs[item->index] = latency;
+    pthread_mutex_unlock(&job->mutex);
+}
+
+static int ImageBatchCompareDoubles(const void *a, const void *b) {
+    double x = *(const double *)a;
+    double y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+void ImageBatchRun(TaskScheduler *scheduler,
+                   size_t count,
+                   size_t memoryCap,
+                   const ImageBatchCallbacks *callbacks,
+                   double *latencyMs,
+                   ImageBatchStats *stats) {
+    memset(stats, 0, sizeof(*stats));
+    stats->count = count;
+    stats->memoryCap = memoryCap;
+    if (count == 0) {
+        return;
+    }
+    ImageBatchJob job;
+    memset(&job, 0, sizeof(job));
+    job.callbacks = callbacks;
+    job.items = calloc(count, sizeof(ImageBatchItem));
+    job.latencyMs = calloc(count, sizeof(double));
+    if (!job.items || !job.latencyMs) {
+        free(job.items);
+        free(job.latencyMs);
+        stats->failed = count;
+        return;
+    }
+    MemoryBudgetInit(&job.budget, memoryCap);
+    pthread_mutex_init(&job.mutex, NULL);
+
+    double start = ImageBatchNowMs();
+    TaskGroup group;
+    TaskGroupInit(&group, TaskPriorityBackground);
+    for (size_t i = 0; i < count; i++) {
+        size_t bytes = callbacks->measure(callbacks->context, i);
+        MemoryBudgetAcquire(&job.budget, bytes);
+        job.items[i] = (ImageBatchItem){&job, i, bytes, ImageBatchNowMs()};
+        TaskGroupSubmit(&group, scheduler, ImageBatchRunItem, &job.items[i]);
+    }
+    TaskGroupWait(&group, scheduler);
+    TaskGroupDestroy(&group);
+    stats->totalMs = ImageBatchNowMs() - start;
+
+    stats->succeeded = job.succeeded;
+    stats->failed = job.failed;
+    stats->peakBytes = job.budget.peakBytes;
+    stats->budgetWaits = job.budget.waits;
+    stats->imagesPerSecond = stats->totalMs > 0.0 ? (double)count * 1000.0 / stats->totalMs : 0.0;
+    stats->averageDecodeMs = job.decodeMs / (double)count;
+    stats->averageProcessMs = job.processMs / (double)count;
+    stats->averageEncodeMs = job.encodeMs / (double)count;
+    if (latencyMs) {
+        memcpy(latencyMs, job.latencyMs, sizeof(double) * count);
+    }
+    double total = 0.0;
+    for (size_t i = 0; i < count; i++) {
+        total += job.latencyMs[i];
+    }
+    stats->averageLatencyMs = total / (double)count;
+    qsort(job.latencyMs, count, sizeof(double), ImageBatchCompareDoubles);
+    stats->p95LatencyMs = job.latencyMs[(count * 95) / 100 < count ? (count * 95) / 100 : count - 1];
+    stats->maxLatencyMs = job.latencyMs[count - 1];
+
+    pthread_mutex_destroy(&job.mutex);
+    MemoryBudgetFree(&job.budget);
+    free(job.items);
+    free(job.latencyMs);
+}
@@ -0,0 +1,95 @@
+//
+//  ImageBatch.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#ifndef IMAGE_BATCH_H
+#define IMAGE_BATCH_H
+
+#include <pthread.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "TaskScheduler.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    pthread_mutex_t mutex;
+    pthread_cond_t released;
+    size_t capBytes;
+    // Guarded by mutex.
+    size_t usedBytes;
+    size_t peakBytes;
+    uint64_t waits;
+} MemoryBudget;
+
+void MemoryBudgetInit(MemoryBudget *budget, size_t capBytes);
+void MemoryBudgetFree(MemoryBudget *budget);
+
+/**
+ * Blocks until bytes fit under the cap. A request larger than the whole
+ * cap is admitted once nothing else is held, so it runs alone instead of
+ * never.
+ */
+void MemoryBudgetAcquire(MemoryBudget *budget, size_t bytes);
+void MemoryBudgetRelease(MemoryBudget *budget, size_t bytes);
+
+typedef struct {
+    double decodeMs;
+    double processMs;
+    double encodeMs;
+} ImageBatchTiming;
+
+typedef struct {
+    void *context;
+    /// Peak bytes the item will hold (decoded and output images). Called on the submitting thread, in order
+    size_t (*measure)(void *context, size_t index);
+    /// Decodes, processes and encodes one item on a scheduler worker. @return 0 on success
+    int (*run)(void *context, size_t index, ImageBatchTiming *timing);
+} ImageBatchCallbacks;
+
+typedef struct {
+    uint64_t count;
+    uint64_t succeeded;
+    uint64_t failed;
+    size_t memoryCap;
+    size_t peakBytes;          // Highest total reservation; at most memoryCap unless one item alone exceeds it
+    uint64_t budgetWaits;      // Admissions that waited for memory
+    double totalMs;
+    double imagesPerSecond;
+    double averageLatencyMs;   // Admission -> encoded, per item
+    double p95LatencyMs;
+    double maxLatencyMs;
+    double averageDecodeMs;
+    double averageProcessMs;
+    double averageEncodeMs;
+} ImageBatchStats;
+
+/**
+ * Runs every item through decode, process and encode in parallel on the
+ * scheduler's background lane, so live frames keep priority.
+ *
+ * Items are admitted in order once their measured footprint fits the
+ * memory cap, so a batch of 48 MP photos never holds more than the cap
+ * however many workers there are. The reservation is returned when the
+ * item is done. The call returns when every item has finished.
+ *
+ * @param latencyMs Optional, count entries; receives each item's latency
+ */
+void ImageBatchRun(TaskScheduler *scheduler,
+                   size_t count,
+                   size_t memoryCap,
+                   const ImageBatchCallbacks *callbacks,
+                   double *latencyMs,
+                   ImageBatchStats *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* IMAGE_BATCH_H */
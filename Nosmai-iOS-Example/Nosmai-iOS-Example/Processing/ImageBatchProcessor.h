@@ -0,0 +1,75 @@
+//
+//  ImageBatchProcessor.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#import <Foundation/Foundation.h>
+#import "ProcessingSession.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Adds the preset's effects to a fresh session; called once per image, on a worker
+typedef void (^ImageBatchPreset)(ProcessingSession *session);
+
+@interface ImageBatchResult : NSObject
+
+@property (nonatomic, readonly) NSString *sourcePath;
+/// nil if the image failed
+@property (nonatomic, readonly, nullable) NSURL *outputURL;
+@property (nonatomic, readonly, nullable) NSError *error;
+/// From admission to the encoded file, including any wait for a worker
+@property (nonatomic, readonly) double latencyMs;
+@property (nonatomic, readonly) double decodeMs;
+@property (nonatomic, readonly) double processMs;
+@property (nonatomic, readonly) double encodeMs;
+
+@end
+
+/**
+ * Still-image input (NosmaiInputSourceTypeImage) for whole albums: decodes,
+ * processes and encodes many photos in parallel with the same effect
+ * chain the live path uses.
+ *
+ * Each image runs on the shared scheduler's background lane, so a batch
+ * never delays live frames. Images are admitted in order only while their
+ * decoded and output bitmaps fit under memoryLimitBytes; an image larger
+ * than the whole limit runs alone. Processing is tiled (see TiledFilter),
+ * so the working memory per image does not grow with its size.
+ */
+@interface ImageBatchProcessor : NSObject
+
+@property (nonatomic, readonly) ProcessingAssetLibrary *assets;
+
+/// Cap on the bitmaps held by a batch at once. Default 256 MB
+@property (nonatomic, assign) size_t memoryLimitBytes;
+/// Tile edge in pixels. Default 256
+@property (nonatomic, assign) int tileSize;
+/// Output type identifier. Default public.jpeg
+@property (nonatomic, copy) NSString *outputType;
+/// Default 0.9
+@property (nonatomic, assign) double compressionQuality;
+
+- (instancetype)initWithAssets:(ProcessingAssetLibrary *)assets NS_DESIGNATED_INITIALIZER;
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ * Processes every image into outputDirectory, keeping the source's name
+ * and orientation. Settings are read when the call is made.
+ *
+ * completion is called on the main queue with one result per path, in
+ * order, and images, succeeded, failed, totalMs, imagesPerSecond,
+ * averageLatencyMs, p95LatencyMs, maxLatencyMs, averageDecodeMs,
+ * averageProcessMs, averageEncodeMs, memoryLimitBytes, peakBytes and
+ * budgetWaits (images that waited for memory).
+ */
+- (void)processImagesAtPaths:(NSArray<NSString *> *)paths
+                      preset:(ImageBatchPreset)preset
+             outputDirectory:(NSURL *)outputDirectory
+                  completion:(void (^)(NSArray<ImageBatchResult *> *results,
+                                       NSDictionary<NSString *, NSNumber *> *statistics))completion;
+
+@end
+
+NS_ASSUME_NONNULL_END
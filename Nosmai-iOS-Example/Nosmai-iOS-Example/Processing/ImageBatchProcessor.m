@@ -0,0 +1,282 @@
+//
+//  ImageBatchProcessor.m
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#import "ImageBatchProcessor.h"
+#import <CoreVideo/CoreVideo.h>
+#import <ImageIO/ImageIO.h>
+#import <UniformTypeIdentifiers/UniformTypeIdentifiers.h>
+#include <time.h>
+#include "ImageBatch.h"
+
+static NSString * const kImageBatchErrorDomain = @"ImageBatchProcessor";
+
+typedef NS_ENUM(NSInteger, ImageBatchErrorCode) {
+    ImageBatchErrorDecode = 1,
+    ImageBatchErrorProcess = 2,
+    ImageBatchErrorEncode = 3,
+};
+
+static double ImageBatchProcessorNowMs(void) {
+    return (double)clock_gettime_nsec_np(CLOCK_UPTIME_RAW) / 1.0e6;
+}
+
+@interface ImageBatchResult ()
+@property (nonatomic, readwrite) NSString *sourcePath;
+@property (nonatomic, readwrite, nullable) NSURL *outputURL;
+@property (nonatomic, readwrite, nullable) NSError *error;
+@property (nonatomic, readwrite) double latencyMs;
+@property (nonatomic, readwrite) double decodeMs;
+@property (nonatomic, readwrite) double processMs;
+@property (nonatomic, readwrite) double encodeMs;
+@end
+
+@implementation ImageBatchResult
+@end
+
+/// One batch's settings and per-image outcomes. Each index is written by one worker only.
+@interface ImageBatchJob : NSObject {
+@public
+    ImageBatchTiming *_timings;
+    NSInteger *_errorCodes;
+}
+@property (nonatomic, copy) NSArray<NSString *> *paths;
+@property (nonatomic, copy) NSArray<NSURL *> *outputURLs;
+@property (nonatomic, copy) ImageBatchPreset preset;
+@property (nonatomic, strong) ProcessingAssetLibrary *assets;
+@property (nonatomic, copy) NSString *outputType;
+@property (nonatomic, assign) double compressionQuality;
+@property (nonatomic, assign) int tileSize;
+@end
+
+@implementation ImageBatchJob
+
+- (instancetype)initWithCount:(NSUInteger)count {
+    self = [super init];
+    if (self) {
+        _timings = calloc(MAX(count, 1), sizeof(ImageBatchTiming));
+        _errorCodes = calloc(MAX(count, 1), sizeof(NSInteger));
+    }
+    return self;
+}
+
+- (void)dealloc {
+    free(_timings);
+    free(_errorCodes);
+}
+
+@end
+
+#pragma mark - Pipeline
+
+static CVPixelBufferRef ImageBatchCreateBuffer(size_t width, size_t height) {
+    NSDictionary *attributes = @{(id)kCVPixelBufferIOSurfacePropertiesKey: @{}};
+    CVPixelBufferRef buffer = NULL;
+    CVPixelBufferCreate(kCFAllocatorDefault, width, height, kCVPixelFormatType_32BGRA,
+                        (__bridge CFDictionaryRef)attributes, &buffer);
+    return buffer;
+}
+
+static size_t ImageBatchMeasure(void *context, size_t index) {
+    ImageBatchJob *job = (__bridge ImageBatchJob *)context;
+    size_t bytes = 0;
+    @autoreleasepool {
+        NSURL *url = [NSURL fileURLWithPath:job.paths[index]];
+        CGImageSourceRef source = CGImageSourceCreateWithURL((__bridge CFURLRef)url, NULL);
+        if (source) {
+            NSDictionary *options = @{(id)kCGImageSourceShouldCache: @NO};
+            NSDictionary *properties = CFBridgingRelease(CGImageSourceCopyPropertiesAtIndex(source, 0, (__bridge CFDictionaryRef)options));
+            size_t width = [properties[(id)kCGImagePropertyPixelWidth] unsignedLongValue];
+            size_t height = [properties[(id)kCGImagePropertyPixelHeight] unsignedLongValue];
+            // Decoded source and processed output, both 32BGRA; tiles are small next to them.
+            bytes = width * height * 4 * 2;
+            CFRelease(source);
+        }
+    }
+    return bytes;
+}
+
+static NSInteger ImageBatchProcessOne(ImageBatchJob *job, size_t index, ImageBatchTiming *timing) {
+    NSURL *url = [NSURL fileURLWithPath:job.paths[index]];
+    double start = ImageBatchProcessorNowMs();
+    CGImageSourceRef imageSource = CGImageSourceCreateWithURL((__bridge CFURLRef)url, NULL);
+    CGImageRef image = imageSource ? CGImageSourceCreateImageAtIndex(imageSource, 0, NULL) : NULL;
+    NSDictionary *properties = imageSource ? CFBridgingRelease(CGImageSourceCopyPropertiesAtIndex(imageSource, 0, NULL)) : nil;
+    if (imageSource) CFRelease(imageSource);
+    if (!image) {
+        return ImageBatchErrorDecode;
+    }
+    size_t width = CGImageGetWidth(image);
+    size_t height = CGImageGetHeight(image);
+    CVPixelBufferRef source = ImageBatchCreateBuffer(width, height);
+    CVPixelBufferRef destination = ImageBatchCreateBuffer(width, height);
+    if (!source || !destination) {
+        CGImageRelease(image);
+        if (source) CVPixelBufferRelease(source);
+        if (destination) CVPixelBufferRelease(destination);
+        return ImageBatchErrorDecode;
+    }
+
+    CGColorSpaceRef colorSpace = CGColorSpaceCreateDeviceRGB();
+    CGBitmapInfo bitmapInfo = kCGBitmapByteOrder32Little | (CGBitmapInfo)kCGImageAlphaPremultipliedFirst;
+    CVPixelBufferLockBaseAddress(source, 0);
+    CGContextRef context = CGBitmapContextCreate(CVPixelBufferGetBaseAddress(source), width, height, 8,
+                                                 CVPixelBufferGetBytesPerRow(source), colorSpace, bitmapInfo);
+    BOOL drawn = context != NULL;
+    if (drawn) {
+        CGContextDrawImage(context, CGRectMake(0, 0, width, height), image);
+        CGContextRelease(context);
+    }
+    CVPixelBufferUnlockBaseAddress(source, 0);
+    CGImageRelease(image);
+    timing->decodeMs = ImageBatchProcessorNowMs() - start;
+
+    start = ImageBatchProcessorNowMs();
+    ProcessingSession *session = [[ProcessingSession alloc] initWithAssets:job.assets];
+    session.tileSize = job.tileSize;
+    job.preset(session);
+    BOOL processed = drawn && [session renderPixelBuffer:source toPixelBuffer:destination];
+    CVPixelBufferRelease(source);
+    timing->processMs = ImageBatchProcessorNowMs() - start;
+    if (!processed) {
+        CVPixelBufferRelease(destination);
+        CGColorSpaceRelease(colorSpace);
+        return drawn ? ImageBatchErrorProcess : ImageBatchErrorDecode;
+    }
+
+    // The encoder reads the output buffer in place rather than from a copy.
+    start = ImageBatchProcessorNowMs();
+    CVPixelBufferLockBaseAddress(destination, kCVPixelBufferLock_ReadOnly);
+    size_t bytesPerRow = CVPixelBufferGetBytesPerRow(destination);
+    CGDataProviderRef provider = CGDataProviderCreateWithData(NULL, CVPixelBufferGetBaseAddress(destination),
+                                                              bytesPerRow * height, NULL);
+    CGImageRef output = CGImageCreate(width, height, 8, 32, bytesPerRow, colorSpace, bitmapInfo,
+                                      provider, NULL, false, kCGRenderingIntentDefault);
+    CGDataProviderRelease(provider);
+    CGColorSpaceRelease(colorSpace);
+
+    BOOL encoded = NO;
+    CGImageDestinationRef imageDestination = CGImageDestinationCreateWithURL((__bridge CFURLRef)job.outputURLs[index],
+                                                                             (__bridge CFStringRef)job.outputType, 1, NULL);
+    if (output && imageDestination) {
+        NSMutableDictionary *outputProperties = [NSMutableDictionary dictionary];
+        outputProperties[(id)kCGImageDestinationLossyCompressionQuality] = @(job.compressionQuality);
+        outputProperties[(id)kCGImagePropertyOrientation] = properties[(id)kCGImagePropertyOrientation];
+        CGImageDestinationAddImage(imageDestination, output, (__bridge CFDictionaryRef)outputProperties);
+        encoded = CGImageDestinationFinalize(imageDestination);
+    }
+    if (imageDestination) CFRelease(imageDestination);
+    CGImageRelease(output);
+    CVPixelBufferUnlockBaseAddress(destination, kCVPixelBufferLock_ReadOnly);
+    CVPixelBufferRelease(destination);
+    timing->encodeMs = ImageBatchProcessorNowMs() - start;
+    return encoded ? 0 : ImageBatchErrorEncode;
+}
+
+static int ImageBatchRunOne(void *context, size_t index, ImageBatchTiming *timing) {
+    ImageBatchJob *job = (__bridge ImageBatchJob *)context;
+    NSInteger code;
+    @autoreleasepool {
+        code = ImageBatchProcessOne(job, index, timing);
+    }
+    job->_timings[index] = *timing;
+    job->_errorCodes[index] = code;
+    return code == 0 ? 0 : -1;
+}
+
+@implementation ImageBatchProcessor
+
+- (instancetype)initWithAssets:(ProcessingAssetLibrary *)assets {
+    self = [super init];
+    if (self) {
+        _assets = assets;
+        _memoryLimitBytes = 256 * 1024 * 1024;
+        _tileSize = 256;
+        _outputType = UTTypeJPEG.identifier;
+        _compressionQuality = 0.9;
+    }
+    return self;
+}
+
+- (void)processImagesAtPaths:(NSArray<NSString *> *)paths
+                      preset:(ImageBatchPreset)preset
+             outputDirectory:(NSURL *)outputDirectory
+                  completion:(void (^)(NSArray<ImageBatchResult *> *results,
+                                       NSDictionary<NSString *, NSNumber *> *statistics))completion {
+    NSString *extension = [UTType typeWithIdentifier:self.outputType].preferredFilenameExtension ?: @"jpg";
+    NSMutableArray<NSURL *> *outputURLs = [NSMutableArray arrayWithCapacity:paths.count];
+    for (NSString *path in paths) {
+        NSString *name = [path.lastPathComponent.stringByDeletingPathExtension stringByAppendingPathExtension:extension];
+        [outputURLs addObject:[outputDirectory URLByAppendingPathComponent:name]];
+    }
+
+    ImageBatchJob *job = [[ImageBatchJob alloc] initWithCount:paths.count];
+    job.paths = paths;
+    job.outputURLs = outputURLs;
+    job.preset = preset;
+    job.assets = self.assets;
+    job.outputType = self.outputType;
+    job.compressionQuality = self.compressionQuality;
+    job.tileSize = self.tileSize;
+    size_t memoryLimit = self.memoryLimitBytes;
+
+    // Admission blocks while the batch is at its memory cap, so it runs off the caller's thread.
+    dispatch_async(dispatch_get_global_queue(QOS_CLASS_UTILITY, 0), ^{
+        size_t count = job.paths.count;
+        double *latencyMs = calloc(MAX(count, 1), sizeof(double));
+        ImageBatchCallbacks callbacks = {(__bridge void *)job, ImageBatchMeasure, ImageBatchRunOne};
+        ImageBatchStats stats;
+        ImageBatchRun(TaskSchedulerShared(), count, memoryLimit, &callbacks, latencyMs, &stats);
+
+        NSMutableArray<ImageBatchResult *> *results = [NSMutableArray arrayWithCapacity:count];
+        for (size_t i = 0; i < count; i++) {
+            ImageBatchResult *result = [[ImageBatchResult alloc] init];
+            result.sourcePath = job.paths[i];
+            result.latencyMs = latencyMs[i];
+            result.decodeMs = job->_timings[i].decodeMs;
+            result.processMs = job->_timings[i].processMs;
+            result.encodeMs = job->_timings[i].encodeMs;
+            NSInteger code = job->_errorCodes[i];
+            if (code == 0) {
+                result.outputURL = job.outputURLs[i];
+            } else {
+                NSString *description = code == ImageBatchErrorDecode ? @"The image cannot be decoded"
+                                      : code == ImageBatchErrorProcess ? @"The image cannot be processed"
+                                      : @"The image cannot be encoded";
+                result.error = [NSError errorWithDomain:kImageBatchErrorDomain
+                                                   code:code
+                                               userInfo:@{NSLocalizedDescriptionKey: description,
+                                                          NSFilePathErrorKey: job.paths[i]}];
+            }
+            [results addObject:result];
+        }
+        free(latencyMs);
+
+        NSDictionary<NSString *, NSNumber *> *statistics = @{
+            @"images": @(stats.count),
+            @"succeeded": @(stats.succeeded),
+            @"failed": @(stats.failed),
+            @"totalMs": @(stats.totalMs),
+            @"imagesPerSecond": @(stats.imagesPerSecond),
+            @"averageLatencyMs": @(stats.averageLatencyMs),
+            @"p95LatencyMs": @(stats.p95LatencyMs),
+            @"maxLatencyMs": @(stats.maxLatencyMs),
+            @"averageDecodeMs": @(stats.averageDecodeMs),
+            @"averageProcessMs": @(stats.averageProcessMs),
+            @"averageEncodeMs": @(stats.averageEncodeMs),
+            @"memoryLimitBytes": @(stats.memoryCap),
+            @"peakBytes": @(stats.peakBytes),
+            @"budgetWaits": @(stats.budgetWaits),
+        };
+        NSLog(@"⏱️ Image batch: %llu images in %.0f ms (%.1f/s), p95 latency %.0f ms, peak %.0f MB",
+              stats.count, stats.totalMs, stats.imagesPerSecond, stats.p95LatencyMs, (double)stats.peakBytes / (1024.0 * 1024.0));
+        dispatch_async(dispatch_get_main_queue(), ^{
+            completion(results, statistics);
+        });
+    });
+}
+
+@end
@@ -0,0 +1,210 @@
+//
+//  ImagePyramid.c
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 18/10/2026.
+//
+
+#include "ImagePyramid.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+// Levels smaller than this are not useful to any consumer.
+static const int kMinLevelDimension = 8;
+
+void ImagePyramidInit(ImagePyramid *pyramid) {
+    memset(pyramid, 0, sizeof(*pyramid));
+    pthread_mutex_init(&pyramid->mutex, NULL);
+}
+
+void ImagePyramidFree(ImagePyramid *pyramid) {
+    for (int i = 0; i < IMAGE_PYRAMID_MAX_LEVELS; i++) {
+        free(pyramid->storage[i]);
+    }
+    pthread_mutex_destroy(&pyramid->mutex);
+    memset(pyramid, 0, sizeof(*pyramid));
+}
+
+void ImagePyramidBeginFrame(ImagePyramid *pyramid,
+                            const uint8_t *pixels,
+                            size_t stride,
+                            int width,
+                            int height,
+                            int channels) {
+    pthread_mutex_lock(&pyramid->mutex);
+    pyramid->frameIndex++;
+    pyramid->stats.frames++;
+    pyramid->levels[0] = (ImagePyramidLevel){pixels, stride, width, height, channels};
+    pyramid->builtFrame[0] = pyramid->frameIndex;
+
+    int count = 1;
+    int w = width;
+    int h = height;
+    while (count < IMAGE_PYRAMID_MAX_LEVELS && w / 2 >= kMinLevelDimension && h / 2 >= kMinLevelDimension) {
+        w /= 2;
+        h /= 2;
+        pyramid->levels[count] = (ImagePyramidLevel){NULL, (size_t)w * (size_t)channels, w, h, channels};
+        count++;
+    }
+    pyramid->levelCount = count;
+    pthread_mutex_unlock(&pyramid->mutex);
+}
+
+int ImagePyramidLevelCount(const ImagePyramid *pyramid) {
+    return pyramid->levelCount;
+}
+
+static void ImagePyramidDownsampleRowScalar(const uint8_t *r0, const uint8_t *r1, int channels, int fromX, int dstWidth, uint8_t *out) {
+    for (int x = fromX; x < dstWidth; x++) {
+        const uint8_t *a = r0 + (size_t)x * 2 * (size_t)channels;
+        const uint8_t *b = r1 + (size_t)x * 2 * (size_t)channels;
+        uint8_t *d = out + (size_t)x * (size_t)channels;
+        for (int c = 0; c < channels; c++) {
+            d[c] = (uint8_t)((a[c] + a[c + channels] + b[c] + b[c + channels] + 2) >> 2);
+        }
+    }
+}
+
+#if defined(__ARM_NEON)
+// 32 source bytes per row -> 16 destination bytes. Pixels are split into even
+// and odd columns with a structure load sized to the pixel, then both rows are
+// summed in 16-bit and rounded back down.
+static inline uint8x16_t ImagePyramidAverageQuad(uint8x16_t e0, uint8x16_t o0, uint8x16_t e1, uint8x16_t o1) {
+    uint16x8_t lo = vaddl_u8(vget_low_u8(e0), vget_low_u8(o0));
+    uint16x8_t hi = vaddl_u8(vget_high_u8(e0), vget_high_u8(o0));
+    lo = vaddq_u16(lo, vaddl_u8(vget_low_u8(e1), vget_low_u8(o1)));
+    hi = vaddq_u16(hi, vaddl_u8(vget_high_u8(e1), vget_high_u8(o1)));
+    return vcombine_u8(vrshrn_n_u16(lo, 2), vrshrn_n_u16(hi, 2));
+}
+
+static int ImagePyramidDownsampleRowNEON(const uint8_t *r0, const uint8_t *r1, int channels, int dstWidth, uint8_t *out) {
+    int perStep = 16 / channels;
+    int x = 0;
+    for (; x + perStep <= dstWidth; x += perStep) {
+        size_t srcOffset = (size_t)x * 2 * (size_t)channels;
+        size_t dstOffset = (size_t)x * (size_t)channels;
+        uint8x16_t result;
+        if (channels == 4) {
+            uint32x4x2_t a = vld2q_u32((const uint32_t *)(const void *)(r0 + srcOffset));
+            uint32x4x2_t b = vld2q_u32((const uint32_t *)(const void *)(r1 + srcOffset));
+            result = ImagePyramidAverageQuad(vreinterpretq_u8_u32(a.val[0]), vreinterpretq_u8_u32(a.val[1]),
+                                             vreinterpretq_u8_u32(b.val[0]), vreinterpretq_u8_u32(b.val[1]));
+        } else if (channels == 2) {
+            uint16x8x2_t a = vld2q_u16((const uint16_t *)(const void *)(r0 + srcOffset));
+            uint16x8x2_t b = vld2q_u16((const uint16_t *)(const void *)(r1 + srcOffset));
+            result = ImagePyramidAverageQuad(vreinterpretq_u8_u16(a.val[0]), vreinterpretq_u8_u16(a.val[1]),
+                                             vreinterpretq_u8_u16(b.val[0]), vreinterpretq_u8_u16(b.val[1]));
+        } else {
+            uint16x8_t lo = vpaddlq_u8(vld1q_u8(r0 + srcOffset));
+            uint16x8_t hi = vpaddlq_u8(vld1q_u8(r0 + srcOffset + 16));
+            lo = vpadalq_u8(lo, vld1q_u8(r1 + srcOffset));
+            hi = vpadalq_u8(hi, vld1q_u8(r1 + srcOffset + 16));
+            result = vcombine_u8(vrshrn_n_u16(lo, 2), vrshrn_n_u16(hi, 2));
+        }
+        vst1q_u8(out + dstOffset, result);
+    }
+    return x;
+}
+#endif
+
+void ImagePyramidDownsample2x(const uint8_t *src,
+                              size_t srcStride,
+                              int srcWidth,
+                              int srcHeight,
+                              int channels,
+                              uint8_t *dst,
+                              size_t dstStride) {
+    int dstWidth = srcWidth / 2;
+    int dstHeight = srcHeight / 2;
+    for (int y = 0; y < dstHeight; y++) {
+        const uint8_t *r0 = src + (size_t)(2 * y) * srcStride;
+        const uint8_t *r1 = r0 + srcStride;
+        uint8_t *out = dst + (size_t)y * dstStride;
+        int done = 0;
+#if defined(__ARM_NEON)
+        if (channels == 1 || channels == 2 || channels == 4) {
+            done = ImagePyramidDownsampleRowNEON(r0, r1, channels, dstWidth, out);
+        }
+#endif
+        ImagePyramidDownsampleRowScalar(r0, r1, channels, done, dstWidth, out);
+    }
+}
+
+static size_t ImagePyramidLevelBytes(const ImagePyramidLevel *level) {
+    return (size_t)level->width * (size_t)level->height * (size_t)level->channels;
+}
+
+// Caller holds the mutex.
+static int ImagePyramidEnsureLevel(ImagePyramid *pyramid, int index) {
+    if (pyramid->builtFrame[index] == pyramid->frameIndex) {
+        return 0;
+    }
+    if (index == 0 || ImagePyramidEnsureLevel(pyramid, index - 1) != 0) {
+        return -1;
+    }
+    ImagePyramidLevel *level = &pyramid->levels[index];
+    const ImagePyramidLevel *parent = &pyramid->levels[index - 1];
+    size_t bytes = ImagePyramidLevelBytes(level);
+    if (bytes > pyramid->storageCapacity[index]) {
+        uint8_t *resized = realloc(pyramid->storage[index], bytes);
+        if (!resized) {
+            return -1;
+        }
+        pyramid->storage[index] = resized;
+        pyramid->storageCapacity[index] = bytes;
+    }
+    ImagePyramidDownsample2x(parent->pixels, parent->stride, parent->width, parent->height, parent->channels,
+                             pyramid->storage[index], level->stride);
+    level->pixels = pyramid->storage[index];
+    pyramid->builtFrame[index] = pyramid->frameIndex;
+    pyramid->stats.levelBuilds[index]++;
+    return 0;
+}
+
+int ImagePyramidGetLevel(ImagePyramid *pyramid, int index, ImagePyramidLevel *outLevel) {
+    pthread_mutex_lock(&pyramid->mutex);
+    if (index < 0 || index >= pyramid->levelCount) {
+        pthread_mutex_unlock(&pyramid->mutex);
+        return -1;
+    }
+    pyramid->stats.levelRequests[index]++;
+    if (pyramid->builtFrame[index] == pyramid->frameIndex) {
+        pyramid->stats.levelHits[index]++;
+        if (index > 0) {
+            // A consumer downscaling on its own would have read the full frame
+            // and written this level.
+            pyramid->stats.bytesSaved += ImagePyramidLevelBytes(&pyramid->levels[0]) +
+                                         ImagePyramidLevelBytes(&pyramid->levels[index]);
+        }
+    } else if (ImagePyramidEnsureLevel(pyramid, index) != 0) {
+        pthread_mutex_unlock(&pyramid->mutex);
+        return -1;
+    }
+    *outLevel = pyramid->levels[index];
+    pthread_mutex_unlock(&pyramid->mutex);
+    return 0;
+}
+
+int ImagePyramidGetLevelForSize(ImagePyramid *pyramid, int minWidth, int minHeight, ImagePyramidLevel *outLevel) {
+    pthread_mutex_lock(&pyramid->mutex);
+    int index = 0;
+    while (index + 1 < pyramid->levelCount &&
+           pyramid->levels[index + 1].width >= minWidth &&
+           pyramid->levels[index + 1].height >= minHeight) {
+        index++;
+    }
+    pthread_mutex_unlock(&pyramid->mutex);
+    return ImagePyramidGetLevel(pyramid, index, outLevel);
+}
+
+ImagePyramidStats ImagePyramidGetStats(ImagePyramid *pyramid) {
+    pthread_mutex_lock(&pyramid->mutex);
+    ImagePyramidStats stats = pyramid->stats;
+    pthread_mutex_unlock(&pyramid->mutex);
+    return stats;
+}
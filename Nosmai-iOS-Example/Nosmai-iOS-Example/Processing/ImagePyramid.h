@@ -0,0 +1,107 @@
+//
+//  ImagePyramid.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 18/10/2026.
+//
+
+#ifndef IMAGE_PYRAMID_H
+#define IMAGE_PYRAMID_H
+
+#include <pthread.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define IMAGE_PYRAMID_MAX_LEVELS 8
+
+typedef struct {
+    const uint8_t *pixels;
+    size_t stride;
+    int width;
+    int height;
+    int channels;
+} ImagePyramidLevel;
+
+typedef struct {
+    uint64_t frames;
+    uint64_t levelRequests[IMAGE_PYRAMID_MAX_LEVELS];
+    uint64_t levelHits[IMAGE_PYRAMID_MAX_LEVELS];    // Served without computing anything
+    uint64_t levelBuilds[IMAGE_PYRAMID_MAX_LEVELS];  // Computed (at most once per frame)
+    uint64_t bytesSaved;  // Full-res reads + level writes avoided by serving a shared level
+} ImagePyramidStats;
+
+/**
+ * Per-frame pyramid of 2x downscales, built lazily with a 2x2 area filter.
+ *
+ * Level 0 borrows the caller's frame. Each level is computed the first time
+ * any consumer asks for it in the current frame and then shared, so face
+ * detection, alignment, low-res passes and thumbnails never downscale the same
+ * frame twice. Level buffers are reused across frames.
+ */
+typedef struct {
+    pthread_mutex_t mutex;
+    ImagePyramidLevel levels[IMAGE_PYRAMID_MAX_LEVELS];
+    uint8_t *storage[IMAGE_PYRAMID_MAX_LEVELS];
+    size_t storageCapacity[IMAGE_PYRAMID_MAX_LEVELS];
+    uint64_t builtFrame[IMAGE_PYRAMID_MAX_LEVELS];
+    uint64_t frameIndex;
+    int levelCount;
+    ImagePyramidStats stats;
+} ImagePyramid;
+
+void ImagePyramidInit(ImagePyramid *pyramid);
+void ImagePyramidFree(ImagePyramid *pyramid);
+
+/**
+ * Start a new frame. Invalidates every level above 0 without freeing memory.
+ * channels may be 1 (luma / gray), 2 (interleaved chroma) or 4 (RGBA / BGRA).
+ * The pixels must stay valid until the next call.
+ */
+void ImagePyramidBeginFrame(ImagePyramid *pyramid,
+                            const uint8_t *pixels,
+                            size_t stride,
+                            int width,
+                            int height,
+                            int channels);
+
+/// Number of levels available for the current frame (level 0 included)
+int ImagePyramidLevelCount(const ImagePyramid *pyramid);
+
+/**
+ * Level `index` of the current frame, computing it (and any missing level
+ * below it) on first use. Thread safe.
+ *
+ * @return 0 on success, -1 if the level does not exist or allocation failed
+ */
+int ImagePyramidGetLevel(ImagePyramid *pyramid, int index, ImagePyramidLevel *outLevel);
+
+/**
+ * Smallest level that is still at least minWidth x minHeight, so a consumer
+ * only has to do a small final resize on its own.
+ */
+int ImagePyramidGetLevelForSize(ImagePyramid *pyramid, int minWidth, int minHeight, ImagePyramidLevel *outLevel);
+
+/// Snapshot of the counters
+ImagePyramidStats ImagePyramidGetStats(ImagePyramid *pyramid);
+
+/**
+ * 2x2 area downscale of one plane. Exposed for other kernels that need a
+ * single half-size step without keeping a pyramid around.
+ */
+void ImagePyramidDownsample2x(const uint8_t *src,
+                              size_t srcStride,
+                              int srcWidth,
+                              int srcHeight,
+                              int channels,
+                              uint8_t *dst,
+                              size_t dstStride);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* IMAGE_PYRAMID_H */
@@ -0,0 +1,84 @@
+//
+//  InputSourceArbiter.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#import <Foundation/Foundation.h>
+#import <nosmai/Nosmai.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+typedef NS_ENUM(NSInteger, InputSourceRequestOutcome) {
+    InputSourceRequestRejected = -1,
+    InputSourceRequestActive = 0,
+    InputSourceRequestQueued = 1,
+};
+
+/**
+ * Arbitrates between the camera, external frames, video files and stills
+ * competing for the one SDK pipeline, with real QueueRequest and
+ * PriorityBased behaviour (the SDK treats every conflict as
+ * AutoStopPrevious).
+ *
+ * A source starts and stops its own capture through the blocks given at
+ * registration; the arbiter never calls -stopProcessing or -cleanup, so a
+ * switch does not tear the SDK's processing graph down. Frames the app feeds go through -admitFrameFromSource: (or
+ * -processFrame:fromSource:mirror:) first; frames the SDK captures itself
+ * are only reported, with -frameDidArriveFromSource:.
+ *
+ * A switch completes with the new source's first admitted frame; the
+ * delegate then gets nosmaiInputSourceDidChange:newSource: on the main
+ * queue, with lastSwitchLatencyMs already updated. Thread-safe.
+ */
+@interface InputSourceArbiter : NSObject
+
+@property (nonatomic, readonly) NosmaiConflictStrategy strategy;
+@property (nonatomic, weak, nullable) id<NosmaiDelegate> delegate;
+
+@property (nonatomic, readonly) NosmaiInputSourceType activeSource;
+/// Request -> first frame of the new source, for the most recent switch
+@property (nonatomic, readonly) double lastSwitchLatencyMs;
+
+/**
+ * active, waiting, switches, queued, rejected, preemptions,
+ * framesAdmitted, framesDropped, lastSwitchMs, averageSwitchMs, maxSwitchMs
+ */
+@property (nonatomic, readonly) NSDictionary<NSString *, NSNumber *> *statistics;
+
+- (instancetype)initWithStrategy:(NosmaiConflictStrategy)strategy NS_DESIGNATED_INITIALIZER;
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ * activate starts the source's capture and deactivate stops it, both
+ * called on the thread that caused the transition, outside any lock.
+ * Higher priorities win under PriorityBased.
+ */
+- (void)registerSource:(NosmaiInputSourceType)source
+              priority:(NSInteger)priority
+              activate:(dispatch_block_t)activate
+            deactivate:(dispatch_block_t)deactivate;
+
+/// Requesting the active source again re-runs its activate block (after an outside stop)
+- (InputSourceRequestOutcome)requestSource:(NosmaiInputSourceType)source;
+
+/// Stops the source or takes it out of the queue; the next waiting source takes over
+- (void)releaseSource:(NosmaiInputSourceType)source;
+
+/// @return NO for frames from a source that is not active; drop them
+- (BOOL)admitFrameFromSource:(NosmaiInputSourceType)source;
+
+/// Hands an app-fed frame to -[NosmaiSDK processFrame:mirror:] if its source is active. @return NO if dropped or not processed
+- (BOOL)processFrame:(CVPixelBufferRef)pixelBuffer fromSource:(NosmaiInputSourceType)source mirror:(BOOL)mirror;
+
+/**
+ * For frames the SDK captured and processed itself (the camera), which
+ * cannot be held back: completes a pending switch to source, without
+ * counting the frame as admitted or dropped.
+ */
+- (void)frameDidArriveFromSource:(NosmaiInputSourceType)source;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,151 @@
+//
+//  InputSourceArbiter.m
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#import "InputSourceArbiter.h"
+#import <os/lock.h>
+#include <time.h>
+#include "SourceArbiter.h"
+
+static double InputSourceArbiterNowMs(void) {
+    return (double)clock_gettime_nsec_np(CLOCK_UPTIME_RAW) / 1.0e6;
+}
+
+static NosmaiInputSourceType InputSourceFromIndex(int index) {
+    return index < 0 ? NosmaiInputSourceTypeNone : (NosmaiInputSourceType)index;
+}
+
+@implementation InputSourceArbiter {
+    SourceArbiter _arbiter;
+    os_unfair_lock _lock;
+    // Guarded by _lock.
+    NSInteger _priorities[SOURCE_ARBITER_MAX_SOURCES];
+    dispatch_block_t _activateBlocks[SOURCE_ARBITER_MAX_SOURCES];
+    dispatch_block_t _deactivateBlocks[SOURCE_ARBITER_MAX_SOURCES];
+}
+
+- (instancetype)initWithStrategy:(NosmaiConflictStrategy)strategy {
+    self = [super init];
+    if (self) {
+        _strategy = strategy;
+        _lock = OS_UNFAIR_LOCK_INIT;
+        SourceArbiterInit(&_arbiter, (SourceArbiterStrategy)strategy);
+    }
+    return self;
+}
+
+- (void)dealloc {
+    SourceArbiterFree(&_arbiter);
+}
+
+- (NosmaiInputSourceType)activeSource {
+    return InputSourceFromIndex(SourceArbiterActiveSource(&_arbiter));
+}
+
+- (double)lastSwitchLatencyMs {
+    return SourceArbiterGetStats(&_arbiter).lastSwitchMs;
+}
+
+- (NSDictionary<NSString *, NSNumber *> *)statistics {
+    SourceArbiterStats stats = SourceArbiterGetStats(&_arbiter);
+    return @{
+        @"active": @(InputSourceFromIndex(stats.active)),
+        @"waiting": @(stats.waiting),
+        @"switches": @(stats.switches),
+        @"queued": @(stats.queued),
+        @"rejected": @(stats.rejected),
+        @"preemptions": @(stats.preemptions),
+        @"framesAdmitted": @(stats.framesAdmitted),
+        @"framesDropped": @(stats.framesDropped),
+        @"lastSwitchMs": @(stats.lastSwitchMs),
+        @"averageSwitchMs": @(stats.averageSwitchMs),
+        @"maxSwitchMs": @(stats.maxSwitchMs),
+    };
+}
+
+- (void)registerSource:(NosmaiInputSourceType)source
+              priority:(NSInteger)priority
+              activate:(dispatch_block_t)activate
+            deactivate:(dispatch_block_t)deactivate {
+    if (source <= NosmaiInputSourceTypeNone || source >= SOURCE_ARBITER_MAX_SOURCES) return;
+    os_unfair_lock_lock(&_lock);
+    _priorities[source] = priority;
+    _activateBlocks[source] = [activate copy];
+    _deactivateBlocks[source] = [deactivate copy];
+    os_unfair_lock_unlock(&_lock);
+}
+
+#pragma mark - Transitions
+
+- (void)applyTransition:(SourceTransition)transition {
+    dispatch_block_t deactivate = nil;
+    dispatch_block_t activate = nil;
+    os_unfair_lock_lock(&_lock);
+    if (transition.deactivate >= 0) deactivate = _deactivateBlocks[transition.deactivate];
+    if (transition.activate >= 0) activate = _activateBlocks[transition.activate];
+    os_unfair_lock_unlock(&_lock);
+    // Stop first, so the two sources never capture at once.
+    if (deactivate) deactivate();
+    if (activate) activate();
+}
+
+- (InputSourceRequestOutcome)requestSource:(NosmaiInputSourceType)source {
+    os_unfair_lock_lock(&_lock);
+    BOOL registered = source > NosmaiInputSourceTypeNone && source < SOURCE_ARBITER_MAX_SOURCES &&
+                      _activateBlocks[source] != nil;
+    int priority = registered ? (int)_priorities[source] : 0;
+    os_unfair_lock_unlock(&_lock);
+    if (!registered) return InputSourceRequestRejected;
+
+    SourceTransition transition;
+    SourceRequestOutcome outcome = SourceArbiterRequest(&_arbiter, (int)source, priority, InputSourceArbiterNowMs(), &transition);
+    [self applyTransition:transition];
+    return (InputSourceRequestOutcome)outcome;
+}
+
+- (void)releaseSource:(NosmaiInputSourceType)source {
+    SourceTransition transition;
+    SourceArbiterRelease(&_arbiter, (int)source, InputSourceArbiterNowMs(), &transition);
+    [self applyTransition:transition];
+    if (transition.deactivate >= 0 && transition.activate < 0) {
+        // Going idle has no first frame to wait for.
+        [self notifyChangeFrom:source to:NosmaiInputSourceTypeNone];
+    }
+}
+
+- (BOOL)admitFrameFromSource:(NosmaiInputSourceType)source {
+    double switchMs;
+    int previous;
+    BOOL admitted = SourceArbiterAdmitFrame(&_arbiter, (int)source, InputSourceArbiterNowMs(), &switchMs, &previous) != 0;
+    if (switchMs >= 0.0) {
+        [self notifyChangeFrom:InputSourceFromIndex(previous) to:source];
+    }
+    return admitted;
+}
+
+- (BOOL)processFrame:(CVPixelBufferRef)pixelBuffer fromSource:(NosmaiInputSourceType)source mirror:(BOOL)mirror {
+    if (![self admitFrameFromSource:source]) return NO;
+    return [[NosmaiSDK sharedInstance] processFrame:pixelBuffer mirror:mirror];
+}
+
+- (void)frameDidArriveFromSource:(NosmaiInputSourceType)source {
+    double switchMs;
+    int previous;
+    SourceArbiterObserveFrame(&_arbiter, (int)source, InputSourceArbiterNowMs(), &switchMs, &previous);
+    if (switchMs >= 0.0) {
+        [self notifyChangeFrom:InputSourceFromIndex(previous) to:source];
+    }
+}
+
+- (void)notifyChangeFrom:(NosmaiInputSourceType)oldSource to:(NosmaiInputSourceType)newSource {
+    id<NosmaiDelegate> delegate = self.delegate;
+    if (![delegate respondsToSelector:@selector(nosmaiInputSourceDidChange:newSource:)]) return;
+    dispatch_async(dispatch_get_main_queue(), ^{
+        [delegate nosmaiInputSourceDidChange:oldSource newSource:newSource];
+    });
+}
+
+@end
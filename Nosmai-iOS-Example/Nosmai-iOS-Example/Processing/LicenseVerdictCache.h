@@ -0,0 +1,42 @@
+//
+//  LicenseVerdictCache.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * The last license verdict the SDK reached online, persisted so the next
+ * launch can set up licensed UI at once instead of waiting for
+ * verification, and keep working offline.
+ *
+ * A verdict is honoured for maxAge after it was recorded; an older one is
+ * ignored, and verification is back on the critical path until the SDK
+ * records a new one.
+ */
+@interface LicenseVerdictCache : NSObject
+
+/// Default 7 days
+@property (nonatomic, assign) NSTimeInterval maxAge;
+
+/// A verdict recorded within maxAge exists
+@property (nonatomic, readonly) BOOL hasFreshVerdict;
+/// NO without a fresh verdict
+@property (nonatomic, readonly) BOOL licenseValid;
+@property (nonatomic, readonly) BOOL beautyEnabled;
+@property (nonatomic, readonly, nullable) NSDate *verifiedAt;
+
+- (instancetype)initWithDefaults:(NSUserDefaults *)defaults NS_DESIGNATED_INITIALIZER;
+/// Standard user defaults
+- (instancetype)init;
+
+- (void)recordLicenseValid:(BOOL)licenseValid beautyEnabled:(BOOL)beautyEnabled;
+- (void)clear;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,66 @@
+//
+//  LicenseVerdictCache.m
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#import "LicenseVerdictCache.h"
+
+static NSString * const kLicenseVerdictKey = @"NosmaiLicenseVerdict";
+
+@implementation LicenseVerdictCache {
+    NSUserDefaults *_defaults;
+}
+
+- (instancetype)initWithDefaults:(NSUserDefaults *)defaults {
+    self = [super init];
+    if (self) {
+        _defaults = defaults;
+        _maxAge = 7 * 24 * 60 * 60;
+    }
+    return self;
+}
+
+- (instancetype)init {
+    return [self initWithDefaults:[NSUserDefaults standardUserDefaults]];
+}
+
+- (nullable NSDictionary *)freshVerdict {
+    NSDictionary *verdict = [_defaults dictionaryForKey:kLicenseVerdictKey];
+    NSDate *verifiedAt = verdict[@"verifiedAt"];
+    if (![verifiedAt isKindOfClass:[NSDate class]]) return nil;
+    NSTimeInterval age = -verifiedAt.timeIntervalSinceNow;
+    // A date in the future means the clock was turned back; do not trust it.
+    return age >= 0 && age <= self.maxAge ? verdict : nil;
+}
+
+- (BOOL)hasFreshVerdict {
+    return [self freshVerdict] != nil;
+}
+
+- (BOOL)licenseValid {
+    return [[self freshVerdict][@"licenseValid"] boolValue];
+}
+
+- (BOOL)beautyEnabled {
+    return [[self freshVerdict][@"beautyEnabled"] boolValue];
+}
+
+- (nullable NSDate *)verifiedAt {
+    return [_defaults dictionaryForKey:kLicenseVerdictKey][@"verifiedAt"];
+}
+
+- (void)recordLicenseValid:(BOOL)licenseValid beautyEnabled:(BOOL)beautyEnabled {
+    [_defaults setObject:@{
+        @"licenseValid": @(licenseValid),
+        @"beautyEnabled": @(beautyEnabled),
+        @"verifiedAt": [NSDate date],
+    } forKey:kLicenseVerdictKey];
+}
+
+- (void)clear {
+    [_defaults removeObjectForKey:kLicenseVerdictKey];
+}
+
+@end
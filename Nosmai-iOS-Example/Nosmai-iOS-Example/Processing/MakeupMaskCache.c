@@ -0,0 +1,244 @@
+//
+//  MakeupMaskCache.c
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 18/10/2026.
+//
+
+#include "MakeupMaskCache.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+struct MakeupMaskCacheEntry {
+    int used;
+    int64_t faceID;
+    MakeupMaskKind kind;
+    const uint8_t *sourcePixels;
+    MakeupPoint landmarks[3];
+    uint64_t lastUse;
+    uint8_t *storage;
+    size_t storageCapacity;
+    int valid;
+    MakeupWarpedMask mask;
+};
+
+void MakeupMaskCacheInit(MakeupMaskCache *cache, size_t capacity, float threshold) {
+    memset(cache, 0, sizeof(*cache));
+    cache->entries = calloc(capacity, sizeof(MakeupMaskCacheEntry));
+    cache->capacity = cache->entries ? capacity : 0;
+    cache->threshold = threshold;
+}
+
+void MakeupMaskCacheFree(MakeupMaskCache *cache) {
+    for (size_t i = 0; i < cache->capacity; i++) {
+        free(cache->entries[i].storage);
+    }
+    free(cache->entries);
+    memset(cache, 0, sizeof(*cache));
+}
+
+void MakeupMaskCacheReset(MakeupMaskCache *cache) {
+    for (size_t i = 0; i < cache->capacity; i++) {
+        cache->entries[i].used = 0;
+        cache->entries[i].valid = 0;
+    }
+}
+
+void MakeupMaskSourceInit(MakeupMaskSource *source, const uint8_t *pixels, size_t stride, int width, int height) {
+    source->pixels = pixels;
+    source->stride = stride;
+    source->width = width;
+    source->height = height;
+    source->anchors[0] = (MakeupPoint){0.0f, (float)height * 0.5f};
+    source->anchors[1] = (MakeupPoint){(float)width, (float)height * 0.5f};
+    source->anchors[2] = (MakeupPoint){(float)width * 0.5f, (float)height};
+}
+
+void MakeupMaskLandmarksForFace(const FaceRegionBox *face, MakeupMaskKind kind, MakeupPoint outLandmarks[3]) {
+    float w = face->width;
+    float h = face->height;
+    if (kind == MakeupMaskKindLipstick) {
+        // Mouth corners and the middle of the lower lip.
+        outLandmarks[0] = (MakeupPoint){face->x + 0.33f * w, face->y + 0.80f * h};
+        outLandmarks[1] = (MakeupPoint){face->x + 0.67f * w, face->y + 0.80f * h};
+        outLandmarks[2] = (MakeupPoint){face->x + 0.50f * w, face->y + 0.87f * h};
+    } else {
+        // Outer cheek edges and the point under the nose between them.
+        outLandmarks[0] = (MakeupPoint){face->x + 0.12f * w, face->y + 0.62f * h};
+        outLandmarks[1] = (MakeupPoint){face->x + 0.88f * w, face->y + 0.62f * h};
+        outLandmarks[2] = (MakeupPoint){face->x + 0.50f * w, face->y + 0.71f * h};
+    }
+}
+
+// Affine transform taking the `from` triangle onto the `to` triangle:
+// to = (m[0] x + m[1] y + m[2], m[3] x + m[4] y + m[5]).
+static int MakeupAffineSolve(const MakeupPoint from[3], const MakeupPoint to[3], float m[6]) {
+    float e1x = from[1].x - from[0].x, e1y = from[1].y - from[0].y;
+    float e2x = from[2].x - from[0].x, e2y = from[2].y - from[0].y;
+    float det = e1x * e2y - e1y * e2x;
+    if (fabsf(det) < 1e-6f) {
+        return 0;
+    }
+    float invDet = 1.0f / det;
+    float t1x = to[1].x - to[0].x, t1y = to[1].y - to[0].y;
+    float t2x = to[2].x - to[0].x, t2y = to[2].y - to[0].y;
+    m[0] = (t1x * e2y - t2x * e1y) * invDet;
+    m[1] = (t2x * e1x - t1x * e2x) * invDet;
+    m[3] = (t1y * e2y - t2y * e1y) * invDet;
+    m[4] = (t2y * e1x - t1y * e2x) * invDet;
+    m[2] = to[0].x - m[0] * from[0].x - m[1] * from[0].y;
+    m[5] = to[0].y - m[3] * from[0].x - m[4] * from[0].y;
+    return 1;
+}
+
+// Bilinear sample of the coverage mask at pixel-center coordinates, with
+// transparent (0) outside the mask.
+static inline uint8_t MakeupSampleMask(const MakeupMaskSource *source, float sx, float sy) {
+    float fx = sx - 0.5f;
+    float fy = sy - 0.5f;
+    if (fx <= -1.0f || fy <= -1.0f || fx >= (float)source->width || fy >= (float)source->height) {
+        return 0;
+    }
+    int x0 = (int)floorf(fx);
+    int y0 = (int)floorf(fy);
+    uint32_t ax = (uint32_t)((fx - (float)x0) * 256.0f);
+    uint32_t ay = (uint32_t)((fy - (float)y0) * 256.0f);
+    uint32_t taps[4];
+    for (int i = 0; i < 4; i++) {
+        int x = x0 + (i & 1);
+        int y = y0 + (i >> 1);
+        taps[i] = (x >= 0 && y >= 0 && x < source->width && y < source->height)
+                      ? source->pixels[(size_t)y * source->stride + (size_t)x]
+                      : 0;
+    }
+    uint32_t top = taps[0] * (256 - ax) + taps[1] * ax;
+    uint32_t bottom = taps[2] * (256 - ax) + taps[3] * ax;
+    return (uint8_t)((top * (256 - ay) + bottom * ay + (1u << 15)) >> 16);
+}
+
+static int MakeupWarp(MakeupMaskCacheEntry *entry, const MakeupMaskSource *source, int frameWidth, int frameHeight) {
+    float forward[6];
+    float inverse[6];
+    if (!MakeupAffineSolve(source->anchors, entry->landmarks, forward) ||
+        !MakeupAffineSolve(entry->landmarks, source->anchors, inverse)) {
+        return 0;
+    }
+
+    // Frame-space bounds of the mask rectangle.
+    const float corners[4][2] = {
+        {0.0f, 0.0f},
+        {(float)source->width, 0.0f},
+        {0.0f, (float)source->height},
+        {(float)source->width, (float)source->height},
+    };
+    float minX = INFINITY, minY = INFINITY, maxX = -INFINITY, maxY = -INFINITY;
+    for (int i = 0; i < 4; i++) {
+        float x = forward[0] * corners[i][0] + forward[1] * corners[i][1] + forward[2];
+        float y = forward[3] * corners[i][0] + forward[4] * corners[i][1] + forward[5];
+        minX = fminf(minX, x);
+        maxX = fmaxf(maxX, x);
+        minY = fminf(minY, y);
+        maxY = fmaxf(maxY, y);
+    }
+    int x0 = (int)fmaxf(floorf(minX), 0.0f);
+    int y0 = (int)fmaxf(floorf(minY), 0.0f);
+    int x1 = (int)fminf(ceilf(maxX), (float)frameWidth);
+    int y1 = (int)fminf(ceilf(maxY), (float)frameHeight);
+    if (x1 <= x0 || y1 <= y0) {
+        return 0;
+    }
+
+    int width = x1 - x0;
+    int height = y1 - y0;
+    size_t bytes = (size_t)width * (size_t)height;
+    if (bytes > entry->storageCapacity) {
+        uint8_t *resized = realloc(entry->storage, bytes);
+        if (!resized) {
+            return 0;
+        }
+        entry->storage = resized;
+        entry->storageCapacity = bytes;
+    }
+
+    for (int y = 0; y < height; y++) {
+        float fy = (float)(y0 + y) + 0.5f;
+        float fx = (float)x0 + 0.5f;
+        float sx = inverse[0] * fx + inverse[1] * fy + inverse[2];
+        float sy = inverse[3] * fx + inverse[4] * fy + inverse[5];
+        uint8_t *out = entry->storage + (size_t)y * (size_t)width;
+        for (int x = 0; x < width; x++) {
+            out[x] = MakeupSampleMask(source, sx, sy);
+            sx += inverse[0];
+            sy += inverse[3];
+        }
+    }
+    entry->mask = (MakeupWarpedMask){entry->storage, (size_t)width, x0, y0, width, height};
+    return 1;
+}
+
+static float MakeupLandmarkMovement(const MakeupPoint a[3], const MakeupPoint b[3]) {
+    float maxSq = 0.0f;
+    for (int i = 0; i < 3; i++) {
+        float dx = a[i].x - b[i].x;
+        float dy = a[i].y - b[i].y;
+        maxSq = fmaxf(maxSq, dx * dx + dy * dy);
+    }
+    return sqrtf(maxSq);
+}
+
+const MakeupWarpedMask *MakeupMaskCacheLookup(MakeupMaskCache *cache,
+                                              int64_t faceID,
+                                              MakeupMaskKind kind,
+                                              const MakeupMaskSource *source,
+                                              const MakeupPoint landmarks[3],
+                                              int frameWidth,
+                                              int frameHeight) {
+    if (cache->capacity == 0) {
+        return NULL;
+    }
+    cache->clock++;
+    cache->stats.lookups++;
+
+    MakeupMaskCacheEntry *entry = NULL;
+    MakeupMaskCacheEntry *oldest = NULL;
+    MakeupMaskCacheEntry *unused = NULL;
+    for (size_t i = 0; i < cache->capacity; i++) {
+        MakeupMaskCacheEntry *candidate = &cache->entries[i];
+        if (!candidate->used) {
+            if (!unused) unused = candidate;
+            continue;
+        }
+        if (candidate->faceID == faceID && candidate->kind == kind) {
+            entry = candidate;
+            break;
+        }
+        if (!oldest || candidate->lastUse < oldest->lastUse) {
+            oldest = candidate;
+        }
+    }
+
+    if (entry && entry->sourcePixels == source->pixels &&
+        MakeupLandmarkMovement(entry->landmarks, landmarks) <= cache->threshold) {
+        entry->lastUse = cache->clock;
+        cache->stats.hits++;
+        return entry->valid ? &entry->mask : NULL;
+    }
+
+    if (!entry) {
+        entry = unused ? unused : oldest;
+        if (entry->used) {
+            cache->stats.evictions++;
+        }
+        entry->used = 1;
+        entry->faceID = faceID;
+        entry->kind = kind;
+    }
+    cache->stats.rewarps++;
+    entry->sourcePixels = source->pixels;
+    memcpy(entry->landmarks, landmarks, sizeof(entry->landmarks));
+    entry->lastUse = cache->clock;
+    entry->valid = MakeupWarp(entry, source, frameWidth, frameHeight);
+    return entry->valid ? &entry->mask : NULL;
+}
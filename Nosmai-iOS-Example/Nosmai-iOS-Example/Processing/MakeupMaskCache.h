@@ -0,0 +1,124 @@
+//
+//  MakeupMaskCache.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 18/10/2026.
+//
+
+#ifndef MAKEUP_MASK_CACHE_H
+#define MAKEUP_MASK_CACHE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "FaceRegion.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    float x, y;
+} MakeupPoint;
+
+typedef enum {
+    MakeupMaskKindLipstick = 0,
+    MakeupMaskKindBlusher = 1,
+    MakeupMaskKindCount
+} MakeupMaskKind;
+
+/**
+ * 8-bit coverage mask (e.g. the alpha of mouth.png or blusher.png) with the
+ * three anchor points, in mask pixels, that line up with the face landmarks.
+ */
+typedef struct {
+    const uint8_t *pixels;
+    size_t stride;
+    int width;
+    int height;
+    MakeupPoint anchors[3];
+} MakeupMaskSource;
+
+/// Mask warped into frame space; covers [x, x + width) x [y, y + height)
+typedef struct {
+    const uint8_t *pixels;
+    size_t stride;
+    int x;
+    int y;
+    int width;
+    int height;
+} MakeupWarpedMask;
+
+typedef struct {
+    uint64_t lookups;
+    uint64_t hits;      // Landmarks within threshold, cached mask reused
+    uint64_t rewarps;   // Landmarks moved (or new face), mask warped again
+    uint64_t evictions;
+} MakeupMaskCacheStats;
+
+typedef struct MakeupMaskCacheEntry MakeupMaskCacheEntry;
+
+/**
+ * Per-face cache of warped makeup masks. A mask is warped again only when any
+ * of its landmarks moves further than `threshold` pixels from where it was
+ * last warped, so a still subject reuses the same mask frame after frame.
+ * FaceBeautyRenderer is its only user; the app's lipstick and blusher are
+ * the SDK's and never reach it.
+ */
+typedef struct {
+    MakeupMaskCacheEntry *entries;
+    size_t capacity;
+    float threshold;
+    uint64_t clock;
+    MakeupMaskCacheStats stats;
+} MakeupMaskCache;
+
+/**
+ * Fills in the anchors used by every bundled mask: middle of the left edge,
+ * middle of the right edge and middle of the bottom edge. They pair with the
+ * landmarks from MakeupMaskLandmarksForFace.
+ */
+void MakeupMaskSourceInit(MakeupMaskSource *source, const uint8_t *pixels, size_t stride, int width, int height);
+
+/// threshold is the landmark movement, in pixels, that forces a re-warp
+void MakeupMaskCacheInit(MakeupMaskCache *cache, size_t capacity, float threshold);
+void MakeupMaskCacheFree(MakeupMaskCache *cache);
+
+/// Drops every entry but keeps the counters
+void MakeupMaskCacheReset(MakeupMaskCache *cache);
+
+/**
+ * Frame-space landmarks for a mask kind, derived from the face box with the
+ * same proportions the makeup filters use.
+ */
+void MakeupMaskLandmarksForFace(const FaceRegionBox *face, MakeupMaskKind kind, MakeupPoint outLandmarks[3]);
+
+/**
+ * Warped mask for (faceID, kind), re-warping only if the landmarks moved more
+ * than the threshold, the source changed, or the face is new.
+ *
+ * @return NULL if the mask falls outside the frame or allocation failed
+ */
+const MakeupWarpedMask *MakeupMaskCacheLookup(MakeupMaskCache *cache,
+                                              int64_t faceID,
+                                              MakeupMaskKind kind,
+                                              const MakeupMaskSource *source,
+                                              const MakeupPoint landmarks[3],
+                                              int frameWidth,
+                                              int frameHeight);
+
+/// Coverage of a warped mask at frame pixel (x, y), 0 outside the mask
+static inline uint8_t MakeupWarpedMaskCoverage(const MakeupWarpedMask *mask, int x, int y) {
+    int mx = x - mask->x;
+    int my = y - mask->y;
+    if (mx < 0 || my < 0 || mx >= mask->width || my >= mask->height) {
+        return 0;
+    }
+    return mask->pixels[(size_t)my * mask->stride + (size_t)mx];
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MAKEUP_MASK_CACHE_H */
@@ -0,0 +1,22 @@
+//
+//  NosmaiFaceInfo+PixelBounds.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 18/10/2026.
+//
+
+#import <nosmai/Nosmai.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface NosmaiFaceInfo (PixelBounds)
+
+/**
+ * Bounding box in pixels of a frame with the given size. Detection may report
+ * normalized (0-1) boxes; those are scaled up, pixel boxes are returned as-is.
+ */
+- (CGRect)pixelBoundingBoxForFrameSize:(CGSize)frameSize;
+
+@end
+
+NS_ASSUME_NONNULL_END
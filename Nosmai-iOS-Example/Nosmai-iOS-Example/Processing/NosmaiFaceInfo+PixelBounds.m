@@ -0,0 +1,23 @@
+//
+//  NosmaiFaceInfo+PixelBounds.m
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 18/10/2026.
+//
+
+#import "NosmaiFaceInfo+PixelBounds.h"
+
+@implementation NosmaiFaceInfo (PixelBounds)
+
+- (CGRect)pixelBoundingBoxForFrameSize:(CGSize)frameSize {
+    CGRect box = self.boundingBox;
+    if (CGRectGetMaxX(box) <= 1.0 && CGRectGetMaxY(box) <= 1.0) {
+        return CGRectMake(box.origin.x * frameSize.width,
+                          box.origin.y * frameSize.height,
+                          box.size.width * frameSize.width,
+                          box.size.height * frameSize.height);
+    }
+    return box;
+}
+
+@end
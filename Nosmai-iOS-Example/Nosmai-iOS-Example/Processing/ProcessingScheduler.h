@@ -0,0 +1,34 @@
+//
+//  ProcessingScheduler.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * Blocks on top of the shared TaskScheduler, for CPU-bound work only
+ * (pixel conversion, LUTs, thumbnail decode). Work that waits on the
+ * network or on disk belongs on a dispatch queue: it would hold a worker
+ * without using it.
+ */
+@interface ProcessingScheduler : NSObject
+
+/// Per-frame work; never waits behind background tasks
++ (void)runRealtime:(dispatch_block_t)block;
+
+/// Work that can wait; one worker is always left for realtime tasks
++ (void)runInBackground:(dispatch_block_t)block;
+
+/// Realtime parallel-for over [0, count); returns when every chunk has run
++ (void)parallelForCount:(size_t)count grain:(size_t)grain block:(void (^)(size_t begin, size_t end))block;
+
+/// workers, backgroundWorkers, steals, helped, and realtime / background (submitted, completed, averageWaitMs, p50WaitMs, p99WaitMs, maxWaitMs)
++ (NSDictionary<NSString *, id> *)statistics;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,77 @@
+//
+//  ProcessingScheduler.m
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#import "ProcessingScheduler.h"
+#include "TaskScheduler.h"
+
+static void ProcessingSchedulerRunBlock(void *context) {
+    dispatch_block_t block = (__bridge_transfer dispatch_block_t)context;
+    @autoreleasepool {
+        block();
+    }
+}
+
+static void ProcessingSchedulerRunRange(void *context, size_t begin, size_t end) {
+    void (^block)(size_t, size_t) = (__bridge void (^)(size_t, size_t))context;
+    @autoreleasepool {
+        block(begin, end);
+    }
+}
+
+static void ProcessingSchedulerSubmit(TaskPriority priority, dispatch_block_t block) {
+    TaskScheduler *scheduler = TaskSchedulerShared();
+    void *context = (__bridge_retained void *)[block copy];
+    if (!scheduler || TaskSchedulerSubmit(scheduler, priority, ProcessingSchedulerRunBlock, context) != 0) {
+        // No scheduler, still run it.
+        dispatch_async(dispatch_get_global_queue(QOS_CLASS_UTILITY, 0), ^{
+            ProcessingSchedulerRunBlock(context);
+        });
+    }
+}
+
+static NSDictionary *ProcessingSchedulerLaneStatistics(const TaskLaneStats *lane) {
+    return @{
+        @"submitted": @(lane->submitted),
+        @"completed": @(lane->completed),
+        @"averageWaitMs": @(lane->averageWaitMs),
+        @"p50WaitMs": @(lane->p50WaitMs),
+        @"p99WaitMs": @(lane->p99WaitMs),
+        @"maxWaitMs": @(lane->maxWaitMs),
+    };
+}
+
+@implementation ProcessingScheduler
+
++ (void)runRealtime:(dispatch_block_t)block {
+    ProcessingSchedulerSubmit(TaskPriorityRealtime, block);
+}
+
++ (void)runInBackground:(dispatch_block_t)block {
+    ProcessingSchedulerSubmit(TaskPriorityBackground, block);
+}
+
++ (void)parallelForCount:(size_t)count grain:(size_t)grain block:(void (^)(size_t, size_t))block {
+    TaskSchedulerParallelFor(TaskSchedulerShared(), TaskPriorityRealtime, count, grain, ProcessingSchedulerRunRange, (__bridge void *)block);
+}
+
++ (NSDictionary<NSString *, id> *)statistics {
+    TaskScheduler *scheduler = TaskSchedulerShared();
+    if (!scheduler) {
+        return @{};
+    }
+    TaskSchedulerStats stats = TaskSchedulerGetStats(scheduler);
+    return @{
+        @"workers": @(stats.workers),
+        @"backgroundWorkers": @(stats.backgroundWorkers),
+        @"steals": @(stats.steals),
+        @"helped": @(stats.helped),
+        @"realtime": ProcessingSchedulerLaneStatistics(&stats.lanes[TaskPriorityRealtime]),
+        @"background": ProcessingSchedulerLaneStatistics(&stats.lanes[TaskPriorityBackground]),
+    };
+}
+
+@end
@@ -0,0 +1,80 @@
+//
+//  ProcessingSession.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#import <Foundation/Foundation.h>
+#import <CoreVideo/CoreVideo.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * Immutable assets shared by any number of ProcessingSessions: decoded
+ * filter packages, colour lookup tables, model weights. Each is loaded
+ * once, never changes afterwards, and is read by every session without
+ * locking. Thread-safe.
+ */
+@interface ProcessingAssetLibrary : NSObject
+
+/// assets, bytes, loads, failedLoads and hits (lookups that found an asset already loaded)
+@property (nonatomic, readonly) NSDictionary<NSString *, NSNumber *> *statistics;
+
+/**
+ * Calls loader only if no asset of that name is loaded yet; concurrent
+ * calls for the same name load it once.
+ *
+ * @return NO if loader returned nil
+ */
+- (BOOL)loadAssetNamed:(NSString *)name loader:(NSData * _Nullable (^)(void))loader;
+
+- (BOOL)hasAssetNamed:(NSString *)name;
+
+@end
+
+/**
+ * One independent processing context with its own effect chain,
+ * parameters and working memory.
+ *
+ * NosmaiCore and NosmaiSDK are process-wide singletons, so every stream
+ * goes through one context and one effect setup. Sessions have no global
+ * state: a server-side deployment creates one per stream and runs them on
+ * separate threads at full parallelism, sharing only the read-only assets
+ * of a ProcessingAssetLibrary. A single session processes one frame at a
+ * time. The example app has a single stream and creates none.
+ */
+@interface ProcessingSession : NSObject
+
+@property (nonatomic, readonly) ProcessingAssetLibrary *assets;
+
+/// Tile edge in pixels. Default 256
+@property (nonatomic, assign) int tileSize;
+
+/// frames, effects, averageMs, lastMs and workingBytes (this session's own memory)
+@property (nonatomic, readonly) NSDictionary<NSString *, NSNumber *> *statistics;
+
+- (instancetype)initWithAssets:(ProcessingAssetLibrary *)assets NS_DESIGNATED_INITIALIZER;
+- (instancetype)init NS_UNAVAILABLE;
+
+// Effects run in the order added.
+
+/// Box smoothing. @return NO if the radius is not positive or the chain is full
+- (BOOL)addSmoothingWithRadius:(int)radius;
+/// Unsharp mask; amount 1.0 adds the detail layer once more
+- (BOOL)addSharpeningWithRadius:(int)radius amount:(float)amount;
+/**
+ * Per-channel lookup from the library: 4 x 256 bytes, table c applied to
+ * byte c of each pixel (B, G, R, A for 32BGRA).
+ *
+ * @return NO if the asset is not loaded or has the wrong size
+ */
+- (BOOL)addColorLookupNamed:(NSString *)name;
+- (void)removeAllEffects;
+
+/// 32BGRA into a different 32BGRA buffer of the same size
+- (BOOL)renderPixelBuffer:(CVPixelBufferRef)source toPixelBuffer:(CVPixelBufferRef)destination;
+
+@end
+
+NS_ASSUME_NONNULL_END
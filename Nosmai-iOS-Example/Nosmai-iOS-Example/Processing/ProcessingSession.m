@@ -0,0 +1,188 @@
+//
+//  ProcessingSession.m
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#import "ProcessingSession.h"
+#import <os/lock.h>
+#include <math.h>
+#include "RenderSession.h"
+
+static int ProcessingAssetLoad(void *context, const char *name, void **data, size_t *size) {
+    NSData * _Nullable (^loader)(void) = (__bridge NSData * _Nullable (^)(void))context;
+    NSData *contents = nil;
+    @autoreleasepool {
+        contents = loader();
+    }
+    if (!contents) {
+        return -1;
+    }
+    void *copy = malloc(contents.length > 0 ? contents.length : 1);
+    if (!copy) {
+        return -1;
+    }
+    memcpy(copy, contents.bytes, contents.length);
+    *data = copy;
+    *size = contents.length;
+    return 0;
+}
+
+@interface ProcessingAssetLibrary ()
+- (nullable RenderAsset *)copyAssetNamed:(NSString *)name;
+@end
+
+@implementation ProcessingAssetLibrary {
+    RenderAssetCache _cache;
+}
+
+- (instancetype)init {
+    self = [super init];
+    if (self) {
+        RenderAssetCacheInit(&_cache);
+    }
+    return self;
+}
+
+- (void)dealloc {
+    RenderAssetCacheFree(&_cache);
+}
+
+- (NSDictionary<NSString *, NSNumber *> *)statistics {
+    RenderAssetCacheStats stats = RenderAssetCacheGetStats(&_cache);
+    return @{
+        @"assets": @(stats.assets),
+        @"bytes": @(stats.bytes),
+        @"loads": @(stats.loads),
+        @"failedLoads": @(stats.failedLoads),
+        @"hits": @(stats.hits),
+    };
+}
+
+- (BOOL)loadAssetNamed:(NSString *)name loader:(NSData * _Nullable (^)(void))loader {
+    RenderAsset *asset = RenderAssetCacheLoad(&_cache, name.UTF8String, ProcessingAssetLoad, (__bridge void *)loader);
+    RenderAssetRelease(asset);
+    return asset != NULL;
+}
+
+- (BOOL)hasAssetNamed:(NSString *)name {
+    RenderAsset *asset = [self copyAssetNamed:name];
+    RenderAssetRelease(asset);
+    return asset != NULL;
+}
+
+- (nullable RenderAsset *)copyAssetNamed:(NSString *)name {
+    return RenderAssetCacheFind(&_cache, name.UTF8String);
+}
+
+@end
+
+@implementation ProcessingSession {
+    os_unfair_lock _lock;
+    // Guarded by _lock.
+    RenderSession _session;
+}
+
+- (instancetype)initWithAssets:(ProcessingAssetLibrary *)assets {
+    self = [super init];
+    if (self) {
+        _lock = OS_UNFAIR_LOCK_INIT;
+        _assets = assets;
+        _tileSize = 256;
+        RenderSessionInit(&_session, _tileSize);
+    }
+    return self;
+}
+
+- (void)dealloc {
+    RenderSessionFree(&_session);
+}
+
+- (void)setTileSize:(int)tileSize {
+    _tileSize = MAX(tileSize, 16);
+    os_unfair_lock_lock(&_lock);
+    RenderSessionSetTileSize(&_session, _tileSize);
+    os_unfair_lock_unlock(&_lock);
+}
+
+- (NSDictionary<NSString *, NSNumber *> *)statistics {
+    os_unfair_lock_lock(&_lock);
+    RenderSessionStats stats = RenderSessionGetStats(&_session);
+    os_unfair_lock_unlock(&_lock);
+    return @{
+        @"frames": @(stats.frames),
+        @"effects": @(stats.stageCount),
+        @"averageMs": @(stats.averageMs),
+        @"lastMs": @(stats.lastMs),
+        @"workingBytes": @(stats.workingBytes),
+    };
+}
+
+#pragma mark - Effects
+
+- (BOOL)addSmoothingWithRadius:(int)radius {
+    os_unfair_lock_lock(&_lock);
+    BOOL added = RenderSessionAddBox(&_session, radius) == 0;
+    os_unfair_lock_unlock(&_lock);
+    return added;
+}
+
+- (BOOL)addSharpeningWithRadius:(int)radius amount:(float)amount {
+    int fixedAmount = (int)lroundf(fmaxf(amount, 0.0f) * 256.0f);
+    os_unfair_lock_lock(&_lock);
+    BOOL added = RenderSessionAddSharpen(&_session, radius, fixedAmount) == 0;
+    os_unfair_lock_unlock(&_lock);
+    return added;
+}
+
+- (BOOL)addColorLookupNamed:(NSString *)name {
+    RenderAsset *asset = [self.assets copyAssetNamed:name];
+    if (!asset) {
+        return NO;
+    }
+    os_unfair_lock_lock(&_lock);
+    BOOL added = RenderSessionAddLUT(&_session, asset) == 0;
+    os_unfair_lock_unlock(&_lock);
+    RenderAssetRelease(asset);
+    return added;
+}
+
+- (void)removeAllEffects {
+    os_unfair_lock_lock(&_lock);
+    RenderSessionRemoveAllStages(&_session);
+    os_unfair_lock_unlock(&_lock);
+}
+
+#pragma mark - Rendering
+
+- (BOOL)renderPixelBuffer:(CVPixelBufferRef)source toPixelBuffer:(CVPixelBufferRef)destination {
+    if (!source || !destination || source == destination) return NO;
+    if (CVPixelBufferGetPixelFormatType(source) != kCVPixelFormatType_32BGRA ||
+        CVPixelBufferGetPixelFormatType(destination) != kCVPixelFormatType_32BGRA) {
+        return NO;
+    }
+    size_t width = CVPixelBufferGetWidth(source);
+    size_t height = CVPixelBufferGetHeight(source);
+    if (CVPixelBufferGetWidth(destination) != width || CVPixelBufferGetHeight(destination) != height) {
+        return NO;
+    }
+
+    CVPixelBufferLockBaseAddress(source, kCVPixelBufferLock_ReadOnly);
+    CVPixelBufferLockBaseAddress(destination, 0);
+    // Uncontended unless the session is shared between threads, which it should not be.
+    os_unfair_lock_lock(&_lock);
+    BOOL rendered = RenderSessionRenderRGBA(&_session,
+                                            CVPixelBufferGetBaseAddress(source),
+                                            CVPixelBufferGetBytesPerRow(source),
+                                            CVPixelBufferGetBaseAddress(destination),
+                                            CVPixelBufferGetBytesPerRow(destination),
+                                            (int)width,
+                                            (int)height) == 0;
+    os_unfair_lock_unlock(&_lock);
+    CVPixelBufferUnlockBaseAddress(destination, 0);
+    CVPixelBufferUnlockBaseAddress(source, kCVPixelBufferLock_ReadOnly);
+    return rendered;
+}
+
+@end
@@ -0,0 +1,170 @@
+//
+//  QualityGovernor.c
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#include "QualityGovernor.h"
+
+#include <string.h>
+
+// Longest step-up dwell after repeated reverts, in multiples of upFrames.
+static const int kMaxDwellFactor = 8;
+
+static const QualityStep kDefaultSteps[] = {
+    {QualityKnobRenderScale, 85},
+    {QualityKnobRenderScale, 70},
+    {QualityKnobDetectionInterval, 2},
+    {QualityKnobDetectionInterval, 3},
+    {QualityKnobSmoothingQuality, 1},
+    {QualityKnobSmoothingQuality, 0},
+    {QualityKnobOptionalEffects, 0},
+};
+
+const QualityStep *QualityGovernorDefaultSteps(int *count) {
+    *count = (int)(sizeof(kDefaultSteps) / sizeof(kDefaultSteps[0]));
+    return kDefaultSteps;
+}
+
+QualitySettings QualityGovernorFullQuality(void) {
+    QualitySettings settings;
+    settings.values[QualityKnobRenderScale] = 100;
+    settings.values[QualityKnobDetectionInterval] = 1;
+    settings.values[QualityKnobSmoothingQuality] = 2;
+    settings.values[QualityKnobOptionalEffects] = 1;
+    return settings;
+}
+
+int QualityGovernorInit(QualityGovernor *governor, const QualityGovernorConfig *config) {
+    memset(governor, 0, sizeof(*governor));
+    if (config->targetFps <= 0.0) {
+        return -1;
+    }
+    int stepCount = config->stepCount;
+    const QualityStep *steps = config->steps;
+    if (!steps) {
+        steps = QualityGovernorDefaultSteps(&stepCount);
+    }
+    if (stepCount <= 0 || stepCount > QUALITY_GOVERNOR_MAX_STEPS) {
+        return -1;
+    }
+    for (int i = 0; i < stepCount; i++) {
+        if ((int)steps[i].knob < 0 || steps[i].knob >= QualityKnobCount) {
+            return -1;
+        }
+        governor->steps[i] = steps[i];
+    }
+
+    governor->config = *config;
+    governor->config.steps = governor->steps;
+    governor->config.stepCount = stepCount;
+    QualityGovernorConfig *c = &governor->config;
+    c->downRatio = c->downRatio > 0.0 ? c->downRatio : 1.0;
+    c->upRatio = c->upRatio > 0.0 ? c->upRatio : 0.75;
+    c->downFrames = c->downFrames > 0 ? c->downFrames : 8;
+    c->upFrames = c->upFrames > 0 ? c->upFrames : 90;
+    c->cooldownFrames = c->cooldownFrames > 0 ? c->cooldownFrames : 30;
+    c->smoothing = c->smoothing > 0.0 && c->smoothing <= 1.0 ? c->smoothing : 0.15;
+
+    governor->settings = QualityGovernorFullQuality();
+    governor->upDwell = c->upFrames;
+    governor->lastStepUpFrame = -1;
+    governor->sinceChange = c->cooldownFrames;
+    governor->stats.budgetMs = 1000.0 / c->targetFps;
+    governor->stats.upFrames = c->upFrames;
+    return 0;
+}
+
+QualitySettings QualityGovernorSettingsForLevel(const QualityGovernor *governor, int level) {
+    QualitySettings settings = QualityGovernorFullQuality();
+    for (int i = 0; i < level && i < governor->config.stepCount; i++) {
+        settings.values[governor->steps[i].knob] = governor->steps[i].value;
+    }
+    return settings;
+}
+
+static void QualityGovernorChange(QualityGovernor *governor, QualityGovernorDirection direction) {
+    QualityGovernorStats *stats = &governor->stats;
+    QualityGovernorEvent event;
+    memset(&event, 0, sizeof(event));
+    event.direction = direction;
+    event.frameMs = governor->averageMs;
+    event.budgetMs = stats->budgetMs;
+    event.frame = stats->frames;
+
+    if (direction == QualityGovernorStepDown) {
+        const QualityStep *step = &governor->steps[stats->level];
+        stats->level++;
+        stats->stepDowns++;
+        event.knob = step->knob;
+        // A step up that could not hold for one dwell: wait longer before trying again.
+        if (governor->lastStepUpFrame >= 0 &&
+            (int64_t)stats->frames - governor->lastStepUpFrame < (int64_t)governor->upDwell + governor->config.cooldownFrames) {
+            event.revert = 1;
+            stats->reverts++;
+            int maxDwell = governor->config.upFrames * kMaxDwellFactor;
+            governor->upDwell = governor->upDwell * 2 < maxDwell ? governor->upDwell * 2 : maxDwell;
+        }
+        governor->lastStepUpFrame = -1;
+    } else {
+        stats->level--;
+        stats->stepUps++;
+        event.knob = governor->steps[stats->level].knob;
+        governor->lastStepUpFrame = (int64_t)stats->frames;
+        if (stats->level == 0) {
+            governor->upDwell = governor->config.upFrames;
+        }
+    }
+    governor->settings = QualityGovernorSettingsForLevel(governor, stats->level);
+    event.level = stats->level;
+    event.value = governor->settings.values[event.knob];
+    stats->maxLevel = stats->level > stats->maxLevel ? stats->level : stats->maxLevel;
+    stats->upFrames = governor->upDwell;
+    governor->overStreak = 0;
+    governor->underStreak = 0;
+    governor->sinceChange = 0;
+
+    if (governor->config.onEvent) {
+        governor->config.onEvent(governor->config.eventContext, &event, &governor->settings);
+    }
+}
+
+int QualityGovernorRecordFrame(QualityGovernor *governor, double frameMs) {
+    const QualityGovernorConfig *config = &governor->config;
+    QualityGovernorStats *stats = &governor->stats;
+    governor->averageMs = stats->frames == 0 ? frameMs
+                                             : governor->averageMs + config->smoothing * (frameMs - governor->averageMs);
+    stats->frames++;
+    stats->framesAtLevel[stats->level]++;
+    stats->overBudget += frameMs > stats->budgetMs ? 1 : 0;
+    stats->averageFrameMs = governor->averageMs;
+    governor->sinceChange++;
+
+    if (governor->averageMs > stats->budgetMs * config->downRatio) {
+        governor->overStreak++;
+        governor->underStreak = 0;
+    } else if (governor->averageMs < stats->budgetMs * config->upRatio) {
+        governor->underStreak++;
+        governor->overStreak = 0;
+    } else {
+        governor->overStreak = 0;
+        governor->underStreak = 0;
+    }
+    if (governor->sinceChange < config->cooldownFrames) {
+        return 0;
+    }
+    if (governor->overStreak >= config->downFrames && stats->level < config->stepCount) {
+        QualityGovernorChange(governor, QualityGovernorStepDown);
+        return QualityGovernorStepDown;
+    }
+    if (governor->underStreak >= governor->upDwell && stats->level > 0) {
+        QualityGovernorChange(governor, QualityGovernorStepUp);
+        return QualityGovernorStepUp;
+    }
+    return 0;
+}
+
+QualityGovernorStats QualityGovernorGetStats(const QualityGovernor *governor) {
+    return governor->stats;
+}
@@ -0,0 +1,138 @@
+//
+//  QualityGovernor.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#ifndef QUALITY_GOVERNOR_H
+#define QUALITY_GOVERNOR_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define QUALITY_GOVERNOR_MAX_STEPS 16
+
+typedef enum {
+    QualityKnobRenderScale = 0,        // Internal render resolution, percent of full size
+    QualityKnobDetectionInterval = 1,  // Run face detection every N frames
+    QualityKnobSmoothingQuality = 2,   // 2 full, 1 reduced, 0 cheapest
+    QualityKnobOptionalEffects = 3,    // 1 on, 0 off
+    QualityKnobCount = 4
+} QualityKnob;
+
+typedef struct {
+    int values[QualityKnobCount];
+} QualitySettings;
+
+/// Moving one level down applies the step; moving back up undoes it
+typedef struct {
+    QualityKnob knob;
+    int value;
+} QualityStep;
+
+typedef enum {
+    QualityGovernorStepDown = -1,
+    QualityGovernorStepUp = 1
+} QualityGovernorDirection;
+
+typedef struct {
+    QualityGovernorDirection direction;
+    int level;               // Level after the change, 0 = full quality
+    QualityKnob knob;        // Knob the change touched
+    int value;               // Its new value
+    double frameMs;          // Smoothed frame time that triggered the change
+    double budgetMs;
+    uint64_t frame;          // Frame count at the change
+    int revert;              // Step down straight after a step up that did not hold
+} QualityGovernorEvent;
+
+typedef void (*QualityGovernorEventFn)(void *context, const QualityGovernorEvent *event, const QualitySettings *settings);
+
+typedef struct {
+    double targetFps;
+    double downRatio;        // Step down above budget * downRatio. Default 1.0
+    double upRatio;          // Step up below budget * upRatio. Default 0.75
+    int downFrames;          // Consecutive frames over before stepping down. Default 8
+    int upFrames;            // Consecutive frames under before stepping up. Default 90
+    int cooldownFrames;      // Frames after any change before the next one. Default 30
+    double smoothing;        // Frame time moving average weight. Default 0.15
+    const QualityStep *steps;  // NULL for QualityGovernorDefaultSteps
+    int stepCount;
+    QualityGovernorEventFn onEvent;
+    void *eventContext;
+} QualityGovernorConfig;
+
+typedef struct {
+    uint64_t frames;
+    uint64_t overBudget;     // Raw frame time above the budget
+    uint64_t stepDowns;
+    uint64_t stepUps;
+    uint64_t reverts;
+    int level;
+    int maxLevel;
+    double averageFrameMs;   // Smoothed
+    double budgetMs;
+    int upFrames;            // Current step-up dwell, after backoff
+    uint64_t framesAtLevel[QUALITY_GOVERNOR_MAX_STEPS + 1];
+} QualityGovernorStats;
+
+/**
+ * Frame-time driven quality ladder.
+ *
+ * Every frame's processing time goes into a moving average compared with
+ * the budget (1000 / targetFps). A sustained overrun steps one level down
+ * the step list (by default render resolution first, then face-detection
+ * cadence, smoothing quality and finally optional effects); sustained
+ * headroom steps back up.
+ *
+ * Hysteresis comes from three places: the up threshold sits well below the
+ * down threshold, stepping up needs a much longer streak than stepping
+ * down, and every change is followed by a cooldown. A step up that has to
+ * be undone within its dwell doubles the dwell for the next attempt (up to
+ * 8x), so a load sitting right at a step boundary does not flap. The dwell
+ * resets once quality is back at level 0.
+ */
+typedef struct {
+    QualityGovernorConfig config;
+    QualityStep steps[QUALITY_GOVERNOR_MAX_STEPS];
+    QualitySettings settings;
+    double averageMs;
+    int overStreak;
+    int underStreak;
+    int sinceChange;
+    int upDwell;
+    int64_t lastStepUpFrame;
+    QualityGovernorStats stats;
+} QualityGovernor;
+
+/// The default order: render resolution, detection cadence, smoothing, optional effects
+const QualityStep *QualityGovernorDefaultSteps(int *count);
+
+/// Every knob at full quality
+QualitySettings QualityGovernorFullQuality(void);
+
+/// @return 0 on success, -1 on invalid configuration
+int QualityGovernorInit(QualityGovernor *governor, const QualityGovernorConfig *config);
+
+/**
+ * Feeds one frame's processing time.
+ *
+ * @return The change made for this frame, or 0 if the level stayed
+ */
+int QualityGovernorRecordFrame(QualityGovernor *governor, double frameMs);
+
+/// Settings after applying the first `level` steps to full quality
+QualitySettings QualityGovernorSettingsForLevel(const QualityGovernor *governor, int level);
+
+QualityGovernorStats QualityGovernorGetStats(const QualityGovernor *governor);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* QUALITY_GOVERNOR_H */
@@ -0,0 +1,234 @@
+//
+//  RenderSession.c
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#include "RenderSession.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static double RenderSessionNowMs(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1000.0 + (double)ts.tv_nsec / 1.0e6;
+}
+
+static RenderAsset *RenderAssetWrap(const char *name, void *data, size_t size) {
+    RenderAsset *asset = calloc(1, sizeof(RenderAsset));
+    if (!asset) {
+        return NULL;
+    }
+    atomic_init(&asset->references, 1);
+    strncpy(asset->name, name, RENDER_ASSET_NAME_LENGTH - 1);
+    asset->size = size;
+    asset->data = data;
+    return asset;
+}
+
+RenderAsset *RenderAssetCreate(const char *name, const void *data, size_t size) {
+    void *copy = malloc(size > 0 ? size : 1);
+    if (!copy) {
+        return NULL;
+    }
+    memcpy(copy, data, size);
+    RenderAsset *asset = RenderAssetWrap(name, copy, size);
+    if (!asset) {
+        free(copy);
+    }
+    return asset;
+}
+
+RenderAsset *RenderAssetRetain(RenderAsset *asset) {
+    if (asset) {
+        atomic_fetch_add(&asset->references, 1);
+    }
+    return asset;
+}
+
+void RenderAssetRelease(RenderAsset *asset) {
+    if (asset && atomic_fetch_sub(&asset->references, 1) == 1) {
+        free((void *)asset->data);
+        free(asset);
+    }
+}
+
+void RenderAssetCacheInit(RenderAssetCache *cache) {
+    memset(cache, 0, sizeof(*cache));
+    pthread_mutex_init(&cache->mutex, NULL);
+}
+
+void RenderAssetCacheFree(RenderAssetCache *cache) {
+    for (size_t i = 0; i < cache->count; i++) {
+        RenderAssetRelease(cache->assets[i]);
+    }
+    free(cache->assets);
+    pthread_mutex_destroy(&cache->mutex);
+    memset(cache, 0, sizeof(*cache));
+}
+
+// Caller holds the mutex.
+static RenderAsset *RenderAssetCacheLookup(RenderAssetCache *cache, const char *name) {
+    for (size_t i = 0; i < cache->count; i++) {
+        if (strncmp(cache->assets[i]->name, name, RENDER_ASSET_NAME_LENGTH - 1) == 0) {
+            cache->stats.hits++;
+            return RenderAssetRetain(cache->assets[i]);
+        }
+    }
+    return NULL;
+}
+
+RenderAsset *RenderAssetCacheFind(RenderAssetCache *cache, const char *name) {
+    pthread_mutex_lock(&cache->mutex);
+    RenderAsset *asset = RenderAssetCacheLookup(cache, name);
+    pthread_mutex_unlock(&cache->mutex);
+    return asset;
+}
+
+RenderAsset *RenderAssetCacheLoad(RenderAssetCache *cache, const char *name, RenderAssetLoadFn load, void *context) {
+    pthread_mutex_lock(&cache->mutex);
+    RenderAsset *asset = RenderAssetCacheLookup(cache, name);
+    if (asset) {
+        pthread_mutex_unlock(&cache->mutex);
+        return asset;
+    }
+
+    void *data = NULL;
+    size_t size = 0;
+    if (cache->count == cache->capacity) {
+        size_t capacity = cache->capacity > 0 ? cache->capacity * 2 : 8;
+        RenderAsset **assets = realloc(cache->assets, sizeof(RenderAsset *) * capacity);
+        if (assets) {
+            cache->assets = assets;
+            cache->capacity = capacity;
+        }
+    }
+    if (cache->count < cache->capacity && load(context, name, &data, &size) == 0) {
+        asset = RenderAssetWrap(name, data, size);
+        if (!asset) {
+            free(data);
+        }
+    }
+    if (asset) {
+        cache->assets[cache->count++] = asset;
+        cache->stats.loads++;
+        cache->stats.assets = (uint32_t)cache->count;
+        cache->stats.bytes += size;
+        RenderAssetRetain(asset);
+    } else {
+        cache->stats.failedLoads++;
+    }
+    pthread_mutex_unlock(&cache->mutex);
+    return asset;
+}
+
+RenderAssetCacheStats RenderAssetCacheGetStats(RenderAssetCache *cache) {
+    pthread_mutex_lock(&cache->mutex);
+    RenderAssetCacheStats stats = cache->stats;
+    pthread_mutex_unlock(&cache->mutex);
+    return stats;
+}
+
+// Frees the tile buffers; they are sized for the chain on the next render.
+static void RenderSessionInvalidate(RenderSession *session) {
+    if (session->filterReady) {
+        TiledFilterFree(&session->filter);
+        session->filterReady = 0;
+    }
+}
+
+void RenderSessionInit(RenderSession *session, int tileSize) {
+    memset(session, 0, sizeof(*session));
+    session->tileSize = tileSize > 0 ? tileSize : 256;
+}
+
+void RenderSessionFree(RenderSession *session) {
+    RenderSessionRemoveAllStages(session);
+    memset(session, 0, sizeof(*session));
+}
+
+static int RenderSessionAddStage(RenderSession *session, TiledFilterApplyFn apply, int radius, RenderAsset *asset) {
+    if (session->stageCount == TILED_FILTER_MAX_STAGES) {
+        return -1;
+    }
+    int index = session->stageCount++;
+    // The params live in the session, so the stage can point at them.
+    const void *params = asset ? asset->data : (const void *)&session->params[index];
+    session->stages[index] = (TiledFilterStage){apply, params, radius};
+    session->assets[index] = RenderAssetRetain(asset);
+    session->stats.stageCount = session->stageCount;
+    RenderSessionInvalidate(session);
+    return 0;
+}
+
+int RenderSessionAddBox(RenderSession *session, int radius) {
+    if (radius <= 0 || session->stageCount == TILED_FILTER_MAX_STAGES) {
+        return -1;
+    }
+    session->params[session->stageCount].box = (TiledFilterBoxParams){radius};
+    return RenderSessionAddStage(session, TiledFilterBox, radius, NULL);
+}
+
+int RenderSessionAddSharpen(RenderSession *session, int radius, int amount) {
+    if (radius <= 0 || session->stageCount == TILED_FILTER_MAX_STAGES) {
+        return -1;
+    }
+    session->params[session->stageCount].sharpen = (TiledFilterSharpenParams){radius, amount};
+    return RenderSessionAddStage(session, TiledFilterSharpen, radius, NULL);
+}
+
+int RenderSessionAddLUT(RenderSession *session, RenderAsset *asset) {
+    if (!asset || asset->size != sizeof(TiledFilterLUTParams)) {
+        return -1;
+    }
+    return RenderSessionAddStage(session, TiledFilterLUT, 0, asset);
+}
+
+void RenderSessionRemoveAllStages(RenderSession *session) {
+    for (int i = 0; i < session->stageCount; i++) {
+        RenderAssetRelease(session->assets[i]);
+        session->assets[i] = NULL;
+    }
+    session->stageCount = 0;
+    session->stats.stageCount = 0;
+    RenderSessionInvalidate(session);
+}
+
+void RenderSessionSetTileSize(RenderSession *session, int tileSize) {
+    if (tileSize > 0 && tileSize != session->tileSize) {
+        session->tileSize = tileSize;
+        RenderSessionInvalidate(session);
+    }
+}
+
+int RenderSessionRenderRGBA(RenderSession *session,
+                            const uint8_t *src,
+                            size_t srcStride,
+                            uint8_t *dst,
+                            size_t dstStride,
+                            int width,
+                            int height) {
+    if (!session->filterReady) {
+        if (TiledFilterInit(&session->filter, session->stages, session->stageCount, session->tileSize) != 0) {
+            return -1;
+        }
+        session->filterReady = 1;
+        session->stats.workingBytes = session->filter.stats.workingBytes;
+    }
+    double start = RenderSessionNowMs();
+    TiledFilterRunRGBA(&session->filter, src, srcStride, dst, dstStride, width, height);
+    double elapsed = RenderSessionNowMs() - start;
+    session->stats.frames++;
+    session->stats.lastMs = elapsed;
+    session->totalMs += elapsed;
+    return 0;
+}
+
+RenderSessionStats RenderSessionGetStats(const RenderSession *session) {
+    RenderSessionStats stats = session->stats;
+    stats.averageMs = stats.frames > 0 ? session->totalMs / (double)stats.frames : 0.0;
+    return stats;
+}
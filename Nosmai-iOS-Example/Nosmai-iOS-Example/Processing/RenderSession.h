@@ -0,0 +1,138 @@
+//
+//  RenderSession.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#ifndef RENDER_SESSION_H
+#define RENDER_SESSION_H
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "TiledFilter.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define RENDER_ASSET_NAME_LENGTH 64
+
+/**
+ * Immutable, reference-counted asset (a decoded filter package, a LUT,
+ * model weights). The data never changes after creation, so any number
+ * of sessions on any threads read it without locking.
+ */
+typedef struct {
+    atomic_int references;
+    char name[RENDER_ASSET_NAME_LENGTH];
+    size_t size;
+    const void *data;
+} RenderAsset;
+
+/// Copies size bytes of data. @return NULL on allocation failure
+RenderAsset *RenderAssetCreate(const char *name, const void *data, size_t size);
+RenderAsset *RenderAssetRetain(RenderAsset *asset);
+void RenderAssetRelease(RenderAsset *asset);
+
+/// Fills *data (malloc'd, taken over by the cache) and *size. @return 0 on success
+typedef int (*RenderAssetLoadFn)(void *context, const char *name, void **data, size_t *size);
+
+typedef struct {
+    uint64_t hits;
+    uint64_t loads;
+    uint64_t failedLoads;
+    uint32_t assets;
+    size_t bytes;
+} RenderAssetCacheStats;
+
+/**
+ * Name -> asset. Every asset is loaded once however many sessions ask
+ * for it. Loads run under the cache mutex: they happen while sessions are
+ * set up, not per frame, and it keeps two sessions from decoding the same
+ * package at once.
+ */
+typedef struct {
+    pthread_mutex_t mutex;
+    RenderAsset **assets;
+    size_t count;
+    size_t capacity;
+    RenderAssetCacheStats stats;
+} RenderAssetCache;
+
+void RenderAssetCacheInit(RenderAssetCache *cache);
+/// Drops the cache's references; assets still held by sessions stay alive
+void RenderAssetCacheFree(RenderAssetCache *cache);
+
+/// @return The asset, retained for the caller, or NULL if it could not be loaded
+RenderAsset *RenderAssetCacheLoad(RenderAssetCache *cache, const char *name, RenderAssetLoadFn load, void *context);
+
+/// @return The asset, retained for the caller, or NULL if it was never loaded
+RenderAsset *RenderAssetCacheFind(RenderAssetCache *cache, const char *name);
+
+RenderAssetCacheStats RenderAssetCacheGetStats(RenderAssetCache *cache);
+
+typedef struct {
+    uint64_t frames;
+    double averageMs;
+    double lastMs;
+    size_t workingBytes;  // Tile buffers, owned by this session
+    int stageCount;
+} RenderSessionStats;
+
+typedef union {
+    TiledFilterBoxParams box;
+    TiledFilterSharpenParams sharpen;
+} RenderSessionParams;
+
+/**
+ * One independent render context: its own effect chain, parameters and
+ * working memory, with nothing global. Sessions on different threads run
+ * fully in parallel; a single session is used from one thread at a time.
+ * The only thing sessions share are RenderAssets, which are read-only.
+ *
+ * Stages point into the session, so it must not move once they are added.
+ */
+typedef struct {
+    TiledFilterStage stages[TILED_FILTER_MAX_STAGES];
+    RenderSessionParams params[TILED_FILTER_MAX_STAGES];
+    RenderAsset *assets[TILED_FILTER_MAX_STAGES];  // Retained; NULL for stages without one
+    int stageCount;
+    int tileSize;
+    TiledFilter filter;
+    int filterReady;  // The chain changed since the tile buffers were sized when 0
+    RenderSessionStats stats;
+    double totalMs;
+} RenderSession;
+
+void RenderSessionInit(RenderSession *session, int tileSize);
+void RenderSessionFree(RenderSession *session);
+
+/// @return 0 on success, -1 if the chain is full or the arguments are invalid
+int RenderSessionAddBox(RenderSession *session, int radius);
+int RenderSessionAddSharpen(RenderSession *session, int radius, int amount);
+/// asset must hold a TiledFilterLUTParams; the session retains it
+int RenderSessionAddLUT(RenderSession *session, RenderAsset *asset);
+void RenderSessionRemoveAllStages(RenderSession *session);
+/// Tile buffers are resized on the next render
+void RenderSessionSetTileSize(RenderSession *session, int tileSize);
+
+/// @return 0 on success, -1 if tile memory could not be allocated
+int RenderSessionRenderRGBA(RenderSession *session,
+                            const uint8_t *src,
+                            size_t srcStride,
+                            uint8_t *dst,
+                            size_t dstStride,
+                            int width,
+                            int height);
+
+RenderSessionStats RenderSessionGetStats(const RenderSession *session);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RENDER_SESSION_H */
@@ -0,0 +1,437 @@
+//
+//  Resampler.c
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 18/10/2026.
+//
+
+#include "Resampler.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "TaskScheduler.h"
+
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+#define RESAMPLER_MAX_BANDS 32
+
+// Weights are Q14; the horizontal pass keeps 6 fractional bits.
+enum {
+    kWeightBits = 14,
+    kIntermediateBits = 6,
+    kHorizontalShift = kWeightBits - kIntermediateBits,
+    kVerticalShift = kWeightBits + kIntermediateBits,
+};
+
+static double ResamplerSinc(double x) {
+    if (fabs(x) < 1e-8) {
+        return 1.0;
+    }
+    double px = M_PI * x;
+    return sin(px) / px;
+}
+
+static double ResamplerKernelSupport(ResamplerKernel kernel) {
+    switch (kernel) {
+        case ResamplerKernelBox: return 0.5;
+        case ResamplerKernelBilinear: return 1.0;
+        case ResamplerKernelBicubic: return 2.0;
+        case ResamplerKernelLanczos3: return 3.0;
+    }
+    return 1.0;
+}
+
+static double ResamplerKernelWeight(ResamplerKernel kernel, double x) {
+    x = fabs(x);
+    switch (kernel) {
+        case ResamplerKernelBox:
+            return x < 0.5 ? 1.0 : 0.0;
+        case ResamplerKernelBilinear:
+            return x < 1.0 ? 1.0 - x : 0.0;
+        case ResamplerKernelBicubic:
+            // Catmull-Rom (B = 0, C = 0.5).
+            if (x < 1.0) return 1.5 * x * x * x - 2.5 * x * x + 1.0;
+            if (x < 2.0) return -0.5 * x * x * x + 2.5 * x * x - 4.0 * x + 2.0;
+            return 0.0;
+        case ResamplerKernelLanczos3:
+            return x < 3.0 ? ResamplerSinc(x) * ResamplerSinc(x / 3.0) : 0.0;
+    }
+    return 0.0;
+}
+
+static void ResamplerAxisFree(ResamplerAxis *axis) {
+    free(axis->start);
+    free(axis->weights);
+    memset(axis, 0, sizeof(*axis));
+}
+
+static int ResamplerAxisBuild(ResamplerAxis *axis, ResamplerKernel kernel, int srcSize, int dstSize) {
+    double scale = (double)srcSize / (double)dstSize;
+    double filterScale = scale > 1.0 ? scale : 1.0;
+    // The box kernel is evaluated as exact overlap with a footprint of
+    // `scale` source pixels, in either direction.
+    double support = kernel == ResamplerKernelBox ? scale * 0.5 + 0.5
+                                                  : ResamplerKernelSupport(kernel) * filterScale;
+    int taps = (int)ceil(support * 2.0) + 1;
+    taps = taps < srcSize ? taps : srcSize;
+
+    axis->start = malloc(sizeof(int) * (size_t)dstSize);
+    axis->weights = calloc((size_t)dstSize * (size_t)taps, sizeof(int16_t));
+    double *window = malloc(sizeof(double) * (size_t)(taps + 4));
+    if (!axis->start || !axis->weights || !window) {
+        free(window);
+        ResamplerAxisFree(axis);
+        return -1;
+    }
+    axis->taps = taps;
+    axis->srcSize = srcSize;
+    axis->dstSize = dstSize;
+
+    for (int i = 0; i < dstSize; i++) {
+        double center = ((double)i + 0.5) * scale;
+        int lo = (int)floor(center - support);
+        int hi = (int)ceil(center + support);
+        lo = lo > 0 ? lo : 0;
+        hi = hi < srcSize ? hi : srcSize;
+
+        // Trim to the taps that actually contribute.
+        int first = -1, last = -1;
+        double sum = 0.0;
+        double weights[64];
+        int span = hi - lo < 64 ? hi - lo : 64;
+        for (int k = 0; k < span; k++) {
+            int j = lo + k;
+            double w;
+            if (kernel == ResamplerKernelBox) {
+                double left = fmax((double)j, center - scale * 0.5);
+                double right = fmin((double)j + 1.0, center + scale * 0.5);
+                w = right > left ? right - left : 0.0;
+            } else {
+                w = ResamplerKernelWeight(kernel, ((double)j + 0.5 - center) / filterScale);
+            }
+            weights[k] = w;
+            if (w != 0.0) {
+                first = first < 0 ? k : first;
+                last = k;
+                sum += w;
+            }
+        }
+
+        for (int k = 0; k < taps; k++) {
+            window[k] = 0.0;
+        }
+        int start;
+        if (first < 0 || sum == 0.0) {
+            int nearest = (int)floor(center);
+            start = nearest < srcSize ? nearest : srcSize - 1;
+            window[0] = 1.0;
+            sum = 1.0;
+        } else {
+            start = lo + first;
+            for (int k = first; k <= last && k - first < taps; k++) {
+                window[k - first] = weights[k];
+            }
+        }
+        // Keep the whole window inside the source so the passes never
+        // bounds-check.
+        if (start + taps > srcSize) {
+            int shift = start + taps - srcSize;
+            memmove(window + shift, window, sizeof(double) * (size_t)(taps - shift));
+            for (int k = 0; k < shift; k++) {
+                window[k] = 0.0;
+            }
+            start -= shift;
+        }
+        axis->start[i] = start;
+
+        int16_t *q = axis->weights + (size_t)i * (size_t)taps;
+        int total = 0, largest = 0;
+        for (int k = 0; k < taps; k++) {
+            q[k] = (int16_t)lround(window[k] / sum * (double)(1 << kWeightBits));
+            total += q[k];
+            largest = abs(q[k]) > abs(q[largest]) ? k : largest;
+        }
+        q[largest] = (int16_t)(q[largest] + ((1 << kWeightBits) - total));
+    }
+    free(window);
+    return 0;
+}
+
+void ResamplerPlanInit(ResamplerPlan *plan) {
+    memset(plan, 0, sizeof(*plan));
+}
+
+static void ResamplerPlanReleaseTables(ResamplerPlan *plan) {
+    ResamplerAxisFree(&plan->x);
+    ResamplerAxisFree(&plan->y);
+    free(plan->bandRows);
+    free(plan->scratch);
+    plan->bandRows = NULL;
+    plan->scratch = NULL;
+    plan->scratchPerBand = 0;
+}
+
+void ResamplerPlanFree(ResamplerPlan *plan) {
+    ResamplerPlanReleaseTables(plan);
+    memset(plan, 0, sizeof(*plan));
+}
+
+int ResamplerPlanPrepare(ResamplerPlan *plan,
+                         ResamplerKernel kernel,
+                         int srcWidth,
+                         int srcHeight,
+                         int dstWidth,
+                         int dstHeight,
+                         int channels,
+                         int bands) {
+    if (srcWidth <= 0 || srcHeight <= 0 || dstWidth <= 0 || dstHeight <= 0 ||
+        (channels != 1 && channels != 2 && channels != 4)) {
+        return -1;
+    }
+    bands = bands < 1 ? 1 : (bands > RESAMPLER_MAX_BANDS ? RESAMPLER_MAX_BANDS : bands);
+    bands = bands < dstHeight ? bands : dstHeight;
+    if (plan->scratch && plan->kernel == kernel && plan->srcWidth == srcWidth && plan->srcHeight == srcHeight &&
+        plan->dstWidth == dstWidth && plan->dstHeight == dstHeight && plan->channels == channels && plan->bands == bands) {
+        plan->stats.reuses++;
+        return 0;
+    }
+
+    ResamplerPlanReleaseTables(plan);
+    plan->kernel = kernel;
+    plan->srcWidth = srcWidth;
+    plan->srcHeight = srcHeight;
+    plan->dstWidth = dstWidth;
+    plan->dstHeight = dstHeight;
+    plan->channels = channels;
+    plan->bands = bands;
+    if (ResamplerAxisBuild(&plan->x, kernel, srcWidth, dstWidth) != 0 ||
+        ResamplerAxisBuild(&plan->y, kernel, srcHeight, dstHeight) != 0) {
+        ResamplerPlanReleaseTables(plan);
+        return -1;
+    }
+
+    plan->bandRows = malloc(sizeof(int) * (size_t)(bands + 1));
+    if (!plan->bandRows) {
+        ResamplerPlanReleaseTables(plan);
+        return -1;
+    }
+    int maxRows = 0;
+    for (int b = 0; b <= bands; b++) {
+        plan->bandRows[b] = (int)((int64_t)b * dstHeight / bands);
+    }
+    for (int b = 0; b < bands; b++) {
+        int first = plan->y.start[plan->bandRows[b]];
+        int last = plan->y.start[plan->bandRows[b + 1] - 1] + plan->y.taps - 1;
+        maxRows = last - first + 1 > maxRows ? last - first + 1 : maxRows;
+    }
+    plan->scratchPerBand = (size_t)maxRows * (size_t)dstWidth * (size_t)channels;
+    plan->scratch = malloc(sizeof(int16_t) * plan->scratchPerBand * (size_t)bands);
+    if (!plan->scratch) {
+        ResamplerPlanReleaseTables(plan);
+        return -1;
+    }
+    plan->stats.builds++;
+    return 1;
+}
+
+static inline int16_t ResamplerClamp16(int value) {
+    return (int16_t)(value < -32768 ? -32768 : (value > 32767 ? 32767 : value));
+}
+
+static inline uint8_t ResamplerClamp8(int value) {
+    return (uint8_t)(value < 0 ? 0 : (value > 255 ? 255 : value));
+}
+
+static void ResamplerHorizontalRow(const ResamplerPlan *plan, const uint8_t *src, int16_t *out) {
+    const ResamplerAxis *axis = &plan->x;
+    int channels = plan->channels;
+    int taps = axis->taps;
+    int x = 0;
+#if defined(__ARM_NEON)
+    if (channels == 4) {
+        // One output pixel per step, all four channels in one vector.
+        for (; x < axis->dstSize; x++) {
+            const int16_t *w = axis->weights + (size_t)x * (size_t)taps;
+            const uint8_t *p = src + (size_t)axis->start[x] * 4;
+            int32x4_t acc = vdupq_n_s32(0);
+            for (int k = 0; k < taps; k++) {
+                uint32_t packed;
+                memcpy(&packed, p + (size_t)k * 4, sizeof(packed));
+                int16x4_t pixel = vget_low_s16(vreinterpretq_s16_u16(vmovl_u8(vcreate_u8(packed))));
+                acc = vmlal_n_s16(acc, pixel, w[k]);
+            }
+            vst1_s16(out + (size_t)x * 4, vqrshrn_n_s32(acc, kHorizontalShift));
+        }
+    }
+#endif
+    if (channels == 4) {
+        for (; x < axis->dstSize; x++) {
+            const int16_t *w = axis->weights + (size_t)x * (size_t)taps;
+            const uint8_t *p = src + (size_t)axis->start[x] * 4;
+            int acc[4] = {0, 0, 0, 0};
+            for (int k = 0; k < taps; k++) {
+                for (int c = 0; c < 4; c++) {
+                    acc[c] += w[k] * p[k * 4 + c];
+                }
+            }
+            for (int c = 0; c < 4; c++) {
+                out[x * 4 + c] = ResamplerClamp16((acc[c] + (1 << (kHorizontalShift - 1))) >> kHorizontalShift);
+            }
+        }
+    }
+    for (; x < axis->dstSize; x++) {
+        const int16_t *w = axis->weights + (size_t)x * (size_t)taps;
+        const uint8_t *p = src + (size_t)axis->start[x] * (size_t)channels;
+        for (int c = 0; c < channels; c++) {
+            int acc = 0;
+            for (int k = 0; k < taps; k++) {
+                acc += w[k] * p[k * channels + c];
+            }
+            out[x * channels + c] = ResamplerClamp16((acc + (1 << (kHorizontalShift - 1))) >> kHorizontalShift);
+        }
+    }
+}
+
+static void ResamplerVerticalRow(const int16_t *const *rows, const int16_t *w, int taps, int count, uint8_t *out) {
+    int i = 0;
+#if defined(__ARM_NEON)
+    for (; i + 8 <= count; i += 8) {
+        int32x4_t lo = vdupq_n_s32(0);
+        int32x4_t hi = vdupq_n_s32(0);
+        for (int k = 0; k < taps; k++) {
+            int16x8_t v = vld1q_s16(rows[k] + i);
+            lo = vmlal_n_s16(lo, vget_low_s16(v), w[k]);
+            hi = vmlal_n_s16(hi, vget_high_s16(v), w[k]);
+        }
+        int16x8_t packed = vcombine_s16(vqrshrn_n_s32(lo, 16), vqrshrn_n_s32(hi, 16));
+        vst1_u8(out + i, vqrshrun_n_s16(packed, kVerticalShift - 16));
+    }
+#endif
+    // Fixed-width blocks the compiler can vectorize on other targets.
+    for (; i + 16 <= count; i += 16) {
+        int acc[16] = {0};
+        for (int k = 0; k < taps; k++) {
+            const int16_t *row = rows[k] + i;
+            for (int j = 0; j < 16; j++) {
+                acc[j] += w[k] * row[j];
+            }
+        }
+        for (int j = 0; j < 16; j++) {
+            out[i + j] = ResamplerClamp8((acc[j] + (1 << (kVerticalShift - 1))) >> kVerticalShift);
+        }
+    }
+    for (; i < count; i++) {
+        int acc = 0;
+        for (int k = 0; k < taps; k++) {
+            acc += w[k] * rows[k][i];
+        }
+        out[i] = ResamplerClamp8((acc + (1 << (kVerticalShift - 1))) >> kVerticalShift);
+    }
+}
+
+typedef struct {
+    ResamplerPlan *plan;
+    const uint8_t *src;
+    size_t srcStride;
+    uint8_t *dst;
+    size_t dstStride;
+} ResamplerJob;
+
+static void ResamplerRunBand(void *context, size_t band) {
+    const ResamplerJob *job = context;
+    const ResamplerPlan *plan = job->plan;
+    int rowBegin = plan->bandRows[band];
+    int rowEnd = plan->bandRows[band + 1];
+    if (rowBegin >= rowEnd) {
+        return;
+    }
+    size_t rowLength = (size_t)plan->dstWidth * (size_t)plan->channels;
+    int16_t *scratch = plan->scratch + plan->scratchPerBand * band;
+    int firstSrc = plan->y.start[rowBegin];
+    int lastSrc = plan->y.start[rowEnd - 1] + plan->y.taps - 1;
+    for (int sy = firstSrc; sy <= lastSrc; sy++) {
+        ResamplerHorizontalRow(plan, job->src + (size_t)sy * job->srcStride, scratch + (size_t)(sy - firstSrc) * rowLength);
+    }
+
+    const int16_t *rows[64];
+    int taps = plan->y.taps < 64 ? plan->y.taps : 64;
+    for (int y = rowBegin; y < rowEnd; y++) {
+        int start = plan->y.start[y];
+        for (int k = 0; k < taps; k++) {
+            rows[k] = scratch + (size_t)(start + k - firstSrc) * rowLength;
+        }
+        ResamplerVerticalRow(rows, plan->y.weights + (size_t)y * (size_t)plan->y.taps, taps, (int)rowLength,
+                             job->dst + (size_t)y * job->dstStride);
+    }
+}
+
+static void ResamplerRunBands(void *context, size_t begin, size_t end) {
+    for (size_t band = begin; band < end; band++) {
+        ResamplerRunBand(context, band);
+    }
+}
+
+void ResamplerRun(ResamplerPlan *plan,
+                  const uint8_t *src,
+                  size_t srcStride,
+                  uint8_t *dst,
+                  size_t dstStride,
+                  int parallel) {
+    if (!plan->scratch) {
+        return;
+    }
+    ResamplerJob job = {plan, src, srcStride, dst, dstStride};
+    size_t bands = (size_t)plan->bands;
+    plan->stats.frames++;
+    if (!parallel || bands == 1) {
+        for (size_t b = 0; b < bands; b++) {
+            ResamplerRunBand(&job, b);
+        }
+        return;
+    }
+    TaskSchedulerParallelFor(TaskSchedulerShared(), TaskPriorityRealtime, bands, 1, ResamplerRunBands, &job);
+}
+
+void ResamplerNV12PlanInit(ResamplerNV12Plan *plan) {
+    ResamplerPlanInit(&plan->luma);
+    ResamplerPlanInit(&plan->chroma);
+}
+
+void ResamplerNV12PlanFree(ResamplerNV12Plan *plan) {
+    ResamplerPlanFree(&plan->luma);
+    ResamplerPlanFree(&plan->chroma);
+}
+
+int ResamplerNV12PlanPrepare(ResamplerNV12Plan *plan,
+                             ResamplerKernel kernel,
+                             int srcWidth,
+                             int srcHeight,
+                             int dstWidth,
+                             int dstHeight,
+                             int bands) {
+    int luma = ResamplerPlanPrepare(&plan->luma, kernel, srcWidth, srcHeight, dstWidth, dstHeight, 1, bands);
+    int chroma = ResamplerPlanPrepare(&plan->chroma, kernel, (srcWidth + 1) / 2, (srcHeight + 1) / 2,
+                                      (dstWidth + 1) / 2, (dstHeight + 1) / 2, 2, bands);
+    if (luma < 0 || chroma < 0) {
+        return -1;
+    }
+    return luma > 0 || chroma > 0 ? 1 : 0;
+}
+
+void ResamplerRunNV12(ResamplerNV12Plan *plan,
+                      const uint8_t *srcY,
+                      size_t srcYStride,
+                      const uint8_t *srcUV,
+                      size_t srcUVStride,
+                      uint8_t *dstY,
+                      size_t dstYStride,
+                      uint8_t *dstUV,
+                      size_t dstUVStride,
+                      int parallel) {
+    ResamplerRun(&plan->luma, srcY, srcYStride, dstY, dstYStride, parallel);
+    ResamplerRun(&plan->chroma, srcUV, srcUVStride, dstUV, dstUVStride, parallel);
+}
@@ -0,0 +1,125 @@
+//
+//  Resampler.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 18/10/2026.
+//
+
+#ifndef RESAMPLER_H
+#define RESAMPLER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    ResamplerKernelBox = 0,       // Exact area average; nearest when enlarging
+    ResamplerKernelBilinear = 1,  // Triangle, 2 taps when enlarging
+    ResamplerKernelBicubic = 2,   // Catmull-Rom, 4 taps when enlarging
+    ResamplerKernelLanczos3 = 3   // 6 taps when enlarging
+} ResamplerKernel;
+
+// Coefficients for one axis. Every output has `taps` weights (Q14, summing
+// to 1 << 14) applied to source indices start[i] .. start[i] + taps - 1.
+typedef struct {
+    int *start;
+    int16_t *weights;
+    int taps;
+    int srcSize;
+    int dstSize;
+} ResamplerAxis;
+
+typedef struct {
+    uint64_t builds;   // Coefficient tables computed
+    uint64_t reuses;   // Prepare calls served by the existing tables
+    uint64_t frames;
+} ResamplerStats;
+
+/**
+ * Separable resize of an interleaved 8-bit plane (1, 2 or 4 channels).
+ *
+ * ResamplerPlanPrepare computes both axes' coefficient tables once per
+ * (kernel, sizes, channels); calling it again with the same arguments costs
+ * nothing. When shrinking, kernels are widened by the scale factor so they
+ * also filter out aliasing.
+ *
+ * The output is split into `bands` row bands. Each band runs the
+ * horizontal pass over just the source rows it needs into its own 16-bit
+ * scratch, then the vertical pass. Bands are independent, so they run in
+ * parallel on the shared TaskScheduler. The inner loops are NEON on ARM
+ * with a scalar fallback.
+ */
+typedef struct {
+    ResamplerKernel kernel;
+    int srcWidth;
+    int srcHeight;
+    int dstWidth;
+    int dstHeight;
+    int channels;
+    int bands;
+    ResamplerAxis x;
+    ResamplerAxis y;
+    int *bandRows;          // bands + 1 output row boundaries
+    int16_t *scratch;       // bands * scratchPerBand intermediate values
+    size_t scratchPerBand;
+    ResamplerStats stats;
+} ResamplerPlan;
+
+void ResamplerPlanInit(ResamplerPlan *plan);
+void ResamplerPlanFree(ResamplerPlan *plan);
+
+/**
+ * @return 1 if the tables were (re)built, 0 if the existing ones match,
+ *         -1 on invalid arguments or allocation failure
+ */
+int ResamplerPlanPrepare(ResamplerPlan *plan,
+                         ResamplerKernel kernel,
+                         int srcWidth,
+                         int srcHeight,
+                         int dstWidth,
+                         int dstHeight,
+                         int channels,
+                         int bands);
+
+/// parallel = 0 runs every band on the calling thread
+void ResamplerRun(ResamplerPlan *plan,
+                  const uint8_t *src,
+                  size_t srcStride,
+                  uint8_t *dst,
+                  size_t dstStride,
+                  int parallel);
+
+/// Luma and interleaved CbCr plans for NV12 (chroma at half size, rounded up)
+typedef struct {
+    ResamplerPlan luma;
+    ResamplerPlan chroma;
+} ResamplerNV12Plan;
+
+void ResamplerNV12PlanInit(ResamplerNV12Plan *plan);
+void ResamplerNV12PlanFree(ResamplerNV12Plan *plan);
+int ResamplerNV12PlanPrepare(ResamplerNV12Plan *plan,
+                             ResamplerKernel kernel,
+                             int srcWidth,
+                             int srcHeight,
+                             int dstWidth,
+                             int dstHeight,
+                             int bands);
+void ResamplerRunNV12(ResamplerNV12Plan *plan,
+                      const uint8_t *srcY,
+                      size_t srcYStride,
+                      const uint8_t *srcUV,
+                      size_t srcUVStride,
+                      uint8_t *dstY,
+                      size_t dstYStride,
+                      uint8_t *dstUV,
+                      size_t dstUVStride,
+                      int parallel);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RESAMPLER_H */
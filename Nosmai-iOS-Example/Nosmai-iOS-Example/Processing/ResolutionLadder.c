@@ -0,0 +1,164 @@
+//
+//  ResolutionLadder.c
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 18/10/2026.
+//
+
+#include "ResolutionLadder.h"
+
+#include <string.h>
+#include <time.h>
+
+static double ResolutionLadderNowMs(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1000.0 + (double)ts.tv_nsec / 1.0e6;
+}
+
+static int ResolutionLadderPlaneCount(ResolutionLadderFormat format) {
+    return format == ResolutionLadderFormatNV12 ? 2 : 1;
+}
+
+// Plane dimensions and channels for a width x height image.
+static void ResolutionLadderPlaneSize(ResolutionLadderFormat format, int plane, int width, int height,
+                                      int *planeWidth, int *planeHeight, int *channels) {
+    if (format == ResolutionLadderFormatRGBA) {
+        *planeWidth = width;
+        *planeHeight = height;
+        *channels = 4;
+    } else if (plane == 0) {
+        *planeWidth = width;
+        *planeHeight = height;
+        *channels = 1;
+    } else {
+        *planeWidth = (width + 1) / 2;
+        *planeHeight = (height + 1) / 2;
+        *channels = 2;
+    }
+}
+
+void ResolutionLadderInit(ResolutionLadder *ladder) {
+    memset(ladder, 0, sizeof(*ladder));
+    for (int i = 0; i < RESOLUTION_LADDER_MAX_OUTPUTS; i++) {
+        ResamplerPlanInit(&ladder->plans[i][0]);
+        ResamplerPlanInit(&ladder->plans[i][1]);
+    }
+    ImagePyramidInit(&ladder->pyramids[0]);
+    ImagePyramidInit(&ladder->pyramids[1]);
+}
+
+void ResolutionLadderFree(ResolutionLadder *ladder) {
+    for (int i = 0; i < RESOLUTION_LADDER_MAX_OUTPUTS; i++) {
+        ResamplerPlanFree(&ladder->plans[i][0]);
+        ResamplerPlanFree(&ladder->plans[i][1]);
+    }
+    ImagePyramidFree(&ladder->pyramids[0]);
+    ImagePyramidFree(&ladder->pyramids[1]);
+    memset(ladder, 0, sizeof(*ladder));
+}
+
+int ResolutionLadderConfigure(ResolutionLadder *ladder,
+                              ResolutionLadderFormat format,
+                              ResamplerKernel kernel,
+                              const int *widths,
+                              const int *heights,
+                              int count,
+                              int bands) {
+    if (count < 0 || count > RESOLUTION_LADDER_MAX_OUTPUTS) {
+        return -1;
+    }
+    for (int i = 0; i < count; i++) {
+        if (widths[i] <= 0 || heights[i] <= 0) {
+            return -1;
+        }
+    }
+    ladder->format = format;
+    ladder->kernel = kernel;
+    ladder->bands = bands;
+    ladder->count = count;
+    for (int i = 0; i < count; i++) {
+        ladder->widths[i] = widths[i];
+        ladder->heights[i] = heights[i];
+    }
+    return 0;
+}
+
+int ResolutionLadderIsPassthrough(const ResolutionLadder *ladder, int index, int width, int height) {
+    return ladder->widths[index] == width && ladder->heights[index] == height;
+}
+
+// Resizes one plane of output `index` from the smallest pyramid level that covers it.
+static int ResolutionLadderResizePlane(ResolutionLadder *ladder, int index, int plane, int parallel,
+                                       uint8_t *dst, size_t dstStride) {
+    int width, height, channels;
+    ResolutionLadderPlaneSize(ladder->format, plane, ladder->widths[index], ladder->heights[index],
+                              &width, &height, &channels);
+    ImagePyramidLevel level;
+    if (ImagePyramidGetLevelForSize(&ladder->pyramids[plane], width, height, &level) != 0) {
+        return -1;
+    }
+    ResamplerPlan *resampler = &ladder->plans[index][plane];
+    if (ResamplerPlanPrepare(resampler, ladder->kernel, level.width, level.height, width, height, channels,
+                             ladder->bands) < 0) {
+        return -1;
+    }
+    ResamplerRun(resampler, level.pixels, level.stride, dst, dstStride, parallel);
+    if (plane == 0) {
+        const ImagePyramidLevel *full = &ladder->pyramids[0].levels[0];
+        ladder->stats.resizeSourcePixels += (uint64_t)level.width * (uint64_t)level.height;
+        ladder->stats.directSourcePixels += (uint64_t)full->width * (uint64_t)full->height;
+    }
+    return 0;
+}
+
+int ResolutionLadderRun(ResolutionLadder *ladder,
+                        const ResolutionLadderImage *frame,
+                        int width,
+                        int height,
+                        ResolutionLadderImage *outputs,
+                        int parallel) {
+    double start = ResolutionLadderNowMs();
+    int planes = ResolutionLadderPlaneCount(ladder->format);
+    for (int plane = 0; plane < planes; plane++) {
+        int planeWidth, planeHeight, channels;
+        ResolutionLadderPlaneSize(ladder->format, plane, width, height, &planeWidth, &planeHeight, &channels);
+        ImagePyramidBeginFrame(&ladder->pyramids[plane], frame->planes[plane], frame->strides[plane],
+                               planeWidth, planeHeight, channels);
+    }
+
+    int result = 0;
+    for (int i = 0; i < ladder->count && result == 0; i++) {
+        if (ResolutionLadderIsPassthrough(ladder, i, width, height)) {
+            outputs[i] = *frame;
+            ladder->stats.passthroughs++;
+            continue;
+        }
+        double outputStart = ResolutionLadderNowMs();
+        for (int plane = 0; plane < planes && result == 0; plane++) {
+            result = ResolutionLadderResizePlane(ladder, i, plane, parallel, outputs[i].planes[plane],
+                                                 outputs[i].strides[plane]);
+        }
+        ladder->outputMs[i] += ResolutionLadderNowMs() - outputStart;
+        ladder->stats.resizes++;
+    }
+
+    ladder->totalMs += ResolutionLadderNowMs() - start;
+    ladder->stats.frames++;
+    return result;
+}
+
+ResolutionLadderStats ResolutionLadderGetStats(ResolutionLadder *ladder) {
+    ResolutionLadderStats stats = ladder->stats;
+    ImagePyramidStats pyramid = ImagePyramidGetStats(&ladder->pyramids[0]);
+    for (int i = 1; i < IMAGE_PYRAMID_MAX_LEVELS; i++) {
+        stats.levelBuilds += pyramid.levelBuilds[i];
+    }
+    if (stats.frames > 0) {
+        stats.averageMs = ladder->totalMs / (double)stats.frames;
+        for (int i = 0; i < ladder->count; i++) {
+            stats.averageOutputMs[i] = ladder->outputMs[i] / (double)stats.frames;
+        }
+    }
+    return stats;
+}
@@ -0,0 +1,111 @@
+//
+//  ResolutionLadder.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 18/10/2026.
+//
+
+#ifndef RESOLUTION_LADDER_H
+#define RESOLUTION_LADDER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ImagePyramid.h"
+#include "Resampler.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define RESOLUTION_LADDER_MAX_OUTPUTS 8
+
+typedef enum {
+    ResolutionLadderFormatRGBA = 0,  // Any 4-byte pixel (RGBA, BGRA); planes[0] only
+    ResolutionLadderFormatNV12 = 1   // planes[0] Y, planes[1] interleaved CbCr
+} ResolutionLadderFormat;
+
+typedef struct {
+    uint8_t *planes[2];
+    size_t strides[2];
+} ResolutionLadderImage;
+
+typedef struct {
+    uint64_t frames;
+    uint64_t passthroughs;      // Outputs served by the frame itself
+    uint64_t resizes;
+    // Luma / RGBA plane only:
+    uint64_t levelBuilds;         // Shared pyramid levels computed
+    uint64_t resizeSourcePixels;  // Pixels the resizes read from their pyramid level
+    uint64_t directSourcePixels;  // Pixels the same resizes would read from the full frame
+    double averageMs;
+    double averageOutputMs[RESOLUTION_LADDER_MAX_OUTPUTS];  // Resize only, per output
+} ResolutionLadderStats;
+
+/**
+ * Several output sizes from one frame.
+ *
+ * The frame goes into a shared ImagePyramid (2x area steps, computed once
+ * per frame and only as deep as some output needs). Each output is then
+ * resampled from the smallest level that still covers it, so a thumbnail
+ * reads a few hundred rows instead of the whole frame, and outputs at the
+ * frame size are passed through without touching the pixels.
+ *
+ * Resampler plans are kept per output and reused while the sizes stay the
+ * same.
+ */
+typedef struct {
+    ResolutionLadderFormat format;
+    ResamplerKernel kernel;
+    int bands;
+    int count;
+    int widths[RESOLUTION_LADDER_MAX_OUTPUTS];
+    int heights[RESOLUTION_LADDER_MAX_OUTPUTS];
+    ResamplerPlan plans[RESOLUTION_LADDER_MAX_OUTPUTS][2];  // Per plane
+    ImagePyramid pyramids[2];                               // Per plane
+    ResolutionLadderStats stats;
+    double totalMs;
+    double outputMs[RESOLUTION_LADDER_MAX_OUTPUTS];
+} ResolutionLadder;
+
+void ResolutionLadderInit(ResolutionLadder *ladder);
+void ResolutionLadderFree(ResolutionLadder *ladder);
+
+/**
+ * Sets the output sizes. Outputs keep their index; a size equal to the
+ * frame's is a passthrough.
+ *
+ * @return 0 on success, -1 on invalid arguments
+ */
+int ResolutionLadderConfigure(ResolutionLadder *ladder,
+                              ResolutionLadderFormat format,
+                              ResamplerKernel kernel,
+                              const int *widths,
+                              const int *heights,
+                              int count,
+                              int bands);
+
+/// Output index is a passthrough for a width x height frame
+int ResolutionLadderIsPassthrough(const ResolutionLadder *ladder, int index, int width, int height);
+
+/**
+ * Produces every output of one width x height frame. outputs[i] supplies
+ * the destination planes of output i; for passthrough outputs it is set to
+ * the frame's own planes instead.
+ *
+ * @return 0 on success, -1 if a plan or pyramid level could not be allocated
+ */
+int ResolutionLadderRun(ResolutionLadder *ladder,
+                        const ResolutionLadderImage *frame,
+                        int width,
+                        int height,
+                        ResolutionLadderImage *outputs,
+                        int parallel);
+
+ResolutionLadderStats ResolutionLadderGetStats(ResolutionLadder *ladder);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RESOLUTION_LADDER_H */
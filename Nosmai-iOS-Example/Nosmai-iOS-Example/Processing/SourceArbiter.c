@@ -0,0 +1,201 @@
+//
+//  SourceArbiter.c
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#include "SourceArbiter.h"
+
+#include <string.h>
+
+void SourceArbiterInit(SourceArbiter *arbiter, SourceArbiterStrategy strategy) {
+    memset(arbiter, 0, sizeof(*arbiter));
+    arbiter->strategy = strategy;
+    arbiter->active = -1;
+    arbiter->switchFrom = -1;
+    arbiter->stats.active = -1;
+    pthread_mutex_init(&arbiter->mutex, NULL);
+}
+
+void SourceArbiterFree(SourceArbiter *arbiter) {
+    pthread_mutex_destroy(&arbiter->mutex);
+}
+
+static int SourceArbiterValid(int source) {
+    return source >= 0 && source < SOURCE_ARBITER_MAX_SOURCES;
+}
+
+// Both below are called with the mutex held.
+
+static void SourceArbiterBeginSwitch(SourceArbiter *arbiter, int source, double nowMs) {
+    if (!arbiter->switchPending) {
+        // A switch overtaken by another before its first frame still counts from the source on screen.
+        arbiter->switchFrom = arbiter->active;
+    }
+    arbiter->active = source;
+    arbiter->switchPending = 1;
+    arbiter->switchRequestedMs = nowMs;
+}
+
+static void SourceArbiterEnqueue(SourceArbiter *arbiter, int source, int resuming) {
+    if (!arbiter->waiting[source]) {
+        arbiter->waiting[source] = 1;
+        // A preempted source resumes ahead of sources that have never run.
+        arbiter->waitOrder[source] = resuming ? 0 : ++arbiter->sequence;
+        arbiter->stats.waiting++;
+    }
+}
+
+SourceRequestOutcome SourceArbiterRequest(SourceArbiter *arbiter,
+                                          int source,
+                                          int priority,
+                                          double nowMs,
+                                          SourceTransition *transition) {
+    transition->activate = -1;
+    transition->deactivate = -1;
+    if (!SourceArbiterValid(source)) {
+        return SourceRequestRejected;
+    }
+    SourceRequestOutcome outcome = SourceRequestActive;
+    pthread_mutex_lock(&arbiter->mutex);
+    arbiter->priorities[source] = priority;
+    if (arbiter->active == source) {
+        transition->activate = source;
+    } else if (arbiter->active < 0) {
+        SourceArbiterBeginSwitch(arbiter, source, nowMs);
+        transition->activate = source;
+    } else if (arbiter->waiting[source]) {
+        outcome = SourceRequestQueued;
+    } else {
+        int current = arbiter->active;
+        switch (arbiter->strategy) {
+            case SourceArbiterAutoStopPrevious:
+                transition->deactivate = current;
+                transition->activate = source;
+                SourceArbiterBeginSwitch(arbiter, source, nowMs);
+                break;
+            case SourceArbiterErrorOnConflict:
+                outcome = SourceRequestRejected;
+                arbiter->stats.rejected++;
+                break;
+            case SourceArbiterQueueRequest:
+                SourceArbiterEnqueue(arbiter, source, 0);
+                outcome = SourceRequestQueued;
+                arbiter->stats.queued++;
+                break;
+            case SourceArbiterPriorityBased:
+                if (priority > arbiter->priorities[current]) {
+                    SourceArbiterEnqueue(arbiter, current, 1);
+                    transition->deactivate = current;
+                    transition->activate = source;
+                    SourceArbiterBeginSwitch(arbiter, source, nowMs);
+                    arbiter->stats.preemptions++;
+                } else {
+                    SourceArbiterEnqueue(arbiter, source, 0);
+                    outcome = SourceRequestQueued;
+                    arbiter->stats.queued++;
+                }
+                break;
+        }
+    }
+    pthread_mutex_unlock(&arbiter->mutex);
+    return outcome;
+}
+
+void SourceArbiterRelease(SourceArbiter *arbiter, int source, double nowMs, SourceTransition *transition) {
+    transition->activate = -1;
+    transition->deactivate = -1;
+    if (!SourceArbiterValid(source)) {
+        return;
+    }
+    pthread_mutex_lock(&arbiter->mutex);
+    if (arbiter->waiting[source]) {
+        arbiter->waiting[source] = 0;
+        arbiter->stats.waiting--;
+    } else if (arbiter->active == source) {
+        transition->deactivate = source;
+        int next = -1;
+        for (int i = 0; i < SOURCE_ARBITER_MAX_SOURCES; i++) {
+            if (!arbiter->waiting[i]) {
+                continue;
+            }
+            int better = next < 0 || arbiter->waitOrder[i] < arbiter->waitOrder[next];
+            if (arbiter->strategy == SourceArbiterPriorityBased && next >= 0 &&
+                arbiter->priorities[i] != arbiter->priorities[next]) {
+                better = arbiter->priorities[i] > arbiter->priorities[next];
+            }
+            if (better) {
+                next = i;
+            }
+        }
+        if (next >= 0) {
+            arbiter->waiting[next] = 0;
+            arbiter->stats.waiting--;
+            SourceArbiterBeginSwitch(arbiter, next, nowMs);
+            transition->activate = next;
+        } else {
+            // Nothing to wait for: going idle completes at once.
+            arbiter->active = -1;
+            arbiter->switchPending = 0;
+            arbiter->switchFrom = -1;
+        }
+    }
+    pthread_mutex_unlock(&arbiter->mutex);
+}
+
+// Caller holds the mutex.
+static void SourceArbiterCompleteSwitch(SourceArbiter *arbiter, double nowMs, double *switchMs, int *previous) {
+    if (!arbiter->switchPending) {
+        return;
+    }
+    double elapsed = nowMs - arbiter->switchRequestedMs;
+    arbiter->switchPending = 0;
+    arbiter->stats.switches++;
+    arbiter->stats.lastSwitchMs = elapsed;
+    arbiter->stats.maxSwitchMs = elapsed > arbiter->stats.maxSwitchMs ? elapsed : arbiter->stats.maxSwitchMs;
+    arbiter->totalSwitchMs += elapsed;
+    *switchMs = elapsed;
+    *previous = arbiter->switchFrom;
+}
+
+int SourceArbiterAdmitFrame(SourceArbiter *arbiter, int source, double nowMs, double *switchMs, int *previous) {
+    *switchMs = -1.0;
+    *previous = -1;
+    pthread_mutex_lock(&arbiter->mutex);
+    int admitted = source == arbiter->active;
+    if (!admitted) {
+        arbiter->stats.framesDropped++;
+    } else {
+        arbiter->stats.framesAdmitted++;
+        SourceArbiterCompleteSwitch(arbiter, nowMs, switchMs, previous);
+    }
+    pthread_mutex_unlock(&arbiter->mutex);
+    return admitted;
+}
+
+void SourceArbiterObserveFrame(SourceArbiter *arbiter, int source, double nowMs, double *switchMs, int *previous) {
+    *switchMs = -1.0;
+    *previous = -1;
+    pthread_mutex_lock(&arbiter->mutex);
+    if (source == arbiter->active) {
+        SourceArbiterCompleteSwitch(arbiter, nowMs, switchMs, previous);
+    }
+    pthread_mutex_unlock(&arbiter->mutex);
+}
+
+int SourceArbiterActiveSource(SourceArbiter *arbiter) {
+    pthread_mutex_lock(&arbiter->mutex);
+    int active = arbiter->active;
+    pthread_mutex_unlock(&arbiter->mutex);
+    return active;
+}
+
+SourceArbiterStats SourceArbiterGetStats(SourceArbiter *arbiter) {
+    pthread_mutex_lock(&arbiter->mutex);
+    SourceArbiterStats stats = arbiter->stats;
+    stats.active = arbiter->active;
+    stats.averageSwitchMs = stats.switches > 0 ? arbiter->totalSwitchMs / (double)stats.switches : 0.0;
+    pthread_mutex_unlock(&arbiter->mutex);
+    return stats;
+}
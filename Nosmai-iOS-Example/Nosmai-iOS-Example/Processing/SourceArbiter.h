@@ -0,0 +1,121 @@
+//
+//  SourceArbiter.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#ifndef SOURCE_ARBITER_H
+#define SOURCE_ARBITER_H
+
+#include <pthread.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SOURCE_ARBITER_MAX_SOURCES 8
+
+/// Same values as NosmaiConflictStrategy
+typedef enum {
+    SourceArbiterAutoStopPrevious = 0,  // The newcomer wins; the previous source is stopped, not queued
+    SourceArbiterErrorOnConflict = 1,   // The newcomer is rejected while another source is active
+    SourceArbiterQueueRequest = 2,      // The newcomer waits; sources take turns in request order
+    SourceArbiterPriorityBased = 3      // A higher priority preempts; the preempted source waits to resume
+} SourceArbiterStrategy;
+
+typedef enum {
+    SourceRequestRejected = -1,
+    SourceRequestActive = 0,
+    SourceRequestQueued = 1
+} SourceRequestOutcome;
+
+/// What the caller has to do after a request or release; -1 for nothing
+typedef struct {
+    int activate;
+    int deactivate;
+} SourceTransition;
+
+typedef struct {
+    int active;                // -1 when no source is active
+    int waiting;               // Sources queued behind it
+    uint64_t switches;         // Completed: the new source delivered its first frame
+    uint64_t queued;
+    uint64_t rejected;
+    uint64_t preemptions;
+    uint64_t framesAdmitted;
+    uint64_t framesDropped;    // From sources that were not active
+    double lastSwitchMs;       // Request -> first frame of the new source
+    double averageSwitchMs;
+    double maxSwitchMs;
+} SourceArbiterStats;
+
+/**
+ * Decides which of several competing input sources feeds the one
+ * processing pipeline, per NosmaiConflictStrategy.
+ *
+ * The arbiter only decides; the caller starts and stops capture as told
+ * by the returned transition and passes every frame through
+ * SourceArbiterAdmitFrame, which drops frames from inactive sources. The
+ * pipeline itself is never torn down, so a switch costs only the new
+ * source's start-up. Sources are small integers (NosmaiInputSourceType)
+ * below SOURCE_ARBITER_MAX_SOURCES. Thread-safe.
+ */
+typedef struct {
+    pthread_mutex_t mutex;
+    SourceArbiterStrategy strategy;
+    // Guarded by mutex.
+    int active;
+    int priorities[SOURCE_ARBITER_MAX_SOURCES];
+    int waiting[SOURCE_ARBITER_MAX_SOURCES];
+    uint64_t waitOrder[SOURCE_ARBITER_MAX_SOURCES];
+    uint64_t sequence;
+    int switchPending;
+    int switchFrom;
+    double switchRequestedMs;
+    double totalSwitchMs;
+    SourceArbiterStats stats;
+} SourceArbiter;
+
+void SourceArbiterInit(SourceArbiter *arbiter, SourceArbiterStrategy strategy);
+void SourceArbiterFree(SourceArbiter *arbiter);
+
+/**
+ * Asks for source to become the active one. Requesting the active source
+ * again updates its priority and asks for it to be re-activated (after an
+ * outside stop) without counting a switch.
+ */
+SourceRequestOutcome SourceArbiterRequest(SourceArbiter *arbiter,
+                                          int source,
+                                          int priority,
+                                          double nowMs,
+                                          SourceTransition *transition);
+
+/// Withdraws source, active or queued; the next waiting source, if any, takes over
+void SourceArbiterRelease(SourceArbiter *arbiter, int source, double nowMs, SourceTransition *transition);
+
+/**
+ * @param switchMs Set to the switch latency when this frame completes a
+ *                 switch, otherwise to -1
+ * @param previous Set to the source switched away from (-1 for none)
+ * @return 1 if the frame is from the active source and should be processed
+ */
+int SourceArbiterAdmitFrame(SourceArbiter *arbiter, int source, double nowMs, double *switchMs, int *previous);
+
+/**
+ * For a frame that was processed before the arbiter could hold it back:
+ * completes a pending switch to source like an admitted frame, but is
+ * neither admitted nor dropped in the statistics.
+ */
+void SourceArbiterObserveFrame(SourceArbiter *arbiter, int source, double nowMs, double *switchMs, int *previous);
+
+int SourceArbiterActiveSource(SourceArbiter *arbiter);
+
+SourceArbiterStats SourceArbiterGetStats(SourceArbiter *arbiter);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SOURCE_ARBITER_H */
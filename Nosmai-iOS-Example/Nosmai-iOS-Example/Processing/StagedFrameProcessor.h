@@ -0,0 +1,70 @@
+//
+//  StagedFrameProcessor.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 18/10/2026.
+//
+
+#import <Foundation/Foundation.h>
+#import <CoreVideo/CoreVideo.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// One stage's work on a frame. Return NO to abandon the frame
+typedef BOOL (^StagedFrameStage)(CVPixelBufferRef pixelBuffer, double timestamp);
+
+/**
+ * External-frame processing split into explicit stages (upload, face
+ * detection, render, readback, delivery...) that overlap across
+ * consecutive frames, on top of FramePipeline.
+ *
+ * framesInFlight sets the trade-off: 1 is the low-latency mode (each frame
+ * runs through every stage before the next is accepted), 2 or 3 the
+ * throughput mode (while one frame renders the next is already being
+ * uploaded, bounded by the slowest stage). Frames that arrive while every
+ * slot is in flight are dropped, the way a camera drops late frames.
+ *
+ * The example app does not use it: camera frames are processed by the SDK
+ * itself, and the -NosmaiInputFile frames go one at a time through
+ * InputSourceArbiter.
+ */
+@interface StagedFrameProcessor : NSObject
+
+/// Can be changed while running. Default 2
+@property (nonatomic, assign) NSInteger framesInFlight;
+
+@property (nonatomic, readonly) BOOL isRunning;
+
+/// Called on the last stage's thread once a frame is through (NO if a stage abandoned it)
+@property (nonatomic, copy, nullable) void (^frameCompletion)(CVPixelBufferRef pixelBuffer, double timestamp, BOOL completed);
+
+/**
+ * submitted, completed, droppedFrames, abandoned, framesInFlight, inFlight,
+ * maxInFlight, averageLatencyMs, p50LatencyMs, p95LatencyMs, maxLatencyMs,
+ * stages (name -> averageMs / maxMs / frames) and settings (frames in
+ * flight -> throughputFps / averageLatencyMs / completed, for every setting
+ * used so far)
+ */
+@property (nonatomic, readonly) NSDictionary<NSString *, id> *statistics;
+
+/// Stages run in the order added. Add them before -start
+- (void)addStageNamed:(NSString *)name block:(StagedFrameStage)block;
+
+/// Filter render stage: -[NosmaiSDK processFrame:mirror:] on the stage's own thread
+- (void)addRenderStageWithMirror:(BOOL)mirror;
+
+/// @return NO without stages or if already running
+- (BOOL)start;
+
+/// Lets every accepted frame finish
+- (void)stop;
+
+/// @return NO if the frame was dropped
+- (BOOL)submitPixelBuffer:(CVPixelBufferRef)pixelBuffer timestamp:(double)timestamp;
+
+/// -[NosmaiSDK getProcessingMetrics] with the pipeline's statistics under "pipeline"
+- (NSDictionary *)processingMetrics;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,247 @@
+//
+//  StagedFrameProcessor.m
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 18/10/2026.
+//
+
+#import "StagedFrameProcessor.h"
+#import <nosmai/Nosmai.h>
+#import <os/lock.h>
+#include <stdatomic.h>
+#include "FramePipeline.h"
+
+// How often stop polls for submits still in progress.
+static const useconds_t kSubmitWaitUs = 1000;
+
+typedef struct {
+    CVPixelBufferRef pixelBuffer;
+    double timestamp;
+} StagedFrameItem;
+
+@interface StagedFrameStageEntry : NSObject
+@property (nonatomic, copy) NSString *name;
+@property (nonatomic, copy) StagedFrameStage block;
+@end
+
+@implementation StagedFrameStageEntry
+@end
+
+static int StagedFrameRunStage(void *context, void *item) {
+    StagedFrameStageEntry *entry = (__bridge StagedFrameStageEntry *)context;
+    StagedFrameItem *frame = item;
+    @autoreleasepool {
+        return entry.block(frame->pixelBuffer, frame->timestamp) ? 0 : -1;
+    }
+}
+
+static void StagedFrameComplete(void *context, void *item, int completed) {
+    StagedFrameProcessor *processor = (__bridge StagedFrameProcessor *)context;
+    StagedFrameItem *frame = item;
+    void (^completion)(CVPixelBufferRef, double, BOOL) = processor.frameCompletion;
+    if (completion) {
+        completion(frame->pixelBuffer, frame->timestamp, completed != 0);
+    }
+    CVPixelBufferRelease(frame->pixelBuffer);
+    free(frame);
+}
+
+@implementation StagedFrameProcessor {
+    os_unfair_lock _lock;
+    FramePipeline _pipeline;
+    atomic_bool _accepting;
+    atomic_int _activeProducers;
+
+    // Guarded by _lock.
+    NSArray<StagedFrameStageEntry *> *_stages;
+    BOOL _running;
+    FramePipelineStats _lastStats;
+}
+
+- (instancetype)init {
+    self = [super init];
+    if (self) {
+        _lock = OS_UNFAIR_LOCK_INIT;
+        _framesInFlight = 2;
+        _stages = @[];
+        atomic_init(&_accepting, false);
+        atomic_init(&_activeProducers, 0);
+    }
+    return self;
+}
+
+- (void)dealloc {
+    [self stop];
+}
+
+- (BOOL)isRunning {
+    os_unfair_lock_lock(&_lock);
+    BOOL running = _running;
+    os_unfair_lock_unlock(&_lock);
+    return running;
+}
+
+- (void)setFramesInFlight:(NSInteger)framesInFlight {
+    _framesInFlight = MAX(1, MIN(framesInFlight, (NSInteger)FRAME_PIPELINE_MAX_IN_FLIGHT));
+    os_unfair_lock_lock(&_lock);
+    if (_running) {
+        FramePipelineSetFramesInFlight(&_pipeline, (int)_framesInFlight);
+    }
+    os_unfair_lock_unlock(&_lock);
+}
+
+#pragma mark - Stages
+
+- (void)addStageNamed:(NSString *)name block:(StagedFrameStage)block {
+    StagedFrameStageEntry *entry = [[StagedFrameStageEntry alloc] init];
+    entry.name = name;
+    entry.block = block;
+    os_unfair_lock_lock(&_lock);
+    if (!_running && _stages.count < FRAME_PIPELINE_MAX_STAGES) {
+        _stages = [_stages arrayByAddingObject:entry];
+    }
+    os_unfair_lock_unlock(&_lock);
+}
+
+- (void)addRenderStageWithMirror:(BOOL)mirror {
+    [self addStageNamed:@"render" block:^BOOL(CVPixelBufferRef pixelBuffer, double timestamp) {
+        return [[NosmaiSDK sharedInstance] processFrame:pixelBuffer mirror:mirror];
+    }];
+}
+
+#pragma mark - Lifecycle
+
+- (BOOL)start {
+    os_unfair_lock_lock(&_lock);
+    NSArray<StagedFrameStageEntry *> *stages = _stages;
+    BOOL running = _running;
+    os_unfair_lock_unlock(&_lock);
+    if (running || stages.count == 0) {
+        return NO;
+    }
+
+    FramePipelineConfig config;
+    memset(&config, 0, sizeof(config));
+    for (NSUInteger i = 0; i < stages.count; i++) {
+        config.stages[i] = (FramePipelineStage){stages[i].name.UTF8String, StagedFrameRunStage, (__bridge void *)stages[i]};
+    }
+    config.stageCount = (int)stages.count;
+    config.framesInFlight = (int)self.framesInFlight;
+    config.onComplete = StagedFrameComplete;
+    config.completeContext = (__bridge void *)self;
+
+    os_unfair_lock_lock(&_lock);
+    _running = FramePipelineStart(&_pipeline, &config) == 0;
+    running = _running;
+    os_unfair_lock_unlock(&_lock);
+    if (running) {
+        atomic_store(&_accepting, true);
+    }
+    return running;
+}
+
+- (void)stop {
+    os_unfair_lock_lock(&_lock);
+    BOOL running = _running;
+    if (running) {
+        // Statistics read the snapshot from here on, so the pipeline can drain unlocked.
+        _lastStats = FramePipelineGetStats(&_pipeline);
+        _running = NO;
+    }
+    os_unfair_lock_unlock(&_lock);
+    if (!running) {
+        return;
+    }
+    atomic_store(&_accepting, false);
+    while (atomic_load(&_activeProducers) > 0) {
+        usleep(kSubmitWaitUs);
+    }
+    FramePipelineStop(&_pipeline);
+    os_unfair_lock_lock(&_lock);
+    _lastStats = FramePipelineGetStats(&_pipeline);
+    os_unfair_lock_unlock(&_lock);
+}
+
+- (BOOL)beginProducing {
+    atomic_fetch_add(&_activeProducers, 1);
+    if (!atomic_load(&_accepting)) {
+        atomic_fetch_sub(&_activeProducers, 1);
+        return NO;
+    }
+    return YES;
+}
+
+- (void)endProducing {
+    atomic_fetch_sub(&_activeProducers, 1);
+}
+
+- (BOOL)submitPixelBuffer:(CVPixelBufferRef)pixelBuffer timestamp:(double)timestamp {
+    if (![self beginProducing]) {
+        return NO;
+    }
+    StagedFrameItem *frame = malloc(sizeof(StagedFrameItem));
+    BOOL accepted = NO;
+    if (frame) {
+        frame->pixelBuffer = CVPixelBufferRetain(pixelBuffer);
+        frame->timestamp = timestamp;
+        accepted = FramePipelineSubmit(&_pipeline, frame) == 0;
+        if (!accepted) {
+            CVPixelBufferRelease(pixelBuffer);
+            free(frame);
+        }
+    }
+    [self endProducing];
+    return accepted;
+}
+
+#pragma mark - Metrics
+
+- (NSDictionary<NSString *, id> *)statistics {
+    os_unfair_lock_lock(&_lock);
+    FramePipelineStats stats = _running ? FramePipelineGetStats(&_pipeline) : _lastStats;
+    NSArray<StagedFrameStageEntry *> *entries = _stages;
+    os_unfair_lock_unlock(&_lock);
+
+    NSMutableDictionary *stages = [NSMutableDictionary dictionary];
+    for (NSUInteger i = 0; i < entries.count; i++) {
+        stages[entries[i].name] = @{
+            @"averageMs": @(stats.stages[i].averageMs),
+            @"maxMs": @(stats.stages[i].maxMs),
+            @"frames": @(stats.stages[i].frames),
+        };
+    }
+    NSMutableDictionary *settings = [NSMutableDictionary dictionary];
+    for (int depth = 1; depth <= FRAME_PIPELINE_MAX_IN_FLIGHT; depth++) {
+        if (stats.depths[depth].activeMs <= 0.0) {
+            continue;
+        }
+        settings[[NSString stringWithFormat:@"%d", depth]] = @{
+            @"throughputFps": @(stats.depths[depth].throughputFps),
+            @"averageLatencyMs": @(stats.depths[depth].averageLatencyMs),
+            @"completed": @(stats.depths[depth].completed),
+        };
+    }
+    return @{
+        @"submitted": @(stats.submitted),
+        @"completed": @(stats.completed),
+        @"droppedFrames": @(stats.dropped),
+        @"abandoned": @(stats.abandoned),
+        @"framesInFlight": @(stats.framesInFlight),
+        @"inFlight": @(stats.inFlight),
+        @"maxInFlight": @(stats.maxInFlight),
+        @"averageLatencyMs": @(stats.averageLatencyMs),
+        @"p50LatencyMs": @(stats.p50LatencyMs),
+        @"p95LatencyMs": @(stats.p95LatencyMs),
+        @"maxLatencyMs": @(stats.maxLatencyMs),
+        @"stages": stages,
+        @"settings": settings,
+    };
+}
+
+- (NSDictionary *)processingMetrics {
+    NSMutableDictionary *metrics = [[[NosmaiSDK sharedInstance] getProcessingMetrics] mutableCopy] ?: [NSMutableDictionary dictionary];
+    metrics[@"pipeline"] = self.statistics;
+    return metrics;
+}
+
+@end
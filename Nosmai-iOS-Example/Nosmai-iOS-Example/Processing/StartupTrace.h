@@ -0,0 +1,44 @@
+//
+//  StartupTrace.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * Machine-readable trace of app start-up, from process launch to the
+ * first filtered frame.
+ *
+ * Steps are named spans that may overlap (steps started together run in
+ * parallel); events are single points. The first filtered frame finishes
+ * the trace: it is logged and written as JSON to
+ * Caches/startup-trace.json with timeToFirstFilteredFrameMs, steps (name,
+ * startMs, endMs, durationMs) and events (name, timeMs), all in
+ * milliseconds since the process started. Thread-safe.
+ */
+@interface StartupTrace : NSObject
+
++ (instancetype)shared;
+
+/// nil until the trace is finished
+@property (nonatomic, readonly, nullable) NSURL *traceURL;
+@property (nonatomic, readonly, getter=isFinished) BOOL finished;
+
+/// A step begun again restarts; steps still open when the trace finishes are written without an end
+- (void)beginStep:(NSString *)name;
+- (void)endStep:(NSString *)name;
+- (void)markEvent:(NSString *)name;
+
+/// Finishes the trace; later calls are ignored, so it can be called for every frame
+- (void)markFirstFilteredFrame;
+
+/// The trace so far, in the JSON layout
+- (NSDictionary<NSString *, id> *)traceDictionary;
+
+@end
+
+NS_ASSUME_NONNULL_END
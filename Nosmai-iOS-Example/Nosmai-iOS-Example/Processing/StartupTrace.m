@@ -0,0 +1,168 @@
+//
+//  StartupTrace.m
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#import "StartupTrace.h"
+#import <os/lock.h>
+#include <stdatomic.h>
+#include <sys/sysctl.h>
+#include <sys/time.h>
+#include <time.h>
+#include <unistd.h>
+
+static double StartupTraceNowMs(void) {
+    return (double)clock_gettime_nsec_np(CLOCK_UPTIME_RAW) / 1.0e6;
+}
+
+/// Milliseconds the process had been running when called, from the kernel's record of its start
+static double StartupTraceProcessAgeMs(void) {
+    struct kinfo_proc info;
+    size_t size = sizeof(info);
+    int mib[4] = {CTL_KERN, KERN_PROC, KERN_PROC_PID, getpid()};
+    if (sysctl(mib, 4, &info, &size, NULL, 0) != 0) {
+        return 0.0;
+    }
+    struct timeval now;
+    gettimeofday(&now, NULL);
+    struct timeval start = info.kp_proc.p_starttime;
+    return (double)(now.tv_sec - start.tv_sec) * 1000.0 + (double)(now.tv_usec - start.tv_usec) / 1000.0;
+}
+
+@implementation StartupTrace {
+    os_unfair_lock _lock;
+    double _originMs;  // Uptime clock reading at process start
+    atomic_bool _finished;
+    // Guarded by _lock.
+    NSMutableArray<NSMutableDictionary<NSString *, id> *> *_steps;
+    NSMutableArray<NSDictionary<NSString *, id> *> *_events;
+    double _firstFrameMs;
+    NSURL *_traceURL;
+}
+
++ (instancetype)shared {
+    static StartupTrace *shared;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        shared = [[StartupTrace alloc] init];
+    });
+    return shared;
+}
+
+- (instancetype)init {
+    self = [super init];
+    if (self) {
+        _lock = OS_UNFAIR_LOCK_INIT;
+        _originMs = StartupTraceNowMs() - StartupTraceProcessAgeMs();
+        atomic_init(&_finished, false);
+        _steps = [NSMutableArray array];
+        _events = [NSMutableArray array];
+        _firstFrameMs = -1.0;
+    }
+    return self;
+}
+
+- (double)elapsedMs {
+    return StartupTraceNowMs() - _originMs;
+}
+
+- (BOOL)isFinished {
+    return atomic_load(&_finished);
+}
+
+- (nullable NSURL *)traceURL {
+    os_unfair_lock_lock(&_lock);
+    NSURL *url = _traceURL;
+    os_unfair_lock_unlock(&_lock);
+    return url;
+}
+
+#pragma mark - Recording
+
+- (void)beginStep:(NSString *)name {
+    if (self.isFinished) return;
+    double now = [self elapsedMs];
+    os_unfair_lock_lock(&_lock);
+    NSUInteger index = [_steps indexOfObjectPassingTest:^BOOL(NSMutableDictionary<NSString *, id> *step, NSUInteger idx, BOOL *stop) {
+        return [step[@"name"] isEqualToString:name];
+    }];
+    if (index != NSNotFound) [_steps removeObjectAtIndex:index];
+    [_steps addObject:[@{@"name": [name copy], @"startMs": @(now)} mutableCopy]];
+    os_unfair_lock_unlock(&_lock);
+}
+
+- (void)endStep:(NSString *)name {
+    if (self.isFinished) return;
+    double now = [self elapsedMs];
+    os_unfair_lock_lock(&_lock);
+    for (NSMutableDictionary<NSString *, id> *step in _steps) {
+        if ([step[@"name"] isEqualToString:name] && !step[@"endMs"]) {
+            step[@"endMs"] = @(now);
+            step[@"durationMs"] = @(now - [step[@"startMs"] doubleValue]);
+            break;
+        }
+    }
+    os_unfair_lock_unlock(&_lock);
+}
+
+- (void)markEvent:(NSString *)name {
+    if (self.isFinished) return;
+    double now = [self elapsedMs];
+    os_unfair_lock_lock(&_lock);
+    [_events addObject:@{@"name": [name copy], @"timeMs": @(now)}];
+    os_unfair_lock_unlock(&_lock);
+}
+
+- (void)markFirstFilteredFrame {
+    if (self.isFinished) return;
+    bool expected = false;
+    if (!atomic_compare_exchange_strong(&_finished, &expected, true)) return;
+    double now = [self elapsedMs];
+    os_unfair_lock_lock(&_lock);
+    _firstFrameMs = now;
+    os_unfair_lock_unlock(&_lock);
+
+    NSDictionary<NSString *, id> *trace = [self traceDictionary];
+    NSLog(@"⏱️ Startup: first filtered frame %.0f ms after launch", now);
+    for (NSDictionary<NSString *, id> *step in trace[@"steps"]) {
+        NSLog(@"⏱️ Startup step %@: %.0f -> %@ ms", step[@"name"], [step[@"startMs"] doubleValue],
+              step[@"endMs"] ? [NSString stringWithFormat:@"%.0f", [step[@"endMs"] doubleValue]] : @"open");
+    }
+
+    // Written off the frame path; the trace is complete and no longer changes.
+    dispatch_async(dispatch_get_global_queue(QOS_CLASS_UTILITY, 0), ^{
+        NSError *error = nil;
+        NSData *json = [NSJSONSerialization dataWithJSONObject:trace options:NSJSONWritingPrettyPrinted | NSJSONWritingSortedKeys error:&error];
+        NSURL *caches = [[NSFileManager defaultManager] URLsForDirectory:NSCachesDirectory inDomains:NSUserDomainMask].firstObject;
+        NSURL *url = [caches URLByAppendingPathComponent:@"startup-trace.json"];
+        if (!json || ![json writeToURL:url options:NSDataWritingAtomic error:&error]) {
+            NSLog(@"❌ Startup trace not written: %@", error.localizedDescription);
+            return;
+        }
+        os_unfair_lock_lock(&self->_lock);
+        self->_traceURL = url;
+        os_unfair_lock_unlock(&self->_lock);
+    });
+}
+
+- (NSDictionary<NSString *, id> *)traceDictionary {
+    os_unfair_lock_lock(&_lock);
+    NSMutableArray<NSDictionary<NSString *, id> *> *steps = [NSMutableArray arrayWithCapacity:_steps.count];
+    for (NSMutableDictionary<NSString *, id> *step in _steps) {
+        [steps addObject:[step copy]];
+    }
+    NSArray<NSDictionary<NSString *, id> *> *events = [_events copy];
+    double firstFrameMs = _firstFrameMs;
+    os_unfair_lock_unlock(&_lock);
+
+    NSMutableDictionary<NSString *, id> *trace = [NSMutableDictionary dictionary];
+    trace[@"version"] = @1;
+    trace[@"steps"] = steps;
+    trace[@"events"] = events;
+    if (firstFrameMs >= 0.0) trace[@"timeToFirstFilteredFrameMs"] = @(firstFrameMs);
+    return trace;
+}
+
+@end
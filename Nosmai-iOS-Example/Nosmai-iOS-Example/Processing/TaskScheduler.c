@@ -0,0 +1,471 @@
+//
+//  TaskScheduler.c
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#include "TaskScheduler.h"
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+// Idle workers and group waiters re-check at least this often.
+static const double kTaskSchedulerWaitMs = 10.0;
+static const size_t kTaskDequeInitialCapacity = 64;
+// Parallel-for never splits into more chunks than this per worker.
+static const size_t kTaskChunksPerWorker = 4;
+
+static _Thread_local TaskWorker *TaskSchedulerCurrentWorker;
+
+static double TaskSchedulerNowMs(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1000.0 + (double)ts.tv_nsec / 1.0e6;
+}
+
+static void TaskSchedulerTimedWait(pthread_cond_t *condition, pthread_mutex_t *mutex, double ms) {
+    struct timespec deadline;
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    long nanoseconds = deadline.tv_nsec + (long)(ms * 1.0e6);
+    deadline.tv_sec += nanoseconds / 1000000000L;
+    deadline.tv_nsec = nanoseconds % 1000000000L;
+    pthread_cond_timedwait(condition, mutex, &deadline);
+}
+
+static int TaskSchedulerBucket(double waitUs) {
+    if (waitUs < 1.0) {
+        return 0;
+    }
+    int exponent = (int)floor(log2(waitUs));
+    int sub = (int)((waitUs / ldexp(1.0, exponent) - 1.0) * 8.0);
+    int bucket = 1 + exponent * 8 + (sub > 7 ? 7 : sub);
+    return bucket < TASK_SCHEDULER_LATENCY_BUCKETS ? bucket : TASK_SCHEDULER_LATENCY_BUCKETS - 1;
+}
+
+// Upper edge of a bucket, in ms.
+static double TaskSchedulerBucketMs(int bucket) {
+    if (bucket == 0) {
+        return 0.001;
+    }
+    int exponent = (bucket - 1) / 8;
+    int sub = (bucket - 1) % 8;
+    return ldexp(1.0, exponent) * (1.0 + (sub + 1) / 8.0) / 1000.0;
+}
+
+static int TaskDequeInit(TaskDeque *deque) {
+    memset(deque, 0, sizeof(*deque));
+    deque->tasks = malloc(sizeof(Task) * kTaskDequeInitialCapacity);
+    if (!deque->tasks) {
+        return -1;
+    }
+    deque->capacity = kTaskDequeInitialCapacity;
+    pthread_mutex_init(&deque->mutex, NULL);
+    return 0;
+}
+
+static void TaskDequeFree(TaskDeque *deque) {
+    if (deque->tasks) {
+        pthread_mutex_destroy(&deque->mutex);
+        free(deque->tasks);
+    }
+    memset(deque, 0, sizeof(*deque));
+}
+
+static int TaskDequePush(TaskDeque *deque, const Task *task) {
+    pthread_mutex_lock(&deque->mutex);
+    if (deque->count == deque->capacity) {
+        size_t capacity = deque->capacity * 2;
+        Task *tasks = malloc(sizeof(Task) * capacity);
+        if (!tasks) {
+            pthread_mutex_unlock(&deque->mutex);
+            return -1;
+        }
+        for (size_t i = 0; i < deque->count; i++) {
+            tasks[i] = deque->tasks[(deque->head + i) % deque->capacity];
+        }
+        free(deque->tasks);
+        deque->tasks = tasks;
+        deque->capacity = capacity;
+        deque->head = 0;
+    }
+    deque->tasks[(deque->head + deque->count) % deque->capacity] = *task;
+    deque->count++;
+    pthread_mutex_unlock(&deque->mutex);
+    return 0;
+}
+
+// Owner end: newest first.
+static int TaskDequePopTail(TaskDeque *deque, Task *task) {
+    pthread_mutex_lock(&deque->mutex);
+    int found = deque->count > 0;
+    if (found) {
+        deque->count--;
+        *task = deque->tasks[(deque->head + deque->count) % deque->capacity];
+    }
+    pthread_mutex_unlock(&deque->mutex);
+    return found;
+}
+
+// Thief end: oldest first.
+static int TaskDequeTakeHead(TaskDeque *deque, Task *task) {
+    pthread_mutex_lock(&deque->mutex);
+    int found = deque->count > 0;
+    if (found) {
+        *task = deque->tasks[deque->head];
+        deque->head = (deque->head + 1) % deque->capacity;
+        deque->count--;
+    }
+    pthread_mutex_unlock(&deque->mutex);
+    return found;
+}
+
+static TaskWorker *TaskSchedulerSelf(TaskScheduler *scheduler) {
+    TaskWorker *worker = TaskSchedulerCurrentWorker;
+    return worker && worker->scheduler == scheduler ? worker : NULL;
+}
+
+static int TaskSchedulerHasWork(TaskScheduler *scheduler) {
+    return atomic_load(&scheduler->pending[TaskPriorityRealtime]) > 0 ||
+           (atomic_load(&scheduler->pending[TaskPriorityBackground]) > 0 &&
+            atomic_load(&scheduler->backgroundRunning) < scheduler->backgroundLimit);
+}
+
+static int TaskSchedulerReserveBackground(TaskScheduler *scheduler) {
+    int running = atomic_load(&scheduler->backgroundRunning);
+    while (running < scheduler->backgroundLimit) {
+        if (atomic_compare_exchange_weak(&scheduler->backgroundRunning, &running, running + 1)) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// Own deque first, then steal starting from the next worker along.
+static int TaskSchedulerTake(TaskScheduler *scheduler, TaskWorker *self, int lane, Task *task) {
+    if (atomic_load(&scheduler->pending[lane]) <= 0) {
+        return 0;
+    }
+    int found = self && TaskDequePopTail(&self->deques[lane], task);
+    if (!found) {
+        unsigned count = (unsigned)scheduler->workerCount;
+        unsigned start = self ? (unsigned)self->index + 1 : atomic_fetch_add(&scheduler->nextWorker, 1);
+        for (unsigned i = 0; i < count && !found; i++) {
+            TaskWorker *victim = &scheduler->workers[(start + i) % count];
+            if (victim != self) {
+                found = TaskDequeTakeHead(&victim->deques[lane], task);
+            }
+        }
+        if (found && self) {
+            atomic_fetch_add(&scheduler->steals, 1);
+        }
+    }
+    if (found) {
+        atomic_fetch_sub(&scheduler->pending[lane], 1);
+    }
+    return found;
+}
+
+static void TaskGroupFinish(TaskGroup *group) {
+    // Decremented under the mutex so a waiter that sees zero can destroy the group at once.
+    pthread_mutex_lock(&group->mutex);
+    if (atomic_fetch_sub(&group->pending, 1) == 1) {
+        pthread_cond_broadcast(&group->done);
+    }
+    pthread_mutex_unlock(&group->mutex);
+}
+
+static void TaskSchedulerRun(TaskScheduler *scheduler, int lane, Task *task) {
+    double waitUs = (TaskSchedulerNowMs() - task->submitMs) * 1000.0;
+    unsigned long long wait = waitUs > 0.0 ? (unsigned long long)waitUs : 0;
+    atomic_fetch_add(&scheduler->waitHistogram[lane][TaskSchedulerBucket(waitUs)], 1);
+    atomic_fetch_add(&scheduler->totalWaitUs[lane], wait);
+    unsigned long long max = atomic_load(&scheduler->maxWaitUs[lane]);
+    while (wait > max && !atomic_compare_exchange_weak(&scheduler->maxWaitUs[lane], &max, wait)) {
+    }
+
+    task->fn(task->context);
+    atomic_fetch_add(&scheduler->completed[lane], 1);
+    if (task->group) {
+        TaskGroupFinish(task->group);
+    }
+}
+
+static void *TaskWorkerMain(void *context) {
+    TaskWorker *self = context;
+    TaskScheduler *scheduler = self->scheduler;
+    TaskSchedulerCurrentWorker = self;
+    while (1) {
+        Task task;
+        if (TaskSchedulerTake(scheduler, self, TaskPriorityRealtime, &task)) {
+            TaskSchedulerRun(scheduler, TaskPriorityRealtime, &task);
+            continue;
+        }
+        if (TaskSchedulerReserveBackground(scheduler)) {
+            int found = TaskSchedulerTake(scheduler, self, TaskPriorityBackground, &task);
+            if (found) {
+                TaskSchedulerRun(scheduler, TaskPriorityBackground, &task);
+            }
+            atomic_fetch_sub(&scheduler->backgroundRunning, 1);
+            if (found) {
+                continue;
+            }
+        }
+        if (atomic_load(&scheduler->stopping) && atomic_load(&scheduler->pending[TaskPriorityRealtime]) <= 0 &&
+            atomic_load(&scheduler->pending[TaskPriorityBackground]) <= 0) {
+            break;
+        }
+
+        pthread_mutex_lock(&scheduler->sleepMutex);
+        atomic_fetch_add(&scheduler->sleepers, 1);
+        if (!TaskSchedulerHasWork(scheduler) && !atomic_load(&scheduler->stopping)) {
+            TaskSchedulerTimedWait(&scheduler->wake, &scheduler->sleepMutex, kTaskSchedulerWaitMs);
+        }
+        atomic_fetch_sub(&scheduler->sleepers, 1);
+        pthread_mutex_unlock(&scheduler->sleepMutex);
+    }
+    TaskSchedulerCurrentWorker = NULL;
+    return NULL;
+}
+
+int TaskSchedulerStart(TaskScheduler *scheduler, int workers, int backgroundWorkers) {
+    memset(scheduler, 0, sizeof(*scheduler));
+    if (workers <= 0) {
+        return -1;
+    }
+    workers = workers < TASK_SCHEDULER_MAX_WORKERS ? workers : TASK_SCHEDULER_MAX_WORKERS;
+    if (backgroundWorkers <= 0 || backgroundWorkers > workers) {
+        backgroundWorkers = workers > 1 ? workers - 1 : 1;
+    }
+    scheduler->backgroundLimit = backgroundWorkers;
+    pthread_mutex_init(&scheduler->sleepMutex, NULL);
+    pthread_cond_init(&scheduler->wake, NULL);
+
+    for (int i = 0; i < workers; i++) {
+        TaskWorker *worker = &scheduler->workers[i];
+        worker->scheduler = scheduler;
+        worker->index = i;
+        if (TaskDequeInit(&worker->deques[TaskPriorityRealtime]) != 0 ||
+            TaskDequeInit(&worker->deques[TaskPriorityBackground]) != 0) {
+            TaskDequeFree(&worker->deques[TaskPriorityRealtime]);
+            break;
+        }
+        scheduler->workerCount = i + 1;
+    }
+    // Threads start once every deque exists, since any of them may be stolen from.
+    for (int i = 0; i < scheduler->workerCount; i++) {
+        TaskWorker *worker = &scheduler->workers[i];
+        worker->started = pthread_create(&worker->thread, NULL, TaskWorkerMain, worker) == 0;
+    }
+    int started = 0;
+    for (int i = 0; i < scheduler->workerCount; i++) {
+        started += scheduler->workers[i].started;
+    }
+    if (started == 0) {
+        TaskSchedulerStop(scheduler);
+        return -1;
+    }
+    return 0;
+}
+
+void TaskSchedulerStop(TaskScheduler *scheduler) {
+    atomic_store(&scheduler->stopping, true);
+    pthread_mutex_lock(&scheduler->sleepMutex);
+    pthread_cond_broadcast(&scheduler->wake);
+    pthread_mutex_unlock(&scheduler->sleepMutex);
+    for (int i = 0; i < scheduler->workerCount; i++) {
+        if (scheduler->workers[i].started) {
+            pthread_join(scheduler->workers[i].thread, NULL);
+        }
+    }
+    for (int i = 0; i < scheduler->workerCount; i++) {
+        TaskDequeFree(&scheduler->workers[i].deques[TaskPriorityRealtime]);
+        TaskDequeFree(&scheduler->workers[i].deques[TaskPriorityBackground]);
+        scheduler->workers[i].started = 0;
+    }
+    scheduler->workerCount = 0;
+    pthread_cond_destroy(&scheduler->wake);
+    pthread_mutex_destroy(&scheduler->sleepMutex);
+}
+
+static TaskScheduler gSharedScheduler;
+static pthread_once_t gSharedSchedulerOnce = PTHREAD_ONCE_INIT;
+static int gSharedSchedulerStarted;
+
+static void TaskSchedulerStartShared(void) {
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    int workers = cores > 2 ? (int)cores : 2;
+    gSharedSchedulerStarted = TaskSchedulerStart(&gSharedScheduler, workers, workers - 1) == 0;
+}
+
+TaskScheduler *TaskSchedulerShared(void) {
+    pthread_once(&gSharedSchedulerOnce, TaskSchedulerStartShared);
+    return gSharedSchedulerStarted ? &gSharedScheduler : NULL;
+}
+
+static int TaskSchedulerEnqueue(TaskScheduler *scheduler, TaskPriority priority, TaskFn fn, void *context, TaskGroup *group) {
+    if (atomic_load(&scheduler->stopping) || scheduler->workerCount == 0) {
+        return -1;
+    }
+    Task task = {fn, context, group, TaskSchedulerNowMs()};
+    TaskWorker *self = TaskSchedulerSelf(scheduler);
+    TaskWorker *target = self ? self
+                              : &scheduler->workers[atomic_fetch_add(&scheduler->nextWorker, 1) % (unsigned)scheduler->workerCount];
+    if (TaskDequePush(&target->deques[priority], &task) != 0) {
+        return -1;
+    }
+    atomic_fetch_add(&scheduler->submitted[priority], 1);
+    atomic_fetch_add(&scheduler->pending[priority], 1);
+    if (atomic_load(&scheduler->sleepers) > 0) {
+        pthread_mutex_lock(&scheduler->sleepMutex);
+        pthread_cond_signal(&scheduler->wake);
+        pthread_mutex_unlock(&scheduler->sleepMutex);
+    }
+    return 0;
+}
+
+int TaskSchedulerSubmit(TaskScheduler *scheduler, TaskPriority priority, TaskFn fn, void *context) {
+    return TaskSchedulerEnqueue(scheduler, priority, fn, context, NULL);
+}
+
+void TaskGroupInit(TaskGroup *group, TaskPriority priority) {
+    atomic_init(&group->pending, 0);
+    group->priority = priority;
+    pthread_mutex_init(&group->mutex, NULL);
+    pthread_cond_init(&group->done, NULL);
+}
+
+void TaskGroupDestroy(TaskGroup *group) {
+    pthread_cond_destroy(&group->done);
+    pthread_mutex_destroy(&group->mutex);
+}
+
+void TaskGroupSubmit(TaskGroup *group, TaskScheduler *scheduler, TaskFn fn, void *context) {
+    atomic_fetch_add(&group->pending, 1);
+    if (!scheduler || TaskSchedulerEnqueue(scheduler, group->priority, fn, context, group) != 0) {
+        fn(context);
+        TaskGroupFinish(group);
+    }
+}
+
+void TaskGroupWait(TaskGroup *group, TaskScheduler *scheduler) {
+    TaskWorker *self = scheduler ? TaskSchedulerSelf(scheduler) : NULL;
+    while (1) {
+        pthread_mutex_lock(&group->mutex);
+        int pending = atomic_load(&group->pending);
+        pthread_mutex_unlock(&group->mutex);
+        if (pending == 0) {
+            return;
+        }
+        // Help instead of blocking, but never with work of a lower priority than the group's.
+        Task task;
+        int found = 0;
+        for (int lane = 0; scheduler && lane <= (int)group->priority && !found; lane++) {
+            found = TaskSchedulerTake(scheduler, self, lane, &task);
+            if (found) {
+                atomic_fetch_add(&scheduler->helped, 1);
+                TaskSchedulerRun(scheduler, lane, &task);
+            }
+        }
+        if (found) {
+            continue;
+        }
+        pthread_mutex_lock(&group->mutex);
+        if (atomic_load(&group->pending) > 0) {
+            TaskSchedulerTimedWait(&group->done, &group->mutex, kTaskSchedulerWaitMs);
+        }
+        pthread_mutex_unlock(&group->mutex);
+    }
+}
+
+typedef struct {
+    TaskRangeFn fn;
+    void *context;
+    size_t begin;
+    size_t end;
+} TaskChunk;
+
+static void TaskChunkRun(void *context) {
+    TaskChunk *chunk = context;
+    chunk->fn(chunk->context, chunk->begin, chunk->end);
+}
+
+void TaskSchedulerParallelFor(TaskScheduler *scheduler,
+                              TaskPriority priority,
+                              size_t count,
+                              size_t grain,
+                              TaskRangeFn fn,
+                              void *context) {
+    if (count == 0) {
+        return;
+    }
+    grain = grain > 0 ? grain : 1;
+    size_t chunks = (count + grain - 1) / grain;
+    size_t maxChunks = scheduler ? (size_t)scheduler->workerCount * kTaskChunksPerWorker : 1;
+    chunks = chunks < maxChunks ? chunks : maxChunks;
+    TaskChunk local[16];
+    TaskChunk *items = chunks <= 16 ? local : malloc(sizeof(TaskChunk) * chunks);
+    if (chunks <= 1 || !items) {
+        fn(context, 0, count);
+        return;
+    }
+
+    size_t share = count / chunks;
+    size_t extra = count % chunks;
+    size_t begin = 0;
+    for (size_t i = 0; i < chunks; i++) {
+        size_t end = begin + share + (i < extra ? 1 : 0);
+        items[i] = (TaskChunk){fn, context, begin, end};
+        begin = end;
+    }
+    TaskGroup group;
+    TaskGroupInit(&group, priority);
+    for (size_t i = 1; i < chunks; i++) {
+        TaskGroupSubmit(&group, scheduler, TaskChunkRun, &items[i]);
+    }
+    TaskChunkRun(&items[0]);
+    TaskGroupWait(&group, scheduler);
+    TaskGroupDestroy(&group);
+    if (items != local) {
+        free(items);
+    }
+}
+
+TaskSchedulerStats TaskSchedulerGetStats(TaskScheduler *scheduler) {
+    TaskSchedulerStats stats;
+    memset(&stats, 0, sizeof(stats));
+    for (int lane = 0; lane < TaskPriorityCount; lane++) {
+        TaskLaneStats *out = &stats.lanes[lane];
+        out->submitted = atomic_load(&scheduler->submitted[lane]);
+        out->completed = atomic_load(&scheduler->completed[lane]);
+        out->averageWaitMs = out->completed > 0 ? (double)atomic_load(&scheduler->totalWaitUs[lane]) / 1000.0 / (double)out->completed : 0.0;
+        out->maxWaitMs = (double)atomic_load(&scheduler->maxWaitUs[lane]) / 1000.0;
+
+        uint64_t total = 0;
+        uint64_t counts[TASK_SCHEDULER_LATENCY_BUCKETS];
+        for (int b = 0; b < TASK_SCHEDULER_LATENCY_BUCKETS; b++) {
+            counts[b] = atomic_load(&scheduler->waitHistogram[lane][b]);
+            total += counts[b];
+        }
+        uint64_t seen = 0;
+        for (int b = 0; b < TASK_SCHEDULER_LATENCY_BUCKETS && total > 0; b++) {
+            seen += counts[b];
+            if (out->p50WaitMs == 0.0 && seen * 2 >= total) {
+                out->p50WaitMs = TaskSchedulerBucketMs(b);
+            }
+            if (seen * 100 >= total * 99) {
+                out->p99WaitMs = TaskSchedulerBucketMs(b);
+                break;
+            }
+        }
+    }
+    stats.steals = atomic_load(&scheduler->steals);
+    stats.helped = atomic_load(&scheduler->helped);
+    stats.workers = scheduler->workerCount;
+    stats.backgroundWorkers = scheduler->backgroundLimit;
+    return stats;
+}
@@ -0,0 +1,167 @@
+//
+//  TaskScheduler.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#ifndef TASK_SCHEDULER_H
+#define TASK_SCHEDULER_H
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TASK_SCHEDULER_MAX_WORKERS 32
+#define TASK_SCHEDULER_LATENCY_BUCKETS 256
+
+typedef enum {
+    TaskPriorityRealtime = 0,    // Per-frame work: conversion, inference, LUTs on the live path
+    TaskPriorityBackground = 1,  // Thumbnails, catalog work, anything that can wait
+    TaskPriorityCount = 2
+} TaskPriority;
+
+typedef void (*TaskFn)(void *context);
+/// One chunk of a parallel-for: indices [begin, end)
+typedef void (*TaskRangeFn)(void *context, size_t begin, size_t end);
+
+typedef struct {
+    TaskFn fn;
+    void *context;
+    struct TaskGroup *group;
+    double submitMs;
+} Task;
+
+/// Mutex-protected ring; the owner works at the tail, thieves take from the head
+typedef struct {
+    pthread_mutex_t mutex;
+    Task *tasks;
+    size_t capacity;
+    size_t head;
+    size_t count;
+} TaskDeque;
+
+struct TaskScheduler;
+
+typedef struct {
+    struct TaskScheduler *scheduler;
+    pthread_t thread;
+    int index;
+    int started;
+    TaskDeque deques[TaskPriorityCount];
+} TaskWorker;
+
+/// Tasks that complete together; see TaskGroupWait
+typedef struct TaskGroup {
+    atomic_int pending;
+    TaskPriority priority;
+    pthread_mutex_t mutex;
+    pthread_cond_t done;
+} TaskGroup;
+
+typedef struct {
+    uint64_t submitted;
+    uint64_t completed;
+    double averageWaitMs;  // Submit -> a thread starts the task
+    double p50WaitMs;
+    double p99WaitMs;
+    double maxWaitMs;
+} TaskLaneStats;
+
+typedef struct {
+    TaskLaneStats lanes[TaskPriorityCount];
+    uint64_t steals;
+    uint64_t helped;       // Tasks run by threads waiting on a group
+    int workers;
+    int backgroundWorkers;
+} TaskSchedulerStats;
+
+/**
+ * Work-stealing scheduler for CPU-side processing.
+ *
+ * Each worker owns one deque per priority lane. Tasks submitted from a
+ * worker go to its own deque and run there newest first, while the data is
+ * still in cache; idle workers steal the oldest task from someone else.
+ * Tasks submitted from other threads are spread round-robin.
+ *
+ * Realtime work always goes first, and at most backgroundWorkers workers
+ * run background tasks at once. The rest are kept free for realtime work,
+ * so a frame never waits behind a thumbnail decode. A thread waiting on a
+ * group runs tasks itself instead of blocking, so parallel-for can nest.
+ */
+typedef struct TaskScheduler {
+    TaskWorker workers[TASK_SCHEDULER_MAX_WORKERS];
+    int workerCount;
+    int backgroundLimit;
+    atomic_int pending[TaskPriorityCount];
+    atomic_int backgroundRunning;
+    atomic_uint nextWorker;
+    atomic_bool stopping;
+    atomic_int sleepers;
+    pthread_mutex_t sleepMutex;
+    pthread_cond_t wake;
+
+    atomic_ullong submitted[TaskPriorityCount];
+    atomic_ullong completed[TaskPriorityCount];
+    atomic_ullong steals;
+    atomic_ullong helped;
+    atomic_ullong totalWaitUs[TaskPriorityCount];
+    atomic_ullong maxWaitUs[TaskPriorityCount];
+    atomic_uint waitHistogram[TaskPriorityCount][TASK_SCHEDULER_LATENCY_BUCKETS];  // Log scale, 8 buckets per octave of us
+} TaskScheduler;
+
+/**
+ * backgroundWorkers <= 0 picks workers - 1 (all of them with one worker).
+ *
+ * @return 0 on success, -1 if no worker could be started
+ */
+int TaskSchedulerStart(TaskScheduler *scheduler, int workers, int backgroundWorkers);
+
+/// Runs every queued task, then joins the workers
+void TaskSchedulerStop(TaskScheduler *scheduler);
+
+/**
+ * The process-wide scheduler every session shares: one worker per core
+ * (at least two), one of them kept for realtime work. Started on first use.
+ */
+TaskScheduler *TaskSchedulerShared(void);
+
+/// Fire and forget. @return 0 on success, -1 if the scheduler is stopping or out of memory
+int TaskSchedulerSubmit(TaskScheduler *scheduler, TaskPriority priority, TaskFn fn, void *context);
+
+void TaskGroupInit(TaskGroup *group, TaskPriority priority);
+void TaskGroupDestroy(TaskGroup *group);
+
+/// Runs fn on the scheduler as part of group; runs it inline if it cannot be queued
+void TaskGroupSubmit(TaskGroup *group, TaskScheduler *scheduler, TaskFn fn, void *context);
+
+/**
+ * Returns once every task of the group has finished. Meanwhile the caller
+ * runs queued tasks of the group's priority (or higher) itself.
+ */
+void TaskGroupWait(TaskGroup *group, TaskScheduler *scheduler);
+
+/**
+ * Splits [0, count) into chunks of about grain indices, runs them on the
+ * scheduler and the calling thread, and returns when all are done. A NULL
+ * scheduler runs everything on the calling thread.
+ */
+void TaskSchedulerParallelFor(TaskScheduler *scheduler,
+                              TaskPriority priority,
+                              size_t count,
+                              size_t grain,
+                              TaskRangeFn fn,
+                              void *context);
+
+TaskSchedulerStats TaskSchedulerGetStats(TaskScheduler *scheduler);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TASK_SCHEDULER_H */
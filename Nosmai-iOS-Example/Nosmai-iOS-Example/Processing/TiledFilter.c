@@ -0,0 +1,267 @@
+//
+//  TiledFilter.c
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 18/10/2026.
+//
+
+#include "TiledFilter.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+static inline int TiledFilterClamp(int value, int low, int high) {
+    return value < low ? low : (value > high ? high : value);
+}
+
+static void TiledFilterCopyRows(const uint8_t *src, size_t srcStride, uint8_t *dst, size_t dstStride, int width, int height) {
+    for (int y = 0; y < height; y++) {
+        memcpy(dst + (size_t)y * dstStride, src + (size_t)y * srcStride, (size_t)width * 4);
+    }
+}
+
+int TiledFilterInit(TiledFilter *filter, const TiledFilterStage *stages, int stageCount, int tileSize) {
+    memset(filter, 0, sizeof(*filter));
+    if (stageCount < 0 || stageCount > TILED_FILTER_MAX_STAGES || tileSize <= 0) {
+        return -1;
+    }
+    for (int i = 0; i < stageCount; i++) {
+        if (!stages[i].apply || stages[i].radius < 0) {
+            return -1;
+        }
+        filter->stages[i] = stages[i];
+        filter->halo += stages[i].radius;
+    }
+    filter->stageCount = stageCount;
+    filter->tileSize = tileSize;
+
+    size_t side = (size_t)tileSize + 2 * (size_t)filter->halo;
+    size_t bufferBytes = side * side * 4;
+    filter->buffers[0] = malloc(bufferBytes);
+    filter->buffers[1] = malloc(bufferBytes);
+    filter->scratch = malloc(sizeof(uint32_t) * side * 8);
+    if (!filter->buffers[0] || !filter->buffers[1] || !filter->scratch) {
+        TiledFilterFree(filter);
+        return -1;
+    }
+    filter->stats.workingBytes = 2 * bufferBytes + sizeof(uint32_t) * side * 8;
+    return 0;
+}
+
+void TiledFilterFree(TiledFilter *filter) {
+    free(filter->buffers[0]);
+    free(filter->buffers[1]);
+    free(filter->scratch);
+    memset(filter, 0, sizeof(*filter));
+}
+
+void TiledFilterApplyChain(const TiledFilterStage *stages,
+                           int stageCount,
+                           const uint8_t *src,
+                           size_t srcStride,
+                           uint8_t *dst,
+                           size_t dstStride,
+                           int width,
+                           int height,
+                           uint8_t *temp,
+                           uint32_t *scratch) {
+    if (stageCount == 0) {
+        TiledFilterCopyRows(src, srcStride, dst, dstStride, width, height);
+        return;
+    }
+    // Alternate so that the last stage lands in dst.
+    size_t tempStride = (size_t)width * 4;
+    const uint8_t *input = src;
+    size_t inputStride = srcStride;
+    for (int i = 0; i < stageCount; i++) {
+        int intoDst = (stageCount - 1 - i) % 2 == 0;
+        uint8_t *output = intoDst ? dst : temp;
+        size_t outputStride = intoDst ? dstStride : tempStride;
+        stages[i].apply(stages[i].params, input, inputStride, output, outputStride, width, height, scratch);
+        input = output;
+        inputStride = outputStride;
+    }
+}
+
+void TiledFilterRun(TiledFilter *filter,
+                    int width,
+                    int height,
+                    TiledFilterReadFn read,
+                    TiledFilterWriteFn write,
+                    void *io) {
+    int tile = filter->tileSize;
+    int halo = filter->halo;
+    size_t stride = ((size_t)tile + 2 * (size_t)halo) * 4;
+    for (int ty = 0; ty < height; ty += tile) {
+        for (int tx = 0; tx < width; tx += tile) {
+            int tileWidth = tile < width - tx ? tile : width - tx;
+            int tileHeight = tile < height - ty ? tile : height - ty;
+            // The halo stops at the image edge, where the stages clamp exactly as
+            // a whole-image pass would.
+            int x0 = TiledFilterClamp(tx - halo, 0, width);
+            int y0 = TiledFilterClamp(ty - halo, 0, height);
+            int x1 = TiledFilterClamp(tx + tileWidth + halo, 0, width);
+            int y1 = TiledFilterClamp(ty + tileHeight + halo, 0, height);
+            int regionWidth = x1 - x0;
+            int regionHeight = y1 - y0;
+
+            read(io, x0, y0, regionWidth, regionHeight, filter->buffers[0], stride);
+            int current = 0;
+            for (int i = 0; i < filter->stageCount; i++) {
+                const TiledFilterStage *stage = &filter->stages[i];
+                stage->apply(stage->params, filter->buffers[current], stride, filter->buffers[1 - current], stride,
+                             regionWidth, regionHeight, filter->scratch);
+                current = 1 - current;
+            }
+            const uint8_t *centre = filter->buffers[current] + (size_t)(ty - y0) * stride + (size_t)(tx - x0) * 4;
+            write(io, tx, ty, tileWidth, tileHeight, centre, stride);
+
+            filter->stats.tiles++;
+            filter->stats.pixelsRead += (uint64_t)regionWidth * (uint64_t)regionHeight;
+            filter->stats.pixelsWritten += (uint64_t)tileWidth * (uint64_t)tileHeight;
+        }
+    }
+}
+
+typedef struct {
+    const uint8_t *src;
+    size_t srcStride;
+    uint8_t *dst;
+    size_t dstStride;
+} TiledFilterMemoryIO;
+
+static void TiledFilterMemoryRead(void *io, int x, int y, int width, int height, uint8_t *dst, size_t dstStride) {
+    const TiledFilterMemoryIO *memory = io;
+    TiledFilterCopyRows(memory->src + (size_t)y * memory->srcStride + (size_t)x * 4, memory->srcStride,
+                        dst, dstStride, width, height);
+}
+
+static void TiledFilterMemoryWrite(void *io, int x, int y, int width, int height, const uint8_t *src, size_t srcStride) {
+    const TiledFilterMemoryIO *memory = io;
+    TiledFilterCopyRows(src, srcStride, memory->dst + (size_t)y * memory->dstStride + (size_t)x * 4, memory->dstStride,
+                        width, height);
+}
+
+void TiledFilterRunRGBA(TiledFilter *filter,
+                        const uint8_t *src,
+                        size_t srcStride,
+                        uint8_t *dst,
+                        size_t dstStride,
+                        int width,
+                        int height) {
+    TiledFilterMemoryIO io = {src, srcStride, dst, dstStride};
+    TiledFilterRun(filter, width, height, TiledFilterMemoryRead, TiledFilterMemoryWrite, &io);
+}
+
+// Box sums with clamped edges: per-column running sums over the window rows
+// (columns, 4 * width values), then a running sum along the row. The
+// result for each pixel goes to out (4 * width values) unnormalised.
+typedef struct {
+    const uint8_t *src;
+    size_t srcStride;
+    int width;
+    int height;
+    int radius;
+    uint32_t *columns;
+} TiledFilterBoxState;
+
+static void TiledFilterBoxBegin(TiledFilterBoxState *state) {
+    size_t length = (size_t)state->width * 4;
+    memset(state->columns, 0, sizeof(uint32_t) * length);
+    for (int k = -state->radius; k <= state->radius; k++) {
+        const uint8_t *row = state->src + (size_t)TiledFilterClamp(k, 0, state->height - 1) * state->srcStride;
+        for (size_t i = 0; i < length; i++) {
+            state->columns[i] += row[i];
+        }
+    }
+}
+
+static void TiledFilterBoxRow(const TiledFilterBoxState *state, uint32_t *out) {
+    int r = state->radius;
+    int last = state->width - 1;
+    for (int c = 0; c < 4; c++) {
+        uint32_t acc = 0;
+        for (int k = -r; k <= r; k++) {
+            acc += state->columns[TiledFilterClamp(k, 0, last) * 4 + c];
+        }
+        for (int x = 0; x < state->width; x++) {
+            out[x * 4 + c] = acc;
+            acc += state->columns[TiledFilterClamp(x + r + 1, 0, last) * 4 + c];
+            acc -= state->columns[TiledFilterClamp(x - r, 0, last) * 4 + c];
+        }
+    }
+}
+
+static void TiledFilterBoxAdvance(TiledFilterBoxState *state, int y) {
+    size_t length = (size_t)state->width * 4;
+    const uint8_t *add = state->src + (size_t)TiledFilterClamp(y + state->radius + 1, 0, state->height - 1) * state->srcStride;
+    const uint8_t *sub = state->src + (size_t)TiledFilterClamp(y - state->radius, 0, state->height - 1) * state->srcStride;
+    for (size_t i = 0; i < length; i++) {
+        state->columns[i] += (uint32_t)add[i] - (uint32_t)sub[i];
+    }
+}
+
+void TiledFilterBox(const void *params, const uint8_t *src, size_t srcStride, uint8_t *dst, size_t dstStride,
+                    int width, int height, uint32_t *scratch) {
+    int radius = ((const TiledFilterBoxParams *)params)->radius;
+    if (radius <= 0) {
+        TiledFilterCopyRows(src, srcStride, dst, dstStride, width, height);
+        return;
+    }
+    TiledFilterBoxState state = {src, srcStride, width, height, radius, scratch};
+    uint32_t *sums = scratch + (size_t)width * 4;
+    uint32_t area = (uint32_t)((2 * radius + 1) * (2 * radius + 1));
+    TiledFilterBoxBegin(&state);
+    for (int y = 0; y < height; y++) {
+        TiledFilterBoxRow(&state, sums);
+        uint8_t *out = dst + (size_t)y * dstStride;
+        for (size_t i = 0; i < (size_t)width * 4; i++) {
+            out[i] = (uint8_t)((sums[i] + area / 2) / area);
+        }
+        TiledFilterBoxAdvance(&state, y);
+    }
+}
+
+void TiledFilterSharpen(const void *params, const uint8_t *src, size_t srcStride, uint8_t *dst, size_t dstStride,
+                        int width, int height, uint32_t *scratch) {
+    const TiledFilterSharpenParams *sharpen = params;
+    if (sharpen->radius <= 0 || sharpen->amount == 0) {
+        TiledFilterCopyRows(src, srcStride, dst, dstStride, width, height);
+        return;
+    }
+    TiledFilterBoxState state = {src, srcStride, width, height, sharpen->radius, scratch};
+    uint32_t *sums = scratch + (size_t)width * 4;
+    uint32_t area = (uint32_t)((2 * sharpen->radius + 1) * (2 * sharpen->radius + 1));
+    TiledFilterBoxBegin(&state);
+    for (int y = 0; y < height; y++) {
+        TiledFilterBoxRow(&state, sums);
+        const uint8_t *in = src + (size_t)y * srcStride;
+        uint8_t *out = dst + (size_t)y * dstStride;
+        for (int x = 0; x < width; x++) {
+            for (int c = 0; c < 3; c++) {
+                int i = x * 4 + c;
+                int blurred = (int)((sums[i] + area / 2) / area);
+                int value = in[i] + (((in[i] - blurred) * sharpen->amount + 128) >> 8);
+                out[i] = (uint8_t)TiledFilterClamp(value, 0, 255);
+            }
+            out[x * 4 + 3] = in[x * 4 + 3];
+        }
+        TiledFilterBoxAdvance(&state, y);
+    }
+}
+
+void TiledFilterLUT(const void *params, const uint8_t *src, size_t srcStride, uint8_t *dst, size_t dstStride,
+                    int width, int height, uint32_t *scratch) {
+    (void)scratch;
+    const TiledFilterLUTParams *lut = params;
+    for (int y = 0; y < height; y++) {
+        const uint8_t *in = src + (size_t)y * srcStride;
+        uint8_t *out = dst + (size_t)y * dstStride;
+        for (int x = 0; x < width; x++) {
+            out[x * 4 + 0] = lut->table[0][in[x * 4 + 0]];
+            out[x * 4 + 1] = lut->table[1][in[x * 4 + 1]];
+            out[x * 4 + 2] = lut->table[2][in[x * 4 + 2]];
+            out[x * 4 + 3] = lut->table[3][in[x * 4 + 3]];
+        }
+    }
+}
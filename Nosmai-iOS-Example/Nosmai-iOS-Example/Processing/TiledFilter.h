@@ -0,0 +1,135 @@
+//
+//  TiledFilter.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 18/10/2026.
+//
+
+#ifndef TILED_FILTER_H
+#define TILED_FILTER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TILED_FILTER_MAX_STAGES 8
+
+/**
+ * One filter of the chain, applied to an RGBA region. Reads outside the
+ * region clamp to its edge. scratch holds at least 8 * width values.
+ */
+typedef void (*TiledFilterApplyFn)(const void *params,
+                                   const uint8_t *src,
+                                   size_t srcStride,
+                                   uint8_t *dst,
+                                   size_t dstStride,
+                                   int width,
+                                   int height,
+                                   uint32_t *scratch);
+
+typedef struct {
+    TiledFilterApplyFn apply;
+    const void *params;  // Must outlive the filter
+    int radius;          // How far the stage reads from an output pixel
+} TiledFilterStage;
+
+/// Fills a region of the source image; x, y, width, height are always inside it
+typedef void (*TiledFilterReadFn)(void *io, int x, int y, int width, int height, uint8_t *dst, size_t dstStride);
+/// Receives finished output pixels
+typedef void (*TiledFilterWriteFn)(void *io, int x, int y, int width, int height, const uint8_t *src, size_t srcStride);
+
+typedef struct {
+    uint64_t tiles;
+    uint64_t pixelsRead;     // Including halos
+    uint64_t pixelsWritten;
+    size_t workingBytes;     // Tile buffers and scratch, independent of the image size
+} TiledFilterStats;
+
+/**
+ * Runs a filter chain over an image of any size in square tiles.
+ *
+ * Each tile is read with a halo of the summed stage radii, so every output
+ * pixel sees the same neighbourhood it would in a whole-image pass. Stages
+ * clamp to the image edge, not the tile edge, and only the halo-free
+ * centre is written out. The output is therefore bit-identical to running
+ * the chain on the whole image at once.
+ *
+ * Working memory is two (tileSize + 2 * halo)^2 RGBA buffers plus one
+ * row of scratch. The image itself is only touched through the read and
+ * write callbacks.
+ */
+typedef struct {
+    TiledFilterStage stages[TILED_FILTER_MAX_STAGES];
+    int stageCount;
+    int tileSize;
+    int halo;
+    uint8_t *buffers[2];
+    uint32_t *scratch;
+    TiledFilterStats stats;
+} TiledFilter;
+
+/// @return 0 on success, -1 on invalid arguments or allocation failure
+int TiledFilterInit(TiledFilter *filter, const TiledFilterStage *stages, int stageCount, int tileSize);
+void TiledFilterFree(TiledFilter *filter);
+
+void TiledFilterRun(TiledFilter *filter,
+                    int width,
+                    int height,
+                    TiledFilterReadFn read,
+                    TiledFilterWriteFn write,
+                    void *io);
+
+/// Tiled run between two in-memory images (which must not overlap)
+void TiledFilterRunRGBA(TiledFilter *filter,
+                        const uint8_t *src,
+                        size_t srcStride,
+                        uint8_t *dst,
+                        size_t dstStride,
+                        int width,
+                        int height);
+
+/// The whole chain over one region; the tiled path's reference
+void TiledFilterApplyChain(const TiledFilterStage *stages,
+                           int stageCount,
+                           const uint8_t *src,
+                           size_t srcStride,
+                           uint8_t *dst,
+                           size_t dstStride,
+                           int width,
+                           int height,
+                           uint8_t *temp,
+                           uint32_t *scratch);
+
+// Stages
+
+typedef struct {
+    int radius;
+} TiledFilterBoxParams;
+
+typedef struct {
+    int radius;
+    int amount;  // 1/256 units; 256 adds the full detail layer once more
+} TiledFilterSharpenParams;
+
+typedef struct {
+    uint8_t table[4][256];
+} TiledFilterLUTParams;
+
+/// Box blur (smoothing)
+void TiledFilterBox(const void *params, const uint8_t *src, size_t srcStride, uint8_t *dst, size_t dstStride,
+                    int width, int height, uint32_t *scratch);
+/// Unsharp mask over a box blur; alpha is kept
+void TiledFilterSharpen(const void *params, const uint8_t *src, size_t srcStride, uint8_t *dst, size_t dstStride,
+                        int width, int height, uint32_t *scratch);
+/// Per-channel lookup table (colour grading), radius 0
+void TiledFilterLUT(const void *params, const uint8_t *src, size_t srcStride, uint8_t *dst, size_t dstStride,
+                    int width, int height, uint32_t *scratch);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TILED_FILTER_H */
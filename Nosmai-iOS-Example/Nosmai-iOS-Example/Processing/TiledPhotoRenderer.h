@@ -0,0 +1,49 @@
+//
+//  TiledPhotoRenderer.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 18/10/2026.
+//
+
+#import <Foundation/Foundation.h>
+#import <CoreVideo/CoreVideo.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * Full-resolution still processing.
+ *
+ * -[NosmaiCore capturePhoto:] returns the frame at preview processing size.
+ * This renderer runs smoothing and sharpening over a full-size still (12 MP
+ * and up, e.g. from AVCapturePhotoOutput) in overlapping tiles (see
+ * TiledFilter). Working memory depends on tileSize, not on the photo, and
+ * the result matches a whole-image pass exactly.
+ *
+ * The example app has no full-size still to give it: the SDK owns the
+ * capture session, and the photo button takes capturePhoto:'s frame.
+ */
+@interface TiledPhotoRenderer : NSObject
+
+/// 0.0 - 1.0, box smoothing up to a 6 pixel radius
+@property (nonatomic, assign) float smoothingLevel;
+
+/// 0.0 - 1.0, unsharp mask strength
+@property (nonatomic, assign) float sharpeningLevel;
+
+/// Tile edge in pixels before halos. Default 512
+@property (nonatomic, assign) int tileSize;
+
+/// tiles, haloOverhead (pixels read per pixel written), workingBytes and lastRenderMs
+@property (nonatomic, readonly) NSDictionary<NSString *, NSNumber *> *statistics;
+
+/**
+ * Renders a 32BGRA still into a different 32BGRA buffer of the same size.
+ *
+ * @return NO if the buffers are incompatible, the same buffer, or tile
+ *         memory could not be allocated
+ */
+- (BOOL)renderPixelBuffer:(CVPixelBufferRef)source toPixelBuffer:(CVPixelBufferRef)destination;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,99 @@
+//
+//  TiledPhotoRenderer.m
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 18/10/2026.
+//
+
+#import "TiledPhotoRenderer.h"
+#import <os/lock.h>
+#include <math.h>
+#include <time.h>
+#include "TiledFilter.h"
+
+static const int kMaxSmoothingRadius = 6;
+static const int kSharpenRadius = 2;
+
+static double TiledPhotoRendererNowMs(void) {
+    return (double)clock_gettime_nsec_np(CLOCK_UPTIME_RAW) / 1.0e6;
+}
+
+@implementation TiledPhotoRenderer {
+    os_unfair_lock _lock;
+    // Guarded by _lock.
+    TiledFilterStats _lastStats;
+    double _lastRenderMs;
+}
+
+- (instancetype)init {
+    self = [super init];
+    if (self) {
+        _lock = OS_UNFAIR_LOCK_INIT;
+        _tileSize = 512;
+    }
+    return self;
+}
+
+- (NSDictionary<NSString *, NSNumber *> *)statistics {
+    os_unfair_lock_lock(&_lock);
+    NSDictionary *stats = @{
+        @"tiles": @(_lastStats.tiles),
+        @"haloOverhead": @(_lastStats.pixelsWritten > 0 ? (double)_lastStats.pixelsRead / (double)_lastStats.pixelsWritten : 0.0),
+        @"workingBytes": @(_lastStats.workingBytes),
+        @"lastRenderMs": @(_lastRenderMs),
+    };
+    os_unfair_lock_unlock(&_lock);
+    return stats;
+}
+
+- (BOOL)renderPixelBuffer:(CVPixelBufferRef)source toPixelBuffer:(CVPixelBufferRef)destination {
+    if (!source || !destination || source == destination) return NO;
+    if (CVPixelBufferGetPixelFormatType(source) != kCVPixelFormatType_32BGRA ||
+        CVPixelBufferGetPixelFormatType(destination) != kCVPixelFormatType_32BGRA) {
+        return NO;
+    }
+    size_t width = CVPixelBufferGetWidth(source);
+    size_t height = CVPixelBufferGetHeight(source);
+    if (CVPixelBufferGetWidth(destination) != width || CVPixelBufferGetHeight(destination) != height) {
+        return NO;
+    }
+
+    // Stages only read their params during the run, so stack storage is enough.
+    TiledFilterBoxParams smoothing = {(int)lroundf(fminf(fmaxf(self.smoothingLevel, 0.0f), 1.0f) * (float)kMaxSmoothingRadius)};
+    TiledFilterSharpenParams sharpening = {kSharpenRadius, (int)lroundf(fminf(fmaxf(self.sharpeningLevel, 0.0f), 1.0f) * 256.0f)};
+    TiledFilterStage stages[2];
+    int stageCount = 0;
+    if (smoothing.radius > 0) {
+        stages[stageCount++] = (TiledFilterStage){TiledFilterBox, &smoothing, smoothing.radius};
+    }
+    if (sharpening.amount > 0) {
+        stages[stageCount++] = (TiledFilterStage){TiledFilterSharpen, &sharpening, sharpening.radius};
+    }
+
+    TiledFilter filter;
+    if (TiledFilterInit(&filter, stages, stageCount, self.tileSize) != 0) {
+        return NO;
+    }
+    double start = TiledPhotoRendererNowMs();
+    CVPixelBufferLockBaseAddress(source, kCVPixelBufferLock_ReadOnly);
+    CVPixelBufferLockBaseAddress(destination, 0);
+    TiledFilterRunRGBA(&filter,
+                       CVPixelBufferGetBaseAddress(source),
+                       CVPixelBufferGetBytesPerRow(source),
+                       CVPixelBufferGetBaseAddress(destination),
+                       CVPixelBufferGetBytesPerRow(destination),
+                       (int)width,
+                       (int)height);
+    CVPixelBufferUnlockBaseAddress(destination, 0);
+    CVPixelBufferUnlockBaseAddress(source, kCVPixelBufferLock_ReadOnly);
+    double elapsed = TiledPhotoRendererNowMs() - start;
+
+    os_unfair_lock_lock(&_lock);
+    _lastStats = filter.stats;
+    _lastRenderMs = elapsed;
+    os_unfair_lock_unlock(&_lock);
+    TiledFilterFree(&filter);
+    return YES;
+}
+
+@end
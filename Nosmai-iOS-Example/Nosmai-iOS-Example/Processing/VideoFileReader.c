@@ -0,0 +1,304 @@
+//
+//  VideoFileReader.c
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#include "VideoFileReader.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+enum {
+    VideoFileSlotFree = 0,
+    VideoFileSlotReading = 1,
+    VideoFileSlotReady = 2,
+    VideoFileSlotOut = 3,
+};
+
+enum {
+    // Both the header and FRAME lines are short; anything longer is not y4m.
+    kY4MLineLength = 512,
+};
+
+static double VideoFileNowMs(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1000.0 + (double)ts.tv_nsec / 1.0e6;
+}
+
+static void VideoFileTimedWait(pthread_cond_t *condition, pthread_mutex_t *mutex) {
+    struct timespec deadline;
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_nsec += 10 * 1000000L;
+    if (deadline.tv_nsec >= 1000000000L) {
+        deadline.tv_sec += 1;
+        deadline.tv_nsec -= 1000000000L;
+    }
+    pthread_cond_timedwait(condition, mutex, &deadline);
+}
+
+/// @return Line length plus one (so an empty line is still a line), 0 at end of file, -1 if too long
+static long VideoFileReadLine(FILE *file, char *line, size_t capacity) {
+    size_t length = 0;
+    int c;
+    while ((c = fgetc(file)) != EOF && c != '\n') {
+        if (length + 1 >= capacity) {
+            return -1;
+        }
+        line[length++] = (char)c;
+    }
+    line[length] = '\0';
+    if (c == EOF && length == 0) {
+        return 0;
+    }
+    return (long)length + 1;
+}
+
+static int VideoFileParseY4MHeader(FILE *file, VideoFileConfig *config) {
+    char line[kY4MLineLength];
+    if (VideoFileReadLine(file, line, sizeof(line)) <= 0 || strncmp(line, "YUV4MPEG2", 9) != 0) {
+        return -1;
+    }
+    config->width = 0;
+    config->height = 0;
+    config->rateNum = 30;
+    config->rateDen = 1;
+    char *context = NULL;
+    for (char *token = strtok_r(line + 9, " ", &context); token; token = strtok_r(NULL, " ", &context)) {
+        switch (token[0]) {
+            case 'W':
+                config->width = atoi(token + 1);
+                break;
+            case 'H':
+                config->height = atoi(token + 1);
+                break;
+            case 'F': {
+                int num = 0;
+                int den = 0;
+                if (sscanf(token + 1, "%d:%d", &num, &den) == 2 && num > 0 && den > 0) {
+                    config->rateNum = num;
+                    config->rateDen = den;
+                }
+                break;
+            }
+            case 'C':
+                if (strcmp(token + 1, "420") != 0 && strcmp(token + 1, "420jpeg") != 0 &&
+                    strcmp(token + 1, "420paldv") != 0 && strcmp(token + 1, "420mpeg2") != 0) {
+                    return -1;
+                }
+                break;
+            default:
+                break;
+        }
+    }
+    return config->width > 0 && config->height > 0 ? 0 : -1;
+}
+
+/// @return 1 with a frame, 0 at a clean end of file, -1 on a short or malformed frame
+static int VideoFileReadFrame(VideoFileReader *reader, uint8_t *buffer) {
+    if (reader->config.format == VideoFileFormatY4M) {
+        char line[kY4MLineLength];
+        long length = VideoFileReadLine(reader->file, line, sizeof(line));
+        if (length == 0) {
+            return 0;
+        }
+        if (length < 0 || strncmp(line, "FRAME", 5) != 0) {
+            return -1;
+        }
+    }
+    size_t read = fread(buffer, 1, reader->frameBytes, reader->file);
+    if (read == reader->frameBytes) {
+        return 1;
+    }
+    return read == 0 && feof(reader->file) && reader->config.format != VideoFileFormatY4M ? 0 : -1;
+}
+
+static void *VideoFileReaderMain(void *context) {
+    VideoFileReader *reader = context;
+    int prefetch = reader->config.prefetchFrames;
+    while (1) {
+        pthread_mutex_lock(&reader->mutex);
+        int slot = (int)(reader->writeIndex % (uint64_t)prefetch);
+        if (!reader->stopping && reader->states[slot] != VideoFileSlotFree) {
+            reader->stats.readerStalls++;
+            while (!reader->stopping && reader->states[slot] != VideoFileSlotFree) {
+                VideoFileTimedWait(&reader->freeCondition, &reader->mutex);
+            }
+        }
+        if (reader->stopping) {
+            pthread_mutex_unlock(&reader->mutex);
+            break;
+        }
+        reader->states[slot] = VideoFileSlotReading;
+        uint8_t *buffer = reader->buffers[slot];
+        pthread_mutex_unlock(&reader->mutex);
+
+        double start = VideoFileNowMs();
+        int result = VideoFileReadFrame(reader, buffer);
+        double elapsed = VideoFileNowMs() - start;
+
+        pthread_mutex_lock(&reader->mutex);
+        if (result == 1) {
+            reader->states[slot] = VideoFileSlotReady;
+            reader->writeIndex++;
+            reader->stats.framesRead++;
+            reader->stats.bytesRead += reader->frameBytes;
+            reader->totalReadMs += elapsed;
+            reader->stats.prefetched = (uint32_t)(reader->writeIndex - reader->readIndex);
+            if (reader->stats.prefetched > reader->stats.maxPrefetched) {
+                reader->stats.maxPrefetched = reader->stats.prefetched;
+            }
+        } else {
+            reader->states[slot] = VideoFileSlotFree;
+            reader->finished = 1;
+            reader->stats.truncated = result < 0 && feof(reader->file);
+            reader->failed = result < 0 && !reader->stats.truncated;
+        }
+        pthread_cond_broadcast(&reader->readyCondition);
+        pthread_mutex_unlock(&reader->mutex);
+        if (result != 1) {
+            break;
+        }
+    }
+    return NULL;
+}
+
+int VideoFileReaderOpen(VideoFileReader *reader, const char *path, const VideoFileConfig *config) {
+    memset(reader, 0, sizeof(*reader));
+    reader->config = *config;
+    if (config->prefetchFrames < 1 || config->prefetchFrames > VIDEO_FILE_MAX_PREFETCH) {
+        return -1;
+    }
+    reader->file = fopen(path, "rb");
+    if (!reader->file) {
+        return -1;
+    }
+    int valid = config->format == VideoFileFormatY4M
+                    ? VideoFileParseY4MHeader(reader->file, &reader->config) == 0
+                    : config->width > 0 && config->height > 0 && config->rateNum > 0 && config->rateDen > 0;
+    if (!valid) {
+        fclose(reader->file);
+        reader->file = NULL;
+        return -1;
+    }
+
+    size_t width = (size_t)reader->config.width;
+    size_t height = (size_t)reader->config.height;
+    size_t chromaWidth = (width + 1) / 2;
+    size_t chromaHeight = (height + 1) / 2;
+    reader->planeOffsets[0] = 0;
+    reader->planeOffsets[1] = width * height;
+    reader->planeOffsets[2] = width * height + chromaWidth * chromaHeight;
+    reader->frameBytes = width * height + 2 * chromaWidth * chromaHeight;
+
+    for (int i = 0; i < reader->config.prefetchFrames; i++) {
+        reader->buffers[i] = malloc(reader->frameBytes);
+        if (!reader->buffers[i]) {
+            VideoFileReaderClose(reader);
+            return -1;
+        }
+    }
+    pthread_mutex_init(&reader->mutex, NULL);
+    pthread_cond_init(&reader->readyCondition, NULL);
+    pthread_cond_init(&reader->freeCondition, NULL);
+    reader->threadStarted = pthread_create(&reader->thread, NULL, VideoFileReaderMain, reader) == 0;
+    if (!reader->threadStarted) {
+        pthread_cond_destroy(&reader->freeCondition);
+        pthread_cond_destroy(&reader->readyCondition);
+        pthread_mutex_destroy(&reader->mutex);
+        VideoFileReaderClose(reader);
+        return -1;
+    }
+    return 0;
+}
+
+VideoFileConfig VideoFileReaderGetConfig(const VideoFileReader *reader) {
+    return reader->config;
+}
+
+int VideoFileReaderNext(VideoFileReader *reader, VideoFileFrame *frame) {
+    pthread_mutex_lock(&reader->mutex);
+    int slot = (int)(reader->readIndex % (uint64_t)reader->config.prefetchFrames);
+    if (reader->states[slot] != VideoFileSlotReady && !reader->finished) {
+        reader->stats.consumerStalls++;
+        while (reader->states[slot] != VideoFileSlotReady && !reader->finished) {
+            VideoFileTimedWait(&reader->readyCondition, &reader->mutex);
+        }
+    }
+    if (reader->states[slot] != VideoFileSlotReady) {
+        int result = reader->failed ? -1 : 0;
+        pthread_mutex_unlock(&reader->mutex);
+        return result;
+    }
+    reader->states[slot] = VideoFileSlotOut;
+    uint64_t index = reader->readIndex++;
+    reader->stats.framesDelivered++;
+    reader->stats.prefetched = (uint32_t)(reader->writeIndex - reader->readIndex);
+    uint8_t *buffer = reader->buffers[slot];
+    pthread_mutex_unlock(&reader->mutex);
+
+    size_t width = (size_t)reader->config.width;
+    size_t chromaWidth = (width + 1) / 2;
+    memset(frame, 0, sizeof(*frame));
+    frame->width = reader->config.width;
+    frame->height = reader->config.height;
+    frame->planes[0] = buffer;
+    frame->strides[0] = width;
+    if (reader->config.format == VideoFileFormatRawNV12) {
+        frame->planeCount = 2;
+        frame->planes[1] = buffer + reader->planeOffsets[1];
+        frame->strides[1] = 2 * chromaWidth;
+    } else {
+        frame->planeCount = 3;
+        frame->planes[1] = buffer + reader->planeOffsets[1];
+        frame->planes[2] = buffer + reader->planeOffsets[2];
+        frame->strides[1] = chromaWidth;
+        frame->strides[2] = chromaWidth;
+    }
+    frame->index = index;
+    frame->timeValue = (int64_t)index * reader->config.rateDen;
+    frame->timeScale = reader->config.rateNum;
+    frame->timestamp = (double)frame->timeValue / (double)frame->timeScale;
+    frame->slot = slot;
+    return 1;
+}
+
+void VideoFileReaderRelease(VideoFileReader *reader, const VideoFileFrame *frame) {
+    pthread_mutex_lock(&reader->mutex);
+    reader->states[frame->slot] = VideoFileSlotFree;
+    pthread_cond_signal(&reader->freeCondition);
+    pthread_mutex_unlock(&reader->mutex);
+}
+
+void VideoFileReaderClose(VideoFileReader *reader) {
+    if (reader->threadStarted) {
+        pthread_mutex_lock(&reader->mutex);
+        reader->stopping = 1;
+        pthread_cond_broadcast(&reader->freeCondition);
+        pthread_mutex_unlock(&reader->mutex);
+        pthread_join(reader->thread, NULL);
+        reader->threadStarted = 0;
+        pthread_cond_destroy(&reader->freeCondition);
+        pthread_cond_destroy(&reader->readyCondition);
+        pthread_mutex_destroy(&reader->mutex);
+    }
+    for (int i = 0; i < VIDEO_FILE_MAX_PREFETCH; i++) {
+        free(reader->buffers[i]);
+        reader->buffers[i] = NULL;
+    }
+    if (reader->file) {
+        fclose(reader->file);
+        reader->file = NULL;
+    }
+}
+
+VideoFileReaderStats VideoFileReaderGetStats(VideoFileReader *reader) {
+    pthread_mutex_lock(&reader->mutex);
+    VideoFileReaderStats stats = reader->stats;
+    stats.averageReadMs = stats.framesRead > 0 ? reader->totalReadMs / (double)stats.framesRead : 0.0;
+    pthread_mutex_unlock(&reader->mutex);
+    return stats;
+}
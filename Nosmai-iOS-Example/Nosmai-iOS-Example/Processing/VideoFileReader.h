@@ -0,0 +1,126 @@
+//
+//  VideoFileReader.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#ifndef VIDEO_FILE_READER_H
+#define VIDEO_FILE_READER_H
+
+#include <pthread.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define VIDEO_FILE_MAX_PREFETCH 16
+
+typedef enum {
+    VideoFileFormatY4M = 0,      // 4:2:0 only; size and rate come from the header
+    VideoFileFormatRawI420 = 1,  // Y, U, V planes back to back
+    VideoFileFormatRawNV12 = 2   // Y plane, then interleaved CbCr
+} VideoFileFormat;
+
+typedef struct {
+    VideoFileFormat format;
+    int width;            // Raw only
+    int height;           // Raw only
+    int32_t rateNum;      // Raw only; frames per second as rateNum / rateDen
+    int32_t rateDen;
+    int prefetchFrames;   // Frames read ahead of the consumer, 1...VIDEO_FILE_MAX_PREFETCH
+} VideoFileConfig;
+
+/// Planes stay valid until the frame is released
+typedef struct {
+    const uint8_t *planes[3];
+    size_t strides[3];
+    int planeCount;        // 3 for y4m and I420, 2 for NV12
+    int width;
+    int height;
+    uint64_t index;
+    int64_t timeValue;     // index * rateDen: exact, no accumulated rounding
+    int32_t timeScale;     // rateNum
+    double timestamp;      // timeValue / timeScale, seconds
+    int slot;
+} VideoFileFrame;
+
+typedef struct {
+    uint64_t framesRead;
+    uint64_t framesDelivered;
+    uint64_t consumerStalls;  // Next had to wait for the reader
+    uint64_t readerStalls;    // The reader had to wait for a free slot (the consumer is the bottleneck)
+    uint64_t bytesRead;
+    uint32_t prefetched;      // Frames read and not yet delivered
+    uint32_t maxPrefetched;
+    double averageReadMs;
+    int truncated;            // The file ended inside a frame
+} VideoFileReaderStats;
+
+/**
+ * Headless frame source over a y4m or raw planar file.
+ *
+ * A background thread reads frames ahead into a fixed ring of
+ * prefetchFrames buffers, so file I/O overlaps processing and memory stays
+ * bounded. Nothing paces the frames: the consumer gets them as fast as it
+ * takes them. Timestamps are derived from the frame index and the exact
+ * rational frame rate.
+ */
+typedef struct {
+    FILE *file;
+    VideoFileConfig config;
+    size_t frameBytes;
+    size_t planeOffsets[3];
+    pthread_t thread;
+    int threadStarted;
+
+    pthread_mutex_t mutex;
+    pthread_cond_t readyCondition;
+    pthread_cond_t freeCondition;
+    // Guarded by mutex.
+    uint8_t *buffers[VIDEO_FILE_MAX_PREFETCH];
+    int states[VIDEO_FILE_MAX_PREFETCH];
+    uint64_t writeIndex;
+    uint64_t readIndex;
+    int finished;
+    int failed;
+    int stopping;
+    VideoFileReaderStats stats;
+    double totalReadMs;
+} VideoFileReader;
+
+/**
+ * Opens the file, parses the y4m header and starts reading ahead.
+ *
+ * @return 0 on success, -1 if the file cannot be opened, the header is
+ *         invalid or not 4:2:0, or memory cannot be allocated
+ */
+int VideoFileReaderOpen(VideoFileReader *reader, const char *path, const VideoFileConfig *config);
+
+/// The file's geometry and rate (from the header for y4m)
+VideoFileConfig VideoFileReaderGetConfig(const VideoFileReader *reader);
+
+/**
+ * Waits for the next frame in file order.
+ *
+ * @return 1 with a frame, 0 at the end of the file, -1 on a read error
+ */
+int VideoFileReaderNext(VideoFileReader *reader, VideoFileFrame *frame);
+
+/// Hands the frame's buffer back to the reader; frames may be released in any order
+void VideoFileReaderRelease(VideoFileReader *reader, const VideoFileFrame *frame);
+
+/// Stops reading ahead and closes the file; frames not released are invalid afterwards
+void VideoFileReaderClose(VideoFileReader *reader);
+
+/// Valid until VideoFileReaderClose
+VideoFileReaderStats VideoFileReaderGetStats(VideoFileReader *reader);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* VIDEO_FILE_READER_H */
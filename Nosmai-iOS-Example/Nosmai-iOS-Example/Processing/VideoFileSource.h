@@ -0,0 +1,76 @@
+//
+//  VideoFileSource.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#import <Foundation/Foundation.h>
+#import <CoreMedia/CoreMedia.h>
+#import <CoreVideo/CoreVideo.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+typedef NS_ENUM(NSInteger, VideoFileRawFormat) {
+    VideoFileRawFormatI420 = 1,
+    VideoFileRawFormatNV12 = 2,
+};
+
+/// Called on the source's thread for every frame, in file order. Return NO to stop
+typedef BOOL (^VideoFileFrameHandler)(CVPixelBufferRef pixelBuffer, CMTime timestamp);
+
+/**
+ * Headless input (NosmaiInputSourceTypeVideoFile) from a y4m or raw
+ * planar file, for reproducible performance and regression runs without a
+ * camera.
+ *
+ * Frames are read ahead on a background thread (see VideoFileReader),
+ * converted to NV12 pixel buffers and delivered as fast as they are
+ * processed, not at the file's frame rate. Timestamps are exact multiples
+ * of the frame duration. Without a frameHandler every frame goes through
+ * -[NosmaiSDK processFrame:mirror:].
+ */
+@interface VideoFileSource : NSObject
+
+/// Frames read ahead, 1...16. Default 4; set before -start
+@property (nonatomic, assign) NSInteger prefetchFrames;
+@property (nonatomic, assign) BOOL mirror;
+@property (nonatomic, copy, nullable) VideoFileFrameHandler frameHandler;
+
+@property (nonatomic, readonly) CGSize frameSize;
+@property (nonatomic, readonly) CMTime frameDuration;
+@property (nonatomic, readonly) BOOL isRunning;
+
+/**
+ * frames, failedFrames, framesPerSecond, averageProcessMs, consumerStalls
+ * (processing waited for the file), readerStalls (the prefetch window was
+ * full), maxPrefetched, bytesRead, averageReadMs, truncated
+ */
+@property (nonatomic, readonly) NSDictionary<NSString *, NSNumber *> *statistics;
+
+/// y4m; size and frame rate come from its header. Returns nil if the header is not 4:2:0 y4m
+- (nullable instancetype)initWithY4MURL:(NSURL *)url error:(NSError **)error;
+
+- (nullable instancetype)initWithRawURL:(NSURL *)url
+                                 format:(VideoFileRawFormat)format
+                                  width:(int)width
+                                 height:(int)height
+                          frameDuration:(CMTime)frameDuration
+                                  error:(NSError **)error;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ * Runs the file on a thread of its own. completion gets the final
+ * statistics on that thread, with an error if reading failed.
+ *
+ * @return NO if already running or the file cannot be opened
+ */
+- (BOOL)startWithCompletion:(nullable void (^)(NSDictionary<NSString *, NSNumber *> *statistics, NSError * _Nullable error))completion;
+
+/// Stops after the current frame
+- (void)stop;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,271 @@
+//
+//  VideoFileSource.m
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 19/10/2026.
+//
+
+#import "VideoFileSource.h"
+#import <nosmai/Nosmai.h>
+#import <os/lock.h>
+#include <stdatomic.h>
+#include <time.h>
+#include "VideoFileReader.h"
+
+static NSString * const kVideoFileSourceErrorDomain = @"VideoFileSource";
+
+static double VideoFileSourceNowMs(void) {
+    return (double)clock_gettime_nsec_np(CLOCK_UPTIME_RAW) / 1.0e6;
+}
+
+static NSError *VideoFileSourceError(NSInteger code, NSString *description) {
+    return [NSError errorWithDomain:kVideoFileSourceErrorDomain
+                               code:code
+                           userInfo:@{NSLocalizedDescriptionKey: description}];
+}
+
+@implementation VideoFileSource {
+    NSString *_path;
+    VideoFileConfig _config;
+    os_unfair_lock _lock;
+    atomic_bool _stopRequested;
+    CVPixelBufferPoolRef _pool;  // Source thread only
+
+    // Guarded by _lock.
+    BOOL _running;
+    uint64_t _frames;
+    uint64_t _failedFrames;
+    double _processMs;
+    double _elapsedMs;
+    VideoFileReaderStats _readerStats;
+}
+
+- (nullable instancetype)initWithPath:(NSString *)path config:(VideoFileConfig)config error:(NSError **)error {
+    self = [super init];
+    if (self) {
+        // Opened once here to validate the file and learn its geometry.
+        config.prefetchFrames = 1;
+        VideoFileReader reader;
+        if (VideoFileReaderOpen(&reader, path.fileSystemRepresentation, &config) != 0) {
+            if (error) {
+                *error = VideoFileSourceError(1, @"The file cannot be opened or is not 4:2:0 y4m");
+            }
+            return nil;
+        }
+        _config = VideoFileReaderGetConfig(&reader);
+        VideoFileReaderClose(&reader);
+        _path = [path copy];
+        _lock = OS_UNFAIR_LOCK_INIT;
+        _prefetchFrames = 4;
+        atomic_init(&_stopRequested, false);
+    }
+    return self;
+}
+
+- (nullable instancetype)initWithY4MURL:(NSURL *)url error:(NSError **)error {
+    VideoFileConfig config = {VideoFileFormatY4M, 0, 0, 0, 0, 1};
+    return [self initWithPath:url.path config:config error:error];
+}
+
+- (nullable instancetype)initWithRawURL:(NSURL *)url
+                                 format:(VideoFileRawFormat)format
+                                  width:(int)width
+                                 height:(int)height
+                          frameDuration:(CMTime)frameDuration
+                                  error:(NSError **)error {
+    // A frame duration of value/timescale is a rate of timescale/value.
+    VideoFileConfig config = {
+        format == VideoFileRawFormatNV12 ? VideoFileFormatRawNV12 : VideoFileFormatRawI420,
+        width,
+        height,
+        frameDuration.timescale,
+        (int32_t)frameDuration.value,
+        1,
+    };
+    return [self initWithPath:url.path config:config error:error];
+}
+
+- (void)dealloc {
+    CVPixelBufferPoolRelease(_pool);
+}
+
+- (CGSize)frameSize {
+    return CGSizeMake(_config.width, _config.height);
+}
+
+- (CMTime)frameDuration {
+    return CMTimeMake(_config.rateDen, _config.rateNum);
+}
+
+- (BOOL)isRunning {
+    os_unfair_lock_lock(&_lock);
+    BOOL running = _running;
+    os_unfair_lock_unlock(&_lock);
+    return running;
+}
+
+- (NSDictionary<NSString *, NSNumber *> *)statistics {
+    os_unfair_lock_lock(&_lock);
+    uint64_t handled = _frames + _failedFrames;
+    NSDictionary *stats = @{
+        @"frames": @(_frames),
+        @"failedFrames": @(_failedFrames),
+        @"framesPerSecond": @(_elapsedMs > 0.0 ? (double)handled * 1000.0 / _elapsedMs : 0.0),
+        @"averageProcessMs": @(handled > 0 ? _processMs / (double)handled : 0.0),
+        @"consumerStalls": @(_readerStats.consumerStalls),
+        @"readerStalls": @(_readerStats.readerStalls),
+        @"maxPrefetched": @(_readerStats.maxPrefetched),
+        @"bytesRead": @(_readerStats.bytesRead),
+        @"averageReadMs": @(_readerStats.averageReadMs),
+        @"truncated": @(_readerStats.truncated),
+    };
+    os_unfair_lock_unlock(&_lock);
+    return stats;
+}
+
+#pragma mark - Lifecycle
+
+- (BOOL)startWithCompletion:(void (^)(NSDictionary<NSString *, NSNumber *> *, NSError *))completion {
+    os_unfair_lock_lock(&_lock);
+    if (_running) {
+        os_unfair_lock_unlock(&_lock);
+        return NO;
+    }
+    _running = YES;
+    _frames = 0;
+    _failedFrames = 0;
+    _processMs = 0.0;
+    _elapsedMs = 0.0;
+    memset(&_readerStats, 0, sizeof(_readerStats));
+    os_unfair_lock_unlock(&_lock);
+
+    VideoFileConfig config = _config;
+    config.prefetchFrames = (int)MAX(1, MIN(self.prefetchFrames, (NSInteger)VIDEO_FILE_MAX_PREFETCH));
+    VideoFileReader *reader = malloc(sizeof(VideoFileReader));
+    if (!reader || VideoFileReaderOpen(reader, _path.fileSystemRepresentation, &config) != 0) {
+        free(reader);
+        os_unfair_lock_lock(&_lock);
+        _running = NO;
+        os_unfair_lock_unlock(&_lock);
+        return NO;
+    }
+    atomic_store(&_stopRequested, false);
+    NSThread *thread = [[NSThread alloc] initWithBlock:^{
+        [self runReader:reader completion:completion];
+    }];
+    thread.name = @"com.nosmai.example.video-file";
+    thread.qualityOfService = NSQualityOfServiceUserInitiated;
+    [thread start];
+    return YES;
+}
+
+- (void)stop {
+    atomic_store(&_stopRequested, true);
+}
+
+#pragma mark - Frames
+
+// Source thread only.
+- (nullable CVPixelBufferRef)createPixelBufferFromFrame:(const VideoFileFrame *)frame {
+    if (!_pool) {
+        NSDictionary *attributes = @{
+            (id)kCVPixelBufferPixelFormatTypeKey: @(kCVPixelFormatType_420YpCbCr8BiPlanarVideoRange),
+            (id)kCVPixelBufferWidthKey: @(frame->width),
+            (id)kCVPixelBufferHeightKey: @(frame->height),
+            (id)kCVPixelBufferIOSurfacePropertiesKey: @{},
+        };
+        CVPixelBufferPoolCreate(kCFAllocatorDefault, NULL, (__bridge CFDictionaryRef)attributes, &_pool);
+    }
+    CVPixelBufferRef pixelBuffer = NULL;
+    if (!_pool || CVPixelBufferPoolCreatePixelBuffer(kCFAllocatorDefault, _pool, &pixelBuffer) != kCVReturnSuccess) {
+        return NULL;
+    }
+
+    CVPixelBufferLockBaseAddress(pixelBuffer, 0);
+    uint8_t *luma = CVPixelBufferGetBaseAddressOfPlane(pixelBuffer, 0);
+    size_t lumaStride = CVPixelBufferGetBytesPerRowOfPlane(pixelBuffer, 0);
+    for (int y = 0; y < frame->height; y++) {
+        memcpy(luma + (size_t)y * lumaStride, frame->planes[0] + (size_t)y * frame->strides[0], (size_t)frame->width);
+    }
+    uint8_t *chroma = CVPixelBufferGetBaseAddressOfPlane(pixelBuffer, 1);
+    size_t chromaStride = CVPixelBufferGetBytesPerRowOfPlane(pixelBuffer, 1);
+    int chromaWidth = (frame->width + 1) / 2;
+    int chromaHeight = (frame->height + 1) / 2;
+    for (int y = 0; y < chromaHeight; y++) {
+        uint8_t *dst = chroma + (size_t)y * chromaStride;
+        if (frame->planeCount == 2) {
+            memcpy(dst, frame->planes[1] + (size_t)y * frame->strides[1], (size_t)chromaWidth * 2);
+            continue;
+        }
+        // I420 -> NV12: interleave Cb and Cr.
+        const uint8_t *cb = frame->planes[1] + (size_t)y * frame->strides[1];
+        const uint8_t *cr = frame->planes[2] + (size_t)y * frame->strides[2];
+        for (int x = 0; x < chromaWidth; x++) {
+            dst[x * 2] = cb[x];
+            dst[x * 2 + 1] = cr[x];
+        }
+    }
+    CVPixelBufferUnlockBaseAddress(pixelBuffer, 0);
+    return pixelBuffer;
+}
+
+- (void)runReader:(VideoFileReader *)reader
+       completion:(void (^)(NSDictionary<NSString *, NSNumber *> *, NSError *))completion {
+    VideoFileFrameHandler handler = self.frameHandler;
+    BOOL mirror = self.mirror;
+    double start = VideoFileSourceNowMs();
+    int result = 1;
+    while (!atomic_load(&_stopRequested)) {
+        VideoFileFrame frame;
+        result = VideoFileReaderNext(reader, &frame);
+        if (result != 1) {
+            break;
+        }
+        double frameStart = VideoFileSourceNowMs();
+        BOOL processed = NO;
+        BOOL keepGoing = YES;
+        @autoreleasepool {
+            CVPixelBufferRef pixelBuffer = [self createPixelBufferFromFrame:&frame];
+            VideoFileReaderRelease(reader, &frame);
+            if (pixelBuffer) {
+                if (handler) {
+                    keepGoing = handler(pixelBuffer, CMTimeMake(frame.timeValue, frame.timeScale));
+                    processed = YES;
+                } else {
+                    processed = [[NosmaiSDK sharedInstance] processFrame:pixelBuffer mirror:mirror];
+                }
+                CVPixelBufferRelease(pixelBuffer);
+            }
+        }
+        double now = VideoFileSourceNowMs();
+
+        os_unfair_lock_lock(&_lock);
+        if (processed) {
+            _frames++;
+        } else {
+            _failedFrames++;
+        }
+        _processMs += now - frameStart;
+        _elapsedMs = now - start;
+        _readerStats = VideoFileReaderGetStats(reader);
+        os_unfair_lock_unlock(&_lock);
+        if (!keepGoing) {
+            break;
+        }
+    }
+
+    os_unfair_lock_lock(&_lock);
+    _readerStats = VideoFileReaderGetStats(reader);
+    _elapsedMs = VideoFileSourceNowMs() - start;
+    _running = NO;
+    os_unfair_lock_unlock(&_lock);
+    VideoFileReaderClose(reader);
+    free(reader);
+
+    if (completion) {
+        NSError *error = result < 0 ? VideoFileSourceError(2, @"Reading the file failed") : nil;
+        completion(self.statistics, error);
+    }
+}
+
+@end
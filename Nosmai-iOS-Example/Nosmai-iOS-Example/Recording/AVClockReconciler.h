@@ -0,0 +1,58 @@
+//
+//  AVClockReconciler.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 18/10/2026.
+//
+
+#import <Foundation/Foundation.h>
+#import <CoreMedia/CoreMedia.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * Keeps audio appended through -[NosmaiVideoRecorder addAudioInput:] in sync
+ * with the video timestamps from the processing path.
+ *
+ * Report every video frame as it reaches the recorder, and pass every audio
+ * sample buffer through -copyRetimedAudioSampleBuffer: before appending it.
+ * The offset and drift between the two clocks are estimated from arrival
+ * times (see ClockSync.h). Audio presentation times are then moved onto the
+ * video timeline. The samples themselves are untouched, so nothing is
+ * resampled or re-encoded.
+ *
+ * Both calls take a short lock and do a fixed amount of work, so they are
+ * safe on the render and audio threads.
+ */
+@interface AVClockReconciler : NSObject
+
+/**
+ * offsetMs, driftPpm, appliedOffsetMs, videoSamples, audioSamples and valid
+ * (1 once both clocks have been seen)
+ */
+@property (nonatomic, readonly) NSDictionary<NSString *, NSNumber *> *statistics;
+
+/// maxSlewPerSecond: how fast a revised estimate may move the audio, e.g. 0.005 = 5 ms per second
+- (instancetype)initWithMaxSlewPerSecond:(double)maxSlewPerSecond NS_DESIGNATED_INITIALIZER;
+
+/// 5 ms per second
+- (instancetype)init;
+
+/// Forgets both clocks; call when a recording starts
+- (void)reset;
+
+/// Video timestamp (seconds) of a frame handed to the recorder now
+- (void)observeVideoTimestamp:(double)timestamp;
+
+/**
+ * Records the buffer's arrival and returns a copy whose timing is on the
+ * video timeline. The caller releases the result.
+ *
+ * @return The retimed copy; sampleBuffer itself, retained, if it has no
+ *         timing or the copy could not be made. Never NULL.
+ */
+- (CMSampleBufferRef)copyRetimedAudioSampleBuffer:(CMSampleBufferRef)sampleBuffer CF_RETURNS_RETAINED;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,111 @@
+//
+//  AVClockReconciler.m
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 18/10/2026.
+//
+
+#import "AVClockReconciler.h"
+#include <time.h>
+#include "ClockSync.h"
+
+// PCM capture buffers carry one timing entry; longer arrays are rare.
+static const CMItemCount kInlineTimingEntries = 8;
+
+static double AVClockReconcilerHostSeconds(void) {
+    return (double)clock_gettime_nsec_np(CLOCK_UPTIME_RAW) / 1.0e9;
+}
+
+@implementation AVClockReconciler {
+    ClockSync _sync;
+}
+
+- (instancetype)initWithMaxSlewPerSecond:(double)maxSlewPerSecond {
+    self = [super init];
+    if (self) {
+        ClockSyncInit(&_sync, 0.5, maxSlewPerSecond);
+    }
+    return self;
+}
+
+- (instancetype)init {
+    return [self initWithMaxSlewPerSecond:0.005];
+}
+
+- (void)dealloc {
+    ClockSyncDestroy(&_sync);
+}
+
+- (void)reset {
+    ClockSyncReset(&_sync);
+}
+
+- (NSDictionary<NSString *, NSNumber *> *)statistics {
+    ClockSyncEstimate estimate = ClockSyncGetEstimate(&_sync);
+    return @{
+        @"offsetMs": @(estimate.offsetSeconds * 1000.0),
+        @"driftPpm": @(estimate.driftPpm),
+        @"appliedOffsetMs": @(estimate.appliedOffsetSeconds * 1000.0),
+        @"videoSamples": @(estimate.videoSamples),
+        @"audioSamples": @(estimate.audioSamples),
+        @"valid": @(estimate.valid),
+    };
+}
+
+- (void)observeVideoTimestamp:(double)timestamp {
+    ClockSyncObserveVideo(&_sync, timestamp, AVClockReconcilerHostSeconds());
+}
+
+- (CMSampleBufferRef)copyRetimedAudioSampleBuffer:(CMSampleBufferRef)sampleBuffer {
+    CMTime presentation = CMSampleBufferGetPresentationTimeStamp(sampleBuffer);
+    if (!CMTIME_IS_NUMERIC(presentation)) {
+        return (CMSampleBufferRef)CFRetain(sampleBuffer);
+    }
+    double audioTime = CMTimeGetSeconds(presentation);
+    ClockSyncObserveAudio(&_sync, audioTime, AVClockReconcilerHostSeconds());
+    double videoTime;
+    ClockSyncAudioToVideo(&_sync, audioTime, &videoTime);
+
+    // Whatever fails below, the audio is kept with its original timing rather than lost.
+    CMItemCount count = 0;
+    if (CMSampleBufferGetSampleTimingInfoArray(sampleBuffer, 0, NULL, &count) != noErr || count <= 0) {
+        return (CMSampleBufferRef)CFRetain(sampleBuffer);
+    }
+    CMSampleTimingInfo inlineTimings[kInlineTimingEntries];
+    CMSampleTimingInfo *timings = count <= kInlineTimingEntries ? inlineTimings : malloc(sizeof(CMSampleTimingInfo) * (size_t)count);
+    if (!timings) {
+        return (CMSampleBufferRef)CFRetain(sampleBuffer);
+    }
+    if (CMSampleBufferGetSampleTimingInfoArray(sampleBuffer, count, timings, &count) != noErr) {
+        if (timings != inlineTimings) {
+            free(timings);
+        }
+        return (CMSampleBufferRef)CFRetain(sampleBuffer);
+    }
+
+    // One shift for the whole buffer, so sample spacing is preserved.
+    CMTime shift = CMTimeSubtract(CMTimeMakeWithSeconds(videoTime, presentation.timescale), presentation);
+    for (CMItemCount i = 0; i < count; i++) {
+        if (CMTIME_IS_NUMERIC(timings[i].presentationTimeStamp)) {
+            timings[i].presentationTimeStamp = CMTimeAdd(timings[i].presentationTimeStamp, shift);
+        }
+        if (CMTIME_IS_NUMERIC(timings[i].decodeTimeStamp)) {
+            timings[i].decodeTimeStamp = CMTimeAdd(timings[i].decodeTimeStamp, shift);
+        }
+    }
+
+    CMSampleBufferRef retimed = NULL;
+    OSStatus status = CMSampleBufferCreateCopyWithNewTiming(kCFAllocatorDefault, sampleBuffer, count, timings, &retimed);
+    if (timings != inlineTimings) {
+        free(timings);
+    }
+    if (status != noErr || !retimed) {
+        if (retimed) {
+            CFRelease(retimed);
+        }
+        return (CMSampleBufferRef)CFRetain(sampleBuffer);
+    }
+    return retimed;
+}
+
+@end
@@ -0,0 +1,166 @@
+//
+//  ClockSync.c
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 18/10/2026.
+//
+
+#include "ClockSync.h"
+
+#include <math.h>
+#include <string.h>
+
+// Rate is only fitted once the points span this much host time; before that
+// jitter would dominate the slope and the clocks are assumed to tick alike.
+static const double kClockSyncMinRateSpan = 10.0;
+// Real oscillators are far closer than this; anything beyond is noise.
+static const double kClockSyncMaxRateError = 0.002;
+
+void ClockSyncInit(ClockSync *sync, double bucketSeconds, double maxSlewPerSecond) {
+    memset(sync, 0, sizeof(*sync));
+    pthread_mutex_init(&sync->mutex, NULL);
+    sync->bucketSeconds = bucketSeconds > 0.0 ? bucketSeconds : 0.5;
+    sync->maxSlewPerSecond = maxSlewPerSecond > 0.0 ? maxSlewPerSecond : 0.005;
+}
+
+void ClockSyncDestroy(ClockSync *sync) {
+    pthread_mutex_destroy(&sync->mutex);
+}
+
+void ClockSyncReset(ClockSync *sync) {
+    pthread_mutex_lock(&sync->mutex);
+    memset(&sync->video, 0, sizeof(sync->video));
+    memset(&sync->audio, 0, sizeof(sync->audio));
+    sync->hasOrigin = 0;
+    sync->hasApplied = 0;
+    sync->applied = 0.0;
+    sync->lastAudioTime = 0.0;
+    sync->lastOutput = 0.0;
+    pthread_mutex_unlock(&sync->mutex);
+}
+
+// Caller holds the mutex.
+static void ClockSyncObserve(ClockSync *sync, ClockSyncTrack *track, double mediaTime, double hostTime) {
+    if (!sync->hasOrigin) {
+        sync->hasOrigin = 1;
+        sync->hostOrigin = hostTime;
+        sync->latestHost = 0.0;
+    }
+    double host = hostTime - sync->hostOrigin;
+    sync->latestHost = host > sync->latestHost ? host : sync->latestHost;
+    int64_t bucket = (int64_t)floor(host / sync->bucketSeconds);
+    track->samples++;
+
+    int newest = (track->head + CLOCK_SYNC_MAX_POINTS - 1) % CLOCK_SYNC_MAX_POINTS;
+    if (track->count > 0 && track->bucket[newest] == bucket) {
+        // Same bucket: keep whichever sample arrived with the least delay.
+        if (host - mediaTime < track->host[newest] - track->media[newest]) {
+            track->host[newest] = host;
+            track->media[newest] = mediaTime;
+            track->dirty = 1;
+        }
+        return;
+    }
+    track->host[track->head] = host;
+    track->media[track->head] = mediaTime;
+    track->bucket[track->head] = bucket;
+    track->head = (track->head + 1) % CLOCK_SYNC_MAX_POINTS;
+    track->count = track->count < CLOCK_SYNC_MAX_POINTS ? track->count + 1 : CLOCK_SYNC_MAX_POINTS;
+    track->dirty = 1;
+}
+
+void ClockSyncObserveVideo(ClockSync *sync, double videoTime, double hostTime) {
+    pthread_mutex_lock(&sync->mutex);
+    ClockSyncObserve(sync, &sync->video, videoTime, hostTime);
+    pthread_mutex_unlock(&sync->mutex);
+}
+
+void ClockSyncObserveAudio(ClockSync *sync, double audioTime, double hostTime) {
+    pthread_mutex_lock(&sync->mutex);
+    ClockSyncObserve(sync, &sync->audio, audioTime, hostTime);
+    pthread_mutex_unlock(&sync->mutex);
+}
+
+// Least squares media = intercept + slope * host. Caller holds the mutex.
+static void ClockSyncFit(ClockSyncTrack *track) {
+    if (!track->dirty || track->count == 0) {
+        return;
+    }
+    track->dirty = 0;
+    double meanHost = 0.0, meanMedia = 0.0;
+    double minHost = track->host[0], maxHost = track->host[0];
+    for (int i = 0; i < track->count; i++) {
+        meanHost += track->host[i];
+        meanMedia += track->media[i];
+        minHost = fmin(minHost, track->host[i]);
+        maxHost = fmax(maxHost, track->host[i]);
+    }
+    meanHost /= track->count;
+    meanMedia /= track->count;
+
+    double slope = 1.0;
+    if (maxHost - minHost >= kClockSyncMinRateSpan) {
+        double sxx = 0.0, sxy = 0.0;
+        for (int i = 0; i < track->count; i++) {
+            double dh = track->host[i] - meanHost;
+            sxx += dh * dh;
+            sxy += dh * (track->media[i] - meanMedia);
+        }
+        slope = sxx > 0.0 ? sxy / sxx : 1.0;
+        slope = fmin(fmax(slope, 1.0 - kClockSyncMaxRateError), 1.0 + kClockSyncMaxRateError);
+    }
+    track->slope = slope;
+    track->intercept = meanMedia - slope * meanHost;
+}
+
+int ClockSyncAudioToVideo(ClockSync *sync, double audioTime, double *outVideoTime) {
+    pthread_mutex_lock(&sync->mutex);
+    int corrected = 0;
+    if (sync->video.count > 0 && sync->audio.count > 0) {
+        ClockSyncFit(&sync->video);
+        ClockSyncFit(&sync->audio);
+        double host = (audioTime - sync->audio.intercept) / sync->audio.slope;
+        double target = sync->video.intercept + sync->video.slope * host - audioTime;
+        if (!sync->hasApplied) {
+            sync->applied = target;
+            sync->hasApplied = 1;
+        } else {
+            double elapsed = audioTime - sync->lastAudioTime;
+            double maxStep = sync->maxSlewPerSecond * (elapsed > 0.0 ? elapsed : 0.0);
+            sync->applied += fmin(fmax(target - sync->applied, -maxStep), maxStep);
+        }
+        corrected = 1;
+    }
+
+    double output = audioTime + sync->applied;
+    if (sync->hasApplied && output < sync->lastOutput) {
+        output = sync->lastOutput;
+    }
+    sync->lastAudioTime = audioTime;
+    sync->lastOutput = output;
+    pthread_mutex_unlock(&sync->mutex);
+    *outVideoTime = output;
+    return corrected;
+}
+
+ClockSyncEstimate ClockSyncGetEstimate(ClockSync *sync) {
+    ClockSyncEstimate estimate;
+    memset(&estimate, 0, sizeof(estimate));
+    pthread_mutex_lock(&sync->mutex);
+    estimate.videoSamples = sync->video.samples;
+    estimate.audioSamples = sync->audio.samples;
+    estimate.videoPoints = (uint32_t)sync->video.count;
+    estimate.audioPoints = (uint32_t)sync->audio.count;
+    estimate.appliedOffsetSeconds = sync->applied;
+    if (sync->video.count > 0 && sync->audio.count > 0) {
+        ClockSyncFit(&sync->video);
+        ClockSyncFit(&sync->audio);
+        double host = sync->latestHost;
+        estimate.valid = 1;
+        estimate.offsetSeconds = (sync->audio.intercept + sync->audio.slope * host) -
+                                 (sync->video.intercept + sync->video.slope * host);
+        estimate.driftPpm = (sync->audio.slope / sync->video.slope - 1.0) * 1.0e6;
+    }
+    pthread_mutex_unlock(&sync->mutex);
+    return estimate;
+}
@@ -0,0 +1,110 @@
+//
+//  ClockSync.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 18/10/2026.
+//
+
+#ifndef CLOCK_SYNC_H
+#define CLOCK_SYNC_H
+
+#include <pthread.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define CLOCK_SYNC_MAX_POINTS 64
+
+typedef struct {
+    int valid;                    // Both clocks have been observed
+    double offsetSeconds;         // Audio clock minus video clock at the latest observation
+    double driftPpm;              // How much faster the audio clock runs than the video clock
+    double appliedOffsetSeconds;  // Correction ClockSyncAudioToVideo currently adds
+    uint64_t videoSamples;
+    uint64_t audioSamples;
+    uint32_t videoPoints;         // Fit points (least-delayed sample per bucket)
+    uint32_t audioPoints;
+} ClockSyncEstimate;
+
+// One media clock observed against the host clock.
+typedef struct {
+    double host[CLOCK_SYNC_MAX_POINTS];
+    double media[CLOCK_SYNC_MAX_POINTS];
+    int64_t bucket[CLOCK_SYNC_MAX_POINTS];
+    int head;
+    int count;
+    uint64_t samples;
+    int dirty;
+    double intercept;  // media = intercept + slope * host
+    double slope;
+} ClockSyncTrack;
+
+/**
+ * Reconciles the video timeline (timestamps from the processing path) with
+ * the audio timeline (sample buffers for addAudioInput:), which runs on
+ * its own clock.
+ *
+ * Each stream reports (media timestamp, host time of arrival). Arrival
+ * jitter only ever adds delay, so per bucket of host time only the
+ * least-delayed sample is kept. A least-squares line through those points
+ * gives each clock's rate and origin against the host clock. Together they
+ * give the A/V offset and drift.
+ *
+ * ClockSyncAudioToVideo retimes audio timestamps onto the video timeline.
+ * Only timestamps change; samples are never resampled or re-encoded. The
+ * first estimate is applied at once. Later revisions are slewed at
+ * maxSlewPerSecond so the audio never jumps, and output is kept monotonic.
+ *
+ * A constant latency difference between the two pipelines cannot be told
+ * apart from a clock offset; the estimate aligns arrival instants.
+ *
+ * Safe to call from the render and audio threads concurrently; every call
+ * holds the mutex for a fixed, small amount of work.
+ */
+typedef struct {
+    pthread_mutex_t mutex;
+    ClockSyncTrack video;
+    ClockSyncTrack audio;
+    double bucketSeconds;
+    double maxSlewPerSecond;
+    int hasOrigin;
+    double hostOrigin;    // Host times are stored relative to this for precision
+    double latestHost;
+    int hasApplied;
+    double applied;
+    double lastAudioTime;
+    double lastOutput;
+} ClockSync;
+
+/**
+ * bucketSeconds: host-time span represented by one fit point (0.5 s keeps
+ * CLOCK_SYNC_MAX_POINTS points = 32 s of history).
+ * maxSlewPerSecond: largest change of the applied correction per second of
+ * audio (e.g. 0.005 = 5 ms/s).
+ */
+void ClockSyncInit(ClockSync *sync, double bucketSeconds, double maxSlewPerSecond);
+void ClockSyncDestroy(ClockSync *sync);
+
+/// Forgets both clocks, e.g. at the start of a recording
+void ClockSyncReset(ClockSync *sync);
+
+void ClockSyncObserveVideo(ClockSync *sync, double videoTime, double hostTime);
+void ClockSyncObserveAudio(ClockSync *sync, double audioTime, double hostTime);
+
+/**
+ * Audio timestamp on the video timeline.
+ *
+ * @return 1 if a correction was applied, 0 if there is no estimate yet (the
+ *         time is passed through, still kept monotonic)
+ */
+int ClockSyncAudioToVideo(ClockSync *sync, double audioTime, double *outVideoTime);
+
+ClockSyncEstimate ClockSyncGetEstimate(ClockSync *sync);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CLOCK_SYNC_H */
@@ -0,0 +1,85 @@
+//
+//  CompressedFrameOutput.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 18/10/2026.
+//
+
+#import <Foundation/Foundation.h>
+#import <CoreVideo/CoreVideo.h>
+#import "FrameFanout.h"
+#import "NV12VideoWriter.h"
+#include "EncodedOutput.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// One access unit with its presentation time; called on the encoder's output thread
+typedef void (^CompressedFrameHandler)(NSData *accessUnit, double timestamp, BOOL keyFrame);
+
+/**
+ * Streaming output that delivers encoded access units instead of raw
+ * pixel buffers.
+ *
+ * Frames from liveFrameStreamCallback (or a FrameFanout sink) are queued
+ * without copying and encoded on their own thread, in parallel with
+ * rendering (see EncodedOutput). The encoder is pluggable: -startWithHandler:
+ * uses a VideoToolbox H.264 session, and -startWithEncoder:handler: takes
+ * any EncodedOutputEncoder, e.g. ReferenceEncoderCreate.
+ *
+ * H.264 access units are AVCC (4-byte big-endian NAL lengths). Key frames
+ * are preceded by their SPS and PPS in the same form, so each key frame
+ * can start a stream on its own.
+ *
+ * Append methods may be called from one producer thread at a time.
+ */
+@interface CompressedFrameOutput : NSObject
+
+@property (nonatomic, readonly) CGSize videoSize;
+@property (nonatomic, readonly) BOOL isRunning;
+
+/// Frames that may wait for the encoder. Default 4
+@property (nonatomic, assign) NSUInteger queueCapacity;
+
+/// Default NV12VideoWriterBackpressureDropNonCritical
+@property (nonatomic, assign) NV12VideoWriterBackpressure backpressurePolicy;
+
+/// Seconds between forced key frames. Default 2
+@property (nonatomic, assign) NSTimeInterval keyFrameInterval;
+
+/// H.264 average bit rate in bits per second. Default 4 Mbps
+@property (nonatomic, assign) int bitRate;
+
+/**
+ * submitted, encoded, droppedFrames, failedFrames, packets, keyFrames,
+ * bytes, queueDepth, maxQueueDepth, averageQueueMs, averageEncodeMs,
+ * latencyMs, averageLatencyMs and maxLatencyMs (latency is submit to
+ * access unit)
+ */
+@property (nonatomic, readonly) NSDictionary<NSString *, NSNumber *> *statistics;
+
+- (instancetype)initWithVideoSize:(CGSize)videoSize NS_DESIGNATED_INITIALIZER;
+- (instancetype)init NS_UNAVAILABLE;
+
+/// @return NO if already running or the H.264 session could not be created
+- (BOOL)startWithHandler:(CompressedFrameHandler)handler;
+
+/**
+ * Takes ownership of encoder. Frames are passed with their planes mapped
+ * for CPU reads.
+ *
+ * @return NO if already running
+ */
+- (BOOL)startWithEncoder:(EncodedOutputEncoder)encoder handler:(CompressedFrameHandler)handler;
+
+/// Encodes what is queued, flushes the encoder and returns once every access unit is delivered
+- (void)stop;
+
+/// NV12 or 32BGRA at videoSize. @return NO if the frame was dropped
+- (BOOL)appendPixelBuffer:(CVPixelBufferRef)pixelBuffer timestamp:(double)timestamp;
+
+/// Adds a sink that feeds this output. @return Token for -[FrameFanout removeSink:]
+- (id)attachToFanout:(FrameFanout *)fanout;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,362 @@
+//
+//  CompressedFrameOutput.m
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 18/10/2026.
+//
+
+#import "CompressedFrameOutput.h"
+#import <VideoToolbox/VideoToolbox.h>
+#import <os/lock.h>
+#include <stdatomic.h>
+#include <time.h>
+
+static const int32_t kCompressedFrameOutputTimescale = 90000;
+// How often stop polls for producers still inside an append.
+static const useconds_t kProducerWaitUs = 1000;
+
+#pragma mark - VideoToolbox Encoder
+
+typedef struct {
+    VTCompressionSessionRef session;
+    // Set by encode / flush on the encoder thread, read by the session's output callback.
+    _Atomic(EncodedPacketFn) emit;
+    _Atomic(void *) emitContext;
+} CompressedFrameH264Encoder;
+
+// Appends a NAL unit with a 4-byte big-endian length, the same framing as the sample data.
+static void CompressedFrameAppendNAL(NSMutableData *data, const uint8_t *nal, size_t size) {
+    uint32_t length = CFSwapInt32HostToBig((uint32_t)size);
+    [data appendBytes:&length length:sizeof(length)];
+    [data appendBytes:nal length:size];
+}
+
+static void CompressedFrameH264Output(void *outputRefCon,
+                                      void *sourceFrameRefCon,
+                                      OSStatus status,
+                                      VTEncodeInfoFlags infoFlags,
+                                      CMSampleBufferRef sampleBuffer) {
+    CompressedFrameH264Encoder *encoder = outputRefCon;
+    if (status != noErr || !sampleBuffer || (infoFlags & kVTEncodeInfo_FrameDropped)) {
+        return;
+    }
+    CFArrayRef attachments = CMSampleBufferGetSampleAttachmentsArray(sampleBuffer, false);
+    BOOL keyFrame = YES;
+    if (attachments && CFArrayGetCount(attachments) > 0) {
+        CFDictionaryRef attachment = CFArrayGetValueAtIndex(attachments, 0);
+        keyFrame = !CFDictionaryContainsKey(attachment, kCMSampleAttachmentKey_NotSync);
+    }
+
+    NSMutableData *accessUnit = [NSMutableData data];
+    if (keyFrame) {
+        CMFormatDescriptionRef format = CMSampleBufferGetFormatDescription(sampleBuffer);
+        size_t count = 0;
+        CMVideoFormatDescriptionGetH264ParameterSetAtIndex(format, 0, NULL, NULL, &count, NULL);
+        for (size_t i = 0; i < count; i++) {
+            const uint8_t *parameterSet = NULL;
+            size_t size = 0;
+            if (CMVideoFormatDescriptionGetH264ParameterSetAtIndex(format, i, &parameterSet, &size, NULL, NULL) == noErr) {
+                CompressedFrameAppendNAL(accessUnit, parameterSet, size);
+            }
+        }
+    }
+    CMBlockBufferRef block = CMSampleBufferGetDataBuffer(sampleBuffer);
+    size_t length = block ? CMBlockBufferGetDataLength(block) : 0;
+    if (length == 0) {
+        return;
+    }
+    NSUInteger offset = accessUnit.length;
+    accessUnit.length = offset + length;
+    if (CMBlockBufferCopyDataBytes(block, 0, length, (uint8_t *)accessUnit.mutableBytes + offset) != kCMBlockBufferNoErr) {
+        return;
+    }
+
+    EncodedPacket packet = {
+        .data = accessUnit.bytes,
+        .size = accessUnit.length,
+        .timestamp = CMTimeGetSeconds(CMSampleBufferGetPresentationTimeStamp(sampleBuffer)),
+        .keyFrame = keyFrame,
+        .frameIndex = (uint64_t)(uintptr_t)sourceFrameRefCon,
+    };
+    EncodedPacketFn emit = atomic_load(&encoder->emit);
+    if (emit) {
+        emit(atomic_load(&encoder->emitContext), &packet);
+    }
+}
+
+static int CompressedFrameH264Encode(void *context,
+                                     const EncodedFrame *frame,
+                                     int forceKeyFrame,
+                                     EncodedPacketFn emit,
+                                     void *emitContext) {
+    CompressedFrameH264Encoder *encoder = context;
+    atomic_store(&encoder->emitContext, emitContext);
+    atomic_store(&encoder->emit, emit);
+    NSDictionary *properties = forceKeyFrame ? @{(__bridge NSString *)kVTEncodeFrameOptionKey_ForceKeyFrame: @YES} : nil;
+    OSStatus status = VTCompressionSessionEncodeFrame(encoder->session,
+                                                      (CVPixelBufferRef)frame->owner,
+                                                      CMTimeMakeWithSeconds(frame->timestamp, kCompressedFrameOutputTimescale),
+                                                      kCMTimeInvalid,
+                                                      (__bridge CFDictionaryRef)properties,
+                                                      (void *)(uintptr_t)frame->index,
+                                                      NULL);
+    return status == noErr ? 0 : -1;
+}
+
+static void CompressedFrameH264Flush(void *context, EncodedPacketFn emit, void *emitContext) {
+    CompressedFrameH264Encoder *encoder = context;
+    atomic_store(&encoder->emitContext, emitContext);
+    atomic_store(&encoder->emit, emit);
+    VTCompressionSessionCompleteFrames(encoder->session, kCMTimeInvalid);
+}
+
+static void CompressedFrameH264Destroy(void *context) {
+    CompressedFrameH264Encoder *encoder = context;
+    VTCompressionSessionInvalidate(encoder->session);
+    CFRelease(encoder->session);
+    free(encoder);
+}
+
+static EncodedOutputEncoder CompressedFrameH264Create(int width, int height, double keyFrameInterval, int bitRate) {
+    EncodedOutputEncoder result = {0};
+    CompressedFrameH264Encoder *encoder = calloc(1, sizeof(CompressedFrameH264Encoder));
+    if (!encoder) {
+        return result;
+    }
+    OSStatus status = VTCompressionSessionCreate(kCFAllocatorDefault, width, height, kCMVideoCodecType_H264,
+                                                 NULL, NULL, NULL, CompressedFrameH264Output, encoder, &encoder->session);
+    if (status != noErr) {
+        free(encoder);
+        return result;
+    }
+    VTSessionRef session = encoder->session;
+    VTSessionSetProperty(session, kVTCompressionPropertyKey_RealTime, kCFBooleanTrue);
+    // Without B-frames every access unit comes out in submit order, one per frame.
+    VTSessionSetProperty(session, kVTCompressionPropertyKey_AllowFrameReordering, kCFBooleanFalse);
+    VTSessionSetProperty(session, kVTCompressionPropertyKey_ProfileLevel, kVTProfileLevel_H264_Baseline_AutoLevel);
+    VTSessionSetProperty(session, kVTCompressionPropertyKey_AverageBitRate, (__bridge CFNumberRef)@(bitRate));
+    if (keyFrameInterval > 0.0) {
+        VTSessionSetProperty(session, kVTCompressionPropertyKey_MaxKeyFrameIntervalDuration,
+                             (__bridge CFNumberRef)@(keyFrameInterval));
+    }
+    VTCompressionSessionPrepareToEncodeFrames(encoder->session);
+
+    result.context = encoder;
+    result.encode = CompressedFrameH264Encode;
+    result.flush = CompressedFrameH264Flush;
+    result.destroy = CompressedFrameH264Destroy;
+    return result;
+}
+
+#pragma mark - Frame Ownership
+
+// VideoToolbox reads the buffer itself; the output only holds a reference.
+static void CompressedFrameReleaseBuffer(void *owner) {
+    CVPixelBufferRelease((CVPixelBufferRef)owner);
+}
+
+// Software encoders read the planes, which stay mapped until the frame is encoded.
+static void CompressedFrameReleaseMappedBuffer(void *owner) {
+    CVPixelBufferRef pixelBuffer = owner;
+    CVPixelBufferUnlockBaseAddress(pixelBuffer, kCVPixelBufferLock_ReadOnly);
+    CVPixelBufferRelease(pixelBuffer);
+}
+
+static void CompressedFramePacket(void *context, const EncodedPacket *packet) {
+    CompressedFrameHandler handler = (__bridge CompressedFrameHandler)context;
+    handler([NSData dataWithBytes:packet->data length:packet->size], packet->timestamp, packet->keyFrame != 0);
+}
+
+@implementation CompressedFrameOutput {
+    os_unfair_lock _lock;
+    EncodedOutput _output;
+    CompressedFrameHandler _handler;
+    BOOL _mapsPlanes;
+    atomic_bool _accepting;
+    atomic_int _activeProducers;
+
+    // Guarded by _lock.
+    BOOL _running;
+    EncodedOutputStats _lastStats;
+}
+
+- (instancetype)initWithVideoSize:(CGSize)videoSize {
+    self = [super init];
+    if (self) {
+        _lock = OS_UNFAIR_LOCK_INIT;
+        _videoSize = videoSize;
+        _queueCapacity = 4;
+        _backpressurePolicy = NV12VideoWriterBackpressureDropNonCritical;
+        _keyFrameInterval = 2.0;
+        _bitRate = 4000000;
+        atomic_init(&_accepting, false);
+        atomic_init(&_activeProducers, 0);
+    }
+    return self;
+}
+
+- (void)dealloc {
+    [self stop];
+}
+
+- (BOOL)isRunning {
+    os_unfair_lock_lock(&_lock);
+    BOOL running = _running;
+    os_unfair_lock_unlock(&_lock);
+    return running;
+}
+
+- (NSDictionary<NSString *, NSNumber *> *)statistics {
+    os_unfair_lock_lock(&_lock);
+    EncodedOutputStats stats = _running ? EncodedOutputGetStats(&_output) : _lastStats;
+    os_unfair_lock_unlock(&_lock);
+    return @{
+        @"submitted": @(stats.submitted),
+        @"encoded": @(stats.encoded),
+        @"droppedFrames": @(stats.dropped),
+        @"failedFrames": @(stats.failed),
+        @"packets": @(stats.packets),
+        @"keyFrames": @(stats.keyFrames),
+        @"bytes": @(stats.bytes),
+        @"queueDepth": @(stats.queueDepth),
+        @"maxQueueDepth": @(stats.maxQueueDepth),
+        @"averageQueueMs": @(stats.averageQueueMs),
+        @"averageEncodeMs": @(stats.averageEncodeMs),
+        @"latencyMs": @(stats.lastLatencyMs),
+        @"averageLatencyMs": @(stats.averageLatencyMs),
+        @"maxLatencyMs": @(stats.maxLatencyMs),
+    };
+}
+
+#pragma mark - Lifecycle
+
+- (BOOL)startWithHandler:(CompressedFrameHandler)handler {
+    if (self.isRunning) {
+        return NO;
+    }
+    EncodedOutputEncoder encoder = CompressedFrameH264Create((int)self.videoSize.width, (int)self.videoSize.height,
+                                                             self.keyFrameInterval, self.bitRate);
+    if (!encoder.encode) {
+        NSLog(@"❌ CompressedFrameOutput: H.264 session could not be created");
+        return NO;
+    }
+    return [self startEncoder:encoder mapsPlanes:NO handler:handler];
+}
+
+- (BOOL)startWithEncoder:(EncodedOutputEncoder)encoder handler:(CompressedFrameHandler)handler {
+    if (self.isRunning) {
+        if (encoder.destroy) encoder.destroy(encoder.context);
+        return NO;
+    }
+    return [self startEncoder:encoder mapsPlanes:YES handler:handler];
+}
+
+- (BOOL)startEncoder:(EncodedOutputEncoder)encoder mapsPlanes:(BOOL)mapsPlanes handler:(CompressedFrameHandler)handler {
+    _handler = [handler copy];
+    _mapsPlanes = mapsPlanes;
+    EncodedOutputConfig config = {
+        .encoder = encoder,
+        .onPacket = CompressedFramePacket,
+        .packetContext = (__bridge void *)_handler,
+        .releaseFrame = mapsPlanes ? CompressedFrameReleaseMappedBuffer : CompressedFrameReleaseBuffer,
+        .queueCapacity = self.queueCapacity,
+        .policy = (FrameQueuePolicy)self.backpressurePolicy,
+        .keyFrameInterval = self.keyFrameInterval,
+    };
+    os_unfair_lock_lock(&_lock);
+    _running = EncodedOutputStart(&_output, &config) == 0;
+    BOOL running = _running;
+    os_unfair_lock_unlock(&_lock);
+    if (running) {
+        atomic_store(&_accepting, true);
+    }
+    return running;
+}
+
+- (void)stop {
+    if (!self.isRunning) {
+        return;
+    }
+    atomic_store(&_accepting, false);
+    while (atomic_load(&_activeProducers) > 0) {
+        usleep(kProducerWaitUs);
+    }
+    // Statistics read the snapshot from here on, so the output can be torn down unlocked.
+    os_unfair_lock_lock(&_lock);
+    _lastStats = EncodedOutputGetStats(&_output);
+    _running = NO;
+    os_unfair_lock_unlock(&_lock);
+
+    // Joins the encoder thread, which delivers the remaining access units first.
+    EncodedOutputStop(&_output);
+    os_unfair_lock_lock(&_lock);
+    _lastStats = EncodedOutputGetStats(&_output);
+    os_unfair_lock_unlock(&_lock);
+    _handler = nil;
+}
+
+#pragma mark - Producer
+
+- (BOOL)beginProducing {
+    atomic_fetch_add(&_activeProducers, 1);
+    if (!atomic_load(&_accepting)) {
+        atomic_fetch_sub(&_activeProducers, 1);
+        return NO;
+    }
+    return YES;
+}
+
+- (void)endProducing {
+    atomic_fetch_sub(&_activeProducers, 1);
+}
+
+- (BOOL)appendPixelBuffer:(CVPixelBufferRef)pixelBuffer timestamp:(double)timestamp {
+    OSType format = CVPixelBufferGetPixelFormatType(pixelBuffer);
+    BOOL nv12 = format == kCVPixelFormatType_420YpCbCr8BiPlanarVideoRange;
+    if (!nv12 && format != kCVPixelFormatType_32BGRA) {
+        return NO;
+    }
+    if ((int)CVPixelBufferGetWidth(pixelBuffer) != (int)self.videoSize.width ||
+        (int)CVPixelBufferGetHeight(pixelBuffer) != (int)self.videoSize.height) {
+        return NO;
+    }
+    if (![self beginProducing]) {
+        return NO;
+    }
+    EncodedFrame frame = {
+        .width = (int)self.videoSize.width,
+        .height = (int)self.videoSize.height,
+        // BGRA goes through as four bytes per pixel; byte order is the encoder's business.
+        .format = nv12 ? EncodedFrameFormatNV12 : EncodedFrameFormatRGBA,
+        .timestamp = timestamp,
+        .owner = (void *)CVPixelBufferRetain(pixelBuffer),
+    };
+    if (_mapsPlanes) {
+        CVPixelBufferLockBaseAddress(pixelBuffer, kCVPixelBufferLock_ReadOnly);
+        for (size_t plane = 0; plane < (nv12 ? 2 : 1); plane++) {
+            frame.planes[plane] = nv12 ? CVPixelBufferGetBaseAddressOfPlane(pixelBuffer, plane)
+                                       : CVPixelBufferGetBaseAddress(pixelBuffer);
+            frame.strides[plane] = nv12 ? CVPixelBufferGetBytesPerRowOfPlane(pixelBuffer, plane)
+                                        : CVPixelBufferGetBytesPerRow(pixelBuffer);
+        }
+    }
+    BOOL queued = EncodedOutputSubmit(&_output, &frame) == 0;
+    if (!queued) {
+        if (_mapsPlanes) {
+            CompressedFrameReleaseMappedBuffer(pixelBuffer);
+        } else {
+            CompressedFrameReleaseBuffer(pixelBuffer);
+        }
+    }
+    [self endProducing];
+    return queued;
+}
+
+- (id)attachToFanout:(FrameFanout *)fanout {
+    __weak CompressedFrameOutput *weakSelf = self;
+    return [fanout addSinkNamed:@"compressed" handler:^(CVPixelBufferRef pixelBuffer, double timestamp) {
+        [weakSelf appendPixelBuffer:pixelBuffer timestamp:timestamp];
+    }];
+}
+
+@end
@@ -0,0 +1,226 @@
+//
+//  EncodedOutput.c
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 18/10/2026.
+//
+
+#include "EncodedOutput.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// Producer / encoder wake-up interval while waiting on the other side.
+static const long kEncodedOutputWaitNs = 10 * 1000 * 1000;
+
+static double EncodedOutputNowMs(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1000.0 + (double)ts.tv_nsec / 1.0e6;
+}
+
+// Caller holds the mutex.
+static void EncodedOutputWait(EncodedOutput *output, pthread_cond_t *condition) {
+    struct timespec deadline;
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_nsec += kEncodedOutputWaitNs;
+    if (deadline.tv_nsec >= 1000000000L) {
+        deadline.tv_sec += 1;
+        deadline.tv_nsec -= 1000000000L;
+    }
+    pthread_cond_timedwait(condition, &output->mutex, &deadline);
+}
+
+static void EncodedOutputEmit(void *context, const EncodedPacket *packet) {
+    EncodedOutput *output = context;
+    double now = EncodedOutputNowMs();
+    EncodedPacket delivered = *packet;
+
+    pthread_mutex_lock(&output->mutex);
+    size_t slot = (size_t)(packet->frameIndex % ENCODED_OUTPUT_LATENCY_SLOTS);
+    if (output->submitIndex[slot] == packet->frameIndex) {
+        delivered.latencyMs = now - output->submitMs[slot];
+        output->stats.lastLatencyMs = delivered.latencyMs;
+        output->stats.maxLatencyMs = fmax(output->stats.maxLatencyMs, delivered.latencyMs);
+        output->totalLatencyMs += delivered.latencyMs;
+    }
+    output->stats.packets++;
+    output->stats.bytes += packet->size;
+    output->stats.keyFrames += packet->keyFrame ? 1 : 0;
+    pthread_mutex_unlock(&output->mutex);
+
+    if (output->config.onPacket) {
+        output->config.onPacket(output->config.packetContext, &delivered);
+    }
+}
+
+static void EncodedOutputRelease(EncodedOutput *output, EncodedFrame *frame) {
+    if (output->config.releaseFrame && frame->owner) {
+        output->config.releaseFrame(frame->owner);
+    }
+    free(frame);
+}
+
+static void *EncodedOutputThreadMain(void *context) {
+    EncodedOutput *output = context;
+    while (1) {
+        FrameQueueEntry entry;
+        if (FrameQueuePop(&output->queue, EncodedOutputNowMs(), &entry)) {
+            pthread_cond_signal(&output->spaceCondition);
+            EncodedFrame *frame = entry.item;
+            double start = EncodedOutputNowMs();
+            int result = output->config.encoder.encode(output->config.encoder.context, frame, entry.critical,
+                                                       EncodedOutputEmit, output);
+            double elapsed = EncodedOutputNowMs() - start;
+            EncodedOutputRelease(output, frame);
+
+            pthread_mutex_lock(&output->mutex);
+            output->totalEncodeMs += elapsed;
+            if (result == 0) {
+                output->stats.encoded++;
+            } else {
+                output->stats.failed++;
+            }
+            pthread_mutex_unlock(&output->mutex);
+            continue;
+        }
+
+        pthread_mutex_lock(&output->mutex);
+        int finished = output->stopping && FrameQueueDepth(&output->queue) == 0;
+        if (!finished) {
+            EncodedOutputWait(output, &output->itemsCondition);
+        }
+        pthread_mutex_unlock(&output->mutex);
+        if (finished) {
+            break;
+        }
+    }
+    if (output->config.encoder.flush) {
+        output->config.encoder.flush(output->config.encoder.context, EncodedOutputEmit, output);
+    }
+    return NULL;
+}
+
+int EncodedOutputStart(EncodedOutput *output, const EncodedOutputConfig *config) {
+    memset(output, 0, sizeof(*output));
+    output->config = *config;
+    size_t capacity = config->queueCapacity > 0 ? config->queueCapacity : 4;
+    size_t reserve = capacity / 4 > 1 ? capacity / 4 : 1;
+    if (!config->encoder.encode || FrameQueueInit(&output->queue, capacity, config->policy, reserve) != 0) {
+        if (config->encoder.destroy) {
+            config->encoder.destroy(config->encoder.context);
+        }
+        return -1;
+    }
+    for (size_t i = 0; i < ENCODED_OUTPUT_LATENCY_SLOTS; i++) {
+        output->submitIndex[i] = UINT64_MAX;
+    }
+    pthread_mutex_init(&output->mutex, NULL);
+    pthread_cond_init(&output->itemsCondition, NULL);
+    pthread_cond_init(&output->spaceCondition, NULL);
+    if (pthread_create(&output->thread, NULL, EncodedOutputThreadMain, output) != 0) {
+        pthread_cond_destroy(&output->itemsCondition);
+        pthread_cond_destroy(&output->spaceCondition);
+        pthread_mutex_destroy(&output->mutex);
+        FrameQueueFree(&output->queue);
+        if (config->encoder.destroy) {
+            config->encoder.destroy(config->encoder.context);
+        }
+        return -1;
+    }
+    output->running = 1;
+    return 0;
+}
+
+int EncodedOutputSubmit(EncodedOutput *output, const EncodedFrame *frame) {
+    if (!output->running) {
+        return -1;
+    }
+    long slot = output->config.keyFrameInterval > 0.0 ? (long)floor(frame->timestamp / output->config.keyFrameInterval) : 0;
+    int critical = output->config.keyFrameInterval > 0.0 && (!output->hasKeySlot || slot != output->lastKeySlot);
+
+    EncodedFrame *item = malloc(sizeof(EncodedFrame));
+    if (!item) {
+        FrameQueueCountDrop(&output->queue, critical);
+        return -1;
+    }
+    *item = *frame;
+    item->index = output->nextIndex++;
+
+    double now = EncodedOutputNowMs();
+    pthread_mutex_lock(&output->mutex);
+    size_t latencySlot = (size_t)(item->index % ENCODED_OUTPUT_LATENCY_SLOTS);
+    output->submitIndex[latencySlot] = item->index;
+    output->submitMs[latencySlot] = now;
+    pthread_mutex_unlock(&output->mutex);
+
+    FrameQueuePushResult result;
+    while ((result = FrameQueuePush(&output->queue, item, frame->timestamp, critical, now)) == FrameQueuePushFull) {
+        pthread_mutex_lock(&output->mutex);
+        int stopping = output->stopping;
+        if (!stopping) {
+            EncodedOutputWait(output, &output->spaceCondition);
+        }
+        pthread_mutex_unlock(&output->mutex);
+        if (stopping) {
+            FrameQueueCountDrop(&output->queue, critical);
+            result = FrameQueuePushDropped;
+            break;
+        }
+        now = EncodedOutputNowMs();
+    }
+    if (result != FrameQueuePushQueued) {
+        free(item);
+        return -1;
+    }
+    if (critical) {
+        output->hasKeySlot = 1;
+        output->lastKeySlot = slot;
+    }
+    pthread_cond_signal(&output->itemsCondition);
+    return 0;
+}
+
+void EncodedOutputStop(EncodedOutput *output) {
+    if (!output->running) {
+        return;
+    }
+    pthread_mutex_lock(&output->mutex);
+    output->stopping = 1;
+    pthread_cond_broadcast(&output->itemsCondition);
+    pthread_cond_broadcast(&output->spaceCondition);
+    pthread_mutex_unlock(&output->mutex);
+    pthread_join(output->thread, NULL);
+
+    // Snapshot the queue counters before the queue goes away.
+    output->stats = EncodedOutputGetStats(output);
+    output->running = 0;
+    if (output->config.encoder.destroy) {
+        output->config.encoder.destroy(output->config.encoder.context);
+    }
+    FrameQueueFree(&output->queue);
+    pthread_cond_destroy(&output->itemsCondition);
+    pthread_cond_destroy(&output->spaceCondition);
+    pthread_mutex_destroy(&output->mutex);
+}
+
+EncodedOutputStats EncodedOutputGetStats(EncodedOutput *output) {
+    if (!output->running) {
+        return output->stats;
+    }
+    FrameQueueStats queue = FrameQueueGetStats(&output->queue);
+    pthread_mutex_lock(&output->mutex);
+    EncodedOutputStats stats = output->stats;
+    uint64_t finished = stats.encoded + stats.failed;
+    stats.averageEncodeMs = finished > 0 ? output->totalEncodeMs / (double)finished : 0.0;
+    stats.averageLatencyMs = stats.packets > 0 ? output->totalLatencyMs / (double)stats.packets : 0.0;
+    pthread_mutex_unlock(&output->mutex);
+    stats.submitted = queue.submitted;
+    stats.dropped = queue.dropped;
+    stats.queueDepth = queue.depth;
+    stats.maxQueueDepth = queue.maxDepth;
+    stats.averageQueueMs = queue.averageLagMs;
+    return stats;
+}
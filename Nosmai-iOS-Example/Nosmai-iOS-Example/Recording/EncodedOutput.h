@@ -0,0 +1,145 @@
+//
+//  EncodedOutput.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 18/10/2026.
+//
+
+#ifndef ENCODED_OUTPUT_H
+#define ENCODED_OUTPUT_H
+
+#include <pthread.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "FrameQueue.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    EncodedFrameFormatNV12 = 0,  // planes[0] Y, planes[1] interleaved CbCr
+    EncodedFrameFormatRGBA = 1   // planes[0] only
+} EncodedFrameFormat;
+
+typedef struct {
+    const uint8_t *planes[2];
+    size_t strides[2];
+    int width;
+    int height;
+    EncodedFrameFormat format;
+    double timestamp;
+    void *owner;     // Keeps the planes alive until the output releases it
+    uint64_t index;  // Assigned by EncodedOutputSubmit
+} EncodedFrame;
+
+/// One access unit; data is only valid during the callback
+typedef struct {
+    const uint8_t *data;
+    size_t size;
+    double timestamp;
+    int keyFrame;
+    uint64_t frameIndex;  // EncodedFrame.index of the frame it encodes
+    double latencyMs;     // Submit -> packet, filled in by the output
+} EncodedPacket;
+
+typedef void (*EncodedPacketFn)(void *context, const EncodedPacket *packet);
+
+/**
+ * Pluggable encoder. encode may emit the packet at once (the software
+ * reference encoder) or later from another thread (a hardware session);
+ * flush emits whatever is still pending. Both run on the encoder thread.
+ */
+typedef struct {
+    void *context;
+    /// @return 0 on success, -1 if the frame could not be encoded
+    int (*encode)(void *context, const EncodedFrame *frame, int forceKeyFrame, EncodedPacketFn emit, void *emitContext);
+    void (*flush)(void *context, EncodedPacketFn emit, void *emitContext);
+    void (*destroy)(void *context);
+} EncodedOutputEncoder;
+
+typedef struct {
+    EncodedOutputEncoder encoder;        // Owned by the output from EncodedOutputStart on
+    EncodedPacketFn onPacket;            // Called on whichever thread the encoder emits from
+    void *packetContext;
+    void (*releaseFrame)(void *owner);   // Optional; called once per submitted frame
+    size_t queueCapacity;                // Frames waiting for the encoder
+    FrameQueuePolicy policy;
+    double keyFrameInterval;             // Seconds; 0 leaves key frames to the encoder
+} EncodedOutputConfig;
+
+typedef struct {
+    uint64_t submitted;
+    uint64_t encoded;
+    uint64_t dropped;
+    uint64_t failed;
+    uint64_t packets;
+    uint64_t keyFrames;
+    uint64_t bytes;
+    uint32_t queueDepth;
+    uint32_t maxQueueDepth;
+    double averageQueueMs;      // Submit -> encoder picks the frame up
+    double averageEncodeMs;     // Time inside encode, including onPacket when the encoder emits synchronously
+    double lastLatencyMs;       // Submit -> packet
+    double averageLatencyMs;
+    double maxLatencyMs;
+} EncodedOutputStats;
+
+#define ENCODED_OUTPUT_LATENCY_SLOTS 256
+
+/**
+ * Output sink that turns rendered frames into encoded access units.
+ *
+ * Submit only queues the frame. Its planes are not copied: the owner keeps
+ * them alive and goes to releaseFrame once the frame is encoded. Encoding
+ * runs on its own thread, in parallel with rendering the next frame.
+ *
+ * The queue is a FrameQueue with the usual backpressure policies; key
+ * frame boundaries are critical and survive
+ * FrameQueuePolicyDropNonCritical.
+ */
+typedef struct {
+    EncodedOutputConfig config;
+    FrameQueue queue;
+    pthread_t thread;
+    pthread_mutex_t mutex;
+    pthread_cond_t itemsCondition;
+    pthread_cond_t spaceCondition;
+    int running;
+    int stopping;
+
+    // Producer only.
+    uint64_t nextIndex;
+    int hasKeySlot;
+    long lastKeySlot;
+
+    // Guarded by mutex.
+    double submitMs[ENCODED_OUTPUT_LATENCY_SLOTS];
+    uint64_t submitIndex[ENCODED_OUTPUT_LATENCY_SLOTS];
+    EncodedOutputStats stats;
+    double totalEncodeMs;
+    double totalLatencyMs;
+} EncodedOutput;
+
+/// @return 0 on success, -1 if the queue or thread could not be created (the encoder is destroyed)
+int EncodedOutputStart(EncodedOutput *output, const EncodedOutputConfig *config);
+
+/**
+ * Queues a frame. Under FrameQueuePolicyBlock waits for room.
+ *
+ * @return 0 if queued (the output now releases the owner), -1 if dropped
+ *         (the caller keeps it)
+ */
+int EncodedOutputSubmit(EncodedOutput *output, const EncodedFrame *frame);
+
+/// Encodes everything queued, flushes the encoder, joins the thread and destroys the encoder
+void EncodedOutputStop(EncodedOutput *output);
+
+EncodedOutputStats EncodedOutputGetStats(EncodedOutput *output);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ENCODED_OUTPUT_H */
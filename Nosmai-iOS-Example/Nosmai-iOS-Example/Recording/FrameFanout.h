@@ -0,0 +1,88 @@
+//
+//  FrameFanout.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 18/10/2026.
+//
+
+#import <UIKit/UIKit.h>
+#import <CoreVideo/CoreVideo.h>
+#import <nosmai/Nosmai.h>
+#import "NV12VideoWriter.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Called on the processing thread. Retain the buffer to keep it; never write to it
+typedef void (^FrameFanoutSink)(CVPixelBufferRef pixelBuffer, double timestamp);
+
+/**
+ * One readback per processed frame, shared by every consumer.
+ *
+ * Live streaming (liveFrameStreamCallback / setCVPixelBufferCallback:),
+ * recording (setRecordingCallback:) and capturePhoto: each read the
+ * rendered frame back on their own, so every extra consumer costs another
+ * full-frame copy. The fanout takes the frame once, from
+ * liveFrameStreamCallback, and hands the same CVPixelBuffer to every sink.
+ * The buffer is reference counted: a sink that needs the frame after
+ * returning (an encoder queue, a photo) retains it, and the pixels are never
+ * copied.
+ *
+ * Sinks may be added and removed from any thread; a frame already being
+ * delivered still reaches the sinks that were registered when it arrived.
+ *
+ * VideoFilterController does not attach one. It records through
+ * -[NosmaiCore startRecordingWithCompletion:], whose readback happens
+ * inside the SDK, or with -NosmaiNV12Recording from setRecordingCallback:
+ * alone; either way there is one consumer and no streaming, so attaching
+ * would add a readback per frame rather than share one. Apps with several pixel buffer
+ * consumers route them all through a single fanout.
+ */
+@interface FrameFanout : NSObject
+
+@property (nonatomic, readonly) BOOL isAttached;
+@property (nonatomic, readonly) NSUInteger sinkCount;
+
+/**
+ * - frames: frames read back.
+ * - readbackBytes: pixel bytes of every frame delivered, counted once per
+ *   frame however many sinks it reaches; readbackBytesPerFrame is the
+ *   average.
+ * - copiedBytes: pixel bytes the fanout copied; only photos are copied
+ *   (into their image), sinks get the frame itself.
+ * - sinks, deliveries and deliveriesPerFrame.
+ * - averageFanoutUs and maxFanoutUs: time to hand one frame to every sink.
+ * - photos: photos taken from the shared frame.
+ */
+@property (nonatomic, readonly) NSDictionary<NSString *, NSNumber *> *statistics;
+
+/**
+ * Takes over liveFrameStreamCallback and turns off the SDK's separate
+ * live-frame output, so frames are read back once. Consumers that used
+ * setRecordingCallback: should become sinks (see -addRecordingSink:).
+ *
+ * The SDK cannot report whether its live-frame output is on, so the caller
+ * says; -detach (or deallocation) restores that state and the callback
+ * the core had before.
+ */
+- (void)attachToCore:(NosmaiCore *)core liveFrameOutputEnabled:(BOOL)liveFrameOutputEnabled;
+- (void)detach;
+
+/// @return Token for -removeSink:
+- (id)addSinkNamed:(NSString *)name handler:(FrameFanoutSink)handler;
+- (void)removeSink:(id)token;
+
+/// Feeds the writer straight from the shared buffer (converted on its encoder thread)
+- (id)addRecordingSink:(NV12VideoWriter *)writer;
+
+/**
+ * Same result as -[NosmaiCore capturePhoto:], built from the next shared
+ * frame instead of a separate readback. Completion runs on the main queue.
+ */
+- (void)capturePhoto:(void (^)(UIImage * _Nullable image, NSError * _Nullable error))completion;
+
+/// Delivers one frame to every sink. Called by the attached core; also usable with other frame sources
+- (void)deliverPixelBuffer:(CVPixelBufferRef)pixelBuffer timestamp:(double)timestamp;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,262 @@
+//
+//  FrameFanout.m
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 18/10/2026.
+//
+
+#import "FrameFanout.h"
+#import <CoreImage/CoreImage.h>
+#import <os/lock.h>
+#include <time.h>
+
+static NSString * const kFrameFanoutErrorDomain = @"FrameFanout";
+// A photo request fails if no frame arrives within this time.
+static const double kPhotoTimeoutSeconds = 1.0;
+
+static double FrameFanoutNowMs(void) {
+    return (double)clock_gettime_nsec_np(CLOCK_UPTIME_RAW) / 1.0e6;
+}
+
+static size_t FrameFanoutPixelBytes(CVPixelBufferRef pixelBuffer) {
+    if (!CVPixelBufferIsPlanar(pixelBuffer)) {
+        return CVPixelBufferGetBytesPerRow(pixelBuffer) * CVPixelBufferGetHeight(pixelBuffer);
+    }
+    size_t bytes = 0;
+    for (size_t plane = 0; plane < CVPixelBufferGetPlaneCount(pixelBuffer); plane++) {
+        bytes += CVPixelBufferGetBytesPerRowOfPlane(pixelBuffer, plane) * CVPixelBufferGetHeightOfPlane(pixelBuffer, plane);
+    }
+    return bytes;
+}
+
+@interface FrameFanoutEntry : NSObject
+@property (nonatomic, copy) NSString *name;
+@property (nonatomic, copy) FrameFanoutSink handler;
+@end
+
+@implementation FrameFanoutEntry
+@end
+
+@implementation FrameFanout {
+    os_unfair_lock _lock;
+    dispatch_queue_t _photoQueue;
+    CIContext *_photoContext;
+    __weak NosmaiCore *_core;
+    void (^_previousStreamCallback)(CVPixelBufferRef, double);
+    BOOL _restoreLiveFrameOutput;
+
+    // Guarded by _lock. Replaced, never mutated, so delivery can use a snapshot.
+    NSArray<FrameFanoutEntry *> *_sinks;
+    NSMutableArray *_pendingPhotos;
+    uint64_t _frames;
+    uint64_t _deliveries;
+    uint64_t _photos;
+    uint64_t _readbackBytes;
+    uint64_t _copiedBytes;
+    double _fanoutMs;
+    double _maxFanoutMs;
+}
+
+- (instancetype)init {
+    self = [super init];
+    if (self) {
+        _lock = OS_UNFAIR_LOCK_INIT;
+        _photoQueue = dispatch_queue_create("com.nosmai.example.fanout-photo",
+                                            dispatch_queue_attr_make_with_qos_class(DISPATCH_QUEUE_SERIAL, QOS_CLASS_USER_INITIATED, 0));
+        _sinks = @[];
+        _pendingPhotos = [NSMutableArray array];
+    }
+    return self;
+}
+
+- (void)dealloc {
+    [self detach];
+}
+
+- (BOOL)isAttached {
+    os_unfair_lock_lock(&_lock);
+    BOOL attached = _core != nil;
+    os_unfair_lock_unlock(&_lock);
+    return attached;
+}
+
+- (NSUInteger)sinkCount {
+    os_unfair_lock_lock(&_lock);
+    NSUInteger count = _sinks.count;
+    os_unfair_lock_unlock(&_lock);
+    return count;
+}
+
+- (NSDictionary<NSString *, NSNumber *> *)statistics {
+    os_unfair_lock_lock(&_lock);
+    NSDictionary *stats = @{
+        @"frames": @(_frames),
+        @"readbackBytes": @(_readbackBytes),
+        @"readbackBytesPerFrame": @(_frames > 0 ? _readbackBytes / _frames : 0),
+        @"copiedBytes": @(_copiedBytes),
+        @"sinks": @(_sinks.count),
+        @"deliveries": @(_deliveries),
+        @"deliveriesPerFrame": @(_frames > 0 ? (double)_deliveries / (double)_frames : 0.0),
+        @"averageFanoutUs": @(_frames > 0 ? _fanoutMs * 1000.0 / (double)_frames : 0.0),
+        @"maxFanoutUs": @(_maxFanoutMs * 1000.0),
+        @"photos": @(_photos),
+    };
+    os_unfair_lock_unlock(&_lock);
+    return stats;
+}
+
+#pragma mark - Attachment
+
+- (void)attachToCore:(NosmaiCore *)core liveFrameOutputEnabled:(BOOL)liveFrameOutputEnabled {
+    [self detach];
+    void (^previousCallback)(CVPixelBufferRef, double) = core.liveFrameStreamCallback;
+    __weak FrameFanout *weakSelf = self;
+    core.liveFrameStreamCallback = ^(CVPixelBufferRef pixelBuffer, double timestamp) {
+        [weakSelf deliverPixelBuffer:pixelBuffer timestamp:timestamp];
+    };
+    // The SDK's own CVPixelBuffer sink would read every frame back a second time.
+    [[NosmaiSDK sharedInstance] setLiveFrameOutputEnabled:NO];
+
+    os_unfair_lock_lock(&_lock);
+    _core = core;
+    _previousStreamCallback = previousCallback;
+    _restoreLiveFrameOutput = liveFrameOutputEnabled;
+    os_unfair_lock_unlock(&_lock);
+}
+
+- (void)detach {
+    os_unfair_lock_lock(&_lock);
+    NosmaiCore *core = _core;
+    void (^previousCallback)(CVPixelBufferRef, double) = _previousStreamCallback;
+    BOOL restoreLiveFrameOutput = _restoreLiveFrameOutput;
+    _core = nil;
+    _previousStreamCallback = nil;
+    _restoreLiveFrameOutput = NO;
+    os_unfair_lock_unlock(&_lock);
+    if (!core) {
+        return;
+    }
+    core.liveFrameStreamCallback = previousCallback;
+    if (restoreLiveFrameOutput) {
+        [[NosmaiSDK sharedInstance] setLiveFrameOutputEnabled:YES];
+    }
+}
+
+#pragma mark - Sinks
+
+- (id)addSinkNamed:(NSString *)name handler:(FrameFanoutSink)handler {
+    FrameFanoutEntry *entry = [[FrameFanoutEntry alloc] init];
+    entry.name = name;
+    entry.handler = handler;
+    os_unfair_lock_lock(&_lock);
+    _sinks = [_sinks arrayByAddingObject:entry];
+    os_unfair_lock_unlock(&_lock);
+    return entry;
+}
+
+- (void)removeSink:(id)token {
+    os_unfair_lock_lock(&_lock);
+    NSMutableArray<FrameFanoutEntry *> *sinks = [_sinks mutableCopy];
+    [sinks removeObjectIdenticalTo:token];
+    _sinks = [sinks copy];
+    os_unfair_lock_unlock(&_lock);
+}
+
+- (id)addRecordingSink:(NV12VideoWriter *)writer {
+    __weak NV12VideoWriter *weakWriter = writer;
+    return [self addSinkNamed:@"recording" handler:^(CVPixelBufferRef pixelBuffer, double timestamp) {
+        NV12VideoWriter *strongWriter = weakWriter;
+        if (strongWriter.isRecording) {
+            [strongWriter appendPixelBuffer:pixelBuffer timestamp:timestamp];
+        }
+    }];
+}
+
+#pragma mark - Photo
+
+- (void)capturePhoto:(void (^)(UIImage * _Nullable, NSError * _Nullable))completion {
+    void (^request)(UIImage *, NSError *) = [completion copy];
+    os_unfair_lock_lock(&_lock);
+    [_pendingPhotos addObject:request];
+    os_unfair_lock_unlock(&_lock);
+
+    dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(kPhotoTimeoutSeconds * NSEC_PER_SEC)), _photoQueue, ^{
+        os_unfair_lock_lock(&self->_lock);
+        BOOL pending = [self->_pendingPhotos indexOfObjectIdenticalTo:request] != NSNotFound;
+        [self->_pendingPhotos removeObjectIdenticalTo:request];
+        os_unfair_lock_unlock(&self->_lock);
+        if (pending) {
+            NSError *error = [NSError errorWithDomain:kFrameFanoutErrorDomain
+                                                 code:1
+                                             userInfo:@{NSLocalizedDescriptionKey: @"No frame arrived for the photo"}];
+            dispatch_async(dispatch_get_main_queue(), ^{ request(nil, error); });
+        }
+    });
+}
+
+// Photo queue only.
+- (nullable UIImage *)imageFromPixelBuffer:(CVPixelBufferRef)pixelBuffer {
+    if (!_photoContext) {
+        _photoContext = [CIContext contextWithOptions:nil];
+    }
+    CIImage *image = [CIImage imageWithCVPixelBuffer:pixelBuffer];
+    CGImageRef cgImage = [_photoContext createCGImage:image fromRect:image.extent];
+    if (!cgImage) {
+        return nil;
+    }
+    uint64_t copied = (uint64_t)CGImageGetBytesPerRow(cgImage) * CGImageGetHeight(cgImage);
+    os_unfair_lock_lock(&_lock);
+    _copiedBytes += copied;
+    os_unfair_lock_unlock(&_lock);
+    UIImage *photo = [UIImage imageWithCGImage:cgImage];
+    CGImageRelease(cgImage);
+    return photo;
+}
+
+#pragma mark - Delivery
+
+- (void)deliverPixelBuffer:(CVPixelBufferRef)pixelBuffer timestamp:(double)timestamp {
+    if (!pixelBuffer) {
+        return;
+    }
+    double start = FrameFanoutNowMs();
+    os_unfair_lock_lock(&_lock);
+    NSArray<FrameFanoutEntry *> *sinks = _sinks;
+    NSArray *photos = nil;
+    if (_pendingPhotos.count > 0) {
+        photos = [_pendingPhotos copy];
+        [_pendingPhotos removeAllObjects];
+    }
+    os_unfair_lock_unlock(&_lock);
+
+    for (FrameFanoutEntry *sink in sinks) {
+        sink.handler(pixelBuffer, timestamp);
+    }
+    if (photos) {
+        CVPixelBufferRetain(pixelBuffer);
+        dispatch_async(_photoQueue, ^{
+            UIImage *image = [self imageFromPixelBuffer:pixelBuffer];
+            CVPixelBufferRelease(pixelBuffer);
+            NSError *error = image ? nil : [NSError errorWithDomain:kFrameFanoutErrorDomain
+                                                               code:2
+                                                           userInfo:@{NSLocalizedDescriptionKey: @"The frame could not be converted"}];
+            dispatch_async(dispatch_get_main_queue(), ^{
+                for (void (^request)(UIImage *, NSError *) in photos) {
+                    request(image, error);
+                }
+            });
+        });
+    }
+    double elapsed = FrameFanoutNowMs() - start;
+
+    os_unfair_lock_lock(&_lock);
+    _frames++;
+    _deliveries += sinks.count;
+    _photos += photos.count;
+    _readbackBytes += FrameFanoutPixelBytes(pixelBuffer);
+    _fanoutMs += elapsed;
+    _maxFanoutMs = elapsed > _maxFanoutMs ? elapsed : _maxFanoutMs;
+    os_unfair_lock_unlock(&_lock);
+}
+
+@end
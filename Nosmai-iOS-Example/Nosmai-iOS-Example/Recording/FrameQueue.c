@@ -0,0 +1,132 @@
+//
+//  FrameQueue.c
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 18/10/2026.
+//
+
+#include "FrameQueue.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+int FrameQueueInit(FrameQueue *queue, size_t capacity, FrameQueuePolicy policy, size_t criticalReserve) {
+    memset(queue, 0, sizeof(*queue));
+    size_t rounded = 2;
+    while (rounded < capacity) {
+        rounded <<= 1;
+    }
+    queue->entries = calloc(rounded, sizeof(FrameQueueEntry));
+    if (!queue->entries) {
+        return -1;
+    }
+    queue->capacity = rounded;
+    queue->mask = rounded - 1;
+    queue->policy = policy;
+    queue->criticalReserve = criticalReserve < rounded ? criticalReserve : rounded - 1;
+    atomic_init(&queue->head, 0);
+    atomic_init(&queue->tail, 0);
+    return 0;
+}
+
+void FrameQueueFree(FrameQueue *queue) {
+    free(queue->entries);
+    memset(queue, 0, sizeof(*queue));
+}
+
+static void FrameQueueRaiseMax32(_Atomic uint32_t *value, uint32_t candidate) {
+    uint32_t current = atomic_load_explicit(value, memory_order_relaxed);
+    while (candidate > current &&
+           !atomic_compare_exchange_weak_explicit(value, &current, candidate, memory_order_relaxed, memory_order_relaxed)) {
+    }
+}
+
+static void FrameQueueRaiseMax64(_Atomic uint64_t *value, uint64_t candidate) {
+    uint64_t current = atomic_load_explicit(value, memory_order_relaxed);
+    while (candidate > current &&
+           !atomic_compare_exchange_weak_explicit(value, &current, candidate, memory_order_relaxed, memory_order_relaxed)) {
+    }
+}
+
+static size_t FrameQueueLimit(const FrameQueue *queue, int critical) {
+    if (queue->policy == FrameQueuePolicyDropNonCritical && !critical) {
+        return queue->capacity - queue->criticalReserve;
+    }
+    return queue->capacity;
+}
+
+int FrameQueueHasRoom(const FrameQueue *queue, int critical) {
+    return FrameQueueDepth(queue) < FrameQueueLimit(queue, critical);
+}
+
+void FrameQueueCountDrop(FrameQueue *queue, int critical) {
+    atomic_fetch_add_explicit(&queue->submitted, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&queue->dropped, 1, memory_order_relaxed);
+    if (critical) {
+        atomic_fetch_add_explicit(&queue->droppedCritical, 1, memory_order_relaxed);
+    }
+}
+
+FrameQueuePushResult FrameQueuePush(FrameQueue *queue, void *item, double timestamp, int critical, double nowMs) {
+    size_t tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+    size_t head = atomic_load_explicit(&queue->head, memory_order_acquire);
+    size_t depth = tail - head;
+
+    if (depth >= FrameQueueLimit(queue, critical)) {
+        if (queue->policy == FrameQueuePolicyBlock) {
+            return FrameQueuePushFull;
+        }
+        FrameQueueCountDrop(queue, critical);
+        return FrameQueuePushDropped;
+    }
+
+    FrameQueueEntry *entry = &queue->entries[tail & queue->mask];
+    entry->item = item;
+    entry->timestamp = timestamp;
+    entry->enqueueMs = nowMs;
+    entry->critical = critical;
+    atomic_store_explicit(&queue->tail, tail + 1, memory_order_release);
+    atomic_fetch_add_explicit(&queue->submitted, 1, memory_order_relaxed);
+    FrameQueueRaiseMax32(&queue->maxDepth, (uint32_t)(depth + 1));
+    return FrameQueuePushQueued;
+}
+
+int FrameQueuePop(FrameQueue *queue, double nowMs, FrameQueueEntry *outEntry) {
+    size_t head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+    size_t tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+    if (head == tail) {
+        return 0;
+    }
+    *outEntry = queue->entries[head & queue->mask];
+    atomic_store_explicit(&queue->head, head + 1, memory_order_release);
+
+    double lagMs = nowMs - outEntry->enqueueMs;
+    uint64_t lagUs = lagMs > 0.0 ? (uint64_t)(lagMs * 1000.0) : 0;
+    atomic_store_explicit(&queue->lastLagUs, lagUs, memory_order_relaxed);
+    atomic_fetch_add_explicit(&queue->totalLagUs, lagUs, memory_order_relaxed);
+    FrameQueueRaiseMax64(&queue->maxLagUs, lagUs);
+    atomic_fetch_add_explicit(&queue->popped, 1, memory_order_relaxed);
+    return 1;
+}
+
+size_t FrameQueueDepth(const FrameQueue *queue) {
+    size_t head = atomic_load_explicit(&queue->head, memory_order_acquire);
+    size_t tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+    return tail - head;
+}
+
+FrameQueueStats FrameQueueGetStats(const FrameQueue *queue) {
+    FrameQueueStats stats;
+    stats.submitted = atomic_load_explicit(&queue->submitted, memory_order_relaxed);
+    stats.dropped = atomic_load_explicit(&queue->dropped, memory_order_relaxed);
+    stats.droppedCritical = atomic_load_explicit(&queue->droppedCritical, memory_order_relaxed);
+    stats.queued = stats.submitted - stats.dropped;
+    stats.popped = atomic_load_explicit(&queue->popped, memory_order_relaxed);
+    stats.depth = (uint32_t)FrameQueueDepth(queue);
+    stats.maxDepth = atomic_load_explicit(&queue->maxDepth, memory_order_relaxed);
+    stats.lastLagMs = (double)atomic_load_explicit(&queue->lastLagUs, memory_order_relaxed) / 1000.0;
+    stats.maxLagMs = (double)atomic_load_explicit(&queue->maxLagUs, memory_order_relaxed) / 1000.0;
+    uint64_t totalLagUs = atomic_load_explicit(&queue->totalLagUs, memory_order_relaxed);
+    stats.averageLagMs = stats.popped > 0 ? (double)totalLagUs / 1000.0 / (double)stats.popped : 0.0;
+    return stats;
+}
@@ -0,0 +1,114 @@
+//
+//  FrameQueue.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 18/10/2026.
+//
+
+#ifndef FRAME_QUEUE_H
+#define FRAME_QUEUE_H
+
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    FrameQueuePolicyBlock = 0,        // Producer waits for a free slot (FrameQueuePushFull)
+    FrameQueuePolicyDropNewest = 1,   // Incoming frame is dropped when the queue is full
+    FrameQueuePolicyDropNonCritical = 2  // Non-critical frames are dropped early; the last
+                                         // slots are reserved for critical ones
+} FrameQueuePolicy;
+
+typedef enum {
+    FrameQueuePushQueued = 0,
+    FrameQueuePushDropped = 1,
+    FrameQueuePushFull = 2            // Block policy only: nothing was queued, retry later
+} FrameQueuePushResult;
+
+typedef struct {
+    void *item;
+    double timestamp;
+    double enqueueMs;
+    int critical;
+} FrameQueueEntry;
+
+typedef struct {
+    uint64_t submitted;
+    uint64_t queued;
+    uint64_t dropped;
+    uint64_t droppedCritical;
+    uint64_t popped;
+    uint32_t depth;
+    uint32_t maxDepth;
+    double lastLagMs;     // Enqueue -> dequeue time of the last frame taken by the encoder
+    double maxLagMs;
+    double averageLagMs;
+} FrameQueueStats;
+
+/**
+ * Bounded single-producer / single-consumer ring between the render thread
+ * and the encoder. Push and pop are lock-free and never wait; what happens
+ * when the encoder falls behind is decided by the policy.
+ *
+ * Critical frames are the ones the encoder must not lose (the first frame
+ * and key frame boundaries). Under FrameQueuePolicyDropNonCritical the
+ * newest `criticalReserve` slots only accept critical frames, so a stalled
+ * writer sheds ordinary frames first.
+ */
+typedef struct {
+    FrameQueueEntry *entries;
+    size_t capacity;
+    size_t mask;
+    size_t criticalReserve;
+    FrameQueuePolicy policy;
+    _Atomic size_t head;  // Next entry to pop (consumer)
+    _Atomic size_t tail;  // Next entry to fill (producer)
+    _Atomic uint64_t submitted;
+    _Atomic uint64_t dropped;
+    _Atomic uint64_t droppedCritical;
+    _Atomic uint64_t popped;
+    _Atomic uint32_t maxDepth;
+    _Atomic uint64_t lastLagUs;
+    _Atomic uint64_t maxLagUs;
+    _Atomic uint64_t totalLagUs;
+} FrameQueue;
+
+/**
+ * capacity is rounded up to a power of two. criticalReserve is clamped to
+ * capacity - 1 and only used by FrameQueuePolicyDropNonCritical.
+ *
+ * @return 0 on success, -1 if allocation failed
+ */
+int FrameQueueInit(FrameQueue *queue, size_t capacity, FrameQueuePolicy policy, size_t criticalReserve);
+void FrameQueueFree(FrameQueue *queue);
+
+/// Producer side. On Dropped / Full the caller still owns item.
+FrameQueuePushResult FrameQueuePush(FrameQueue *queue, void *item, double timestamp, int critical, double nowMs);
+
+/**
+ * Whether a push would currently be accepted. Lets the producer skip work
+ * (e.g. a colour conversion) for a frame that is going to be dropped.
+ */
+int FrameQueueHasRoom(const FrameQueue *queue, int critical);
+
+/// Counts a frame the producer dropped after FrameQueueHasRoom said no
+void FrameQueueCountDrop(FrameQueue *queue, int critical);
+
+/// Consumer side. @return 1 if an entry was taken, 0 if the queue is empty
+int FrameQueuePop(FrameQueue *queue, double nowMs, FrameQueueEntry *outEntry);
+
+/// Current number of queued entries; callable from any thread
+size_t FrameQueueDepth(const FrameQueue *queue);
+
+/// Counter snapshot; callable from any thread
+FrameQueueStats FrameQueueGetStats(const FrameQueue *queue);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FRAME_QUEUE_H */
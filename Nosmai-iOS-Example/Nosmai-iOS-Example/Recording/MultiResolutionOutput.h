@@ -0,0 +1,63 @@
+//
+//  MultiResolutionOutput.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 18/10/2026.
+//
+
+#import <Foundation/Foundation.h>
+#import <CoreGraphics/CoreGraphics.h>
+#import <CoreVideo/CoreVideo.h>
+#import "FrameFanout.h"
+#include "Resampler.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Called on the thread that delivered the frame. Retain the buffer to keep it
+typedef void (^MultiResolutionHandler)(CVPixelBufferRef pixelBuffer, double timestamp);
+
+/**
+ * Every processed frame at several sizes, each delivered to its own handler
+ * (e.g. full-size preview, a 720p stream and a 160p analytics thumbnail).
+ *
+ * The sizes come out of one ResolutionLadder: a shared 2x pyramid built
+ * once per frame, with each size resampled from the smallest level that
+ * covers it. Outputs at the frame size get the frame itself. Output buffers
+ * come from per-size pools and have the frame's pixel format (NV12 or
+ * 32BGRA).
+ *
+ * Outputs may be added and removed from any thread; frames are processed
+ * on one thread at a time.
+ *
+ * Not used by the example app, which has one preview and one recording
+ * and no second output size.
+ */
+@interface MultiResolutionOutput : NSObject
+
+/// Applies from the next frame. Default ResamplerKernelBilinear
+@property (nonatomic, assign) ResamplerKernel kernel;
+
+/**
+ * frames, droppedFrames (no pool buffer or unsupported format), outputs,
+ * passthroughs, resizes, levelBuildsPerFrame, sourcePixelRatio (pixels the
+ * resizes read / pixels separate full-frame resizes would read), averageMs
+ * and averageOutputMs (array, per output in the order added)
+ */
+@property (nonatomic, readonly) NSDictionary<NSString *, id> *statistics;
+
+/**
+ * @param size Output size; CGSizeZero for the frame's own size
+ * @return Token for -removeOutput:, or nil if the maximum number of outputs is reached
+ */
+- (nullable id)addOutputWithSize:(CGSize)size handler:(MultiResolutionHandler)handler;
+- (void)removeOutput:(id)token;
+
+/// Produces and delivers every output for one frame
+- (void)processPixelBuffer:(CVPixelBufferRef)pixelBuffer timestamp:(double)timestamp;
+
+/// Adds a sink that feeds this output. @return Token for -[FrameFanout removeSink:]
+- (id)attachToFanout:(FrameFanout *)fanout;
+
+@end
+
+NS_ASSUME_NONNULL_END
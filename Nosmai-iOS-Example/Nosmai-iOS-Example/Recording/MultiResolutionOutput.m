@@ -0,0 +1,231 @@
+//
+//  MultiResolutionOutput.m
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 18/10/2026.
+//
+
+#import "MultiResolutionOutput.h"
+#import <os/lock.h>
+#include "ResolutionLadder.h"
+
+// Row bands per resize, as for the recorder's scaling.
+static const int kLadderBands = 8;
+
+@interface MultiResolutionEntry : NSObject
+@property (nonatomic, assign) CGSize size;
+@property (nonatomic, copy) MultiResolutionHandler handler;
+@end
+
+@implementation MultiResolutionEntry {
+    @public
+    // Processing thread only.
+    CVPixelBufferPoolRef _pool;
+    int _poolWidth;
+    int _poolHeight;
+    OSType _poolFormat;
+}
+
+- (void)dealloc {
+    CVPixelBufferPoolRelease(_pool);
+}
+
+// Processing thread only.
+- (nullable CVPixelBufferRef)createBufferWithWidth:(int)width height:(int)height format:(OSType)format CF_RETURNS_RETAINED {
+    if (!_pool || _poolWidth != width || _poolHeight != height || _poolFormat != format) {
+        CVPixelBufferPoolRelease(_pool);
+        _pool = NULL;
+        NSDictionary *attributes = @{
+            (id)kCVPixelBufferPixelFormatTypeKey: @(format),
+            (id)kCVPixelBufferWidthKey: @(width),
+            (id)kCVPixelBufferHeightKey: @(height),
+            (id)kCVPixelBufferIOSurfacePropertiesKey: @{},
+        };
+        if (CVPixelBufferPoolCreate(kCFAllocatorDefault, NULL, (__bridge CFDictionaryRef)attributes, &_pool) != kCVReturnSuccess) {
+            return NULL;
+        }
+        _poolWidth = width;
+        _poolHeight = height;
+        _poolFormat = format;
+    }
+    CVPixelBufferRef buffer = NULL;
+    CVPixelBufferPoolCreatePixelBuffer(kCFAllocatorDefault, _pool, &buffer);
+    return buffer;
+}
+
+@end
+
+@implementation MultiResolutionOutput {
+    os_unfair_lock _lock;
+    // Processing thread only.
+    ResolutionLadder _ladder;
+
+    // Guarded by _lock. Replaced, never mutated, so processing can use a snapshot.
+    NSArray<MultiResolutionEntry *> *_entries;
+    uint64_t _droppedFrames;
+    ResolutionLadderStats _ladderStats;
+}
+
+- (instancetype)init {
+    self = [super init];
+    if (self) {
+        _lock = OS_UNFAIR_LOCK_INIT;
+        _kernel = ResamplerKernelBilinear;
+        _entries = @[];
+        ResolutionLadderInit(&_ladder);
+    }
+    return self;
+}
+
+- (void)dealloc {
+    ResolutionLadderFree(&_ladder);
+}
+
+- (NSDictionary<NSString *, id> *)statistics {
+    os_unfair_lock_lock(&_lock);
+    ResolutionLadderStats stats = _ladderStats;
+    uint64_t dropped = _droppedFrames;
+    NSUInteger outputs = _entries.count;
+    os_unfair_lock_unlock(&_lock);
+
+    NSMutableArray<NSNumber *> *outputMs = [NSMutableArray arrayWithCapacity:outputs];
+    for (NSUInteger i = 0; i < outputs && i < RESOLUTION_LADDER_MAX_OUTPUTS; i++) {
+        [outputMs addObject:@(stats.averageOutputMs[i])];
+    }
+    return @{
+        @"frames": @(stats.frames),
+        @"droppedFrames": @(dropped),
+        @"outputs": @(outputs),
+        @"passthroughs": @(stats.passthroughs),
+        @"resizes": @(stats.resizes),
+        @"levelBuildsPerFrame": @(stats.frames > 0 ? (double)stats.levelBuilds / (double)stats.frames : 0.0),
+        @"sourcePixelRatio": @(stats.directSourcePixels > 0
+                                   ? (double)stats.resizeSourcePixels / (double)stats.directSourcePixels
+                                   : 0.0),
+        @"averageMs": @(stats.averageMs),
+        @"averageOutputMs": outputMs,
+    };
+}
+
+#pragma mark - Outputs
+
+- (id)addOutputWithSize:(CGSize)size handler:(MultiResolutionHandler)handler {
+    MultiResolutionEntry *entry = [[MultiResolutionEntry alloc] init];
+    entry.size = size;
+    entry.handler = handler;
+    os_unfair_lock_lock(&_lock);
+    BOOL added = _entries.count < RESOLUTION_LADDER_MAX_OUTPUTS;
+    if (added) {
+        _entries = [_entries arrayByAddingObject:entry];
+    }
+    os_unfair_lock_unlock(&_lock);
+    return added ? entry : nil;
+}
+
+- (void)removeOutput:(id)token {
+    os_unfair_lock_lock(&_lock);
+    NSMutableArray<MultiResolutionEntry *> *entries = [_entries mutableCopy];
+    [entries removeObjectIdenticalTo:token];
+    _entries = [entries copy];
+    os_unfair_lock_unlock(&_lock);
+}
+
+- (id)attachToFanout:(FrameFanout *)fanout {
+    __weak MultiResolutionOutput *weakSelf = self;
+    return [fanout addSinkNamed:@"multi-resolution" handler:^(CVPixelBufferRef pixelBuffer, double timestamp) {
+        [weakSelf processPixelBuffer:pixelBuffer timestamp:timestamp];
+    }];
+}
+
+#pragma mark - Processing
+
+static ResolutionLadderImage MultiResolutionImage(CVPixelBufferRef pixelBuffer, BOOL nv12) {
+    ResolutionLadderImage image = {{NULL, NULL}, {0, 0}};
+    if (nv12) {
+        for (size_t plane = 0; plane < 2; plane++) {
+            image.planes[plane] = CVPixelBufferGetBaseAddressOfPlane(pixelBuffer, plane);
+            image.strides[plane] = CVPixelBufferGetBytesPerRowOfPlane(pixelBuffer, plane);
+        }
+    } else {
+        image.planes[0] = CVPixelBufferGetBaseAddress(pixelBuffer);
+        image.strides[0] = CVPixelBufferGetBytesPerRow(pixelBuffer);
+    }
+    return image;
+}
+
+- (void)countDroppedFrame {
+    os_unfair_lock_lock(&_lock);
+    _droppedFrames++;
+    os_unfair_lock_unlock(&_lock);
+}
+
+- (void)processPixelBuffer:(CVPixelBufferRef)pixelBuffer timestamp:(double)timestamp {
+    OSType format = CVPixelBufferGetPixelFormatType(pixelBuffer);
+    BOOL nv12 = format == kCVPixelFormatType_420YpCbCr8BiPlanarVideoRange;
+    if (!nv12 && format != kCVPixelFormatType_32BGRA) {
+        [self countDroppedFrame];
+        return;
+    }
+    os_unfair_lock_lock(&_lock);
+    NSArray<MultiResolutionEntry *> *entries = _entries;
+    os_unfair_lock_unlock(&_lock);
+    int count = (int)entries.count;
+    if (count == 0) {
+        return;
+    }
+
+    int width = (int)CVPixelBufferGetWidth(pixelBuffer);
+    int height = (int)CVPixelBufferGetHeight(pixelBuffer);
+    int widths[RESOLUTION_LADDER_MAX_OUTPUTS];
+    int heights[RESOLUTION_LADDER_MAX_OUTPUTS];
+    for (int i = 0; i < count; i++) {
+        CGSize size = entries[i].size;
+        widths[i] = size.width > 0 ? (int)size.width : width;
+        heights[i] = size.height > 0 ? (int)size.height : height;
+    }
+    if (ResolutionLadderConfigure(&_ladder, nv12 ? ResolutionLadderFormatNV12 : ResolutionLadderFormatRGBA,
+                                  self.kernel, widths, heights, count, kLadderBands) != 0) {
+        [self countDroppedFrame];
+        return;
+    }
+
+    CVPixelBufferRef buffers[RESOLUTION_LADDER_MAX_OUTPUTS] = {NULL};
+    ResolutionLadderImage outputs[RESOLUTION_LADDER_MAX_OUTPUTS];
+    BOOL ready = YES;
+    for (int i = 0; i < count && ready; i++) {
+        if (ResolutionLadderIsPassthrough(&_ladder, i, width, height)) {
+            continue;
+        }
+        buffers[i] = [entries[i] createBufferWithWidth:widths[i] height:heights[i] format:format];
+        ready = buffers[i] != NULL;
+        if (ready) {
+            CVPixelBufferLockBaseAddress(buffers[i], 0);
+            outputs[i] = MultiResolutionImage(buffers[i], nv12);
+        }
+    }
+    if (ready) {
+        CVPixelBufferLockBaseAddress(pixelBuffer, kCVPixelBufferLock_ReadOnly);
+        ResolutionLadderImage frame = MultiResolutionImage(pixelBuffer, nv12);
+        ready = ResolutionLadderRun(&_ladder, &frame, width, height, outputs, 1) == 0;
+        CVPixelBufferUnlockBaseAddress(pixelBuffer, kCVPixelBufferLock_ReadOnly);
+    }
+    for (int i = 0; i < count; i++) {
+        if (buffers[i]) {
+            CVPixelBufferUnlockBaseAddress(buffers[i], 0);
+        }
+    }
+
+    os_unfair_lock_lock(&_lock);
+    _ladderStats = ResolutionLadderGetStats(&_ladder);
+    _droppedFrames += ready ? 0 : 1;
+    os_unfair_lock_unlock(&_lock);
+
+    for (int i = 0; i < count; i++) {
+        if (ready) {
+            entries[i].handler(buffers[i] ? buffers[i] : pixelBuffer, timestamp);
+        }
+        CVPixelBufferRelease(buffers[i]);
+    }
+}
+
+@end
@@ -0,0 +1,111 @@
+//
+//  NV12VideoWriter.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 18/10/2026.
+//
+
+#import <Foundation/Foundation.h>
+#import <AVFoundation/AVFoundation.h>
+#import <CoreVideo/CoreVideo.h>
+#include "Resampler.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// What the writer does when frames arrive faster than the encoder takes them
+typedef NS_ENUM(NSInteger, NV12VideoWriterBackpressure) {
+    /// The producer waits for a free slot; no frame is lost
+    NV12VideoWriterBackpressureBlock = 0,
+    /// The incoming frame is dropped while the queue is full
+    NV12VideoWriterBackpressureDropNewest,
+    /// Ordinary frames are dropped first; key frame boundaries keep reserved slots
+    NV12VideoWriterBackpressureDropNonCritical,
+};
+
+/**
+ * Movie writer whose encoder input is NV12
+ * (kCVPixelFormatType_420YpCbCr8BiPlanarVideoRange), the layout the hardware
+ * encoder consumes.
+ *
+ * - NV12 pixel buffers (e.g. from a render pass that already writes YUV) are
+ *   appended without touching the pixels.
+ * - RGBA from -[NosmaiSDK setRecordingCallback:] and 32BGRA buffers are
+ *   converted with one fused pass straight into an encoder pool buffer, so no
+ *   RGBA intermediate is allocated or copied.
+ *
+ * Frames pass through a bounded lock-free queue to a dedicated encoder
+ * thread, so appending never waits on AVAssetWriter. What happens when the
+ * encoder falls behind is set by backpressurePolicy. Append methods may be
+ * called from one producer thread at a time.
+ */
+@interface NV12VideoWriter : NSObject
+
+@property (nonatomic, readonly) CGSize videoSize;
+@property (nonatomic, readonly) BOOL isRecording;
+
+/// Encoder for the next recording. Default AVVideoCodecTypeH264
+@property (nonatomic, copy) AVVideoCodecType codec;
+
+/// Applies from the next recording. Default NV12VideoWriterBackpressureDropNonCritical
+@property (nonatomic, assign) NV12VideoWriterBackpressure backpressurePolicy;
+
+/// Frames that may wait for the encoder, rounded up to a power of two. Default 8
+@property (nonatomic, assign) NSUInteger queueCapacity;
+
+/**
+ * Filter for RGBA frames whose size differs from videoSize, e.g. when the
+ * recording videoSize is smaller than the render target. Default
+ * ResamplerKernelBilinear. Pixel buffers must still match videoSize.
+ */
+@property (nonatomic, assign) ResamplerKernel scalingKernel;
+
+/**
+ * Key frame interval in seconds. The first frame of each interval is
+ * critical and survives NV12VideoWriterBackpressureDropNonCritical. Default 1
+ */
+@property (nonatomic, assign) NSTimeInterval keyFrameInterval;
+
+/**
+ * frames, droppedFrames, droppedCriticalFrames, convertedFrames,
+ * passthroughFrames, bytesTouchedPerFrame, averageConvertMs, scaledFrames,
+ * averageScaleMs, queueDepth, maxQueueDepth, encoderLagMs,
+ * averageEncoderLagMs and maxEncoderLagMs
+ */
+@property (nonatomic, readonly) NSDictionary<NSString *, NSNumber *> *statistics;
+
+- (instancetype)initWithVideoSize:(CGSize)videoSize NS_DESIGNATED_INITIALIZER;
+- (instancetype)init NS_UNAVAILABLE;
+
+- (void)startRecordingToURL:(NSURL *)outputURL
+                 completion:(nullable void (^)(BOOL success, NSError * _Nullable error))completion;
+
+- (void)stopRecordingWithCompletion:(nullable void (^)(NSURL * _Nullable outputURL, NSError * _Nullable error))completion;
+
+/// Stops without producing a file; queued frames are discarded
+- (void)cancelRecording;
+
+/**
+ * Tightly packed RGBA, exactly as delivered by setRecordingCallback:. The data
+ * is only valid during the callback, so it is converted into an encoder
+ * buffer on the calling thread (skipped when the frame would be dropped).
+ * Frames of another size are first resampled to videoSize with
+ * scalingKernel.
+ *
+ * @return NO if the frame was dropped
+ */
+- (BOOL)appendRGBAData:(const uint8_t *)data
+                 width:(int)width
+                height:(int)height
+             timestamp:(double)timestamp;
+
+/**
+ * The buffer is retained and queued. NV12 goes to the encoder as it is;
+ * 32BGRA is converted in a single fused pass on the encoder thread.
+ *
+ * @return NO if the frame was dropped or the format is unsupported
+ */
+- (BOOL)appendPixelBuffer:(CVPixelBufferRef)pixelBuffer timestamp:(double)timestamp;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,527 @@
+//
+//  NV12VideoWriter.m
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 18/10/2026.
+//
+
+#import "NV12VideoWriter.h"
+#import <os/lock.h>
+#include <math.h>
+#include <stdatomic.h>
+#include <time.h>
+#include "ColorConvert.h"
+#include "FrameQueue.h"
+
+static NSString * const kNV12VideoWriterErrorDomain = @"NV12VideoWriter";
+static const int32_t kNV12VideoWriterTimescale = 90000;
+// How long the encoder thread waits for AVAssetWriterInput to accept a frame.
+static const double kEncoderReadyTimeoutMs = 2000.0;
+// Producer / consumer wake-up interval while waiting on the other side.
+static const int64_t kQueueWaitNs = 10 * NSEC_PER_MSEC;
+// Row bands for resampling mismatched RGBA frames.
+static const int kScaleBands = 8;
+
+static double NV12VideoWriterNowMs(void) {
+    return (double)clock_gettime_nsec_np(CLOCK_UPTIME_RAW) / 1.0e6;
+}
+
+@implementation NV12VideoWriter {
+    os_unfair_lock _lock;
+    AVAssetWriter *_writer;
+    AVAssetWriterInput *_input;
+    AVAssetWriterInputPixelBufferAdaptor *_adaptor;
+    BOOL _sessionStarted;
+    void (^_stopCompletion)(NSURL *, NSError *);
+
+    FrameQueue _queue;
+    BOOL _hasQueue;
+    dispatch_queue_t _encoderQueue;
+    dispatch_semaphore_t _itemsSemaphore;
+    dispatch_semaphore_t _spaceSemaphore;
+    atomic_bool _accepting;
+    atomic_bool _cancelled;
+    atomic_int _activeProducers;
+
+    // Producer thread only.
+    BOOL _hasKeySlot;
+    long _lastKeySlot;
+    ResamplerPlan _scalePlan;
+    uint8_t *_scaleBuffer;
+    size_t _scaleBufferBytes;
+
+    // Guarded by _lock.
+    uint64_t _writeFailures;
+    uint64_t _convertedFrames;
+    uint64_t _passthroughFrames;
+    uint64_t _bytesTouched;
+    double _convertMs;
+    uint64_t _scaledFrames;
+    double _scaleMs;
+}
+
+- (instancetype)initWithVideoSize:(CGSize)videoSize {
+    self = [super init];
+    if (self) {
+        _lock = OS_UNFAIR_LOCK_INIT;
+        _videoSize = videoSize;
+        _codec = AVVideoCodecTypeH264;
+        _backpressurePolicy = NV12VideoWriterBackpressureDropNonCritical;
+        _queueCapacity = 8;
+        _keyFrameInterval = 1.0;
+        _scalingKernel = ResamplerKernelBilinear;
+        ResamplerPlanInit(&_scalePlan);
+        _encoderQueue = dispatch_queue_create("com.nosmai.example.nv12-encoder",
+                                              dispatch_queue_attr_make_with_qos_class(DISPATCH_QUEUE_SERIAL, QOS_CLASS_USER_INITIATED, 0));
+        _itemsSemaphore = dispatch_semaphore_create(0);
+        _spaceSemaphore = dispatch_semaphore_create(0);
+        atomic_init(&_accepting, false);
+        atomic_init(&_cancelled, false);
+        atomic_init(&_activeProducers, 0);
+    }
+    return self;
+}
+
+- (void)dealloc {
+    if (_hasQueue) {
+        FrameQueueFree(&_queue);
+    }
+    ResamplerPlanFree(&_scalePlan);
+    free(_scaleBuffer);
+}
+
+- (BOOL)isRecording {
+    os_unfair_lock_lock(&_lock);
+    BOOL recording = _writer != nil;
+    os_unfair_lock_unlock(&_lock);
+    return recording;
+}
+
+- (NSDictionary<NSString *, NSNumber *> *)statistics {
+    os_unfair_lock_lock(&_lock);
+    FrameQueueStats queue = {0};
+    if (_hasQueue) {
+        queue = FrameQueueGetStats(&_queue);
+    }
+    uint64_t written = _convertedFrames + _passthroughFrames;
+    NSDictionary *stats = @{
+        @"frames": @(queue.submitted),
+        @"droppedFrames": @(queue.dropped + _writeFailures),
+        @"droppedCriticalFrames": @(queue.droppedCritical),
+        @"convertedFrames": @(_convertedFrames),
+        @"passthroughFrames": @(_passthroughFrames),
+        @"bytesTouchedPerFrame": @(written > 0 ? _bytesTouched / written : 0),
+        @"averageConvertMs": @(_convertedFrames > 0 ? _convertMs / (double)_convertedFrames : 0.0),
+        @"scaledFrames": @(_scaledFrames),
+        @"averageScaleMs": @(_scaledFrames > 0 ? _scaleMs / (double)_scaledFrames : 0.0),
+        @"queueDepth": @(queue.depth),
+        @"maxQueueDepth": @(queue.maxDepth),
+        @"encoderLagMs": @(queue.lastLagMs),
+        @"averageEncoderLagMs": @(queue.averageLagMs),
+        @"maxEncoderLagMs": @(queue.maxLagMs),
+    };
+    os_unfair_lock_unlock(&_lock);
+    return stats;
+}
+
+#pragma mark - Recording
+
+- (void)startRecordingToURL:(NSURL *)outputURL completion:(void (^)(BOOL, NSError * _Nullable))completion {
+    if (self.isRecording) {
+        NSError *error = [NSError errorWithDomain:kNV12VideoWriterErrorDomain
+                                             code:1
+                                         userInfo:@{NSLocalizedDescriptionKey: @"Already recording"}];
+        if (completion) dispatch_async(dispatch_get_main_queue(), ^{ completion(NO, error); });
+        return;
+    }
+
+    [[NSFileManager defaultManager] removeItemAtURL:outputURL error:nil];
+    NSError *error = nil;
+    AVAssetWriter *writer = [AVAssetWriter assetWriterWithURL:outputURL fileType:AVFileTypeQuickTimeMovie error:&error];
+    if (!writer) {
+        if (completion) dispatch_async(dispatch_get_main_queue(), ^{ completion(NO, error); });
+        return;
+    }
+
+    int width = (int)self.videoSize.width;
+    int height = (int)self.videoSize.height;
+    AVAssetWriterInput *input = [AVAssetWriterInput assetWriterInputWithMediaType:AVMediaTypeVideo outputSettings:@{
+        AVVideoCodecKey: self.codec,
+        AVVideoWidthKey: @(width),
+        AVVideoHeightKey: @(height),
+        AVVideoCompressionPropertiesKey: @{
+            AVVideoMaxKeyFrameIntervalDurationKey: @(self.keyFrameInterval),
+        },
+    }];
+    input.expectsMediaDataInRealTime = YES;
+
+    // The pool hands out NV12 buffers, so conversion writes straight into
+    // memory the encoder reads.
+    AVAssetWriterInputPixelBufferAdaptor *adaptor = [AVAssetWriterInputPixelBufferAdaptor
+        assetWriterInputPixelBufferAdaptorWithAssetWriterInput:input
+                                   sourcePixelBufferAttributes:@{
+        (id)kCVPixelBufferPixelFormatTypeKey: @(kCVPixelFormatType_420YpCbCr8BiPlanarVideoRange),
+        (id)kCVPixelBufferWidthKey: @(width),
+        (id)kCVPixelBufferHeightKey: @(height),
+        (id)kCVPixelBufferIOSurfacePropertiesKey: @{},
+    }];
+
+    if (![writer canAddInput:input]) {
+        NSError *inputError = [NSError errorWithDomain:kNV12VideoWriterErrorDomain
+                                                  code:2
+                                              userInfo:@{NSLocalizedDescriptionKey: @"Cannot add video input"}];
+        if (completion) dispatch_async(dispatch_get_main_queue(), ^{ completion(NO, inputError); });
+        return;
+    }
+    [writer addInput:input];
+    if (![writer startWriting]) {
+        NSError *writeError = writer.error;
+        if (completion) dispatch_async(dispatch_get_main_queue(), ^{ completion(NO, writeError); });
+        return;
+    }
+
+    os_unfair_lock_lock(&_lock);
+    if (_hasQueue) {
+        FrameQueueFree(&_queue);
+    }
+    // A quarter of the slots stay free for key frame boundaries.
+    size_t capacity = MAX(self.queueCapacity, (NSUInteger)2);
+    _hasQueue = FrameQueueInit(&_queue, capacity, (FrameQueuePolicy)self.backpressurePolicy, MAX(capacity / 4, (size_t)1)) == 0;
+    if (!_hasQueue) {
+        os_unfair_lock_unlock(&_lock);
+        [writer cancelWriting];
+        NSError *queueError = [NSError errorWithDomain:kNV12VideoWriterErrorDomain
+                                                  code:4
+                                              userInfo:@{NSLocalizedDescriptionKey: @"Cannot allocate frame queue"}];
+        if (completion) dispatch_async(dispatch_get_main_queue(), ^{ completion(NO, queueError); });
+        return;
+    }
+    _writer = writer;
+    _input = input;
+    _adaptor = adaptor;
+    _sessionStarted = NO;
+    _stopCompletion = nil;
+    _writeFailures = _convertedFrames = _passthroughFrames = _bytesTouched = _scaledFrames = 0;
+    _convertMs = _scaleMs = 0.0;
+    os_unfair_lock_unlock(&_lock);
+
+    _hasKeySlot = NO;
+    atomic_store(&_cancelled, false);
+    atomic_store(&_accepting, true);
+    dispatch_async(_encoderQueue, ^{
+        [self drainQueue];
+    });
+
+    NSLog(@"🎬 NV12 writer started %dx%d", width, height);
+    if (completion) dispatch_async(dispatch_get_main_queue(), ^{ completion(YES, nil); });
+}
+
+- (void)stopRecordingWithCompletion:(void (^)(NSURL * _Nullable, NSError * _Nullable))completion {
+    os_unfair_lock_lock(&_lock);
+    BOOL recording = _writer != nil && atomic_load(&_accepting);
+    if (recording) {
+        _stopCompletion = [completion copy];
+    }
+    os_unfair_lock_unlock(&_lock);
+
+    if (!recording) {
+        if (completion) dispatch_async(dispatch_get_main_queue(), ^{ completion(nil, nil); });
+        return;
+    }
+    // Frames already queued are still written; the encoder thread finishes
+    // the file once the queue is empty.
+    atomic_store(&_accepting, false);
+    dispatch_semaphore_signal(_itemsSemaphore);
+    dispatch_semaphore_signal(_spaceSemaphore);
+}
+
+- (void)cancelRecording {
+    os_unfair_lock_lock(&_lock);
+    BOOL recording = _writer != nil && atomic_load(&_accepting);
+    os_unfair_lock_unlock(&_lock);
+    if (!recording) return;
+    atomic_store(&_cancelled, true);
+    atomic_store(&_accepting, false);
+    dispatch_semaphore_signal(_itemsSemaphore);
+    dispatch_semaphore_signal(_spaceSemaphore);
+}
+
+#pragma mark - Producer
+
+// Returns YES for the first frame of each key frame interval.
+- (BOOL)isCriticalTimestamp:(double)timestamp {
+    double interval = self.keyFrameInterval > 0.0 ? self.keyFrameInterval : 1.0;
+    long slot = (long)floor(timestamp / interval);
+    return !_hasKeySlot || slot != _lastKeySlot;
+}
+
+- (void)markQueuedTimestamp:(double)timestamp {
+    double interval = self.keyFrameInterval > 0.0 ? self.keyFrameInterval : 1.0;
+    _lastKeySlot = (long)floor(timestamp / interval);
+    _hasKeySlot = YES;
+}
+
+// Waits for room under the block policy, or counts the drop under the others.
+- (BOOL)reserveRoomForCritical:(BOOL)critical {
+    while (!FrameQueueHasRoom(&_queue, critical)) {
+        if (_queue.policy != FrameQueuePolicyBlock || !atomic_load(&_accepting)) {
+            FrameQueueCountDrop(&_queue, critical);
+            return NO;
+        }
+        dispatch_semaphore_wait(_spaceSemaphore, dispatch_time(DISPATCH_TIME_NOW, kQueueWaitNs));
+    }
+    return YES;
+}
+
+// Takes ownership of one reference to buffer.
+- (BOOL)enqueueBuffer:(CVPixelBufferRef)buffer timestamp:(double)timestamp critical:(BOOL)critical {
+    while (YES) {
+        FrameQueuePushResult result = FrameQueuePush(&_queue, (void *)buffer, timestamp, critical, NV12VideoWriterNowMs());
+        if (result == FrameQueuePushQueued) {
+            [self markQueuedTimestamp:timestamp];
+            dispatch_semaphore_signal(_itemsSemaphore);
+            return YES;
+        }
+        if (result == FrameQueuePushDropped || !atomic_load(&_accepting)) {
+            if (result == FrameQueuePushFull) FrameQueueCountDrop(&_queue, critical);
+            CVPixelBufferRelease(buffer);
+            return NO;
+        }
+        dispatch_semaphore_wait(_spaceSemaphore, dispatch_time(DISPATCH_TIME_NOW, kQueueWaitNs));
+    }
+}
+
+- (BOOL)beginProducing {
+    atomic_fetch_add(&_activeProducers, 1);
+    if (!atomic_load(&_accepting)) {
+        atomic_fetch_sub(&_activeProducers, 1);
+        return NO;
+    }
+    return YES;
+}
+
+- (void)endProducing {
+    atomic_fetch_sub(&_activeProducers, 1);
+    dispatch_semaphore_signal(_itemsSemaphore);
+}
+
+// Producer thread only. Returns videoSize RGBA valid until the next call.
+- (const uint8_t *)scaleRGBAData:(const uint8_t *)data width:(int)width height:(int)height {
+    int dstWidth = (int)self.videoSize.width;
+    int dstHeight = (int)self.videoSize.height;
+    size_t bytes = (size_t)dstWidth * (size_t)dstHeight * 4;
+    if (_scaleBufferBytes < bytes) {
+        free(_scaleBuffer);
+        _scaleBuffer = malloc(bytes);
+        _scaleBufferBytes = _scaleBuffer ? bytes : 0;
+    }
+    if (!_scaleBuffer ||
+        ResamplerPlanPrepare(&_scalePlan, self.scalingKernel, width, height, dstWidth, dstHeight, 4, kScaleBands) < 0) {
+        return NULL;
+    }
+    double start = NV12VideoWriterNowMs();
+    ResamplerRun(&_scalePlan, data, (size_t)width * 4, _scaleBuffer, (size_t)dstWidth * 4, 1);
+    double elapsed = NV12VideoWriterNowMs() - start;
+
+    os_unfair_lock_lock(&_lock);
+    _scaledFrames++;
+    _scaleMs += elapsed;
+    os_unfair_lock_unlock(&_lock);
+    return _scaleBuffer;
+}
+
+- (BOOL)appendRGBAData:(const uint8_t *)data width:(int)width height:(int)height timestamp:(double)timestamp {
+    if (!data || width <= 0 || height <= 0) {
+        return NO;
+    }
+    if (![self beginProducing]) {
+        return NO;
+    }
+    BOOL critical = [self isCriticalTimestamp:timestamp];
+    BOOL queued = NO;
+    if ([self reserveRoomForCritical:critical]) {
+        BOOL matches = width == (int)self.videoSize.width && height == (int)self.videoSize.height;
+        const uint8_t *pixels = matches ? data : [self scaleRGBAData:data width:width height:height];
+        CVPixelBufferRef target = pixels ? [self createEncoderBuffer] : NULL;
+        if (target) {
+            [self convertPixels:pixels bytesPerRow:(size_t)self.videoSize.width * 4 order:ColorConvertOrderRGBA into:target];
+            queued = [self enqueueBuffer:target timestamp:timestamp critical:critical];
+        } else {
+            FrameQueueCountDrop(&_queue, critical);
+        }
+    }
+    [self endProducing];
+    return queued;
+}
+
+- (BOOL)appendPixelBuffer:(CVPixelBufferRef)pixelBuffer timestamp:(double)timestamp {
+    OSType format = CVPixelBufferGetPixelFormatType(pixelBuffer);
+    if (format != kCVPixelFormatType_420YpCbCr8BiPlanarVideoRange && format != kCVPixelFormatType_32BGRA) {
+        return NO;
+    }
+    if ((int)CVPixelBufferGetWidth(pixelBuffer) != (int)self.videoSize.width ||
+        (int)CVPixelBufferGetHeight(pixelBuffer) != (int)self.videoSize.height) {
+        return NO;
+    }
+    if (![self beginProducing]) {
+        return NO;
+    }
+    BOOL critical = [self isCriticalTimestamp:timestamp];
+    BOOL queued = NO;
+    if ([self reserveRoomForCritical:critical]) {
+        queued = [self enqueueBuffer:CVPixelBufferRetain(pixelBuffer) timestamp:timestamp critical:critical];
+    }
+    [self endProducing];
+    return queued;
+}
+
+#pragma mark - Encoder Thread
+
+- (CVPixelBufferRef)createEncoderBuffer {
+    os_unfair_lock_lock(&_lock);
+    CVPixelBufferPoolRef pool = _adaptor.pixelBufferPool;
+    CVPixelBufferRef buffer = NULL;
+    if (pool) {
+        CVPixelBufferPoolCreatePixelBuffer(kCFAllocatorDefault, pool, &buffer);
+    }
+    os_unfair_lock_unlock(&_lock);
+    return buffer;
+}
+
+- (void)convertPixels:(const uint8_t *)pixels
+          bytesPerRow:(size_t)bytesPerRow
+                order:(ColorConvertChannelOrder)order
+                 into:(CVPixelBufferRef)target {
+    int width = (int)CVPixelBufferGetWidth(target);
+    int height = (int)CVPixelBufferGetHeight(target);
+    double start = NV12VideoWriterNowMs();
+    CVPixelBufferLockBaseAddress(target, 0);
+    ColorConvertRGBAToNV12(pixels,
+                           bytesPerRow,
+                           width,
+                           height,
+                           order,
+                           CVPixelBufferGetBaseAddressOfPlane(target, 0),
+                           CVPixelBufferGetBytesPerRowOfPlane(target, 0),
+                           CVPixelBufferGetBaseAddressOfPlane(target, 1),
+                           CVPixelBufferGetBytesPerRowOfPlane(target, 1));
+    CVPixelBufferUnlockBaseAddress(target, 0);
+    double elapsed = NV12VideoWriterNowMs() - start;
+
+    os_unfair_lock_lock(&_lock);
+    _convertMs += elapsed;
+    _convertedFrames++;
+    _bytesTouched += ColorConvertNV12BytesTouched(width, height);
+    os_unfair_lock_unlock(&_lock);
+}
+
+- (void)drainQueue {
+    while (YES) {
+        FrameQueueEntry entry;
+        if (FrameQueuePop(&_queue, NV12VideoWriterNowMs(), &entry)) {
+            dispatch_semaphore_signal(_spaceSemaphore);
+            CVPixelBufferRef buffer = (CVPixelBufferRef)entry.item;
+            if (!atomic_load(&_cancelled)) {
+                [self writeBuffer:buffer timestamp:entry.timestamp];
+            }
+            CVPixelBufferRelease(buffer);
+            continue;
+        }
+        if (!atomic_load(&_accepting) && atomic_load(&_activeProducers) == 0 && FrameQueueDepth(&_queue) == 0) {
+            break;
+        }
+        dispatch_semaphore_wait(_itemsSemaphore, dispatch_time(DISPATCH_TIME_NOW, kQueueWaitNs));
+    }
+    [self finishWriting];
+}
+
+- (void)writeBuffer:(CVPixelBufferRef)buffer timestamp:(double)timestamp {
+    CVPixelBufferRef target = buffer;
+    BOOL passthrough = CVPixelBufferGetPixelFormatType(buffer) == kCVPixelFormatType_420YpCbCr8BiPlanarVideoRange;
+    if (CVPixelBufferGetPixelFormatType(buffer) == kCVPixelFormatType_32BGRA) {
+        target = [self createEncoderBuffer];
+        if (!target) {
+            os_unfair_lock_lock(&_lock);
+            _writeFailures++;
+            os_unfair_lock_unlock(&_lock);
+            return;
+        }
+        CVPixelBufferLockBaseAddress(buffer, kCVPixelBufferLock_ReadOnly);
+        [self convertPixels:CVPixelBufferGetBaseAddress(buffer)
+                bytesPerRow:CVPixelBufferGetBytesPerRow(buffer)
+                      order:ColorConvertOrderBGRA
+                       into:target];
+        CVPixelBufferUnlockBaseAddress(buffer, kCVPixelBufferLock_ReadOnly);
+    }
+
+    os_unfair_lock_lock(&_lock);
+    AVAssetWriter *writer = _writer;
+    AVAssetWriterInput *input = _input;
+    AVAssetWriterInputPixelBufferAdaptor *adaptor = _adaptor;
+    os_unfair_lock_unlock(&_lock);
+
+    // Only this thread waits on the encoder; the producer never does.
+    CMTime time = CMTimeMakeWithSeconds(timestamp, kNV12VideoWriterTimescale);
+    double deadline = NV12VideoWriterNowMs() + kEncoderReadyTimeoutMs;
+    BOOL appended = NO;
+    if (writer.status == AVAssetWriterStatusWriting) {
+        if (!_sessionStarted) {
+            [writer startSessionAtSourceTime:time];
+            _sessionStarted = YES;
+        }
+        while (!input.isReadyForMoreMediaData && writer.status == AVAssetWriterStatusWriting &&
+               NV12VideoWriterNowMs() < deadline) {
+            usleep(1000);
+        }
+        appended = input.isReadyForMoreMediaData && [adaptor appendPixelBuffer:target withPresentationTime:time];
+    }
+
+    os_unfair_lock_lock(&_lock);
+    if (!appended) {
+        _writeFailures++;
+    } else if (passthrough) {
+        _passthroughFrames++;
+    }
+    os_unfair_lock_unlock(&_lock);
+    if (target != buffer) {
+        CVPixelBufferRelease(target);
+    }
+}
+
+- (void)finishWriting {
+    os_unfair_lock_lock(&_lock);
+    AVAssetWriter *writer = _writer;
+    AVAssetWriterInput *input = _input;
+    void (^completion)(NSURL *, NSError *) = _stopCompletion;
+    _stopCompletion = nil;
+    os_unfair_lock_unlock(&_lock);
+
+    void (^done)(NSURL *, NSError *) = ^(NSURL *url, NSError *error) {
+        os_unfair_lock_lock(&self->_lock);
+        self->_writer = nil;
+        self->_input = nil;
+        self->_adaptor = nil;
+        os_unfair_lock_unlock(&self->_lock);
+        NSLog(@"🎬 NV12 writer finished: %@", self.statistics);
+        if (completion) dispatch_async(dispatch_get_main_queue(), ^{ completion(url, error); });
+    };
+
+    if (atomic_load(&_cancelled)) {
+        [writer cancelWriting];
+        done(nil, nil);
+        return;
+    }
+    if (!_sessionStarted) {
+        [writer cancelWriting];
+        done(nil, [NSError errorWithDomain:kNV12VideoWriterErrorDomain
+                                      code:3
+                                  userInfo:@{NSLocalizedDescriptionKey: @"No frames were recorded"}]);
+        return;
+    }
+    [input markAsFinished];
+    [writer finishWritingWithCompletionHandler:^{
+        done(writer.status == AVAssetWriterStatusCompleted ? writer.outputURL : nil, writer.error);
+    }];
+}
+
+@end
@@ -0,0 +1,308 @@
+//
+//  PreRollBuffer.c
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 18/10/2026.
+//
+
+#include "PreRollBuffer.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ImagePyramid.h"
+
+static size_t PreRollUVStride(int width) {
+    return (size_t)((width + 1) / 2) * 2;
+}
+
+static size_t PreRollFrameBytes(int width, int height, PreRollFormat format) {
+    size_t pixels = (size_t)width * (size_t)height;
+    if (format == PreRollFormatRGBA) {
+        return pixels * 4;
+    }
+    return pixels + PreRollUVStride(width) * (size_t)((height + 1) / 2);
+}
+
+int PreRollBufferInit(PreRollBuffer *buffer, int width, int height, PreRollFormat format, double duration, double frameRate) {
+    memset(buffer, 0, sizeof(*buffer));
+    if (width <= 0 || height <= 0 || duration <= 0.0 || frameRate <= 0.0) {
+        return -1;
+    }
+    int capacity = (int)ceil(duration * frameRate);
+    capacity = capacity > 0 ? capacity : 1;
+    buffer->frameBytes = PreRollFrameBytes(width, height, format);
+    buffer->scratchBytes = format == PreRollFormatNV12 ? (size_t)width * (size_t)height * 4 : 0;
+    buffer->storage = malloc(buffer->frameBytes * (size_t)capacity);
+    buffer->timestamps = calloc((size_t)capacity, sizeof(double));
+    buffer->scratch = buffer->scratchBytes > 0 ? malloc(buffer->scratchBytes) : NULL;
+    if (!buffer->storage || !buffer->timestamps || (buffer->scratchBytes > 0 && !buffer->scratch)) {
+        PreRollBufferFree(buffer);
+        return -1;
+    }
+    // Touch every page now so the first pass through the ring does not take
+    // page faults on the render thread.
+    memset(buffer->storage, 0, buffer->frameBytes * (size_t)capacity);
+    buffer->capacity = capacity;
+    buffer->width = width;
+    buffer->height = height;
+    buffer->format = format;
+    buffer->duration = duration;
+    return 0;
+}
+
+void PreRollBufferFree(PreRollBuffer *buffer) {
+    free(buffer->storage);
+    free(buffer->timestamps);
+    free(buffer->scratch);
+    memset(buffer, 0, sizeof(*buffer));
+}
+
+void PreRollBufferReset(PreRollBuffer *buffer) {
+    buffer->head = 0;
+    buffer->count = 0;
+}
+
+// Source advance per destination pixel, 16.16 fixed point.
+static inline int64_t PreRollStep(int srcSize, int dstSize) {
+    return ((int64_t)srcSize << 16) / dstSize;
+}
+
+// Bilinear source position for a destination index, pixel centres aligned.
+// weight is the share of i1 in 1/256.
+static inline void PreRollSourceCoord(int index, int64_t step, int srcSize, int *i0, int *i1, int *weight) {
+    int64_t fixed = (step >> 1) + (int64_t)index * step - 32768;
+    if (fixed < 0) {
+        fixed = 0;
+    }
+    int base = (int)(fixed >> 16);
+    if (base >= srcSize - 1) {
+        *i0 = *i1 = srcSize - 1;
+        *weight = 0;
+        return;
+    }
+    *i0 = base;
+    *i1 = base + 1;
+    *weight = (int)((fixed >> 8) & 255);
+}
+
+static inline int PreRollLerp2D(int a, int b, int c, int d, int wx, int wy) {
+    int top = a * (256 - wx) + b * wx;
+    int bottom = c * (256 - wx) + d * wx;
+    return (top * (256 - wy) + bottom * wy + 32768) >> 16;
+}
+
+// Bilinear scale of a 4-channel frame; channel order is preserved. An exact
+// half size takes the pyramid's 2x2 area filter instead.
+static void PreRollScale(const uint8_t *src,
+                         size_t srcStride,
+                         int srcWidth,
+                         int srcHeight,
+                         uint8_t *dst,
+                         size_t dstStride,
+                         int dstWidth,
+                         int dstHeight) {
+    if (srcWidth == dstWidth && srcHeight == dstHeight) {
+        for (int y = 0; y < dstHeight; y++) {
+            memcpy(dst + (size_t)y * dstStride, src + (size_t)y * srcStride, (size_t)dstWidth * 4);
+        }
+        return;
+    }
+    if (srcWidth / 2 == dstWidth && srcHeight / 2 == dstHeight) {
+        ImagePyramidDownsample2x(src, srcStride, srcWidth, srcHeight, 4, dst, dstStride);
+        return;
+    }
+
+    int64_t stepX = PreRollStep(srcWidth, dstWidth);
+    int64_t stepY = PreRollStep(srcHeight, dstHeight);
+    for (int y = 0; y < dstHeight; y++) {
+        int y0, y1, wy;
+        PreRollSourceCoord(y, stepY, srcHeight, &y0, &y1, &wy);
+        const uint8_t *row0 = src + (size_t)y0 * srcStride;
+        const uint8_t *row1 = src + (size_t)y1 * srcStride;
+        uint8_t *d = dst + (size_t)y * dstStride;
+        for (int x = 0; x < dstWidth; x++, d += 4) {
+            int x0, x1, wx;
+            PreRollSourceCoord(x, stepX, srcWidth, &x0, &x1, &wx);
+            const uint8_t *a = row0 + (size_t)x0 * 4;
+            const uint8_t *b = row0 + (size_t)x1 * 4;
+            const uint8_t *c = row1 + (size_t)x0 * 4;
+            const uint8_t *e = row1 + (size_t)x1 * 4;
+            for (int ch = 0; ch < 4; ch++) {
+                d[ch] = (uint8_t)PreRollLerp2D(a[ch], b[ch], c[ch], e[ch], wx, wy);
+            }
+        }
+    }
+}
+
+static void PreRollSwapRedBlue(uint8_t *pixels, size_t stride, int width, int height) {
+    for (int y = 0; y < height; y++) {
+        uint8_t *p = pixels + (size_t)y * stride;
+        for (int x = 0; x < width; x++, p += 4) {
+            uint8_t r = p[0];
+            p[0] = p[2];
+            p[2] = r;
+        }
+    }
+}
+
+static inline uint8_t PreRollClamp(int value) {
+    return (uint8_t)(value < 0 ? 0 : (value > 255 ? 255 : value));
+}
+
+// NV12 (BT.709 video range) -> RGBA of any size, luma and chroma sampled bilinearly.
+static void PreRollScaleNV12ToRGBA(const PreRollFrame *frame, uint8_t *dst, size_t dstStride, int dstWidth, int dstHeight) {
+    int chromaWidth = (frame->width + 1) / 2;
+    int chromaHeight = (frame->height + 1) / 2;
+    int64_t stepX = PreRollStep(frame->width, dstWidth);
+    int64_t stepY = PreRollStep(frame->height, dstHeight);
+    int64_t chromaStepX = PreRollStep(chromaWidth, dstWidth);
+    int64_t chromaStepY = PreRollStep(chromaHeight, dstHeight);
+    for (int y = 0; y < dstHeight; y++) {
+        int y0, y1, wy, cy0, cy1, wcy;
+        PreRollSourceCoord(y, stepY, frame->height, &y0, &y1, &wy);
+        PreRollSourceCoord(y, chromaStepY, chromaHeight, &cy0, &cy1, &wcy);
+        const uint8_t *luma0 = frame->plane0 + (size_t)y0 * frame->stride0;
+        const uint8_t *luma1 = frame->plane0 + (size_t)y1 * frame->stride0;
+        const uint8_t *chroma0 = frame->plane1 + (size_t)cy0 * frame->stride1;
+        const uint8_t *chroma1 = frame->plane1 + (size_t)cy1 * frame->stride1;
+        uint8_t *d = dst + (size_t)y * dstStride;
+        for (int x = 0; x < dstWidth; x++, d += 4) {
+            int x0, x1, wx, cx0, cx1, wcx;
+            PreRollSourceCoord(x, stepX, frame->width, &x0, &x1, &wx);
+            PreRollSourceCoord(x, chromaStepX, chromaWidth, &cx0, &cx1, &wcx);
+            int luma = PreRollLerp2D(luma0[x0], luma0[x1], luma1[x0], luma1[x1], wx, wy) - 16;
+            int cb = PreRollLerp2D(chroma0[cx0 * 2], chroma0[cx1 * 2], chroma1[cx0 * 2], chroma1[cx1 * 2], wcx, wcy) - 128;
+            int cr = PreRollLerp2D(chroma0[cx0 * 2 + 1], chroma0[cx1 * 2 + 1],
+                                   chroma1[cx0 * 2 + 1], chroma1[cx1 * 2 + 1], wcx, wcy) - 128;
+            int scaled = 298 * luma + 128;
+            d[0] = PreRollClamp((scaled + 459 * cr) >> 8);
+            d[1] = PreRollClamp((scaled - 55 * cb - 136 * cr) >> 8);
+            d[2] = PreRollClamp((scaled + 541 * cb) >> 8);
+            d[3] = 255;
+        }
+    }
+}
+
+void PreRollBufferPush(PreRollBuffer *buffer,
+                       const uint8_t *src,
+                       size_t srcStride,
+                       int srcWidth,
+                       int srcHeight,
+                       ColorConvertChannelOrder order,
+                       double timestamp) {
+    if (!buffer->storage || !src || srcWidth <= 0 || srcHeight <= 0) {
+        return;
+    }
+    if (buffer->count > 0) {
+        int newest = (buffer->head + buffer->capacity - 1) % buffer->capacity;
+        if (timestamp < buffer->timestamps[newest]) {
+            PreRollBufferReset(buffer);
+        }
+    }
+
+    int slot = buffer->head;
+    uint8_t *pixels = buffer->storage + buffer->frameBytes * (size_t)slot;
+    int width = buffer->width;
+    int height = buffer->height;
+    if (buffer->format == PreRollFormatRGBA) {
+        PreRollScale(src, srcStride, srcWidth, srcHeight, pixels, (size_t)width * 4, width, height);
+        if (order == ColorConvertOrderBGRA) {
+            PreRollSwapRedBlue(pixels, (size_t)width * 4, width, height);
+        }
+    } else {
+        uint8_t *uv = pixels + (size_t)width * (size_t)height;
+        if (srcWidth == width && srcHeight == height) {
+            ColorConvertRGBAToNV12(src, srcStride, width, height, order, pixels, (size_t)width, uv, PreRollUVStride(width));
+        } else {
+            PreRollScale(src, srcStride, srcWidth, srcHeight, buffer->scratch, (size_t)width * 4, width, height);
+            ColorConvertRGBAToNV12(buffer->scratch, (size_t)width * 4, width, height, order,
+                                   pixels, (size_t)width, uv, PreRollUVStride(width));
+        }
+    }
+
+    buffer->timestamps[slot] = timestamp;
+    buffer->head = (slot + 1) % buffer->capacity;
+    if (buffer->count == buffer->capacity) {
+        buffer->overwritten++;
+    } else {
+        buffer->count++;
+    }
+    buffer->pushed++;
+}
+
+static int PreRollOldestSlot(const PreRollBuffer *buffer) {
+    return (buffer->head + buffer->capacity - buffer->count) % buffer->capacity;
+}
+
+// Filled slots that fall outside the time window, counted from the oldest.
+static int PreRollExpiredCount(const PreRollBuffer *buffer) {
+    if (buffer->count == 0) {
+        return 0;
+    }
+    int oldest = PreRollOldestSlot(buffer);
+    double newest = buffer->timestamps[(buffer->head + buffer->capacity - 1) % buffer->capacity];
+    int expired = 0;
+    while (expired < buffer->count - 1 &&
+           newest - buffer->timestamps[(oldest + expired) % buffer->capacity] > buffer->duration) {
+        expired++;
+    }
+    return expired;
+}
+
+int PreRollBufferCount(const PreRollBuffer *buffer) {
+    return buffer->count - PreRollExpiredCount(buffer);
+}
+
+int PreRollBufferGetFrame(const PreRollBuffer *buffer, int index, PreRollFrame *outFrame) {
+    int expired = PreRollExpiredCount(buffer);
+    if (index < 0 || index >= buffer->count - expired) {
+        return 0;
+    }
+    int slot = (PreRollOldestSlot(buffer) + expired + index) % buffer->capacity;
+    const uint8_t *pixels = buffer->storage + buffer->frameBytes * (size_t)slot;
+    outFrame->width = buffer->width;
+    outFrame->height = buffer->height;
+    outFrame->format = buffer->format;
+    outFrame->timestamp = buffer->timestamps[slot];
+    outFrame->plane0 = pixels;
+    if (buffer->format == PreRollFormatRGBA) {
+        outFrame->stride0 = (size_t)buffer->width * 4;
+        outFrame->plane1 = NULL;
+        outFrame->stride1 = 0;
+    } else {
+        outFrame->stride0 = (size_t)buffer->width;
+        outFrame->plane1 = pixels + (size_t)buffer->width * (size_t)buffer->height;
+        outFrame->stride1 = PreRollUVStride(buffer->width);
+    }
+    return 1;
+}
+
+void PreRollFrameReadRGBA(const PreRollFrame *frame, uint8_t *dst, size_t dstStride, int dstWidth, int dstHeight) {
+    if (frame->format == PreRollFormatRGBA) {
+        PreRollScale(frame->plane0, frame->stride0, frame->width, frame->height, dst, dstStride, dstWidth, dstHeight);
+    } else {
+        PreRollScaleNV12ToRGBA(frame, dst, dstStride, dstWidth, dstHeight);
+    }
+}
+
+PreRollBufferStats PreRollBufferGetStats(const PreRollBuffer *buffer) {
+    PreRollBufferStats stats;
+    memset(&stats, 0, sizeof(stats));
+    stats.pushed = buffer->pushed;
+    stats.overwritten = buffer->overwritten;
+    stats.capacity = (uint32_t)buffer->capacity;
+    stats.frameBytes = buffer->frameBytes;
+    stats.memoryBytes = buffer->frameBytes * (size_t)buffer->capacity + buffer->scratchBytes +
+                        sizeof(double) * (size_t)buffer->capacity;
+    int frames = PreRollBufferCount(buffer);
+    stats.frames = (uint32_t)frames;
+    if (frames > 1) {
+        PreRollFrame oldest, newest;
+        PreRollBufferGetFrame(buffer, 0, &oldest);
+        PreRollBufferGetFrame(buffer, frames - 1, &newest);
+        stats.bufferedSeconds = newest.timestamp - oldest.timestamp;
+    }
+    return stats;
+}
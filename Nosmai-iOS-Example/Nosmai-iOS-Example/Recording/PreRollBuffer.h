@@ -0,0 +1,115 @@
+//
+//  PreRollBuffer.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 18/10/2026.
+//
+
+#ifndef PRE_ROLL_BUFFER_H
+#define PRE_ROLL_BUFFER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "ColorConvert.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    PreRollFormatRGBA = 0,  // Raw, 4 bytes per pixel
+    PreRollFormatNV12 = 1   // 4:2:0 BT.709 video range, 1.5 bytes per pixel
+} PreRollFormat;
+
+/// One stored frame. Planes point into the ring and stay valid until the next push or reset.
+typedef struct {
+    const uint8_t *plane0;  // RGBA pixels, or luma for NV12
+    size_t stride0;
+    const uint8_t *plane1;  // Interleaved CbCr for NV12, NULL for RGBA
+    size_t stride1;
+    int width;
+    int height;
+    PreRollFormat format;
+    double timestamp;
+} PreRollFrame;
+
+typedef struct {
+    uint64_t pushed;
+    uint64_t overwritten;  // Frames that fell out of the ring
+    uint32_t frames;       // Frames currently inside the pre-roll window
+    uint32_t capacity;
+    size_t frameBytes;
+    size_t memoryBytes;    // Everything the ring holds, allocated once at init
+    double bufferedSeconds;
+} PreRollBufferStats;
+
+/**
+ * Fixed-size ring of the most recent frames, kept at a reduced resolution
+ * for retroactive recording.
+ *
+ * All slots (and, for NV12, one RGBA scratch frame used to scale before
+ * conversion) are allocated by PreRollBufferInit. Pushing overwrites the
+ * oldest slot in place, so steady-state capture never allocates. Frames
+ * older than `duration` seconds behind the newest one are not reported.
+ */
+typedef struct {
+    uint8_t *storage;
+    uint8_t *scratch;
+    double *timestamps;
+    size_t frameBytes;
+    size_t scratchBytes;
+    int capacity;
+    int width;
+    int height;
+    PreRollFormat format;
+    double duration;
+    int head;   // Slot the next push writes
+    int count;  // Filled slots
+    uint64_t pushed;
+    uint64_t overwritten;
+} PreRollBuffer;
+
+/**
+ * Capacity is duration * frameRate slots (at least one) of width x height.
+ *
+ * @return 0 on success, -1 on invalid arguments or allocation failure
+ */
+int PreRollBufferInit(PreRollBuffer *buffer, int width, int height, PreRollFormat format, double duration, double frameRate);
+void PreRollBufferFree(PreRollBuffer *buffer);
+
+/// Forgets every frame; memory is kept
+void PreRollBufferReset(PreRollBuffer *buffer);
+
+/**
+ * Scales a 4-channel frame to the ring resolution (bilinear) and stores it,
+ * converting to NV12 when the ring uses that format. A timestamp earlier than
+ * the newest stored one (e.g. after a camera switch) resets the ring first.
+ */
+void PreRollBufferPush(PreRollBuffer *buffer,
+                       const uint8_t *src,
+                       size_t srcStride,
+                       int srcWidth,
+                       int srcHeight,
+                       ColorConvertChannelOrder order,
+                       double timestamp);
+
+/// Frames inside the pre-roll window
+int PreRollBufferCount(const PreRollBuffer *buffer);
+
+/**
+ * index 0 is the oldest frame inside the window.
+ *
+ * @return 1 if the frame exists, 0 otherwise
+ */
+int PreRollBufferGetFrame(const PreRollBuffer *buffer, int index, PreRollFrame *outFrame);
+
+/// Decodes and scales a stored frame (either format) to RGBA of any size
+void PreRollFrameReadRGBA(const PreRollFrame *frame, uint8_t *dst, size_t dstStride, int dstWidth, int dstHeight);
+
+PreRollBufferStats PreRollBufferGetStats(const PreRollBuffer *buffer);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PRE_ROLL_BUFFER_H */
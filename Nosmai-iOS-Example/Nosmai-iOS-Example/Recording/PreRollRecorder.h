@@ -0,0 +1,97 @@
+//
+//  PreRollRecorder.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 18/10/2026.
+//
+
+#import <Foundation/Foundation.h>
+#import <nosmai/Nosmai.h>
+#import "NV12VideoWriter.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// How frames are kept while waiting in the pre-roll ring
+typedef NS_ENUM(NSInteger, PreRollStorage) {
+    /// RGBA, 4 bytes per pixel, stored exactly
+    PreRollStorageRaw = 0,
+    /// NV12 4:2:0, 1.5 bytes per pixel
+    PreRollStorageNV12,
+};
+
+/**
+ * Recorder that can include the seconds before record was tapped.
+ *
+ * While idle, frames go into a fixed-size ring (PreRollBuffer) at the
+ * pre-roll resolution. The ring's memory is allocated once in
+ * -enablePreRollWithDuration:size:storage: and reused in place.
+ *
+ * Starting a recording freezes the ring. Live frames go to the main writer
+ * while the buffered frames are encoded into a separate file in the
+ * background. On stop, both files are joined with a passthrough export (no
+ * re-encode) into the requested URL.
+ *
+ * Append methods may be called from one producer thread at a time.
+ */
+@interface PreRollRecorder : NSObject
+
+@property (nonatomic, readonly) CGSize videoSize;
+@property (nonatomic, readonly) BOOL isRecording;
+@property (nonatomic, readonly) BOOL isPreRollEnabled;
+
+/// Writer settings for the next recording
+@property (nonatomic, assign) NV12VideoWriterBackpressure backpressurePolicy;
+
+/**
+ * preRollMemoryBytes, preRollFrameBytes, preRollCapacity, preRollFrames,
+ * preRollSeconds, preRollPushed, preRollOverwritten, averagePushMs,
+ * preRollWidth, preRollHeight and preRollStorage
+ */
+@property (nonatomic, readonly) NSDictionary<NSString *, id> *debugInfo;
+
+- (instancetype)initWithVideoSize:(CGSize)videoSize NS_DESIGNATED_INITIALIZER;
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ * Allocates the ring: duration * frameRate slots of size. Replaces any
+ * earlier ring. Ignored while recording.
+ *
+ * @return NO if the memory could not be allocated or the arguments are invalid
+ */
+- (BOOL)enablePreRollWithDuration:(NSTimeInterval)duration
+                        frameRate:(double)frameRate
+                             size:(CGSize)size
+                          storage:(PreRollStorage)storage;
+
+/// Frees the ring. Ignored while recording
+- (void)disablePreRoll;
+
+- (void)startRecordingToURL:(NSURL *)outputURL
+                 completion:(nullable void (^)(BOOL success, NSError * _Nullable error))completion;
+
+/// The file starts with the pre-roll footage buffered when recording started
+- (void)stopRecordingWithCompletion:(nullable void (^)(NSURL * _Nullable outputURL, NSError * _Nullable error))completion;
+
+/**
+ * Goes to the ring while idle and to the writer while recording.
+ *
+ * @return YES if the frame was recorded live
+ */
+- (BOOL)appendRGBAData:(const uint8_t *)data
+                 width:(int)width
+                height:(int)height
+             timestamp:(double)timestamp;
+
+/// 32BGRA buffers feed the ring; NV12 buffers are only recorded live
+- (BOOL)appendPixelBuffer:(CVPixelBufferRef)pixelBuffer timestamp:(double)timestamp;
+
+@end
+
+@interface NosmaiCore (PreRollRecorder)
+
+/// -exportDebugInfo with the recorder's ring under "preRoll"
+- (NSDictionary<NSString *, id> *)exportDebugInfoWithPreRollRecorder:(nullable PreRollRecorder *)recorder;
+
+@end
+
+NS_ASSUME_NONNULL_END
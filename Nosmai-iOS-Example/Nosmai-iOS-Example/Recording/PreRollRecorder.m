@@ -0,0 +1,383 @@
+//
+//  PreRollRecorder.m
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 18/10/2026.
+//
+
+#import "PreRollRecorder.h"
+#import <os/lock.h>
+#include <time.h>
+#include "PreRollBuffer.h"
+
+static NSString * const kPreRollRecorderErrorDomain = @"PreRollRecorder";
+
+static double PreRollRecorderNowMs(void) {
+    return (double)clock_gettime_nsec_np(CLOCK_UPTIME_RAW) / 1.0e6;
+}
+
+@implementation PreRollRecorder {
+    os_unfair_lock _lock;
+    dispatch_queue_t _flushQueue;
+    dispatch_group_t _flushGroup;
+
+    // Guarded by _lock.
+    PreRollBuffer _ring;
+    BOOL _hasRing;
+    PreRollStorage _storage;
+    // Set while the ring is being encoded; nothing may push or free it.
+    BOOL _frozen;
+    NV12VideoWriter *_writer;
+    NSURL *_outputURL;
+    NSURL *_preRollURL;
+    NSError *_preRollError;
+    double _pushMs;
+    uint64_t _timedPushes;
+}
+
+- (instancetype)initWithVideoSize:(CGSize)videoSize {
+    self = [super init];
+    if (self) {
+        _lock = OS_UNFAIR_LOCK_INIT;
+        _videoSize = videoSize;
+        _backpressurePolicy = NV12VideoWriterBackpressureDropNonCritical;
+        _flushQueue = dispatch_queue_create("com.nosmai.example.preroll-flush",
+                                            dispatch_queue_attr_make_with_qos_class(DISPATCH_QUEUE_SERIAL, QOS_CLASS_USER_INITIATED, 0));
+        _flushGroup = dispatch_group_create();
+    }
+    return self;
+}
+
+- (void)dealloc {
+    if (_hasRing) {
+        PreRollBufferFree(&_ring);
+    }
+}
+
+- (BOOL)isRecording {
+    os_unfair_lock_lock(&_lock);
+    BOOL recording = _writer != nil;
+    os_unfair_lock_unlock(&_lock);
+    return recording;
+}
+
+- (BOOL)isPreRollEnabled {
+    os_unfair_lock_lock(&_lock);
+    BOOL enabled = _hasRing;
+    os_unfair_lock_unlock(&_lock);
+    return enabled;
+}
+
+- (NSDictionary<NSString *, id> *)debugInfo {
+    os_unfair_lock_lock(&_lock);
+    if (!_hasRing) {
+        os_unfair_lock_unlock(&_lock);
+        return @{@"preRollMemoryBytes": @0};
+    }
+    PreRollBufferStats stats = PreRollBufferGetStats(&_ring);
+    NSDictionary *info = @{
+        @"preRollMemoryBytes": @(stats.memoryBytes),
+        @"preRollFrameBytes": @(stats.frameBytes),
+        @"preRollCapacity": @(stats.capacity),
+        @"preRollFrames": @(stats.frames),
+        @"preRollSeconds": @(stats.bufferedSeconds),
+        @"preRollPushed": @(stats.pushed),
+        @"preRollOverwritten": @(stats.overwritten),
+        @"averagePushMs": @(_timedPushes > 0 ? _pushMs / (double)_timedPushes : 0.0),
+        @"preRollWidth": @(_ring.width),
+        @"preRollHeight": @(_ring.height),
+        @"preRollStorage": _storage == PreRollStorageNV12 ? @"nv12" : @"raw",
+    };
+    os_unfair_lock_unlock(&_lock);
+    return info;
+}
+
+#pragma mark - Pre-roll
+
+- (BOOL)enablePreRollWithDuration:(NSTimeInterval)duration
+                        frameRate:(double)frameRate
+                             size:(CGSize)size
+                          storage:(PreRollStorage)storage {
+    PreRollBuffer ring;
+    PreRollFormat format = storage == PreRollStorageNV12 ? PreRollFormatNV12 : PreRollFormatRGBA;
+    if (PreRollBufferInit(&ring, (int)size.width, (int)size.height, format, duration, frameRate) != 0) {
+        return NO;
+    }
+
+    os_unfair_lock_lock(&_lock);
+    if (_frozen || _writer) {
+        os_unfair_lock_unlock(&_lock);
+        PreRollBufferFree(&ring);
+        return NO;
+    }
+    PreRollBuffer previous = _ring;
+    BOOL hadRing = _hasRing;
+    _ring = ring;
+    _hasRing = YES;
+    _storage = storage;
+    _pushMs = 0.0;
+    _timedPushes = 0;
+    os_unfair_lock_unlock(&_lock);
+
+    if (hadRing) {
+        PreRollBufferFree(&previous);
+    }
+    NSLog(@"🎬 Pre-roll ring: %.1f s at %dx%d (%@), %.1f MB",
+          duration, (int)size.width, (int)size.height, storage == PreRollStorageNV12 ? @"NV12" : @"raw",
+          (double)PreRollBufferGetStats(&ring).memoryBytes / (1024.0 * 1024.0));
+    return YES;
+}
+
+- (void)disablePreRoll {
+    os_unfair_lock_lock(&_lock);
+    if (_frozen || _writer || !_hasRing) {
+        os_unfair_lock_unlock(&_lock);
+        return;
+    }
+    PreRollBuffer ring = _ring;
+    _hasRing = NO;
+    memset(&_ring, 0, sizeof(_ring));
+    os_unfair_lock_unlock(&_lock);
+    PreRollBufferFree(&ring);
+}
+
+- (void)pushToRing:(const uint8_t *)pixels
+       bytesPerRow:(size_t)bytesPerRow
+             width:(int)width
+            height:(int)height
+             order:(ColorConvertChannelOrder)order
+         timestamp:(double)timestamp {
+    os_unfair_lock_lock(&_lock);
+    if (_hasRing && !_frozen && !_writer) {
+        double start = PreRollRecorderNowMs();
+        PreRollBufferPush(&_ring, pixels, bytesPerRow, width, height, order, timestamp);
+        _pushMs += PreRollRecorderNowMs() - start;
+        _timedPushes++;
+    }
+    os_unfair_lock_unlock(&_lock);
+}
+
+// Encodes the frozen ring into its own file at the recording size.
+- (void)flushRingToURL:(NSURL *)url frameCount:(int)frameCount {
+    NV12VideoWriter *writer = [[NV12VideoWriter alloc] initWithVideoSize:self.videoSize];
+    writer.backpressurePolicy = NV12VideoWriterBackpressureBlock;
+    [writer startRecordingToURL:url completion:nil];
+
+    int width = (int)self.videoSize.width;
+    int height = (int)self.videoSize.height;
+    size_t stride = (size_t)width * 4;
+    NSMutableData *scratch = writer.isRecording ? [NSMutableData dataWithLength:stride * (size_t)height] : nil;
+    for (int i = 0; scratch && i < frameCount; i++) {
+        // Frozen, so the ring can be read without the lock.
+        PreRollFrame frame;
+        if (!PreRollBufferGetFrame(&_ring, i, &frame)) {
+            break;
+        }
+        PreRollFrameReadRGBA(&frame, scratch.mutableBytes, stride, width, height);
+        [writer appendRGBAData:scratch.bytes width:width height:height timestamp:frame.timestamp];
+    }
+
+    dispatch_group_enter(_flushGroup);
+    [writer stopRecordingWithCompletion:^(NSURL *outputURL, NSError *error) {
+        os_unfair_lock_lock(&self->_lock);
+        self->_preRollURL = outputURL;
+        self->_preRollError = outputURL ? nil : error;
+        PreRollBufferReset(&self->_ring);
+        self->_frozen = NO;
+        os_unfair_lock_unlock(&self->_lock);
+        dispatch_group_leave(self->_flushGroup);
+    }];
+}
+
+#pragma mark - Recording
+
++ (NSURL *)siblingOfURL:(NSURL *)url suffix:(NSString *)suffix {
+    NSString *name = [url.URLByDeletingPathExtension.lastPathComponent stringByAppendingString:suffix];
+    return [[url URLByDeletingLastPathComponent] URLByAppendingPathComponent:[name stringByAppendingPathExtension:@"mov"]];
+}
+
+- (void)startRecordingToURL:(NSURL *)outputURL completion:(void (^)(BOOL, NSError * _Nullable))completion {
+    os_unfair_lock_lock(&_lock);
+    if (_writer || _frozen) {
+        os_unfair_lock_unlock(&_lock);
+        NSError *error = [NSError errorWithDomain:kPreRollRecorderErrorDomain
+                                             code:1
+                                         userInfo:@{NSLocalizedDescriptionKey: @"Already recording"}];
+        if (completion) dispatch_async(dispatch_get_main_queue(), ^{ completion(NO, error); });
+        return;
+    }
+    int frameCount = _hasRing ? PreRollBufferCount(&_ring) : 0;
+    NV12VideoWriter *writer = [[NV12VideoWriter alloc] initWithVideoSize:self.videoSize];
+    writer.backpressurePolicy = self.backpressurePolicy;
+    _writer = writer;
+    _outputURL = outputURL;
+    _preRollURL = nil;
+    _preRollError = nil;
+    _frozen = frameCount > 0;
+    os_unfair_lock_unlock(&_lock);
+
+    // With pre-roll the live part is written next to the final file and
+    // joined on stop.
+    NSURL *liveURL = frameCount > 0 ? [PreRollRecorder siblingOfURL:outputURL suffix:@"-live"] : outputURL;
+    [writer startRecordingToURL:liveURL completion:^(BOOL success, NSError *error) {
+        if (!success) {
+            os_unfair_lock_lock(&self->_lock);
+            if (self->_writer == writer) self->_writer = nil;
+            os_unfair_lock_unlock(&self->_lock);
+        }
+        if (completion) completion(success, error);
+    }];
+    if (!writer.isRecording) {
+        os_unfair_lock_lock(&_lock);
+        _frozen = NO;
+        os_unfair_lock_unlock(&_lock);
+        return;
+    }
+
+    if (frameCount > 0) {
+        NSURL *preRollURL = [PreRollRecorder siblingOfURL:outputURL suffix:@"-preroll"];
+        dispatch_group_enter(_flushGroup);
+        dispatch_async(_flushQueue, ^{
+            [self flushRingToURL:preRollURL frameCount:frameCount];
+            dispatch_group_leave(self->_flushGroup);
+        });
+    }
+}
+
+- (void)stopRecordingWithCompletion:(void (^)(NSURL * _Nullable, NSError * _Nullable))completion {
+    os_unfair_lock_lock(&_lock);
+    NV12VideoWriter *writer = _writer;
+    NSURL *outputURL = _outputURL;
+    _writer = nil;
+    os_unfair_lock_unlock(&_lock);
+
+    if (!writer) {
+        if (completion) dispatch_async(dispatch_get_main_queue(), ^{ completion(nil, nil); });
+        return;
+    }
+    [writer stopRecordingWithCompletion:^(NSURL *liveURL, NSError *error) {
+        dispatch_group_notify(self->_flushGroup, dispatch_get_main_queue(), ^{
+            os_unfair_lock_lock(&self->_lock);
+            NSURL *preRollURL = self->_preRollURL;
+            NSError *preRollError = self->_preRollError;
+            self->_preRollURL = nil;
+            os_unfair_lock_unlock(&self->_lock);
+
+            if (!liveURL || [liveURL isEqual:outputURL]) {
+                if (completion) completion(liveURL, error);
+                return;
+            }
+            if (!preRollURL) {
+                NSLog(@"⚠️ Pre-roll was not written: %@", preRollError);
+                [self moveURL:liveURL toURL:outputURL completion:completion];
+                return;
+            }
+            [self joinPreRoll:preRollURL live:liveURL toURL:outputURL completion:completion];
+        });
+    }];
+}
+
+- (void)moveURL:(NSURL *)sourceURL toURL:(NSURL *)destinationURL completion:(void (^)(NSURL *, NSError *))completion {
+    NSFileManager *fileManager = [NSFileManager defaultManager];
+    [fileManager removeItemAtURL:destinationURL error:nil];
+    NSError *error = nil;
+    BOOL moved = [fileManager moveItemAtURL:sourceURL toURL:destinationURL error:&error];
+    if (completion) completion(moved ? destinationURL : nil, error);
+}
+
+// Both files come from the same encoder settings, so the tracks are
+// concatenated without re-encoding.
+- (void)joinPreRoll:(NSURL *)preRollURL
+               live:(NSURL *)liveURL
+              toURL:(NSURL *)outputURL
+         completion:(void (^)(NSURL *, NSError *))completion {
+    AVMutableComposition *composition = [AVMutableComposition composition];
+    AVMutableCompositionTrack *track = [composition addMutableTrackWithMediaType:AVMediaTypeVideo
+                                                                preferredTrackID:kCMPersistentTrackID_Invalid];
+    CMTime cursor = kCMTimeZero;
+    NSError *error = nil;
+    for (NSURL *url in @[preRollURL, liveURL]) {
+        AVURLAsset *asset = [AVURLAsset URLAssetWithURL:url options:@{AVURLAssetPreferPreciseDurationAndTimingKey: @YES}];
+        AVAssetTrack *source = [asset tracksWithMediaType:AVMediaTypeVideo].firstObject;
+        if (!source || ![track insertTimeRange:source.timeRange ofTrack:source atTime:cursor error:&error]) {
+            break;
+        }
+        if (CMTIME_COMPARE_INLINE(cursor, ==, kCMTimeZero)) {
+            track.preferredTransform = source.preferredTransform;
+        }
+        cursor = CMTimeAdd(cursor, source.timeRange.duration);
+    }
+    AVAssetExportSession *export = error ? nil : [[AVAssetExportSession alloc] initWithAsset:composition
+                                                                                 presetName:AVAssetExportPresetPassthrough];
+    if (!export) {
+        NSLog(@"⚠️ Could not join pre-roll: %@", error);
+        [[NSFileManager defaultManager] removeItemAtURL:preRollURL error:nil];
+        [self moveURL:liveURL toURL:outputURL completion:completion];
+        return;
+    }
+
+    [[NSFileManager defaultManager] removeItemAtURL:outputURL error:nil];
+    export.outputURL = outputURL;
+    export.outputFileType = AVFileTypeQuickTimeMovie;
+    double start = PreRollRecorderNowMs();
+    [export exportAsynchronouslyWithCompletionHandler:^{
+        dispatch_async(dispatch_get_main_queue(), ^{
+            [[NSFileManager defaultManager] removeItemAtURL:preRollURL error:nil];
+            if (export.status == AVAssetExportSessionStatusCompleted) {
+                NSLog(@"🎬 Pre-roll joined in %.1f ms", PreRollRecorderNowMs() - start);
+                [[NSFileManager defaultManager] removeItemAtURL:liveURL error:nil];
+                if (completion) completion(outputURL, nil);
+            } else {
+                NSLog(@"⚠️ Could not join pre-roll: %@", export.error);
+                [self moveURL:liveURL toURL:outputURL completion:completion];
+            }
+        });
+    }];
+}
+
+#pragma mark - Frames
+
+- (BOOL)appendRGBAData:(const uint8_t *)data width:(int)width height:(int)height timestamp:(double)timestamp {
+    os_unfair_lock_lock(&_lock);
+    NV12VideoWriter *writer = _writer;
+    os_unfair_lock_unlock(&_lock);
+    if (writer) {
+        return [writer appendRGBAData:data width:width height:height timestamp:timestamp];
+    }
+    [self pushToRing:data bytesPerRow:(size_t)width * 4 width:width height:height order:ColorConvertOrderRGBA timestamp:timestamp];
+    return NO;
+}
+
+- (BOOL)appendPixelBuffer:(CVPixelBufferRef)pixelBuffer timestamp:(double)timestamp {
+    os_unfair_lock_lock(&_lock);
+    NV12VideoWriter *writer = _writer;
+    os_unfair_lock_unlock(&_lock);
+    if (writer) {
+        return [writer appendPixelBuffer:pixelBuffer timestamp:timestamp];
+    }
+    if (CVPixelBufferGetPixelFormatType(pixelBuffer) == kCVPixelFormatType_32BGRA) {
+        CVPixelBufferLockBaseAddress(pixelBuffer, kCVPixelBufferLock_ReadOnly);
+        [self pushToRing:CVPixelBufferGetBaseAddress(pixelBuffer)
+             bytesPerRow:CVPixelBufferGetBytesPerRow(pixelBuffer)
+                   width:(int)CVPixelBufferGetWidth(pixelBuffer)
+                  height:(int)CVPixelBufferGetHeight(pixelBuffer)
+                   order:ColorConvertOrderBGRA
+               timestamp:timestamp];
+        CVPixelBufferUnlockBaseAddress(pixelBuffer, kCVPixelBufferLock_ReadOnly);
+    }
+    return NO;
+}
+
+@end
+
+@implementation NosmaiCore (PreRollRecorder)
+
+- (NSDictionary<NSString *, id> *)exportDebugInfoWithPreRollRecorder:(PreRollRecorder *)recorder {
+    NSMutableDictionary<NSString *, id> *info = [[self exportDebugInfo] mutableCopy] ?: [NSMutableDictionary dictionary];
+    if (recorder) {
+        info[@"preRoll"] = recorder.debugInfo;
+    }
+    return info;
+}
+
+@end
@@ -0,0 +1,269 @@
+//
+//  ReferenceEncoder.c
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 18/10/2026.
+//
+
+#include "ReferenceEncoder.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+enum {
+    kHeaderBytes = 16,
+    kMaxLiteral = 128,
+    kMaxRun = 129,
+};
+
+typedef struct {
+    int keyFrameInterval;
+    int framesSinceKey;
+    int hasPrevious;
+    int width;
+    int height;
+    EncodedFrameFormat format;
+    uint8_t *current;
+    uint8_t *previous;
+    uint8_t *residual;
+    size_t frameBytes;
+    uint8_t *packet;
+    size_t packetCapacity;
+} ReferenceEncoder;
+
+size_t ReferenceFrameBytes(int width, int height, EncodedFrameFormat format) {
+    if (format == EncodedFrameFormatRGBA) {
+        return (size_t)width * (size_t)height * 4;
+    }
+    size_t chromaRow = (size_t)((width + 1) / 2) * 2;
+    return (size_t)width * (size_t)height + chromaRow * (size_t)((height + 1) / 2);
+}
+
+static size_t ReferencePackBits(const uint8_t *src, size_t count, uint8_t *dst) {
+    size_t i = 0, out = 0;
+    while (i < count) {
+        size_t run = 1;
+        while (i + run < count && run < kMaxRun && src[i + run] == src[i]) {
+            run++;
+        }
+        if (run >= 3) {
+            dst[out++] = (uint8_t)(run + 126);
+            dst[out++] = src[i];
+            i += run;
+            continue;
+        }
+        // Literals up to the next run of three.
+        size_t start = i, length = 0;
+        while (i < count && length < kMaxLiteral) {
+            if (i + 2 < count && src[i] == src[i + 1] && src[i] == src[i + 2]) {
+                break;
+            }
+            i++;
+            length++;
+        }
+        dst[out++] = (uint8_t)(length - 1);
+        memcpy(dst + out, src + start, length);
+        out += length;
+    }
+    return out;
+}
+
+static int ReferenceUnpackBits(const uint8_t *src, size_t size, uint8_t *dst, size_t count) {
+    size_t in = 0, out = 0;
+    while (out < count) {
+        if (in >= size) {
+            return -1;
+        }
+        uint8_t control = src[in++];
+        if (control < 128) {
+            size_t length = (size_t)control + 1;
+            if (in + length > size || out + length > count) {
+                return -1;
+            }
+            memcpy(dst + out, src + in, length);
+            in += length;
+            out += length;
+        } else {
+            size_t run = (size_t)control - 126;
+            if (in >= size || out + run > count) {
+                return -1;
+            }
+            memset(dst + out, src[in++], run);
+            out += run;
+        }
+    }
+    return in == size ? 0 : -1;
+}
+
+static void ReferenceWrite32(uint8_t *dst, uint32_t value) {
+    dst[0] = (uint8_t)value;
+    dst[1] = (uint8_t)(value >> 8);
+    dst[2] = (uint8_t)(value >> 16);
+    dst[3] = (uint8_t)(value >> 24);
+}
+
+static uint32_t ReferenceRead32(const uint8_t *src) {
+    return (uint32_t)src[0] | (uint32_t)src[1] << 8 | (uint32_t)src[2] << 16 | (uint32_t)src[3] << 24;
+}
+
+static void ReferenceEncoderRelease(ReferenceEncoder *encoder) {
+    free(encoder->current);
+    free(encoder->previous);
+    free(encoder->residual);
+    free(encoder->packet);
+    encoder->current = encoder->previous = encoder->residual = encoder->packet = NULL;
+    encoder->frameBytes = 0;
+    encoder->packetCapacity = 0;
+}
+
+// Gathers the planes into the packed layout.
+static void ReferenceGather(const EncodedFrame *frame, uint8_t *dst) {
+    size_t rowBytes = (size_t)frame->width * (frame->format == EncodedFrameFormatRGBA ? 4 : 1);
+    for (int y = 0; y < frame->height; y++) {
+        memcpy(dst, frame->planes[0] + (size_t)y * frame->strides[0], rowBytes);
+        dst += rowBytes;
+    }
+    if (frame->format == EncodedFrameFormatNV12) {
+        size_t chromaRow = (size_t)((frame->width + 1) / 2) * 2;
+        for (int y = 0; y < (frame->height + 1) / 2; y++) {
+            memcpy(dst, frame->planes[1] + (size_t)y * frame->strides[1], chromaRow);
+            dst += chromaRow;
+        }
+    }
+}
+
+static int ReferenceEncode(void *context, const EncodedFrame *frame, int forceKeyFrame, EncodedPacketFn emit, void *emitContext) {
+    ReferenceEncoder *encoder = context;
+    if (frame->width <= 0 || frame->height <= 0) {
+        return -1;
+    }
+    size_t frameBytes = ReferenceFrameBytes(frame->width, frame->height, frame->format);
+    if (frame->width != encoder->width || frame->height != encoder->height || frame->format != encoder->format) {
+        ReferenceEncoderRelease(encoder);
+        encoder->current = malloc(frameBytes);
+        encoder->previous = malloc(frameBytes);
+        encoder->residual = malloc(frameBytes);
+        encoder->packetCapacity = kHeaderBytes + frameBytes + frameBytes / kMaxLiteral + 1;
+        encoder->packet = malloc(encoder->packetCapacity);
+        if (!encoder->current || !encoder->previous || !encoder->residual || !encoder->packet) {
+            ReferenceEncoderRelease(encoder);
+            encoder->width = encoder->height = 0;
+            return -1;
+        }
+        encoder->frameBytes = frameBytes;
+        encoder->width = frame->width;
+        encoder->height = frame->height;
+        encoder->format = frame->format;
+        encoder->hasPrevious = 0;
+    }
+
+    int keyFrame = forceKeyFrame || !encoder->hasPrevious ||
+                   (encoder->keyFrameInterval > 0 && encoder->framesSinceKey >= encoder->keyFrameInterval);
+    ReferenceGather(frame, encoder->current);
+    const uint8_t *payload = encoder->current;
+    if (!keyFrame) {
+        for (size_t i = 0; i < frameBytes; i++) {
+            encoder->residual[i] = (uint8_t)(encoder->current[i] - encoder->previous[i]);
+        }
+        payload = encoder->residual;
+    }
+
+    uint8_t *packet = encoder->packet;
+    memcpy(packet, "NREF", 4);
+    packet[4] = (uint8_t)keyFrame;
+    packet[5] = (uint8_t)frame->format;
+    packet[6] = 0;
+    packet[7] = 0;
+    ReferenceWrite32(packet + 8, (uint32_t)frame->width);
+    ReferenceWrite32(packet + 12, (uint32_t)frame->height);
+    size_t size = kHeaderBytes + ReferencePackBits(payload, frameBytes, packet + kHeaderBytes);
+
+    uint8_t *swap = encoder->previous;
+    encoder->previous = encoder->current;
+    encoder->current = swap;
+    encoder->hasPrevious = 1;
+    encoder->framesSinceKey = keyFrame ? 1 : encoder->framesSinceKey + 1;
+
+    EncodedPacket out = {packet, size, frame->timestamp, keyFrame, frame->index, 0.0};
+    emit(emitContext, &out);
+    return 0;
+}
+
+static void ReferenceDestroy(void *context) {
+    ReferenceEncoder *encoder = context;
+    ReferenceEncoderRelease(encoder);
+    free(encoder);
+}
+
+EncodedOutputEncoder ReferenceEncoderCreate(int keyFrameInterval) {
+    EncodedOutputEncoder result;
+    memset(&result, 0, sizeof(result));
+    ReferenceEncoder *encoder = calloc(1, sizeof(ReferenceEncoder));
+    if (!encoder) {
+        return result;
+    }
+    encoder->keyFrameInterval = keyFrameInterval > 0 ? keyFrameInterval : 0;
+    result.context = encoder;
+    result.encode = ReferenceEncode;
+    result.flush = NULL;
+    result.destroy = ReferenceDestroy;
+    return result;
+}
+
+void ReferenceDecoderInit(ReferenceDecoder *decoder) {
+    memset(decoder, 0, sizeof(*decoder));
+}
+
+void ReferenceDecoderFree(ReferenceDecoder *decoder) {
+    free(decoder->frame);
+    free(decoder->residual);
+    memset(decoder, 0, sizeof(*decoder));
+}
+
+int ReferenceDecoderDecode(ReferenceDecoder *decoder, const uint8_t *data, size_t size) {
+    if (size < kHeaderBytes || memcmp(data, "NREF", 4) != 0 || data[5] > EncodedFrameFormatRGBA) {
+        return -1;
+    }
+    int keyFrame = data[4] != 0;
+    EncodedFrameFormat format = (EncodedFrameFormat)data[5];
+    uint32_t width = ReferenceRead32(data + 8);
+    uint32_t height = ReferenceRead32(data + 12);
+    if (width == 0 || height == 0 || width > 16384 || height > 16384) {
+        return -1;
+    }
+    if ((int)width != decoder->width || (int)height != decoder->height || format != decoder->format) {
+        if (!keyFrame) {
+            return -1;
+        }
+        free(decoder->frame);
+        free(decoder->residual);
+        decoder->frameBytes = ReferenceFrameBytes((int)width, (int)height, format);
+        decoder->frame = malloc(decoder->frameBytes);
+        decoder->residual = malloc(decoder->frameBytes);
+        int allocated = decoder->frame && decoder->residual;
+        decoder->width = allocated ? (int)width : 0;
+        decoder->height = allocated ? (int)height : 0;
+        decoder->format = format;
+        decoder->hasKeyFrame = 0;
+        if (!allocated) {
+            return -1;
+        }
+    }
+    if (keyFrame) {
+        decoder->hasKeyFrame = ReferenceUnpackBits(data + kHeaderBytes, size - kHeaderBytes, decoder->frame, decoder->frameBytes) == 0;
+        return decoder->hasKeyFrame ? 0 : -1;
+    }
+    if (!decoder->hasKeyFrame) {
+        return -1;
+    }
+    uint8_t *residual = decoder->residual;
+    int result = ReferenceUnpackBits(data + kHeaderBytes, size - kHeaderBytes, residual, decoder->frameBytes);
+    if (result == 0) {
+        for (size_t i = 0; i < decoder->frameBytes; i++) {
+            decoder->frame[i] = (uint8_t)(decoder->frame[i] + residual[i]);
+        }
+    } else {
+        decoder->hasKeyFrame = 0;
+    }
+    return result;
+}
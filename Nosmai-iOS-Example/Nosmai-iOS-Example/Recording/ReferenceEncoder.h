@@ -0,0 +1,66 @@
+//
+//  ReferenceEncoder.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 18/10/2026.
+//
+
+#ifndef REFERENCE_ENCODER_H
+#define REFERENCE_ENCODER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "EncodedOutput.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Lossless software stand-in for a hardware encoder, so EncodedOutput can
+ * be exercised anywhere (including Linux benchmark hosts).
+ *
+ * Key frames are the frame's bytes run-length coded (PackBits); other
+ * frames code the bytewise difference to the previous frame the same way,
+ * so static content costs almost nothing. Every packet starts with a
+ * 16-byte header: "NREF", key flag, format, two reserved bytes, then width
+ * and height as little-endian 32-bit values.
+ *
+ * @param keyFrameInterval Frames between key frames, 0 for only the first
+ *        and forced ones
+ * @return Encoder whose context is freed by its destroy callback;
+ *         encode is NULL if allocation failed
+ */
+EncodedOutputEncoder ReferenceEncoderCreate(int keyFrameInterval);
+
+typedef struct {
+    uint8_t *frame;
+    uint8_t *residual;
+    size_t frameBytes;
+    int width;
+    int height;
+    EncodedFrameFormat format;
+    int hasKeyFrame;
+} ReferenceDecoder;
+
+void ReferenceDecoderInit(ReferenceDecoder *decoder);
+void ReferenceDecoderFree(ReferenceDecoder *decoder);
+
+/**
+ * Decodes one packet into decoder->frame: tightly packed planes (NV12: Y
+ * then CbCr, both `width` bytes wide rounded up to even for CbCr; RGBA: 4 *
+ * width per row).
+ *
+ * @return 0 on success, -1 for corrupt data or a delta frame without a key frame
+ */
+int ReferenceDecoderDecode(ReferenceDecoder *decoder, const uint8_t *data, size_t size);
+
+/// Bytes of the packed frame layout ReferenceDecoderDecode produces
+size_t ReferenceFrameBytes(int width, int height, EncodedFrameFormat format);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* REFERENCE_ENCODER_H */
@@ -0,0 +1,89 @@
+//
+//  SegmentedRecorder.h
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 18/10/2026.
+//
+
+#import <Foundation/Foundation.h>
+#import "NV12VideoWriter.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * Records into a sequence of movie files. Rolling to the next file never
+ * costs a frame.
+ *
+ * A standby NV12VideoWriter is kept fully set up in the background: the
+ * AVAssetWriter is created, its input is added and startWriting has run.
+ * When a segment reaches segmentDuration or maxSegmentBytes, the next frame
+ * goes straight to the standby writer. The finished writer drains and closes
+ * its file on its own thread. A new standby is then prepared off the
+ * producer thread.
+ *
+ * The same standby makes -startRecording instant. Call -prewarm when the
+ * camera screen appears, and again implicitly after every stop. If no
+ * standby is ready when a segment is due, the current segment keeps
+ * growing until one is; frames are never held back.
+ *
+ * Append methods may be called from one producer thread at a time.
+ */
+@interface SegmentedRecorder : NSObject
+
+@property (nonatomic, readonly) CGSize videoSize;
+@property (nonatomic, readonly) NSURL *outputDirectory;
+@property (nonatomic, readonly) BOOL isRecording;
+
+/// Seconds of media per segment, 0 for no limit. Default 10
+@property (nonatomic, assign) NSTimeInterval segmentDuration;
+
+/// Approximate file size per segment, 0 for no limit. Default 0
+@property (nonatomic, assign) unsigned long long maxSegmentBytes;
+
+/// Writer settings for standby writers prepared from now on
+@property (nonatomic, copy) AVVideoCodecType codec;
+@property (nonatomic, assign) NV12VideoWriterBackpressure backpressurePolicy;
+@property (nonatomic, assign) NSUInteger queueCapacity;
+
+/// Whether a writer is waiting, ready to take the next frame
+@property (nonatomic, readonly) BOOL isStandbyReady;
+
+/**
+ * Counters for the current or last recording:
+ * - segments, rolls, deferredRolls.
+ * - readyLatencyMs: from -startRecording to a writer accepting frames.
+ * - firstFrameLatencyMs: from -startRecording to the first frame queued.
+ * - maxBoundaryGapMs and boundaryGapFrames: the timestamp gap across segment
+ *   boundaries, and frames missing there compared with the frame interval.
+ * - droppedFrames: frames the writers reported dropped.
+ */
+@property (nonatomic, readonly) NSDictionary<NSString *, NSNumber *> *statistics;
+
+- (instancetype)initWithVideoSize:(CGSize)videoSize outputDirectory:(NSURL *)outputDirectory NS_DESIGNATED_INITIALIZER;
+- (instancetype)init NS_UNAVAILABLE;
+
+/// Prepares a standby writer in the background if there is none
+- (void)prewarm;
+
+/**
+ * Starts the first segment. Uses the standby writer when one is ready,
+ * otherwise sets one up on the calling thread.
+ *
+ * @return NO if no writer could be started or the previous recording is
+ *         still closing its files
+ */
+- (BOOL)startRecording;
+
+/// Completion runs on the main queue once every segment file is closed, with the files in recording order
+- (void)stopRecordingWithCompletion:(nullable void (^)(NSArray<NSURL *> *segments, NSError * _Nullable error))completion;
+
+/// Same contract as the NV12VideoWriter methods; NO if the frame was not recorded
+- (BOOL)appendRGBAData:(const uint8_t *)data
+                 width:(int)width
+                height:(int)height
+             timestamp:(double)timestamp;
+- (BOOL)appendPixelBuffer:(CVPixelBufferRef)pixelBuffer timestamp:(double)timestamp;
+
+@end
+
+NS_ASSUME_NONNULL_END
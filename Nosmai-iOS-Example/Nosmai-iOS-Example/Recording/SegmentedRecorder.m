@@ -0,0 +1,349 @@
+//
+//  SegmentedRecorder.m
+//  Nosmai-iOS-Example
+//
+//  Created by Developer vativeApps on 18/10/2026.
+//
+
+#import "SegmentedRecorder.h"
+#import <os/lock.h>
+#include <math.h>
+#include <time.h>
+
+// The file size only changes as the encoder flushes, so it is sampled rather
+// than checked on every frame.
+static const double kSizeCheckInterval = 0.25;
+
+static double SegmentedRecorderNowMs(void) {
+    return (double)clock_gettime_nsec_np(CLOCK_UPTIME_RAW) / 1.0e6;
+}
+
+@implementation SegmentedRecorder {
+    os_unfair_lock _lock;
+    dispatch_queue_t _prewarmQueue;
+    NSString *_filePrefix;
+
+    // Guarded by _lock.
+    NV12VideoWriter *_active;
+    NSURL *_activeURL;
+    NV12VideoWriter *_standby;
+    NSURL *_standbyURL;
+    BOOL _prewarming;
+    BOOL _recording;
+    NSUInteger _nextFileIndex;
+    NSMutableArray<NSURL *> *_segments;
+    NSUInteger _pendingFinishes;
+    NSError *_finishError;
+    void (^_stopCompletion)(NSArray<NSURL *> *, NSError *);
+    double _startCallMs;
+    double _readyLatencyMs;
+    double _firstFrameLatencyMs;
+    uint64_t _rolls;
+    uint64_t _deferredRolls;
+    uint64_t _boundaryGapFrames;
+    uint64_t _droppedFrames;
+    double _maxBoundaryGapMs;
+
+    // Producer thread only.
+    BOOL _hasSegmentFrame;
+    BOOL _rollDeferred;
+    double _segmentStartTimestamp;
+    double _lastTimestamp;
+    double _lastSizeCheckTimestamp;
+    double _frameInterval;
+}
+
+- (instancetype)initWithVideoSize:(CGSize)videoSize outputDirectory:(NSURL *)outputDirectory {
+    self = [super init];
+    if (self) {
+        _lock = OS_UNFAIR_LOCK_INIT;
+        _videoSize = videoSize;
+        _outputDirectory = outputDirectory;
+        _segmentDuration = 10.0;
+        _codec = AVVideoCodecTypeH264;
+        _backpressurePolicy = NV12VideoWriterBackpressureDropNonCritical;
+        _queueCapacity = 8;
+        _filePrefix = [[NSUUID UUID].UUIDString substringToIndex:8];
+        _segments = [NSMutableArray array];
+        _prewarmQueue = dispatch_queue_create("com.nosmai.example.segment-prewarm",
+                                              dispatch_queue_attr_make_with_qos_class(DISPATCH_QUEUE_SERIAL, QOS_CLASS_UTILITY, 0));
+    }
+    return self;
+}
+
+- (void)dealloc {
+    [_standby cancelRecording];
+}
+
+- (BOOL)isRecording {
+    os_unfair_lock_lock(&_lock);
+    BOOL recording = _recording;
+    os_unfair_lock_unlock(&_lock);
+    return recording;
+}
+
+- (BOOL)isStandbyReady {
+    os_unfair_lock_lock(&_lock);
+    BOOL ready = _standby != nil;
+    os_unfair_lock_unlock(&_lock);
+    return ready;
+}
+
+- (NSDictionary<NSString *, NSNumber *> *)statistics {
+    os_unfair_lock_lock(&_lock);
+    NSDictionary *stats = @{
+        @"segments": @(_segments.count),
+        @"rolls": @(_rolls),
+        @"deferredRolls": @(_deferredRolls),
+        @"readyLatencyMs": @(_readyLatencyMs),
+        @"firstFrameLatencyMs": @(_firstFrameLatencyMs),
+        @"maxBoundaryGapMs": @(_maxBoundaryGapMs),
+        @"boundaryGapFrames": @(_boundaryGapFrames),
+        @"droppedFrames": @(_droppedFrames),
+    };
+    os_unfair_lock_unlock(&_lock);
+    return stats;
+}
+
+#pragma mark - Writers
+
+- (NSURL *)nextSegmentURL {
+    os_unfair_lock_lock(&_lock);
+    NSUInteger index = _nextFileIndex++;
+    os_unfair_lock_unlock(&_lock);
+    NSString *name = [NSString stringWithFormat:@"%@-%04lu.mov", _filePrefix, (unsigned long)index];
+    return [self.outputDirectory URLByAppendingPathComponent:name];
+}
+
+// Everything up to startWriting, which is the slow part of starting a file.
+- (nullable NV12VideoWriter *)startedWriterForURL:(NSURL *)url {
+    NV12VideoWriter *writer = [[NV12VideoWriter alloc] initWithVideoSize:self.videoSize];
+    writer.codec = self.codec;
+    writer.backpressurePolicy = self.backpressurePolicy;
+    writer.queueCapacity = self.queueCapacity;
+    [writer startRecordingToURL:url completion:nil];
+    return writer.isRecording ? writer : nil;
+}
+
+- (void)prewarm {
+    os_unfair_lock_lock(&_lock);
+    BOOL needed = _standby == nil && !_prewarming;
+    if (needed) {
+        _prewarming = YES;
+    }
+    os_unfair_lock_unlock(&_lock);
+    if (!needed) return;
+
+    dispatch_async(_prewarmQueue, ^{
+        NSURL *url = [self nextSegmentURL];
+        double start = SegmentedRecorderNowMs();
+        NV12VideoWriter *writer = [self startedWriterForURL:url];
+        os_unfair_lock_lock(&self->_lock);
+        self->_prewarming = NO;
+        self->_standby = writer;
+        self->_standbyURL = writer ? url : nil;
+        os_unfair_lock_unlock(&self->_lock);
+        if (writer) {
+            NSLog(@"🎬 Standby segment writer ready in %.1f ms", SegmentedRecorderNowMs() - start);
+        } else {
+            NSLog(@"⚠️ Standby segment writer could not be started");
+        }
+    });
+}
+
+// Closes a writer that has left the active slot.
+- (void)finishWriter:(NV12VideoWriter *)writer {
+    [writer stopRecordingWithCompletion:^(NSURL *outputURL, NSError *error) {
+        NSDictionary *stats = writer.statistics;
+        os_unfair_lock_lock(&self->_lock);
+        self->_droppedFrames += stats[@"droppedFrames"].unsignedLongLongValue;
+        if (!outputURL && error && !self->_finishError) {
+            self->_finishError = error;
+        }
+        self->_pendingFinishes--;
+        void (^completion)(NSArray<NSURL *> *, NSError *) = nil;
+        NSArray<NSURL *> *segments = nil;
+        NSError *finishError = nil;
+        if (self->_pendingFinishes == 0 && !self->_recording && self->_stopCompletion) {
+            completion = self->_stopCompletion;
+            self->_stopCompletion = nil;
+            NSFileManager *fileManager = [NSFileManager defaultManager];
+            NSIndexSet *written = [self->_segments indexesOfObjectsPassingTest:^BOOL(NSURL *url, NSUInteger idx, BOOL *stop) {
+                return [fileManager fileExistsAtPath:url.path];
+            }];
+            segments = [self->_segments objectsAtIndexes:written];
+            finishError = self->_finishError;
+        }
+        os_unfair_lock_unlock(&self->_lock);
+        if (completion) completion(segments, finishError);
+    }];
+}
+
+#pragma mark - Recording
+
+- (BOOL)startRecording {
+    double startMs = SegmentedRecorderNowMs();
+    os_unfair_lock_lock(&_lock);
+    if (_recording || _pendingFinishes > 0) {
+        os_unfair_lock_unlock(&_lock);
+        return NO;
+    }
+    NV12VideoWriter *writer = _standby;
+    NSURL *url = _standbyURL;
+    _standby = nil;
+    _standbyURL = nil;
+    os_unfair_lock_unlock(&_lock);
+
+    if (!writer) {
+        NSLog(@"⚠️ No standby segment writer, starting one on the calling thread");
+        url = [self nextSegmentURL];
+        writer = [self startedWriterForURL:url];
+        if (!writer) return NO;
+    }
+
+    os_unfair_lock_lock(&_lock);
+    _active = writer;
+    _activeURL = url;
+    [_segments removeAllObjects];
+    [_segments addObject:url];
+    _finishError = nil;
+    _stopCompletion = nil;
+    _rolls = _deferredRolls = _boundaryGapFrames = _droppedFrames = 0;
+    _maxBoundaryGapMs = 0.0;
+    _startCallMs = startMs;
+    _readyLatencyMs = SegmentedRecorderNowMs() - startMs;
+    _firstFrameLatencyMs = -1.0;
+    _hasSegmentFrame = NO;
+    _rollDeferred = NO;
+    _frameInterval = 0.0;
+    _recording = YES;
+    os_unfair_lock_unlock(&_lock);
+
+    // The next segment's writer is set up while this one records.
+    [self prewarm];
+    return YES;
+}
+
+- (void)stopRecordingWithCompletion:(void (^)(NSArray<NSURL *> * _Nonnull, NSError * _Nullable))completion {
+    os_unfair_lock_lock(&_lock);
+    if (!_recording) {
+        os_unfair_lock_unlock(&_lock);
+        if (completion) dispatch_async(dispatch_get_main_queue(), ^{ completion(@[], nil); });
+        return;
+    }
+    NV12VideoWriter *writer = _active;
+    _active = nil;
+    _activeURL = nil;
+    _recording = NO;
+    _pendingFinishes++;
+    _stopCompletion = [completion copy];
+    os_unfair_lock_unlock(&_lock);
+
+    [self finishWriter:writer];
+    // Keeps the next start instant.
+    [self prewarm];
+}
+
+#pragma mark - Producer
+
+- (BOOL)segmentIsFullAtTimestamp:(double)timestamp writerURL:(NSURL *)url {
+    if (self.segmentDuration > 0.0 && timestamp - _segmentStartTimestamp >= self.segmentDuration) {
+        return YES;
+    }
+    if (self.maxSegmentBytes > 0 && timestamp - _lastSizeCheckTimestamp >= kSizeCheckInterval) {
+        _lastSizeCheckTimestamp = timestamp;
+        NSDictionary *attributes = [[NSFileManager defaultManager] attributesOfItemAtPath:url.path error:nil];
+        return attributes.fileSize >= self.maxSegmentBytes;
+    }
+    return NO;
+}
+
+// Picks the writer for this frame, rolling to the standby writer when the
+// current segment is full. Producer thread only.
+- (nullable NV12VideoWriter *)writerForTimestamp:(double)timestamp {
+    os_unfair_lock_lock(&_lock);
+    NV12VideoWriter *writer = _active;
+    NSURL *url = _activeURL;
+    os_unfair_lock_unlock(&_lock);
+    if (!writer) return nil;
+
+    if (!_hasSegmentFrame) {
+        return writer;
+    }
+    double interval = timestamp - _lastTimestamp;
+    if (interval > 0.0 && (_frameInterval <= 0.0 || interval < _frameInterval)) {
+        _frameInterval = interval;
+    }
+    if (!_rollDeferred && ![self segmentIsFullAtTimestamp:timestamp writerURL:url]) {
+        return writer;
+    }
+
+    NV12VideoWriter *finished = nil;
+    os_unfair_lock_lock(&_lock);
+    if (_active != writer) {
+        // Stopped while this frame was on its way.
+        os_unfair_lock_unlock(&_lock);
+        return nil;
+    }
+    if (_standby) {
+        finished = _active;
+        _active = _standby;
+        _activeURL = _standbyURL;
+        _standby = nil;
+        _standbyURL = nil;
+        [_segments addObject:_activeURL];
+        _pendingFinishes++;
+        _rolls++;
+        double gapMs = (timestamp - _lastTimestamp) * 1000.0;
+        _maxBoundaryGapMs = MAX(_maxBoundaryGapMs, gapMs);
+        if (_frameInterval > 0.0) {
+            long missing = lround((timestamp - _lastTimestamp) / _frameInterval) - 1;
+            _boundaryGapFrames += missing > 0 ? (uint64_t)missing : 0;
+        }
+        writer = _active;
+    } else if (!_rollDeferred) {
+        _deferredRolls++;
+    }
+    os_unfair_lock_unlock(&_lock);
+
+    _rollDeferred = finished == nil;
+    if (finished) {
+        _hasSegmentFrame = NO;
+        [self finishWriter:finished];
+    }
+    [self prewarm];
+    return writer;
+}
+
+- (void)didAppend:(BOOL)queued timestamp:(double)timestamp {
+    if (!_hasSegmentFrame) {
+        _hasSegmentFrame = YES;
+        _segmentStartTimestamp = timestamp;
+        _lastSizeCheckTimestamp = timestamp;
+    }
+    _lastTimestamp = timestamp;
+    if (!queued) return;
+    os_unfair_lock_lock(&_lock);
+    if (_firstFrameLatencyMs < 0.0) {
+        _firstFrameLatencyMs = SegmentedRecorderNowMs() - _startCallMs;
+    }
+    os_unfair_lock_unlock(&_lock);
+}
+
+- (BOOL)appendRGBAData:(const uint8_t *)data width:(int)width height:(int)height timestamp:(double)timestamp {
+    NV12VideoWriter *writer = [self writerForTimestamp:timestamp];
+    if (!writer) return NO;
+    BOOL queued = [writer appendRGBAData:data width:width height:height timestamp:timestamp];
+    [self didAppend:queued timestamp:timestamp];
+    return queued;
+}
+
+- (BOOL)appendPixelBuffer:(CVPixelBufferRef)pixelBuffer timestamp:(double)timestamp {
+    NV12VideoWriter *writer = [self writerForTimestamp:timestamp];
+    if (!writer) return NO;
+    BOOL queued = [writer appendPixelBuffer:pixelBuffer timestamp:timestamp];
+    [self didAppend:queued timestamp:timestamp];
+    return queued;
+}
+
+@end
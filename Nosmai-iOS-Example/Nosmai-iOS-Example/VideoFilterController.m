@@ -7,9 +7,26 @@
 #import <SystemConfiguration/SystemConfiguration.h>
 #import <sys/socket.h>
 #import <netinet/in.h>
+#import "AdaptiveQualityGovernor.h"
+#import "FilterCatalog.h"
+#import "InputSourceArbiter.h"
+#import "LicenseVerdictCache.h"
+#import "NV12VideoWriter.h"
+#import "ProcessingScheduler.h"
+#import "StartupTrace.h"
+#import "VideoFileSource.h"
+#if DEBUG
+#import "BenchmarkRunner.h"
+#endif
 
 // Constants
 static NSString * const kNosmaiAPIKey = @"API-KEY";
+// Adaptive quality governor, on unless launched with -NosmaiAdaptiveQuality NO.
+static NSString * const kAdaptiveQualityDefaultsKey = @"NosmaiAdaptiveQuality";
+// A y4m file to run through the filters ahead of the camera, e.g. -NosmaiInputFile /path/clip.y4m.
+static NSString * const kInputFileDefaultsKey = @"NosmaiInputFile";
+// Records video only through NV12VideoWriter instead of the SDK recorder: -NosmaiNV12Recording YES.
+static NSString * const kNV12RecordingDefaultsKey = @"NosmaiNV12Recording";
 
 
 static const float kDefaultButtonSize = 50.0f;
@@ -579,6 +596,10 @@ typedef NS_ENUM(NSInteger, BeautyFilterType) {
 // State
 @property(atomic, assign) BOOL isRecording;
 @property(atomic, assign) BOOL isSDKReady;
+@property(atomic, assign) BOOL isCameraAuthorized;
+@property (assign, nonatomic) BOOL didBeginFirstFrameStep;
+@property (assign, nonatomic) SCNetworkReachabilityRef onlineReachability; // Set while waiting to retry SDK start-up
+@property (strong, nonatomic) UIView *offlineNoticeView; // Shown while SDK start-up waits for the network
 @property (assign, nonatomic) BOOL areFiltersLoading;
 @property (assign, nonatomic) BOOL isLoadingCloudFilters;
 @property(assign, nonatomic) BOOL isGridVisible;
@@ -624,6 +645,13 @@ typedef NS_ENUM(NSInteger, BeautyFilterType) {
 
 
 @property (strong, nonatomic) NSString *currentActiveFilterPath;
+@property (strong, nonatomic) AdaptiveQualityGovernor *qualityGovernor;
+@property (strong, nonatomic) InputSourceArbiter *sourceArbiter;
+@property (strong, nonatomic) VideoFileSource *inputFileSource; // Until the file has played once
+@property (strong, nonatomic) NV12VideoWriter *nv12Writer; // While recording with kNV12RecordingDefaultsKey
+@property (strong, nonatomic) LicenseVerdictCache *licenseVerdictCache;
+@property (strong, nonatomic) FilterCatalog *filterCatalog;
+@property (assign, nonatomic) BOOL didReceiveCloudFilters;
 
 // Method declarations
 - (void)closeController;
@@ -638,6 +666,7 @@ typedef NS_ENUM(NSInteger, BeautyFilterType) {
 #pragma mark - Life Cycle
 - (void)viewDidLoad {
     [super viewDidLoad];
+    [[StartupTrace shared] markEvent:@"viewDidLoad"];
     self.view.backgroundColor = UIColor.blackColor;
     self.areFiltersLoading = YES;
     self.isLoadingCloudFilters = YES; // Initially loading cloud filters
@@ -652,6 +681,9 @@ typedef NS_ENUM(NSInteger, BeautyFilterType) {
     self.currentAppliedEffectInfo = nil; // Initialize effect tracking
     [self setupBeautyFiltersData];
     [self setupUI];
+    [self applyCachedLicenseVerdict];
+    // SDK start-up (license, models, filters) and the permission prompts do not depend on each other.
+    [self setupNosmaiCore];
     [self requestCameraAndMicPermissions];
     self.hapticGenerator = [[UIImpactFeedbackGenerator alloc] initWithStyle:UIImpactFeedbackStyleMedium];
     
@@ -660,6 +692,11 @@ typedef NS_ENUM(NSInteger, BeautyFilterType) {
                                                  name:@"NosmaiSDKDidClearBuiltInFilters"
                                                object:nil];
 
+#if DEBUG
+    if ([BenchmarkRunner isRequestedByLaunchArguments]) {
+        [BenchmarkRunner runAllInBackground];
+    }
+#endif
 }
 
 
@@ -683,6 +720,8 @@ typedef NS_ENUM(NSInteger, BeautyFilterType) {
         self.previewContainerView.alpha = 0.0;
     }];
     
+    // Through the arbiter, so it no longer counts the camera as active
+    [self releaseInputSources];
     [[NosmaiCore shared] cleanup];
 }
 
@@ -819,13 +858,17 @@ typedef NS_ENUM(NSInteger, BeautyFilterType) {
 - (void)dealloc {
     
     // Stop any ongoing operations
-    if (self.isRecording) {
+    if (self.nv12Writer) {
+        [[NosmaiSDK sharedInstance] setRecordingEnabled:NO];
+        [self.nv12Writer cancelRecording];
+    } else if (self.isRecording) {
         [[NosmaiCore shared] stopRecordingWithCompletion:nil];
     }
     
     // Invalidate timer
     [self.recordingTimer invalidate];
     self.recordingTimer = nil;
+    [self stopWaitingForNetwork];
     
     // Clear all filter data
     [self cleanupFilterData];
@@ -837,7 +880,9 @@ typedef NS_ENUM(NSInteger, BeautyFilterType) {
     [[NosmaiSDK sharedInstance] stopProcessing];
     
     // Stop camera if running
-    if ([NosmaiCore shared].camera.isCapturing) {
+    if (self.sourceArbiter) {
+        [self releaseInputSources];
+    } else if ([NosmaiCore shared].camera.isCapturing) {
         [[NosmaiCore shared].camera stopCapture];
     }
     
@@ -850,15 +895,21 @@ typedef NS_ENUM(NSInteger, BeautyFilterType) {
 #pragma mark - Permissions
 
 - (void)requestCameraAndMicPermissions {
+    [[StartupTrace shared] beginStep:@"permissions.camera"];
     [AVCaptureDevice requestAccessForMediaType:AVMediaTypeVideo completionHandler:^(BOOL granted) {
         dispatch_async(dispatch_get_main_queue(), ^{
+            [[StartupTrace shared] endStep:@"permissions.camera"];
             if (granted) {
+                self.isCameraAuthorized = YES;
+                if (self.viewIfLoaded.window) [self startCameraCapture];
+                // Only recording needs the microphone; the camera does not wait for this prompt.
+                [[StartupTrace shared] beginStep:@"permissions.microphone"];
                 [AVCaptureDevice requestAccessForMediaType:AVMediaTypeAudio completionHandler:^(BOOL audioGranted) {
                     dispatch_async(dispatch_get_main_queue(), ^{
+                        [[StartupTrace shared] endStep:@"permissions.microphone"];
                         if (!audioGranted) {
                             [self showPermissionAlert:@"Microphone" isRequired:NO];
                         }
-                        [self setupNosmaiCore];
                     });
                 }];
             } else {
@@ -1355,7 +1406,7 @@ typedef NS_ENUM(NSInteger, BeautyFilterType) {
         // Load effect preview image
         NSString *previewPath = effectInfo[@"previewPath"];
         if (previewPath && previewPath.length > 0) {
-            dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_HIGH, 0), ^{
+            [ProcessingScheduler runInBackground:^{
                 @autoreleasepool {
                     UIImage *previewImage = [[NosmaiSDK sharedInstance] loadPreviewImageForFilter:previewPath];
                     
@@ -1377,7 +1428,7 @@ typedef NS_ENUM(NSInteger, BeautyFilterType) {
                         }
                     });
                 }
-            });
+            }];
         } else {
             // No preview path available, use sparkles icon
             UIImageSymbolConfiguration *config = [UIImageSymbolConfiguration configurationWithPointSize:22 weight:UIImageSymbolWeightMedium];
@@ -1821,11 +1872,18 @@ typedef NS_ENUM(NSInteger, BeautyFilterType) {
 
 - (void)setupNosmaiCore {
     [NosmaiCore shared].delegate = self;
+    [[StartupTrace shared] beginStep:@"sdk.initialize"];
     [[NosmaiCore shared] initializeWithAPIKey:kNosmaiAPIKey completion:^(BOOL success, NSError *error) {
         dispatch_async(dispatch_get_main_queue(), ^{
+            [[StartupTrace shared] endStep:@"sdk.initialize"];
             if (success) {
                 [self configureSDKComponents];
                 [self loadFiltersInBackground];
+            } else if (![self isNetworkAvailable] && self.licenseVerdictCache.licenseValid && [self retryNosmaiCoreWhenOnline]) {
+                // Offline with a recent valid verdict: no licence error, but camera and preview need an
+                // initialized SDK, so say why the preview is empty until the network is back.
+                NSLog(@"📱 SDK initialization failed offline, license verdict from %@, waiting for network", self.licenseVerdictCache.verifiedAt);
+                [self showOfflineNotice];
             } else {
                 [self showSDKError:error];
             }
@@ -1833,9 +1891,107 @@ typedef NS_ENUM(NSInteger, BeautyFilterType) {
     }];
 }
 
+- (void)stopWaitingForNetwork {
+    if (!self.onlineReachability) return;
+    SCNetworkReachabilitySetDispatchQueue(self.onlineReachability, NULL);
+    SCNetworkReachabilitySetCallback(self.onlineReachability, NULL, NULL);
+    CFRelease(self.onlineReachability);
+    self.onlineReachability = NULL;
+}
+
+- (void)networkReachabilityChanged:(SCNetworkReachabilityFlags)flags {
+    if (!(flags & kSCNetworkReachabilityFlagsReachable) || (flags & kSCNetworkReachabilityFlagsConnectionRequired)) return;
+    [self stopWaitingForNetwork];
+    [self hideOfflineNotice];
+    if (!self.isSDKReady) [self setupNosmaiCore];
+}
+
+// Main queue; the controller stops the callbacks before it goes away, so info is not retained.
+static void VideoFilterControllerReachabilityChanged(SCNetworkReachabilityRef target, SCNetworkReachabilityFlags flags, void *info) {
+    [(__bridge VideoFilterController *)info networkReachabilityChanged:flags];
+}
+
+/// NO when reachability cannot be watched, so the caller reports the failure instead of waiting forever
+- (BOOL)retryNosmaiCoreWhenOnline {
+    if (self.onlineReachability) return YES;
+    struct sockaddr_in zeroAddress;
+    bzero(&zeroAddress, sizeof(zeroAddress));
+    zeroAddress.sin_len = sizeof(zeroAddress);
+    zeroAddress.sin_family = AF_INET;
+    SCNetworkReachabilityRef reachability = SCNetworkReachabilityCreateWithAddress(kCFAllocatorDefault, (const struct sockaddr*)&zeroAddress);
+    if (!reachability) return NO;
+    
+    SCNetworkReachabilityContext context = {0, (__bridge void *)self, NULL, NULL, NULL};
+    if (!SCNetworkReachabilitySetCallback(reachability, VideoFilterControllerReachabilityChanged, &context) ||
+        !SCNetworkReachabilitySetDispatchQueue(reachability, dispatch_get_main_queue())) {
+        NSLog(@"❌ Network reachability unavailable, SDK start-up will not be retried");
+        CFRelease(reachability);
+        return NO;
+    }
+    self.onlineReachability = reachability;
+    return YES;
+}
+
+- (void)showOfflineNotice {
+    if (self.offlineNoticeView) return;
+    UIView *noticeView = [[UIView alloc] init];
+    noticeView.backgroundColor = [UIColor colorWithWhite:0.0 alpha:0.85];
+    noticeView.layer.cornerRadius = 20;
+    noticeView.translatesAutoresizingMaskIntoConstraints = NO;
+    
+    UIImageView *iconView = [[UIImageView alloc] initWithImage:[UIImage systemImageNamed:@"wifi.slash"]];
+    iconView.tintColor = [UIColor systemOrangeColor];
+    iconView.translatesAutoresizingMaskIntoConstraints = NO;
+    [noticeView addSubview:iconView];
+    
+    UILabel *label = [[UILabel alloc] init];
+    label.text = @"Offline. The camera starts when you're back online.";
+    label.textColor = [UIColor whiteColor];
+    label.font = [UIFont systemFontOfSize:14 weight:UIFontWeightMedium];
+    label.numberOfLines = 2;
+    label.translatesAutoresizingMaskIntoConstraints = NO;
+    [noticeView addSubview:label];
+    
+    [self.view addSubview:noticeView];
+    [NSLayoutConstraint activateConstraints:@[
+        [noticeView.centerXAnchor constraintEqualToAnchor:self.view.centerXAnchor],
+        [noticeView.centerYAnchor constraintEqualToAnchor:self.view.centerYAnchor],
+        [noticeView.widthAnchor constraintLessThanOrEqualToAnchor:self.view.widthAnchor constant:-2 * kDefaultMargin],
+        [noticeView.heightAnchor constraintGreaterThanOrEqualToConstant:40],
+        
+        [iconView.leadingAnchor constraintEqualToAnchor:noticeView.leadingAnchor constant:15],
+        [iconView.centerYAnchor constraintEqualToAnchor:noticeView.centerYAnchor],
+        [iconView.widthAnchor constraintEqualToConstant:20],
+        [iconView.heightAnchor constraintEqualToConstant:20],
+        
+        [label.leadingAnchor constraintEqualToAnchor:iconView.trailingAnchor constant:10],
+        [label.trailingAnchor constraintEqualToAnchor:noticeView.trailingAnchor constant:-15],
+        [label.topAnchor constraintEqualToAnchor:noticeView.topAnchor constant:10],
+        [label.bottomAnchor constraintEqualToAnchor:noticeView.bottomAnchor constant:-10],
+    ]];
+    self.offlineNoticeView = noticeView;
+}
+
+- (void)hideOfflineNotice {
+    [self.offlineNoticeView removeFromSuperview];
+    self.offlineNoticeView = nil;
+}
+
+- (void)applyCachedLicenseVerdict {
+    self.licenseVerdictCache = [[LicenseVerdictCache alloc] init];
+    if (!self.licenseVerdictCache.hasFreshVerdict) return;
+    [[StartupTrace shared] markEvent:@"license.cachedVerdict"];
+    // Only the look: the button reaches NosmaiCore, so updateBeautyButtonState enables it once the SDK is ready.
+    BOOL beautyEnabled = self.licenseVerdictCache.licenseValid && self.licenseVerdictCache.beautyEnabled;
+    self.beautyButton.enabled = NO;
+    self.beautyButton.alpha = beautyEnabled ? 1.0 : 0.4;
+}
+
 - (void)configureSDKComponents {
     if (self.isSDKReady) return;
     self.isSDKReady = YES;
+    [self hideOfflineNotice];
+    [[StartupTrace shared] beginStep:@"sdk.configure"];
     NosmaiCameraConfig *config = [[NosmaiCameraConfig alloc] init];
     config.position = NosmaiCameraPositionFront;
     config.sessionPreset = AVCaptureSessionPresetHigh;
@@ -1847,27 +2003,111 @@ typedef NS_ENUM(NSInteger, BeautyFilterType) {
     
     // Set delegate to receive filter updates
     [[NosmaiSDK sharedInstance] setDelegate:self];
+    [self setupQualityGovernor];
+    [self setupSourceArbiter];
     
-    // Update beauty button state immediately
+    // Later license changes, and the verdict to remember, arrive through nosmaiDidChangeState:.
     [self updateBeautyButtonState];
-    
-    // Check again after a short delay to catch async license verification
-    dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(0.5 * NSEC_PER_SEC)), dispatch_get_main_queue(), ^{
-        [self updateBeautyButtonState];
-    });
-    
-    // Check once more after a longer delay to ensure we catch any delayed license verification
-    dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(1.5 * NSEC_PER_SEC)), dispatch_get_main_queue(), ^{
-        [self updateBeautyButtonState];
-    });
+    [[StartupTrace shared] endStep:@"sdk.configure"];
 
     if (self.viewIfLoaded.window) [self startCameraCapture];
 }
 
+- (void)setupQualityGovernor {
+    NSNumber *adaptiveQuality = [[NSUserDefaults standardUserDefaults] objectForKey:kAdaptiveQualityDefaultsKey];
+    if (adaptiveQuality && !adaptiveQuality.boolValue) return;
+    // The SDK has no face-detection cadence to set, so the governor does not step through it.
+    self.qualityGovernor = [[AdaptiveQualityGovernor alloc] initWithTargetFrameRate:30.0
+                                                                              knobs:@[@"renderScale", @"smoothingQuality", @"optionalEffects"]];
+    self.qualityGovernor.enabled = YES;
+    __weak typeof(self) weakSelf = self;
+    self.qualityGovernor.changeHandler = ^(AdaptiveQualityGovernor *governor, NSDictionary<NSString *, id> *event) {
+        if ([event[@"knob"] isEqualToString:@"renderScale"]) {
+            // The capture preset is the render resolution the SDK works at.
+            AVCaptureSessionPreset preset = AVCaptureSessionPresetHigh;
+            if (governor.renderScale < 0.8) {
+                preset = AVCaptureSessionPreset960x540;
+            } else if (governor.renderScale < 1.0) {
+                preset = AVCaptureSessionPreset1280x720;
+            }
+            [[NosmaiCore shared].camera setVideoQualityPreset:preset];
+        } else {
+            [weakSelf reapplyActiveBeautyFaceFilters:nil];
+        }
+    };
+}
+
+/// The level the SDK gets for a slider: skin smoothing scaled by the governor's smoothing quality, sharpening off without optional effects
+- (float)governedLevelForBeautyFilter:(BeautyFilterModel *)filter {
+    if (!self.qualityGovernor) return filter.currentValue;
+    if ([filter.identifier isEqualToString:@"skin_smoothing"]) {
+        return filter.currentValue * (float)self.qualityGovernor.smoothingQuality / 2.0f;
+    }
+    if ([filter.identifier isEqualToString:@"sharpening"] && !self.qualityGovernor.optionalEffectsEnabled) {
+        return filter.defaultValue;
+    }
+    return filter.currentValue;
+}
+
+- (void)setupSourceArbiter {
+    self.sourceArbiter = [[InputSourceArbiter alloc] initWithStrategy:NosmaiConflictStrategyPriorityBased];
+    self.sourceArbiter.delegate = self;
+    [self.sourceArbiter registerSource:NosmaiInputSourceTypeCamera
+                              priority:0
+                              activate:^{ [[NosmaiCore shared].camera startCapture]; }
+                            deactivate:^{ [[NosmaiCore shared].camera stopCapture]; }];
+    [self setupInputFileSource];
+}
+
+/// The file preempts the camera once, then hands the pipeline back to it
+- (void)setupInputFileSource {
+    NSString *path = [[NSUserDefaults standardUserDefaults] stringForKey:kInputFileDefaultsKey];
+    if (path.length == 0) return;
+    NSError *error = nil;
+    VideoFileSource *fileSource = [[VideoFileSource alloc] initWithY4MURL:[NSURL fileURLWithPath:path] error:&error];
+    if (!fileSource) {
+        NSLog(@"❌ Input file %@ not opened: %@", path, error.localizedDescription);
+        return;
+    }
+    InputSourceArbiter *arbiter = self.sourceArbiter;
+    fileSource.frameHandler = ^BOOL(CVPixelBufferRef pixelBuffer, CMTime timestamp) {
+        [arbiter processFrame:pixelBuffer fromSource:NosmaiInputSourceTypeVideoFile mirror:NO];
+        return YES;
+    };
+    __weak typeof(self) weakSelf = self;
+    [arbiter registerSource:NosmaiInputSourceTypeVideoFile
+                   priority:1
+                   activate:^{
+        [fileSource startWithCompletion:^(NSDictionary<NSString *, NSNumber *> *statistics, NSError *readError) {
+            NSLog(@"⏱️ Input file: %@ frames at %.1f fps%@", statistics[@"frames"], statistics[@"framesPerSecond"].doubleValue,
+                  readError ? [NSString stringWithFormat:@", stopped: %@", readError.localizedDescription] : @"");
+            dispatch_async(dispatch_get_main_queue(), ^{
+                weakSelf.inputFileSource = nil;
+                [arbiter releaseSource:NosmaiInputSourceTypeVideoFile];
+            });
+        }];
+    }
+                 deactivate:^{ [fileSource stop]; }];
+    self.inputFileSource = fileSource;
+}
+
+/// Camera first, so releasing the file does not hand the pipeline to a camera that is about to stop
+- (void)releaseInputSources {
+    [self.sourceArbiter releaseSource:NosmaiInputSourceTypeCamera];
+    [self.sourceArbiter releaseSource:NosmaiInputSourceTypeVideoFile];
+}
+
 - (void)startCameraCapture {
-    if (!self.isSDKReady) return;
+    if (!self.isSDKReady || !self.isCameraAuthorized) return;
     
-    [[NosmaiCore shared].camera startCapture];
+    // Once per launch: reappearing or retrying must not restart the step.
+    if (!self.didBeginFirstFrameStep && ![StartupTrace shared].isFinished) {
+        self.didBeginFirstFrameStep = YES;
+        [[StartupTrace shared] beginStep:@"camera.firstFrame"];
+    }
+    // With an input file still to play, the camera waits behind it.
+    if (self.inputFileSource) [self.sourceArbiter requestSource:NosmaiInputSourceTypeVideoFile];
+    [self.sourceArbiter requestSource:NosmaiInputSourceTypeCamera];
     
     [[NosmaiSDK sharedInstance] startProcessing];
     
@@ -1921,12 +2161,27 @@ typedef NS_ENUM(NSInteger, BeautyFilterType) {
 #pragma mark - Filter Management
 
 - (void)loadFiltersInBackground {
-    // Get initial filters synchronously for immediate UI display
-    NSDictionary<NSString*, NSArray<NSDictionary*>*> *organizedFilters = [[NosmaiSDK sharedInstance] getInitialFilters];
+    // List from the catalog index when there is one: a single small read instead of
+    // getInitialFilters opening every package on the main thread
+    if (!self.filterCatalog) {
+        self.filterCatalog = [[FilterCatalog alloc] init];
+    }
+    [[StartupTrace shared] beginStep:@"filters.initial"];
+    NSDictionary<NSString*, NSArray<NSDictionary*>*> *organizedFilters = [self.filterCatalog cachedFilters];
+    BOOL listedFromIndex = organizedFilters != nil;
+    if (!listedFromIndex) {
+        organizedFilters = [[NosmaiSDK sharedInstance] getInitialFilters];
+        [self.filterCatalog recordFilters:organizedFilters];
+    }
+    [[StartupTrace shared] endStep:@"filters.initial"];
     
     // Process the organized filters
     [self processOrganizedFilters:organizedFilters];
     
+    if (listedFromIndex) {
+        [self revalidateFilterCatalog];
+    }
+    
     // Update UI immediately with local filters
     [self transitionFromPlaceholdersToFilters];
     
@@ -1940,6 +2195,26 @@ typedef NS_ENUM(NSInteger, BeautyFilterType) {
     }
 }
 
+- (void)revalidateFilterCatalog {
+    __weak typeof(self) weakSelf = self;
+    // Only when a package changed since the index was written is the catalog listed from the SDK
+    // again; that happens on the catalog's queue, never on the main thread.
+    [self.filterCatalog revalidateWithLister:^NSDictionary<NSString*, NSArray<NSDictionary*>*> *{
+        return [[NosmaiSDK sharedInstance] getInitialFilters];
+    } completion:^(NSDictionary<NSString*, NSArray<NSDictionary*>*> *refreshedFilters) {
+        typeof(self) strongSelf = weakSelf;
+        if (!strongSelf) return;
+        NSDictionary<NSString *, NSNumber *> *stats = strongSelf.filterCatalog.statistics;
+        NSLog(@"⏱️ Filter catalog: %@ filters listed in %.2f ms, revalidated in %.2f ms (%@ touched, %@ changed, %@ missing, %@ new)",
+              stats[@"entries"], [stats[@"loadMs"] doubleValue], [stats[@"revalidateMs"] doubleValue],
+              stats[@"touched"], stats[@"changed"], stats[@"missing"], stats[@"added"]);
+        // A cloud update already replaced the listing with a merged one, and recorded it after this one
+        if (!refreshedFilters || strongSelf.didReceiveCloudFilters) return;
+        [strongSelf processOrganizedFilters:refreshedFilters];
+        [strongSelf reloadBottomSheetFilters];
+    }];
+}
+
 - (void)retryFilterLoadingIfNeeded {
     // Only retry if SDK is ready but filters haven't loaded
     if (self.isSDKReady && (!self.onlyFiltersArray || self.onlyFiltersArray.count == 0 || !self.onlyEffectsArray || self.onlyEffectsArray.count == 0)) {
@@ -2195,6 +2470,7 @@ typedef NS_ENUM(NSInteger, BeautyFilterType) {
 #pragma mark - Beauty Filters Methods
 
 - (void)updateBeautyButtonState {
+    if (!self.isSDKReady) return;
     BOOL beautyEnabled = [[NosmaiCore shared].effects isBeautyEffectEnabled];
     self.beautyButton.enabled = beautyEnabled;
     self.beautyButton.alpha = beautyEnabled ? 1.0 : 0.4;
@@ -2752,7 +3028,7 @@ typedef NS_ENUM(NSInteger, BeautyFilterType) {
                         NSInvocation *invocation = [NSInvocation invocationWithMethodSignature:signature];
                         [invocation setTarget:effects];
                         [invocation setSelector:selector];
-                        float value = filter.currentValue;
+                        float value = [self governedLevelForBeautyFilter:filter];
                         [invocation setArgument:&value atIndex:2];
                         [invocation invoke];
                         
@@ -2816,7 +3092,7 @@ typedef NS_ENUM(NSInteger, BeautyFilterType) {
                     NSInvocation *invocation = [NSInvocation invocationWithMethodSignature:signature];
                     [invocation setTarget:effects];
                     [invocation setSelector:selector];
-                    float value = filter.currentValue;
+                    float value = [self governedLevelForBeautyFilter:filter];
                     [invocation setArgument:&value atIndex:2];
                     [invocation invoke];
                 }
@@ -3503,8 +3779,8 @@ typedef NS_ENUM(NSInteger, BeautyFilterType) {
             if (filterInfo[@"previewPath"]) {
                 NSString *previewPath = filterInfo[@"previewPath"];
                 
-                // Load image asynchronously
-                dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_HIGH, 0), ^{
+                // Decode on a background worker so it never delays frame processing
+                [ProcessingScheduler runInBackground:^{
                     @autoreleasepool {
                         UIImage *previewImage = [[NosmaiSDK sharedInstance] loadPreviewImageForFilter:previewPath];
                         
@@ -3521,12 +3797,13 @@ typedef NS_ENUM(NSInteger, BeautyFilterType) {
                             }
                         });
                     }
-                });
+                }];
             } else if (filterInfo[@"thumbnailUrl"] && [filterInfo[@"type"] isEqualToString:@"cloud"]) {
             // For cloud filters without local preview, load from thumbnail URL
             NSString *thumbnailUrl = filterInfo[@"thumbnailUrl"];
             
-            dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_HIGH, 0), ^{
+            // Network fetch: stays on a dispatch queue, off the processing workers
+            dispatch_async(dispatch_get_global_queue(QOS_CLASS_UTILITY, 0), ^{
                 @autoreleasepool {
                     NSData *imageData = [NSData dataWithContentsOfURL:[NSURL URLWithString:thumbnailUrl]];
                     UIImage *previewImage = imageData ? [UIImage imageWithData:imageData] : nil;
@@ -4052,7 +4329,9 @@ typedef NS_ENUM(NSInteger, BeautyFilterType) {
 }
 
 - (void)performCloseController {
-    if ([NosmaiCore shared].camera.isCapturing) {
+    if (self.sourceArbiter) {
+        [self releaseInputSources];
+    } else if ([NosmaiCore shared].camera.isCapturing) {
         [[NosmaiCore shared].camera stopCapture];
     }
     [[NosmaiCore shared] cleanup];
@@ -4098,15 +4377,19 @@ typedef NS_ENUM(NSInteger, BeautyFilterType) {
     self.isRecording = YES;
     self.recordingStartTime = [NSDate timeIntervalSinceReferenceDate];
     
-    // Start the SDK recording
-    [[NosmaiCore shared] startRecordingWithCompletion:^(BOOL success, NSError *error) {
-        if (!success) {
-            dispatch_async(dispatch_get_main_queue(), ^{
-                NSLog(@"Failed to start recording: %@", error);
-                [self stopRecording]; // Revert UI if recording fails
-            });
-        }
-    }];
+    if ([[NSUserDefaults standardUserDefaults] boolForKey:kNV12RecordingDefaultsKey]) {
+        [self startNV12Recording];
+    } else {
+        // Start the SDK recording
+        [[NosmaiCore shared] startRecordingWithCompletion:^(BOOL success, NSError *error) {
+            if (!success) {
+                dispatch_async(dispatch_get_main_queue(), ^{
+                    NSLog(@"Failed to start recording: %@", error);
+                    [self stopRecording]; // Revert UI if recording fails
+                });
+            }
+        }];
+    }
     
     // Animate to recording state
     [UIView animateWithDuration:0.3 delay:0 usingSpringWithDamping:0.8 initialSpringVelocity:0.5 options:UIViewAnimationOptionCurveEaseOut animations:^{
@@ -4145,8 +4428,7 @@ typedef NS_ENUM(NSInteger, BeautyFilterType) {
     [self.recordingTimer invalidate];
     self.recordingTimer = nil;
     
-    // Stop the SDK recording
-    [[NosmaiCore shared] stopRecordingWithCompletion:^(NSURL *videoURL, NSError *error) {
+    void (^finished)(NSURL *, NSError *) = ^(NSURL *videoURL, NSError *error) {
         dispatch_async(dispatch_get_main_queue(), ^{
             // Hide the full-screen loader
             [self hideFullScreenLoader];
@@ -4159,7 +4441,13 @@ typedef NS_ENUM(NSInteger, BeautyFilterType) {
                 [self showRecordingError:error];
             }
         });
-    }];
+    };
+    if (self.nv12Writer) {
+        [self stopNV12RecordingWithCompletion:finished];
+    } else {
+        // Stop the SDK recording
+        [[NosmaiCore shared] stopRecordingWithCompletion:finished];
+    }
     
     // Remove pulsing animation
     [self stopPulsingAnimation];
@@ -4188,6 +4476,38 @@ typedef NS_ENUM(NSInteger, BeautyFilterType) {
 
 
 
+/// The SDK's RGBA recording frames go through one fused conversion into the encoder's NV12 buffers; no audio track
+- (void)startNV12Recording {
+    // Portrait 720p; frames of another size are resampled on the way in.
+    NV12VideoWriter *writer = [[NV12VideoWriter alloc] initWithVideoSize:CGSizeMake(720, 1280)];
+    NSString *name = [NSString stringWithFormat:@"nv12-%@.mov", [NSUUID UUID].UUIDString];
+    NSURL *outputURL = [NSURL fileURLWithPath:[NSTemporaryDirectory() stringByAppendingPathComponent:name]];
+    self.nv12Writer = writer;
+    [writer startRecordingToURL:outputURL completion:^(BOOL success, NSError *error) {
+        if (!success) {
+            NSLog(@"Failed to start recording: %@", error);
+            [self stopRecording]; // Revert UI if recording fails
+            return;
+        }
+        if (self.nv12Writer != writer) return;
+        [[NosmaiSDK sharedInstance] setRecordingCallback:^(const uint8_t *data, int width, int height, double timestamp) {
+            [writer appendRGBAData:data width:width height:height timestamp:timestamp];
+        }];
+        [[NosmaiSDK sharedInstance] setRecordingEnabled:YES];
+    }];
+}
+
+- (void)stopNV12RecordingWithCompletion:(void (^)(NSURL *videoURL, NSError *error))completion {
+    NV12VideoWriter *writer = self.nv12Writer;
+    self.nv12Writer = nil;
+    [[NosmaiSDK sharedInstance] setRecordingEnabled:NO];
+    [[NosmaiSDK sharedInstance] setRecordingCallback:^(const uint8_t *data, int width, int height, double timestamp) {}];
+    [writer stopRecordingWithCompletion:^(NSURL *outputURL, NSError *error) {
+        NSLog(@"⏱️ NV12 recording: %@", writer.statistics);
+        completion(outputURL, error);
+    }];
+}
+
 - (void)startPulsingAnimation {
     CABasicAnimation *scaleAnimation = [CABasicAnimation animationWithKeyPath:@"transform.scale"];
     scaleAnimation.fromValue = @1.0;
@@ -4572,7 +4892,29 @@ typedef NS_ENUM(NSInteger, BeautyFilterType) {
     });
 }
 
-- (void)nosmaiDidChangeState:(NosmaiState)newState {}
+- (void)nosmaiDidChangeState:(NosmaiState)newState {
+    if (newState != NosmaiStateReady) return;
+    dispatch_async(dispatch_get_main_queue(), ^{
+        [[StartupTrace shared] markEvent:@"sdk.ready"];
+        [self updateBeautyButtonState];
+        // Ready is the end of verification, so this is the only verdict worth remembering.
+        [self.licenseVerdictCache recordLicenseValid:[[NosmaiCore shared] isLicenseValid]
+                                       beautyEnabled:[[NosmaiCore shared].effects isBeautyEffectEnabled]];
+    });
+}
+- (void)nosmaiDidProcessFrame:(BOOL)success processingTime:(double)processingTime error:(NSError *)error {
+    if (success) [self.qualityGovernor recordProcessingTime:processingTime];
+    if (success && ![StartupTrace shared].isFinished) {
+        [[StartupTrace shared] endStep:@"camera.firstFrame"];
+        [[StartupTrace shared] markFirstFilteredFrame];
+    }
+    // The SDK has already processed this camera frame; it can only complete a switch, not be dropped.
+    if (success) [self.sourceArbiter frameDidArriveFromSource:NosmaiInputSourceTypeCamera];
+}
+- (void)nosmaiInputSourceDidChange:(NosmaiInputSourceType)oldSource newSource:(NosmaiInputSourceType)newSource {
+    NSLog(@"⏱️ Input source changed %ld -> %ld, switch took %.1f ms",
+          (long)oldSource, (long)newSource, self.sourceArbiter.lastSwitchLatencyMs);
+}
 - (void)nosmaiCameraDidChangeState:(NosmaiCameraState)newState {}
 - (void)nosmaiCameraDidFailWithError:(NSError *)error {}
 - (void)nosmaiCameraDidCaptureFrame {}
@@ -4582,8 +4924,10 @@ typedef NS_ENUM(NSInteger, BeautyFilterType) {
 - (void)nosmaiDidUpdateFilters:(NSDictionary<NSString*, NSArray<NSDictionary*>*>*)organizedFilters {
 
     
-    // Process the updated filters
+    // Process the updated filters, and index them for the next launch
+    self.didReceiveCloudFilters = YES;
     [self processOrganizedFilters:organizedFilters];
+    [self.filterCatalog recordFilters:organizedFilters];
     
     // Hide cloud filters loading indicator as filters have been loaded
     self.isLoadingCloudFilters = NO;
@@ -4591,6 +4935,10 @@ typedef NS_ENUM(NSInteger, BeautyFilterType) {
         self.cloudFiltersLoadingView.hidden = YES;
     }
     
+    [self reloadBottomSheetFilters];
+}
+
+- (void)reloadBottomSheetFilters {
     // If bottom sheet is open, update it too
     if (self.bottomSheetView.superview) {
         if ([self.currentBottomSheetType isEqualToString:@"Filters"]) {